@@ -39,6 +39,12 @@
 #include "cmsis_compiler.h"
 
 
+/* Fill value for the unused part of the main stack. Overriding it through
+   DEFINES also changes the value the stack_usage module looks for. */
+#if !defined(CY_STACK_PAINT_PATTERN)
+#define CY_STACK_PAINT_PATTERN          (0xCDCDCDCDUL)
+#endif
+
 CY_MISRA_FP_BLOCK_START('MISRA C-2012 Rule 8.6', 3, \
 'Checked manually. The definition is a part of linker script or application.')
 CY_MISRA_DEVIATE_BLOCK_START('ARRAY_VS_SINGLETON', 1, \
@@ -508,6 +514,14 @@ __WEAK void Reset_Handler(void)
 
     __set_MSPLIM((uint32_t)(&__STACK_LIMIT));
 
+    /* Paint the stack below the current frame so its high-water mark can be
+       read back at run time. Interrupts are disabled, nothing else uses it. */
+    for (volatile uint32_t *addr = (volatile uint32_t *)(&__STACK_LIMIT);
+         addr < (volatile uint32_t *)__get_MSP(); addr++)
+    {
+        *addr = CY_STACK_PAINT_PATTERN;
+    }
+
 #if defined(__ICCARM__)
     /* Initialize data section */
     __iar_data_init3();
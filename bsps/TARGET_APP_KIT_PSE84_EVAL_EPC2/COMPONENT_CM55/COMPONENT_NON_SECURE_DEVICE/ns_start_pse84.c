@@ -38,6 +38,12 @@
 
 #define SCB_NS_CPACR_CP10_CP11_ENABLE      (0xFUL << 20u)
 
+/* Fill value for the unused part of the main stack. Overriding it through
+   DEFINES also changes the value the stack_usage module looks for. */
+#if !defined(CY_STACK_PAINT_PATTERN)
+#define CY_STACK_PAINT_PATTERN          (0xCDCDCDCDUL)
+#endif
+
 CY_MISRA_FP_BLOCK_START('MISRA C-2012 Rule 8.6', 3, \
 'Checked manually. The definition is a part of linker script or application.')
 CY_MISRA_DEVIATE_BLOCK_START('ARRAY_VS_SINGLETON', 1, \
@@ -506,6 +512,14 @@ __WEAK void Reset_Handler(void)
 
     __set_MSPLIM((uint32_t)(&__STACK_LIMIT));
 
+    /* Paint the stack below the current frame so its high-water mark can be
+       read back at run time. Interrupts are disabled, nothing else uses it. */
+    for (volatile uint32_t *addr = (volatile uint32_t *)(&__STACK_LIMIT);
+         addr < (volatile uint32_t *)__get_MSP(); addr++)
+    {
+        *addr = CY_STACK_PAINT_PATTERN;
+    }
+
     /* Enable Loop and branch info cache */
     SCB->CCR |= SCB_CCR_LOB_Msk;
      __DMB();
@@ -119,11 +119,25 @@ mtb_ipc_mbox_receiver_t cybsp_srf_ipc_receiver;
 #define MTB_IPC_IRQ_SEMA_SRF                        (MTB_IPC_IRQ_SEMA_SRF_RELAY)
 #define MTB_IPC_IRQ_QUEUE_SRF                       (MTB_IPC_IRQ_QUEUE_SRF_RELAY)
 #if (defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE))
+// Stack sizes (in bytes) and priorities of the SRF relay threads. Override through DEFINES to tune
+// the reservation once the stack high-water mark is known.
+#ifndef CYBSP_SRF_RECEIVE_THREAD_STACK_SIZE
+#define CYBSP_SRF_RECEIVE_THREAD_STACK_SIZE         (500u * sizeof(uint64_t))
+#endif
+#ifndef CYBSP_SRF_PROCESS_THREAD_STACK_SIZE
+#define CYBSP_SRF_PROCESS_THREAD_STACK_SIZE         (500u * sizeof(uint64_t))
+#endif
+#ifndef CYBSP_SRF_RECEIVE_THREAD_PRIORITY
+#define CYBSP_SRF_RECEIVE_THREAD_PRIORITY           (CY_RTOS_PRIORITY_NORMAL)
+#endif
+#ifndef CYBSP_SRF_PROCESS_THREAD_PRIORITY
+#define CYBSP_SRF_PROCESS_THREAD_PRIORITY           (CY_RTOS_PRIORITY_NORMAL)
+#endif
 cy_queue_t cybsp_srf_request_queue;
 cy_thread_t cybsp_srf_receive;
 cy_thread_t cybsp_srf_process;
-static uint64_t cybsp_srf_thread_stack_receive[500];
-static uint64_t cybsp_srf_thread_stack_process[500];
+static uint64_t cybsp_srf_thread_stack_receive[CYBSP_SRF_RECEIVE_THREAD_STACK_SIZE / sizeof(uint64_t)];
+static uint64_t cybsp_srf_thread_stack_process[CYBSP_SRF_PROCESS_THREAD_STACK_SIZE / sizeof(uint64_t)];
 #else
 mtb_srf_ipc_packet_t* cybsp_srf_ring_buffer[MTB_SRF_POOL_SIZE];
 #endif
@@ -222,14 +236,14 @@ cy_rslt_t _cybsp_ipc_srf_init()
                     result = cy_rtos_thread_create(&cybsp_srf_receive, &mtb_srf_ipc_receive_thread,
                                         "Receive Thread", &cybsp_srf_thread_stack_receive,
                                         sizeof(cybsp_srf_thread_stack_receive),
-                                        CY_RTOS_PRIORITY_NORMAL, (cy_thread_arg_t)&cybsp_mtb_srf_relay_context);
+                                        CYBSP_SRF_RECEIVE_THREAD_PRIORITY, (cy_thread_arg_t)&cybsp_mtb_srf_relay_context);
 
                     if (CY_RSLT_SUCCESS == result)
                     {
                         result = cy_rtos_thread_create(&cybsp_srf_process, &mtb_srf_ipc_process_thread,
                                                     "Process Thread", &cybsp_srf_thread_stack_process,
                                                     sizeof(cybsp_srf_thread_stack_process),
-                                                    CY_RTOS_PRIORITY_NORMAL, (cy_thread_arg_t)&cybsp_mtb_srf_relay_context);
+                                                    CYBSP_SRF_PROCESS_THREAD_PRIORITY, (cy_thread_arg_t)&cybsp_mtb_srf_relay_context);
                     }
                 }
             }
@@ -0,0 +1,86 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CPU cycle counter
+ * Purpose : Cheap timestamps for statistics and latency measurement, based on
+ *           the DWT cycle counter (Cortex-M33 and Cortex-M55).
+ ********************************************************************************
+ * @file    cycle_counter.h
+ * @brief   DWT CYCCNT helpers
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Start the DWT cycle counter. Safe to call more than once.
+ */
+static inline void cycle_counter_init(void)
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @brief Current cycle count. Wraps every 2^32 cycles; compute differences
+ *        with unsigned 32-bit subtraction.
+ */
+static inline uint32_t cycle_counter_read(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Convert a cycle count to microseconds at the current core clock
+ */
+static inline uint32_t cycle_counter_to_us(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000ULL) / SystemCoreClock);
+}
+
+/**
+ * @brief Convert microseconds to cycles at the current core clock
+ */
+static inline uint32_t cycle_counter_from_us(uint32_t us)
+{
+    return (uint32_t)(((uint64_t)us * SystemCoreClock) / 1000000ULL);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYCLE_COUNTER_H */
+/* [] END OF FILE */
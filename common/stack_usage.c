@@ -0,0 +1,118 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Stack and heap high-water marks
+ * Purpose : Measure painted stacks and query the C library heap.
+ *           Build with STACK_USAGE_HOST defined to get only the region
+ *           functions, e.g. to exercise them on a simulated stack.
+ ********************************************************************************
+ * @file    stack_usage.c
+ * @brief   Painted-stack and heap high-water reporting, shared by both cores
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+
+#include "stack_usage.h"
+
+#if !defined(STACK_USAGE_HOST) && defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#include <malloc.h>
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/* Linker symbols, same names as in ns_start_pse84.c */
+#if !defined(STACK_USAGE_HOST)
+#if defined(__llvm__) && !defined(__ARMCC_VERSION)
+extern uint32_t __stack;
+extern uint32_t __stack_limit;
+extern uint32_t __HeapBase;
+extern uint32_t __HeapLimit;
+#define STACK_USAGE_TOP             (&__stack)
+#define STACK_USAGE_LIMIT           (&__stack_limit)
+#define STACK_USAGE_HEAP_SIZE       ((uint32_t)((uintptr_t)&__HeapLimit - (uintptr_t)&__HeapBase))
+#elif defined(__ARMCC_VERSION)
+extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Limit;
+extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Base;
+#define STACK_USAGE_TOP             (&Image$$ARM_LIB_STACK$$ZI$$Limit)
+#define STACK_USAGE_LIMIT           (&Image$$ARM_LIB_STACK$$ZI$$Base)
+#elif defined(__GNUC__)
+extern uint32_t __StackTop;
+extern uint32_t __StackLimit;
+extern uint32_t __HeapBase;
+extern uint32_t __HeapLimit;
+#define STACK_USAGE_TOP             (&__StackTop)
+#define STACK_USAGE_LIMIT           (&__StackLimit)
+#define STACK_USAGE_HEAP_SIZE       ((uint32_t)((uintptr_t)&__HeapLimit - (uintptr_t)&__HeapBase))
+#elif defined(__ICCARM__)
+extern uint32_t CSTACK$$Limit;
+extern uint32_t CSTACK$$Base;
+#define STACK_USAGE_TOP             (&CSTACK$$Limit)
+#define STACK_USAGE_LIMIT           (&CSTACK$$Base)
+#endif
+#endif /* !defined(STACK_USAGE_HOST) */
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+void stack_usage_paint(uint32_t *limit, uint32_t *top)
+{
+    for (volatile uint32_t *addr = limit; addr < top; addr++)
+    {
+        *addr = CY_STACK_PAINT_PATTERN;
+    }
+}
+
+uint32_t stack_usage_measure(const uint32_t *limit, const uint32_t *top)
+{
+    const uint32_t *addr = limit;
+
+    while ((addr < top) && (*addr == CY_STACK_PAINT_PATTERN))
+    {
+        addr++;
+    }
+    return (uint32_t)((uintptr_t)top - (uintptr_t)addr);
+}
+
+#if !defined(STACK_USAGE_HOST)
+void stack_usage_get(stack_usage_t *usage)
+{
+    usage->stack_size = (uint32_t)((uintptr_t)STACK_USAGE_TOP - (uintptr_t)STACK_USAGE_LIMIT);
+    usage->stack_peak = stack_usage_measure(STACK_USAGE_LIMIT, STACK_USAGE_TOP);
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    /* The newlib-nano and picolibc allocators never return memory to sbrk,
+     * so the arena only grows and its size is the heap high-water mark */
+    struct mallinfo info = mallinfo();
+
+    usage->heap_size = STACK_USAGE_HEAP_SIZE;
+    usage->heap_peak = (uint32_t)info.arena;
+    usage->heap_in_use = (uint32_t)info.uordblks;
+#else
+    usage->heap_size = 0;
+    usage->heap_peak = 0;
+    usage->heap_in_use = 0;
+#endif
+}
+#endif /* !defined(STACK_USAGE_HOST) */
+
+/* [] END OF FILE */
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Stack and heap high-water marks
+ * Purpose : Report how much of the main stack and heap reservation an image
+ *           has used, so the linker reservations can be sized from data.
+ * Design  : Reset_Handler (ns_start_pse84.c) fills the unused stack with
+ *           CY_STACK_PAINT_PATTERN; the deepest overwritten word gives the
+ *           peak. The heap peak is the largest arena the C library grew to.
+ ********************************************************************************
+ * @file    stack_usage.h
+ * @brief   Painted-stack and heap high-water reporting, shared by both cores
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef STACK_USAGE_H
+#define STACK_USAGE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Fill value, must match the one used by ns_start_pse84.c */
+#if !defined(CY_STACK_PAINT_PATTERN)
+#define CY_STACK_PAINT_PATTERN          (0xCDCDCDCDUL)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Memory use of the running image, all values in bytes */
+typedef struct
+{
+    uint32_t stack_size;    /**< Main stack reservation (__StackSize)       */
+    uint32_t stack_peak;    /**< Deepest main stack use since reset         */
+    uint32_t heap_size;     /**< Heap reservation, 0 if not known           */
+    uint32_t heap_peak;     /**< Largest heap arena obtained from sbrk      */
+    uint32_t heap_in_use;   /**< Heap currently allocated                   */
+} stack_usage_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Fill a stack region with CY_STACK_PAINT_PATTERN
+ *
+ * Same fill as Reset_Handler. Use it for stacks that are not painted at
+ * reset, or for a simulated stack in a host build.
+ *
+ * @param[in] limit  Lowest address of the region (stack grows towards it)
+ * @param[in] top    One past the highest address of the region
+ */
+void stack_usage_paint(uint32_t *limit, uint32_t *top);
+
+/**
+ * @brief Bytes of a painted, descending stack that have been written
+ *
+ * Scans upwards from @p limit to the first word that no longer holds the
+ * pattern. A frame that reserves space without writing it is not counted,
+ * so leave some margin when sizing from this value.
+ *
+ * @param[in] limit  Lowest address of the region
+ * @param[in] top    One past the highest address of the region
+ *
+ * @return Peak use in bytes
+ */
+uint32_t stack_usage_measure(const uint32_t *limit, const uint32_t *top);
+
+#if !defined(STACK_USAGE_HOST)
+/** @brief Peak main stack and heap use of this image */
+void stack_usage_get(stack_usage_t *usage);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STACK_USAGE_H */
+/* [] END OF FILE */
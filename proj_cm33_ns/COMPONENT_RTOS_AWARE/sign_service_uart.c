@@ -0,0 +1,170 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : UART transport for the signing service (RTOS_BUILD=1 only)
+ * Purpose : SCB bring-up, receive interrupt, service thread and signing
+ *           offload to the worker pool.
+ ********************************************************************************
+ * @file    sign_service_uart.c
+ * @brief   Interrupt-driven SCB UART transport for sign_service
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "sign_service.h"
+#include "sign_service_uart.h"
+#include "sign_worker.h"
+
+#if defined(SIGN_SERVICE_UART_HW)
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static cy_stc_scb_uart_context_t sign_service_uart_context;
+static cy_semaphore_t            sign_service_uart_sema;
+static cy_mutex_t                sign_service_uart_tx_mutex;
+#if (SIGN_SERVICE_UART_OFFLOAD != 0)
+static sign_job_t                sign_service_uart_jobs[SIGN_SERVICE_RX_FRAMES];  /**< One per slot */
+#endif
+static cy_thread_t               sign_service_uart_thread_handle;
+static uint64_t                  sign_service_uart_stack[SIGN_SERVICE_UART_STACK_SIZE /
+                                                         sizeof(uint64_t)];
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief RX FIFO not empty: move every byte into the frame slots
+ */
+static void sign_service_uart_isr(void)
+{
+    bool complete = false;
+
+    while (Cy_SCB_UART_GetNumInRxFifo(SIGN_SERVICE_UART_HW) > 0U)
+    {
+        complete |= sign_service_rx_byte((uint8_t)Cy_SCB_UART_Get(SIGN_SERVICE_UART_HW));
+    }
+    Cy_SCB_ClearRxInterrupt(SIGN_SERVICE_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+
+    if (complete)
+    {
+        (void)cy_rtos_semaphore_set(&sign_service_uart_sema);
+    }
+}
+
+/** @brief sign_service transmit function; service thread and workers */
+static void sign_service_uart_tx(const uint8_t *data, size_t len)
+{
+    (void)cy_rtos_mutex_get(&sign_service_uart_tx_mutex, CY_RTOS_NEVER_TIMEOUT);
+    Cy_SCB_UART_PutArrayBlocking(SIGN_SERVICE_UART_HW, (void *)data, (uint32_t)len);
+    (void)cy_rtos_mutex_set(&sign_service_uart_tx_mutex);
+}
+
+#if (SIGN_SERVICE_UART_OFFLOAD != 0)
+/** @brief Worker completion: send the response from the worker thread */
+static void sign_service_uart_job_done(sign_job_t *job)
+{
+    sign_service_sign_done((sign_service_sign_t *)job->user_arg, job->status, job->signature_len);
+}
+
+/** @brief Queue a SIGN request to the worker pool, or decline if the queue is full */
+static bool sign_service_uart_offload(sign_service_sign_t *req)
+{
+    sign_job_t *job = &sign_service_uart_jobs[req->slot];
+
+    *job = (sign_job_t)
+    {
+        .key_id         = req->key->key_id,
+        .alg            = req->key->alg,
+        .input          = req->message,
+        .input_len      = req->message_len,
+        .signature      = req->signature,
+        .signature_size = SIGNING_SIGNATURE_MAX_SIZE,
+        .on_done        = sign_service_uart_job_done,
+        .user_arg       = req,
+    };
+    return (sign_worker_submit(job, 0) == CY_RSLT_SUCCESS);
+}
+#endif
+
+/**
+ * @brief Service thread: wait for a complete frame, answer it, repeat
+ *
+ * @param[in] arg  Unused
+ */
+static void sign_service_uart_thread(cy_thread_arg_t arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    for (;;)
+    {
+        if (cy_rtos_semaphore_get(&sign_service_uart_sema, CY_RTOS_NEVER_TIMEOUT) == CY_RSLT_SUCCESS)
+        {
+            (void)sign_service_process();
+        }
+    }
+}
+
+cy_rslt_t sign_service_uart_start(signing_key_t *key)
+{
+    const cy_stc_sysint_t irq_cfg =
+    {
+        .intrSrc      = SIGN_SERVICE_UART_IRQ,
+        .intrPriority = SIGN_SERVICE_UART_IRQ_PRIORITY,
+    };
+    cy_rslt_t result;
+
+    sign_service_init(key, sign_service_uart_tx);
+#if (SIGN_SERVICE_UART_OFFLOAD != 0)
+    sign_service_set_offload(sign_service_uart_offload);
+#endif
+
+    result = cy_rtos_semaphore_init(&sign_service_uart_sema, SIGN_SERVICE_RX_FRAMES, 0);
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = cy_rtos_mutex_init(&sign_service_uart_tx_mutex, false);
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = (cy_rslt_t)Cy_SCB_UART_Init(SIGN_SERVICE_UART_HW, &SIGN_SERVICE_UART_CONFIG,
+                                             &sign_service_uart_context);
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = (cy_rslt_t)Cy_SysInt_Init(&irq_cfg, sign_service_uart_isr);
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        Cy_SCB_SetRxInterruptMask(SIGN_SERVICE_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+        NVIC_EnableIRQ(SIGN_SERVICE_UART_IRQ);
+        Cy_SCB_UART_Enable(SIGN_SERVICE_UART_HW);
+
+        result = cy_rtos_thread_create(&sign_service_uart_thread_handle, &sign_service_uart_thread,
+                                       "Sign Service", sign_service_uart_stack,
+                                       sizeof(sign_service_uart_stack),
+                                       SIGN_SERVICE_UART_PRIORITY, NULL);
+    }
+
+    return result;
+}
+
+#endif /* defined(SIGN_SERVICE_UART_HW) */
+
+/* [] END OF FILE */
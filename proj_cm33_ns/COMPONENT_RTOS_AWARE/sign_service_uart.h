@@ -0,0 +1,93 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : UART transport for the signing service (RTOS_BUILD=1 only)
+ * Purpose : Serve sign_service requests on a non-secure SCB UART.
+ * Design  : The RX FIFO interrupt drains the FIFO into the service's frame
+ *           slots and wakes a service thread when a frame is complete. The
+ *           thread handles the frames and sends the responses with blocking
+ *           writes. With SIGN_SERVICE_UART_OFFLOAD, SIGN requests go to the
+ *           signing worker pool (sign_worker_init() must have run), so the
+ *           thread parses the next request while TF-M signs, and workers
+ *           send their responses themselves under a transmit mutex. The
+ *           debug UART belongs to TF-M, so the service needs its
+ *           own SCB, configured in the Device Configurator and named here:
+ *             SIGN_SERVICE_UART_HW      SCB base, e.g. SCB5
+ *             SIGN_SERVICE_UART_IRQ     its interrupt, e.g. scb_5_interrupt_IRQn
+ *             SIGN_SERVICE_UART_CONFIG  its generated cy_stc_scb_uart_config_t
+ *           Without SIGN_SERVICE_UART_HW this module compiles to nothing.
+ ********************************************************************************
+ * @file    sign_service_uart.h
+ * @brief   Interrupt-driven SCB UART transport for sign_service
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SIGN_SERVICE_UART_H
+#define SIGN_SERVICE_UART_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "cyabs_rtos.h"
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Stack size of the service thread in bytes */
+#ifndef SIGN_SERVICE_UART_STACK_SIZE
+#define SIGN_SERVICE_UART_STACK_SIZE  (4096U)
+#endif
+
+/** @brief Service thread priority */
+#ifndef SIGN_SERVICE_UART_PRIORITY
+#define SIGN_SERVICE_UART_PRIORITY    (CY_RTOS_PRIORITY_ABOVENORMAL)
+#endif
+
+/** @brief Hand SIGN requests to the signing worker pool (0: sign on the service thread) */
+#ifndef SIGN_SERVICE_UART_OFFLOAD
+#define SIGN_SERVICE_UART_OFFLOAD     (1)
+#endif
+
+/** @brief UART interrupt priority */
+#ifndef SIGN_SERVICE_UART_IRQ_PRIORITY
+#define SIGN_SERVICE_UART_IRQ_PRIORITY (3U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Bring up the UART and start the service thread
+ *
+ * @param[in] key  Key used for all requests; must stay valid
+ *
+ * @return CY_RSLT_SUCCESS, or the first UART or RTOS error
+ */
+cy_rslt_t sign_service_uart_start(signing_key_t *key);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGN_SERVICE_UART_H */
+/* [] END OF FILE */
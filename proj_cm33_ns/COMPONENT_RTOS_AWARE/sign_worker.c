@@ -0,0 +1,127 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Signing worker pool (RTOS_BUILD=1 only)
+ * Purpose : Run PSA signing jobs on a small pool of threads fed from a job
+ *           queue. The TF-M NS interface serializes secure calls, so extra
+ *           workers overlap queueing/callback work with the secure call,
+ *           not two secure calls with each other.
+ ********************************************************************************
+ * @file    sign_worker.c
+ * @brief   Job-queue based signing worker pool
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "sign_worker.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static cy_queue_t          sign_worker_queue;
+static cy_thread_t         sign_worker_threads[SIGN_WORKER_COUNT];
+static uint64_t            sign_worker_stacks[SIGN_WORKER_COUNT]
+                                             [SIGN_WORKER_STACK_SIZE / sizeof(uint64_t)];
+static sign_worker_stats_t sign_worker_stats[SIGN_WORKER_COUNT];
+
+static const char * const  sign_worker_names[] =
+{
+    "Sign Worker 0", "Sign Worker 1", "Sign Worker 2", "Sign Worker 3"
+};
+
+CY_STATIC_ASSERT(SIGN_WORKER_COUNT <= (sizeof(sign_worker_names) / sizeof(sign_worker_names[0])),
+                 "Add thread names for the extra workers");
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Worker thread: take a job, sign, report, repeat
+ *
+ * @param[in] arg  Pointer to this worker's stats entry
+ */
+static void sign_worker_thread(cy_thread_arg_t arg)
+{
+    sign_worker_stats_t *stats = (sign_worker_stats_t *)arg;
+    sign_job_t *job;
+    uint32_t start;
+
+    for (;;)
+    {
+        if (cy_rtos_queue_get(&sign_worker_queue, &job, CY_RTOS_NEVER_TIMEOUT) != CY_RSLT_SUCCESS)
+        {
+            continue;
+        }
+
+        start = cycle_counter_read();
+        job->status = psa_sign_message(job->key_id, job->alg,
+                                       job->input, job->input_len,
+                                       job->signature, job->signature_size,
+                                       &job->signature_len);
+        stats->busy_cycles += (uint32_t)(cycle_counter_read() - start);
+        stats->jobs++;
+        if (job->status != PSA_SUCCESS)
+        {
+            stats->failures++;
+        }
+
+        if (job->on_done != NULL)
+        {
+            job->on_done(job);
+        }
+    }
+}
+
+cy_rslt_t sign_worker_init(void)
+{
+    cy_rslt_t result;
+
+    memset(sign_worker_stats, 0, sizeof(sign_worker_stats));
+
+    result = cy_rtos_queue_init(&sign_worker_queue, SIGN_WORKER_QUEUE_LEN, sizeof(sign_job_t *));
+
+    for (uint32_t i = 0; (i < SIGN_WORKER_COUNT) && (result == CY_RSLT_SUCCESS); i++)
+    {
+        result = cy_rtos_thread_create(&sign_worker_threads[i], &sign_worker_thread,
+                                       sign_worker_names[i], sign_worker_stacks[i],
+                                       sizeof(sign_worker_stacks[i]), SIGN_WORKER_PRIORITY,
+                                       (cy_thread_arg_t)&sign_worker_stats[i]);
+    }
+
+    return result;
+}
+
+cy_rslt_t sign_worker_submit(sign_job_t *job, cy_time_t timeout_ms)
+{
+    job->status = PSA_OPERATION_INCOMPLETE;
+    job->signature_len = 0;
+    return cy_rtos_queue_put(&sign_worker_queue, &job, timeout_ms);
+}
+
+void sign_worker_get_stats(uint32_t index, sign_worker_stats_t *stats)
+{
+    CY_ASSERT(index < SIGN_WORKER_COUNT);
+    *stats = sign_worker_stats[index];
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Signing worker pool (RTOS_BUILD=1 only)
+ * Purpose : Run PSA signing jobs on a small pool of threads fed from a job
+ *           queue, so producers never wait for the TF-M round-trip.
+ ********************************************************************************
+ * @file    sign_worker.h
+ * @brief   Job-queue based signing worker pool
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SIGN_WORKER_H
+#define SIGN_WORKER_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cyabs_rtos.h"
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Number of worker threads */
+#ifndef SIGN_WORKER_COUNT
+#define SIGN_WORKER_COUNT             (2U)
+#endif
+
+/** @brief Stack size of each worker thread in bytes */
+#ifndef SIGN_WORKER_STACK_SIZE
+#define SIGN_WORKER_STACK_SIZE        (4096U)
+#endif
+
+/** @brief Number of jobs that can wait in the queue */
+#ifndef SIGN_WORKER_QUEUE_LEN
+#define SIGN_WORKER_QUEUE_LEN         (8U)
+#endif
+
+/** @brief Worker thread priority */
+#ifndef SIGN_WORKER_PRIORITY
+#define SIGN_WORKER_PRIORITY          (CY_RTOS_PRIORITY_BELOWNORMAL)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct sign_job sign_job_t;
+
+/** @brief Completion callback, runs on the worker thread that signed the job */
+typedef void (*sign_job_done_t)(sign_job_t *job);
+
+/**
+ * @brief One signing request
+ *
+ * Owned by the caller; must stay valid until @ref on_done has been called.
+ */
+struct sign_job
+{
+    psa_key_id_t     key_id;          /**< Key used for signing            */
+    psa_algorithm_t  alg;             /**< e.g. PSA_ALG_ECDSA(PSA_ALG_SHA_256) */
+    const uint8_t   *input;           /**< Message to sign                 */
+    size_t           input_len;       /**< Message length in bytes         */
+    uint8_t         *signature;       /**< Output buffer                   */
+    size_t           signature_size;  /**< Output buffer size              */
+    size_t           signature_len;   /**< [out] Signature length          */
+    psa_status_t     status;          /**< [out] Result of psa_sign_message */
+    sign_job_done_t  on_done;         /**< Completion callback (optional)  */
+    void            *user_arg;        /**< Free for the caller's use       */
+};
+
+/** @brief Per-worker counters */
+typedef struct
+{
+    uint32_t jobs;          /**< Jobs completed by this worker         */
+    uint32_t failures;      /**< Jobs that did not return PSA_SUCCESS  */
+    uint64_t busy_cycles;   /**< Cycles spent inside psa_sign_message  */
+} sign_worker_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Create the job queue and start the worker threads
+ *
+ * @return CY_RSLT_SUCCESS or the abstraction-rtos error
+ */
+cy_rslt_t sign_worker_init(void);
+
+/**
+ * @brief Queue a signing job
+ *
+ * @param[in] job         Job descriptor
+ * @param[in] timeout_ms  Time to wait for a free queue entry
+ *
+ * @return CY_RSLT_SUCCESS, or the queue error on timeout
+ */
+cy_rslt_t sign_worker_submit(sign_job_t *job, cy_time_t timeout_ms);
+
+/**
+ * @brief Read the counters of one worker
+ *
+ * @param[in]  index  Worker index, below SIGN_WORKER_COUNT
+ * @param[out] stats  Counter snapshot
+ */
+void sign_worker_get_stats(uint32_t index, sign_worker_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGN_WORKER_H */
+/* [] END OF FILE */
@@ -0,0 +1,91 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Per-thread CPU and stack statistics (RTOS_BUILD=1 only)
+ * Purpose : Report CPU share and stack high-water mark of every FreeRTOS task.
+ ********************************************************************************
+ * @file    task_stats.c
+ * @brief   FreeRTOS run-time and stack statistics over the platform log
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "log_token.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_stats.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief Previous run-time counter per task number, for delta reporting */
+static uint32_t task_stats_prev_runtime[TASK_STATS_MAX_TASKS];
+static uint32_t task_stats_prev_total;
+
+static TaskStatus_t task_stats_status[TASK_STATS_MAX_TASKS];
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+void task_stats_timer_init(void)
+{
+    cycle_counter_init();
+}
+
+uint32_t task_stats_timer_read(void)
+{
+    return cycle_counter_read();
+}
+
+void task_stats_report(void)
+{
+    uint32_t total;
+    uint32_t total_delta;
+    UBaseType_t count;
+
+    count = uxTaskGetSystemState(task_stats_status, TASK_STATS_MAX_TASKS, &total);
+    total_delta = total - task_stats_prev_total;
+    task_stats_prev_total = total;
+
+    LOG_PRINT("Task             CPU%%  Stack free\r\n");
+
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        const TaskStatus_t *task = &task_stats_status[i];
+        uint32_t slot = task->xTaskNumber % TASK_STATS_MAX_TASKS;
+        uint32_t delta = task->ulRunTimeCounter - task_stats_prev_runtime[slot];
+        uint32_t permille = 0;
+
+        task_stats_prev_runtime[slot] = task->ulRunTimeCounter;
+        if (total_delta > 0U)
+        {
+            permille = (uint32_t)(((uint64_t)delta * 1000U) / total_delta);
+        }
+
+        LOG_PRINT("%-16s %3lu.%lu %8lu B\r\n",
+                  task->pcTaskName,
+                  (unsigned long)(permille / 10U), (unsigned long)(permille % 10U),
+                  (unsigned long)(task->usStackHighWaterMark * sizeof(StackType_t)));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,70 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Per-thread CPU and stack statistics (RTOS_BUILD=1 only)
+ * Purpose : Report CPU share and stack high-water mark of every FreeRTOS task,
+ *           including the BSP SRF relay threads and the signing workers.
+ ********************************************************************************
+ * @file    task_stats.h
+ * @brief   FreeRTOS run-time and stack statistics over the platform log
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Maximum number of tasks included in one report */
+#ifndef TASK_STATS_MAX_TASKS
+#define TASK_STATS_MAX_TASKS          (12U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Enable the DWT cycle counter (portCONFIGURE_TIMER_FOR_RUN_TIME_STATS) */
+void task_stats_timer_init(void);
+
+/** @brief Current run-time counter value (portGET_RUN_TIME_COUNTER_VALUE) */
+uint32_t task_stats_timer_read(void);
+
+/**
+ * @brief Log one line per task: CPU share since the previous call and
+ *        minimum free stack ever observed
+ *
+ * Call at least once every 2^32 CPU cycles so counter deltas stay valid.
+ */
+void task_stats_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TASK_STATS_H */
+/* [] END OF FILE */
@@ -0,0 +1,145 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : FreeRTOS kernel configuration (proj_cm33_ns, RTOS_BUILD=1)
+ * Purpose : Kernel settings for the RTOS-aware relay build. Only used when the
+ *           Makefile enables the FREERTOS/RTOS_AWARE components.
+ ********************************************************************************
+ * @file    FreeRTOSConfig.h
+ * @brief   FreeRTOS configuration for the CM33 non-secure image
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *
+ * @see     https://www.freertos.org/a00110.html
+ *******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include "cy_utils.h"
+
+extern uint32_t SystemCoreClock;
+
+/* -------------------------------------------------------------------- */
+/* Scheduler                                                            */
+/* -------------------------------------------------------------------- */
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configCPU_CLOCK_HZ                      SystemCoreClock
+#define configTICK_RATE_HZ                      1000u
+#define configMAX_PRIORITIES                    7
+#define configMINIMAL_STACK_SIZE                128
+#define configMAX_TASK_NAME_LEN                 16
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TIME_SLICING                  1
+#define configUSE_TICKLESS_IDLE                 0
+
+/* -------------------------------------------------------------------- */
+/* Synchronization                                                      */
+/* -------------------------------------------------------------------- */
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               10
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_NEWLIB_REENTRANT              1
+#define configENABLE_BACKWARD_COMPATIBILITY     1
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+
+/* -------------------------------------------------------------------- */
+/* Memory allocation                                                    */
+/* -------------------------------------------------------------------- */
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   (24 * 1024)
+#define configAPPLICATION_ALLOCATED_HEAP        0
+
+/* -------------------------------------------------------------------- */
+/* Hooks, statistics and trace                                          */
+/* -------------------------------------------------------------------- */
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configCHECK_FOR_STACK_OVERFLOW          2
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#define configRECORD_STACK_HIGH_ADDRESS         1
+
+/* Per-task CPU accounting uses the DWT cycle counter (see task_stats.c).
+ * The counter wraps every 2^32 cycles, so task_stats_report() works on
+ * deltas between successive calls. task_stats.c is only part of the
+ * RTOS_AWARE component, hence the guard. */
+#if defined(COMPONENT_RTOS_AWARE)
+#define configGENERATE_RUN_TIME_STATS           1
+extern void task_stats_timer_init(void);
+extern uint32_t task_stats_timer_read(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() task_stats_timer_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         task_stats_timer_read()
+#else
+#define configGENERATE_RUN_TIME_STATS           0
+#endif
+
+/* -------------------------------------------------------------------- */
+/* Software timers                                                      */
+/* -------------------------------------------------------------------- */
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            (configMINIMAL_STACK_SIZE * 2)
+
+/* -------------------------------------------------------------------- */
+/* Optional API functions                                               */
+/* -------------------------------------------------------------------- */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xResumeFromISR                  1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xTaskAbortDelay                 1
+#define INCLUDE_xTaskGetHandle                  1
+#define INCLUDE_xTaskResumeFromISR              1
+
+/* -------------------------------------------------------------------- */
+/* Armv8-M port (non-secure side, TF-M owns the secure world)           */
+/* -------------------------------------------------------------------- */
+#define configENABLE_FPU                        1
+#define configENABLE_MPU                        0
+#define configENABLE_TRUSTZONE                  0
+#define configRUN_FREERTOS_SECURE_ONLY          0
+#define configENABLE_MVE                        0
+
+/* Interrupt priorities: the SRF IPC interrupts are registered at priority 7
+ * by cybsp.c, so the kernel must mask at least up to that level. */
+#define configPRIO_BITS                         3
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY 7
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 1
+#define configKERNEL_INTERRUPT_PRIORITY \
+    (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY \
+    (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+#define configASSERT(x)                         CY_ASSERT(x)
+
+#endif /* FREERTOS_CONFIG_H */
+/* [] END OF FILE */
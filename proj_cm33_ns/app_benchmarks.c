@@ -0,0 +1,1720 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Boot benchmarks
+ * Purpose : Time the application modules on the device and log the results
+ *           with LOG_PRINT().
+ * Design  : Each benchmark creates and destroys its own keys and state, so
+ *           they can run in any order and do not depend on the demo key.
+ *           Figures are DWT cycles (cycle_counter.h). The whole file is
+ *           compiled only with APP_BENCHMARKS.
+ ********************************************************************************
+ * @file    app_benchmarks.c
+ * @brief   Boot-time benchmarks of the CM33 NS application modules
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "app_benchmarks.h"
+
+#if (APP_BENCHMARKS)
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "psa/crypto.h"
+
+#include "audit_log.h"
+#include "cbor_write.h"
+#include "cose_sign1.h"
+#include "crypto_dispatch.h"
+#include "csr_write.h"
+#include "cycle_counter.h"
+#include "ecdsa_der.h"
+#include "image_verify.h"
+#include "jws_token.h"
+#include "lms_verify.h"
+#include "log_token.h"
+#include "signing.h"
+#include "sha256_sw.h"
+#include "stack_usage.h"
+#include "trust_store.h"
+#include "verify_cache.h"
+#include "x509_chain.h"
+#include "x509_demo_certs.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Signatures per nonce mode in the latency comparison */
+#ifndef SIGNING_BENCH_RUNS
+#define SIGNING_BENCH_RUNS            (32U)
+#endif
+
+/** @brief Signatures per prefix/tail size pair in the prefix signing benchmark */
+#ifndef SIGNING_PREFIX_RUNS
+#define SIGNING_PREFIX_RUNS           (8U)
+#endif
+
+/** @brief Largest prefix and tail in the prefix signing benchmark */
+#define SIGNING_PREFIX_MAX            (256U)
+#define SIGNING_TAIL_MAX              (256U)
+
+/** @brief Frame layout of the segment list signing benchmark */
+#define IOV_HEADER_SIZE               (32U)
+#define IOV_PAYLOAD_MAX               (1024U)
+#define IOV_TRAILER_SIZE              (16U)
+
+/** @brief Command replay trace: distinct commands, arrivals, TTL in arrivals */
+#define REPLAY_COMMANDS               (8U)
+#define REPLAY_ARRIVALS               (64U)
+#define REPLAY_TTL                    (24U)
+
+/** @brief Largest telemetry payload and message in the COSE_Sign1 benchmark */
+#define COSE_BENCH_PAYLOAD_MAX        (1100U)
+#define COSE_BENCH_MESSAGE_MAX        COSE_SIGN1_SIZE(0U, COSE_BENCH_PAYLOAD_MAX)
+
+/** @brief Largest claims set and token in the JWS minting benchmark */
+#define JWS_BENCH_CLAIMS_MAX          (160U)
+#define JWS_BENCH_TOKEN_MAX           JWS_TOKEN_SIZE(sizeof(JWS_HEADER_ES256_JWT), JWS_BENCH_CLAIMS_MAX)
+
+/** @brief Stored P-256 signatures transcoded and mutated records parsed in the DER benchmark */
+#define DER_BATCH_SIGNATURES          (128U)
+#define DER_MUTATIONS                 (1024U)
+
+/** @brief Audit log benchmark: PS assets, entries per mode, checkpoint interval in commits */
+#define AUDIT_BENCH_UID_BASE          (0x41554400ULL)
+#define AUDIT_BENCH_SINGLE            (8U)
+#define AUDIT_BENCH_ENTRIES           (128U)
+#define AUDIT_BENCH_CHECKPOINT        (4U)
+
+/** @brief Print the benchmark log as AUDIT lines for tools/audit_verify.py */
+#ifndef AUDIT_BENCH_EXPORT
+#define AUDIT_BENCH_EXPORT            (1)
+#endif
+
+/** @brief Trust store benchmark: largest index, lookups per size, stored keys, PS assets */
+#define TRUST_BENCH_INDEX_MAX         (2048U)
+#define TRUST_BENCH_LOOKUPS           (1024U)
+#define TRUST_BENCH_KEYS              (12U)
+#define TRUST_BENCH_UID_BASE          (0x54535400ULL)
+
+/** @brief X.509 chain benchmark: timed rounds per case, cache lifetime in seconds */
+#define X509_BENCH_ROUNDS             (8U)
+#define X509_BENCH_TTL                (3600U)
+
+/** @brief CSR benchmark: timed requests, painted stack window and its distance below SP */
+#define CSR_BENCH_ROUNDS              (8U)
+#define CSR_BENCH_STACK_WINDOW        (1536U)
+#define CSR_BENCH_STACK_MARGIN        (64U)
+
+/** @brief Image size of the RAM-staged MCUboot image in the verification demo */
+#define IMAGE_DEMO_SIZE               (8U * 1024U)
+
+/** @brief Key generations per scheme in the cost table */
+#ifndef SIGNING_COST_KEYGEN_RUNS
+#define SIGNING_COST_KEYGEN_RUNS      (4U)
+#endif
+
+/** @brief Messages per mode in the logging cost benchmark */
+#ifndef LOG_BENCH_RUNS
+#define LOG_BENCH_RUNS                (16U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief Message of the signing latency and cost benchmarks (the demo message) */
+static const unsigned char bench_message[] = "Hello World";
+
+/** @brief Relay hook of app_benchmarks_run_cm55(), or NULL */
+static app_benchmarks_serve_t bench_serve;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Check deterministic ECDSA and compare signing latency per nonce mode
+ *
+ * Runs the RFC 6979 known-answer test, then signs the demo message
+ * SIGNING_BENCH_RUNS times with a fresh key of each mode. Randomized
+ * signing draws a nonce from the secure DRBG every time; deterministic
+ * signing does not, so its spread should be narrower.
+ */
+static void signing_latency_compare(void)
+{
+    static const signing_nonce_t modes[] = { SIGNING_NONCE_RANDOM, SIGNING_NONCE_DETERMINISTIC };
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    psa_status_t status;
+
+    status = signing_self_test();
+    LOG_PRINT("RFC 6979 known-answer test: %s\r\n",
+              (status == PSA_SUCCESS) ? "OK" :
+              ((status == PSA_ERROR_NOT_SUPPORTED) ? "not supported" : "FAIL"));
+
+    LOG_PRINT("ECDSA P-256 sign latency over %lu runs (cycles):\r\n",
+              (unsigned long)SIGNING_BENCH_RUNS);
+    for (uint32_t m = 0; m < (sizeof(modes) / sizeof(modes[0])); m++)
+    {
+        const signing_key_config_t config =
+        {
+            SIGNING_SCHEME_ECDSA_P256, modes[m], PSA_KEY_LIFETIME_VOLATILE
+        };
+        const char *name = (modes[m] == SIGNING_NONCE_DETERMINISTIC) ? "deterministic" : "randomized";
+        signing_key_t key;
+        uint32_t mean;
+        uint32_t stddev;
+
+        status = signing_key_generate(&config, &key);
+        for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < SIGNING_BENCH_RUNS); i++)
+        {
+            status = signing_sign(&key, bench_message, sizeof(bench_message),
+                                  signature, sizeof(signature), &signature_len);
+        }
+        if (status != PSA_SUCCESS)
+        {
+            LOG_PRINT("  %-13s: failed (%ld)\r\n", name, (long)status);
+        }
+        else
+        {
+            signing_latency_summary(&key.sign_latency, &mean, &stddev);
+            LOG_PRINT("  %-13s: mean %lu, stddev %lu\r\n",
+                      name, (unsigned long)mean, (unsigned long)stddev);
+            LOG_PRINT("  %-13s  min %lu, max %lu\r\n",
+                      "", (unsigned long)key.sign_latency.min, (unsigned long)key.sign_latency.max);
+        }
+        signing_key_destroy(&key);
+    }
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Log keygen, sign and verify cost of every signature scheme
+ *
+ * Each figure is the mean over the runs, in cycles and microseconds.
+ * Schemes the TF-M image was not built with are reported as such.
+ */
+static void signing_cost_table(void)
+{
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+
+    LOG_PRINT("Signature cost (mean cycles / us; keygen x%lu, sign and verify x%lu):\r\n",
+              (unsigned long)SIGNING_COST_KEYGEN_RUNS, (unsigned long)SIGNING_BENCH_RUNS);
+    LOG_PRINT("  %-12s %-19s %-19s %s\r\n", "scheme", "keygen", "sign", "verify");
+    for (uint32_t sc = 0; sc < SIGNING_SCHEME_COUNT; sc++)
+    {
+        const signing_key_config_t config =
+        {
+            (signing_scheme_t)sc, SIGNING_NONCE_RANDOM, PSA_KEY_LIFETIME_VOLATILE
+        };
+        signing_key_t key = { .key_id = PSA_KEY_ID_NULL };
+        uint64_t keygen_sum = 0;
+        uint32_t keygen;
+        uint32_t sign;
+        uint32_t verify;
+        uint32_t stddev;
+        psa_status_t status = PSA_SUCCESS;
+
+        if (config.scheme == SIGNING_SCHEME_HSS_SHA256)
+        {
+            /* Verify only; timed by lms_verify_compare() */
+            continue;
+        }
+        for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < SIGNING_COST_KEYGEN_RUNS); i++)
+        {
+            signing_key_destroy(&key);
+            status = signing_key_generate(&config, &key);
+            keygen_sum += key.keygen_cycles;
+        }
+        for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < SIGNING_BENCH_RUNS); i++)
+        {
+            status = signing_sign(&key, bench_message, sizeof(bench_message),
+                                  signature, sizeof(signature), &signature_len);
+            if (status == PSA_SUCCESS)
+            {
+                status = signing_verify(&key, bench_message, sizeof(bench_message),
+                                        signature, signature_len);
+            }
+        }
+
+        if (status == PSA_ERROR_NOT_SUPPORTED)
+        {
+            LOG_PRINT("  %-12s not supported by the secure image\r\n", signing_scheme_name(config.scheme));
+        }
+        else if (status != PSA_SUCCESS)
+        {
+            LOG_PRINT("  %-12s failed (%ld)\r\n", signing_scheme_name(config.scheme), (long)status);
+        }
+        else
+        {
+            keygen = (uint32_t)(keygen_sum / SIGNING_COST_KEYGEN_RUNS);
+            signing_latency_summary(&key.sign_latency, &sign, &stddev);
+            signing_latency_summary(&key.verify_latency, &verify, &stddev);
+            LOG_PRINT("  %-12s %9lu / %7lu ", signing_scheme_name(config.scheme),
+                      (unsigned long)keygen, (unsigned long)cycle_counter_to_us(keygen));
+            LOG_PRINT("%9lu / %7lu %9lu / %7lu\r\n",
+                      (unsigned long)sign, (unsigned long)cycle_counter_to_us(sign),
+                      (unsigned long)verify, (unsigned long)cycle_counter_to_us(verify));
+        }
+        signing_key_destroy(&key);
+    }
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Log bytes and encode cycles per message of both logging modes
+ *
+ * Sends LOG_BENCH_RUNS copies of a typical status line through LOG_PRINT()
+ * and, in a tokenized build, through the text formatter as well, then
+ * reports the counter deltas of each run and the totals since reset.
+ */
+static void log_token_benchmark(void)
+{
+    log_token_stats_t before;
+    log_token_stats_t after;
+
+    cycle_counter_init();
+
+    log_token_get_stats(&before);
+    for (uint32_t i = 0; i < LOG_BENCH_RUNS; i++)
+    {
+        LOG_PRINT("Request %lu: slot %lu, %lu bytes, %s\r\n",
+                  (unsigned long)i, (unsigned long)(i % 8U), (unsigned long)(64U + i), "OK");
+    }
+    log_token_get_stats(&after);
+    LOG_PRINT("Log cost per message (%s, x%lu): %lu bytes, %lu cycles\r\n",
+              (LOG_TOKENIZED) ? "tokenized" : "text", (unsigned long)LOG_BENCH_RUNS,
+              (unsigned long)((after.bytes - before.bytes) / LOG_BENCH_RUNS),
+              (unsigned long)((after.encode_cycles - before.encode_cycles) / LOG_BENCH_RUNS));
+
+#if (LOG_TOKENIZED)
+    log_token_get_stats(&before);
+    for (uint32_t i = 0; i < LOG_BENCH_RUNS; i++)
+    {
+        log_token_printf("Request %lu: slot %lu, %lu bytes, %s\r\n",
+                         (unsigned long)i, (unsigned long)(i % 8U), (unsigned long)(64U + i), "OK");
+    }
+    log_token_get_stats(&after);
+    LOG_PRINT("Log cost per message (%s, x%lu): %lu bytes, %lu cycles\r\n",
+              "text", (unsigned long)LOG_BENCH_RUNS,
+              (unsigned long)((after.bytes - before.bytes) / LOG_BENCH_RUNS),
+              (unsigned long)((after.encode_cycles - before.encode_cycles) / LOG_BENCH_RUNS));
+#endif
+
+    log_token_get_stats(&after);
+    LOG_PRINT("Log totals since reset: %lu messages, %lu bytes\r\n\r\n",
+              (unsigned long)after.messages, (unsigned long)after.bytes);
+}
+
+/**
+ * @brief Compare whole-message signing with prefix midstate signing
+ *
+ * For each prefix and tail size, signs prefix || tail SIGNING_PREFIX_RUNS
+ * times with signing_sign() and with a signing_prefix_t that hashed the
+ * prefix once. The first prefix signature of each pair is verified over
+ * the whole frame.
+ */
+static void signing_prefix_benchmark(void)
+{
+    static const uint16_t prefix_sizes[] = { 64U, 128U, 256U };
+    static const uint16_t tail_sizes[] = { 32U, 256U };
+    static uint8_t frame[SIGNING_PREFIX_MAX + SIGNING_TAIL_MAX];
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    signing_prefix_t prefix;
+    signing_key_t key;
+    uint32_t whole;
+    uint32_t cached;
+    uint32_t stddev;
+    psa_status_t status;
+
+    for (uint32_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = (uint8_t)i;
+    }
+    status = signing_key_generate(&config, &key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Prefix signing: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+
+    LOG_PRINT("Prefix signing, ECDSA P-256 (mean cycles: whole message / cached prefix):\r\n");
+    for (uint32_t p = 0; p < (sizeof(prefix_sizes) / sizeof(prefix_sizes[0])); p++)
+    {
+        status = signing_prefix_init(&prefix, &key, frame, prefix_sizes[p]);
+        for (uint32_t t = 0; (status == PSA_SUCCESS) && (t < (sizeof(tail_sizes) / sizeof(tail_sizes[0]))); t++)
+        {
+            const uint8_t *tail = &frame[prefix_sizes[p]];
+            size_t frame_len = (size_t)prefix_sizes[p] + tail_sizes[t];
+
+            signing_latency_reset(&key);
+            for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < SIGNING_PREFIX_RUNS); r++)
+            {
+                status = signing_sign(&key, frame, frame_len, signature, sizeof(signature), &signature_len);
+            }
+            signing_latency_summary(&key.sign_latency, &whole, &stddev);
+
+            signing_latency_reset(&key);
+            for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < SIGNING_PREFIX_RUNS); r++)
+            {
+                status = signing_prefix_sign(&prefix, tail, tail_sizes[t],
+                                             signature, sizeof(signature), &signature_len);
+                if ((status == PSA_SUCCESS) && (r == 0U))
+                {
+                    status = signing_verify(&key, frame, frame_len, signature, signature_len);
+                }
+            }
+            signing_latency_summary(&key.sign_latency, &cached, &stddev);
+
+            if (status == PSA_SUCCESS)
+            {
+                LOG_PRINT("  prefix %3lu, tail %3lu: %9lu / %9lu\r\n",
+                          (unsigned long)prefix_sizes[p], (unsigned long)tail_sizes[t],
+                          (unsigned long)whole, (unsigned long)cached);
+            }
+        }
+        signing_prefix_free(&prefix);
+        if (status != PSA_SUCCESS)
+        {
+            LOG_PRINT("  prefix %3lu: failed (%ld)\r\n", (unsigned long)prefix_sizes[p], (long)status);
+            break;
+        }
+    }
+    signing_key_destroy(&key);
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Compare signing a copied frame with signing its segment list
+ *
+ * A frame is header || payload || trailer in three buffers. The copy path
+ * joins them into one buffer and calls signing_sign(); the segment path
+ * passes the three buffers to signing_sign_iov(). Each is timed over
+ * SIGNING_PREFIX_RUNS signatures, copy included.
+ */
+static void signing_iov_benchmark(void)
+{
+    static const uint16_t payload_sizes[] = { 64U, 256U, IOV_PAYLOAD_MAX };
+    static uint8_t header[IOV_HEADER_SIZE];
+    static uint8_t payload[IOV_PAYLOAD_MAX];
+    static uint8_t trailer[IOV_TRAILER_SIZE];
+    static uint8_t frame[IOV_HEADER_SIZE + IOV_PAYLOAD_MAX + IOV_TRAILER_SIZE];
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    signing_key_t key;
+    psa_status_t status;
+
+    memset(header, 0xA5, sizeof(header));
+    memset(trailer, 0x5A, sizeof(trailer));
+    for (uint32_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)i;
+    }
+    status = signing_key_generate(&config, &key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Segment signing: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+
+    LOG_PRINT("Segment signing, ECDSA P-256 (mean cycles: copy + sign / segments):\r\n");
+    for (uint32_t p = 0; (status == PSA_SUCCESS) && (p < (sizeof(payload_sizes) / sizeof(payload_sizes[0]))); p++)
+    {
+        const signing_iovec_t iov[] =
+        {
+            { header, sizeof(header) },
+            { payload, payload_sizes[p] },
+            { trailer, sizeof(trailer) },
+        };
+        size_t frame_len = sizeof(header) + payload_sizes[p] + sizeof(trailer);
+        uint64_t copy_cycles = 0;
+        uint64_t iov_cycles = 0;
+
+        for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < SIGNING_PREFIX_RUNS); r++)
+        {
+            uint32_t start = cycle_counter_read();
+
+            memcpy(frame, header, sizeof(header));
+            memcpy(&frame[sizeof(header)], payload, payload_sizes[p]);
+            memcpy(&frame[sizeof(header) + payload_sizes[p]], trailer, sizeof(trailer));
+            status = signing_sign(&key, frame, frame_len, signature, sizeof(signature), &signature_len);
+            copy_cycles += cycle_counter_read() - start;
+
+            if (status == PSA_SUCCESS)
+            {
+                start = cycle_counter_read();
+                status = signing_sign_iov(&key, iov, sizeof(iov) / sizeof(iov[0]),
+                                          signature, sizeof(signature), &signature_len);
+                iov_cycles += cycle_counter_read() - start;
+            }
+        }
+        if (status == PSA_SUCCESS)
+        {
+            status = signing_verify_iov(&key, iov, sizeof(iov) / sizeof(iov[0]), signature, signature_len);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            LOG_PRINT("  frame %4lu B: %9lu / %9lu\r\n", (unsigned long)frame_len,
+                      (unsigned long)(copy_cycles / SIGNING_PREFIX_RUNS),
+                      (unsigned long)(iov_cycles / SIGNING_PREFIX_RUNS));
+        }
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("  failed (%ld)\r\n", (long)status);
+    }
+    signing_key_destroy(&key);
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Replay a trace of repeated signed commands with and without the
+ *        verification cache
+ *
+ * REPLAY_COMMANDS commands are signed once. REPLAY_ARRIVALS arrivals then
+ * pick one of them, half of the time the most frequent one, as a fleet
+ * re-sending a configuration push would. Time is the arrival number and
+ * entries expire after REPLAY_TTL arrivals.
+ */
+static void verify_cache_replay(void)
+{
+    static uint8_t signatures[REPLAY_COMMANDS][SIGNING_SIGNATURE_MAX_SIZE];
+    static uint8_t hashes[REPLAY_COMMANDS][SHA256_SW_DIGEST_SIZE];
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t command[16] = "set-config #0";
+    size_t signature_len = 0;
+    signing_key_t key;
+    verify_cache_stats_t stats;
+    uint64_t direct = 0;
+    uint64_t cached = 0;
+    uint32_t lcg = 1U;
+    psa_status_t status;
+
+    status = signing_key_generate(&config, &key);
+    for (uint32_t c = 0; (status == PSA_SUCCESS) && (c < REPLAY_COMMANDS); c++)
+    {
+        command[12] = (uint8_t)('0' + c);
+        status = crypto_dispatch_sha256(command, sizeof(command), hashes[c]);
+        if (status == PSA_SUCCESS)
+        {
+            status = signing_sign(&key, command, sizeof(command),
+                                  signatures[c], sizeof(signatures[c]), &signature_len);
+        }
+    }
+
+    verify_cache_init(REPLAY_TTL);
+    for (uint32_t a = 0; (status == PSA_SUCCESS) && (a < REPLAY_ARRIVALS); a++)
+    {
+        uint32_t c;
+        uint32_t start;
+
+        lcg = (lcg * 1103515245UL) + 12345UL;
+        c = (((lcg >> 16) & 1U) != 0U) ? 0U : ((lcg >> 17) % REPLAY_COMMANDS);
+
+        start = cycle_counter_read();
+        status = psa_verify_hash(key.key_id, key.alg, hashes[c], sizeof(hashes[c]),
+                                 signatures[c], signature_len);
+        direct += cycle_counter_read() - start;
+
+        if (status == PSA_SUCCESS)
+        {
+            start = cycle_counter_read();
+            status = verify_cache_verify_hash(key.key_id, key.alg, hashes[c], sizeof(hashes[c]),
+                                              signatures[c], signature_len, a);
+            cached += cycle_counter_read() - start;
+        }
+    }
+    verify_cache_forget_key(key.key_id);
+    signing_key_destroy(&key);
+
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Verify cache replay failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+    verify_cache_get_stats(&stats);
+    LOG_PRINT("Verify cache replay: %lu arrivals, %lu hits, %lu misses, %lu expired, %lu key exports\r\n",
+              (unsigned long)REPLAY_ARRIVALS, (unsigned long)stats.hits,
+              (unsigned long)stats.misses, (unsigned long)stats.expired,
+              (unsigned long)stats.key_exports);
+    LOG_PRINT("  mean cycles per arrival: direct %lu, cached %lu\r\n\n",
+              (unsigned long)(direct / REPLAY_ARRIVALS), (unsigned long)(cached / REPLAY_ARRIVALS));
+}
+
+/**
+ * @brief Encode a telemetry record: { "dev": bstr, "seq": uint, "t": [ float... ] }
+ *
+ * @param[in] w         Writer, possibly counting only
+ * @param[in] seq       Record number
+ * @param[in] readings  Number of samples
+ */
+static void telemetry_encode(cbor_writer_t *w, uint32_t seq, uint32_t readings)
+{
+    static const uint8_t device_id[8] = { 0x45, 0x84, 0x00, 0x01, 0x00, 0x00, 0x2A, 0x17 };
+
+    cbor_put_map(w, 3U);
+    cbor_put_tstr(w, "dev");
+    cbor_put_bstr(w, device_id, sizeof(device_id));
+    cbor_put_tstr(w, "seq");
+    cbor_put_uint(w, seq);
+    cbor_put_tstr(w, "t");
+    cbor_put_array(w, readings);
+    for (uint32_t i = 0; i < readings; i++)
+    {
+        cbor_put_float(w, 20.0f + ((float)(i % 50U) * 0.1f));
+    }
+}
+
+/**
+ * @brief Compare buffered and single-pass COSE_Sign1 signing of telemetry
+ *
+ * Buffered: encode the payload, build the Sig_structure in a second
+ * buffer, sign it with psa_sign_message() and serialize the message. Single
+ * pass: count the payload size, then encode straight into the message
+ * while hashing on this core, and sign the digest.
+ */
+static void cose_sign1_benchmark(void)
+{
+    static const uint16_t readings[] = { 8U, 48U, 210U };
+    static const uint8_t protected_header[] = { 0xA1, 0x01, 0x26 };    /* {1: -7} */
+    static uint8_t payload[COSE_BENCH_PAYLOAD_MAX];
+    static uint8_t tbs[COSE_BENCH_PAYLOAD_MAX + 32U];
+    static uint8_t message[COSE_BENCH_MESSAGE_MAX];
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    size_t message_len = 0;
+    size_t tbs_len = 0;
+    cbor_writer_t w;
+    cose_sign1_t cose;
+    signing_key_t key;
+    psa_status_t status;
+
+    status = cose_sign1_self_test();
+    LOG_PRINT("COSE_Sign1 interoperability vector: %s\r\n",
+              (status == PSA_SUCCESS) ? "pass" : "FAIL");
+
+    status = signing_key_generate(&config, &key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("COSE_Sign1: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+
+    LOG_PRINT("COSE_Sign1 ES256 telemetry (mean cycles: buffered / single pass, payload B per kcycle):\r\n");
+    for (uint32_t p = 0; (status == PSA_SUCCESS) && (p < (sizeof(readings) / sizeof(readings[0]))); p++)
+    {
+        uint64_t buffered_cycles = 0;
+        uint64_t stream_cycles = 0;
+        size_t payload_len = 0;
+
+        for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < SIGNING_PREFIX_RUNS); r++)
+        {
+            uint32_t start = cycle_counter_read();
+
+            cbor_writer_init(&w, payload, sizeof(payload));
+            telemetry_encode(&w, r, readings[p]);
+            payload_len = w.len;
+
+            cbor_writer_init(&w, tbs, sizeof(tbs));
+            cbor_put_array(&w, 4U);
+            cbor_put_tstr(&w, "Signature1");
+            cbor_put_bstr(&w, protected_header, sizeof(protected_header));
+            cbor_put_bstr(&w, NULL, 0U);
+            cbor_put_bstr(&w, payload, payload_len);
+            tbs_len = w.len;
+            status = signing_sign(&key, tbs, tbs_len, signature, sizeof(signature), &signature_len);
+
+            cbor_writer_init(&w, message, sizeof(message));
+            cbor_put_tag(&w, COSE_SIGN1_TAG);
+            cbor_put_array(&w, 4U);
+            cbor_put_bstr(&w, protected_header, sizeof(protected_header));
+            cbor_put_map(&w, 0U);
+            cbor_put_bstr(&w, payload, payload_len);
+            cbor_put_bstr(&w, signature, signature_len);
+            buffered_cycles += cycle_counter_read() - start;
+
+            if (status == PSA_SUCCESS)
+            {
+                start = cycle_counter_read();
+                cbor_writer_init(&w, NULL, 0U);
+                telemetry_encode(&w, r, readings[p]);
+                status = cose_sign1_begin(&cose, &key, NULL, 0U, NULL, 0U, w.len,
+                                          message, sizeof(message));
+                if (status == PSA_SUCCESS)
+                {
+                    telemetry_encode(cose_sign1_payload(&cose), r, readings[p]);
+                    status = cose_sign1_finish(&cose, &message_len);
+                }
+                stream_cycles += cycle_counter_read() - start;
+            }
+        }
+        if (status == PSA_SUCCESS)
+        {
+            /* Check the last single-pass message against the buffered Sig_structure */
+            status = signing_verify(&key, tbs, tbs_len, &message[message_len - COSE_ES256_SIGNATURE_SIZE],
+                                    COSE_ES256_SIGNATURE_SIZE);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            LOG_PRINT("  payload %4lu B: %9lu / %9lu, %lu\r\n", (unsigned long)payload_len,
+                      (unsigned long)(buffered_cycles / SIGNING_PREFIX_RUNS),
+                      (unsigned long)(stream_cycles / SIGNING_PREFIX_RUNS),
+                      (unsigned long)((payload_len * 1000U * SIGNING_PREFIX_RUNS) / (stream_cycles + 1U)));
+        }
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("  failed (%ld)\r\n", (long)status);
+    }
+    else
+    {
+        LOG_PRINT("  buffered path needs %lu B of payload and Sig_structure buffers\r\n",
+                  (unsigned long)(sizeof(payload) + sizeof(tbs)));
+    }
+    signing_key_destroy(&key);
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Format the claims of a five-minute device token
+ *
+ * @param[out] claims  JSON output
+ * @param[in]  size    Capacity of @p claims
+ * @param[in]  seq     Token number; sets the issue time and the token id
+ *
+ * @return Length of the claims
+ */
+static size_t jws_claims_format(char *claims, size_t size, uint32_t seq)
+{
+    uint32_t iat = 1791158400UL + (seq * 60U);
+
+    return (size_t)snprintf(claims, size,
+                            "{\"sub\":\"psoc-edge-0017\",\"aud\":\"telemetry\","
+                            "\"iat\":%lu,\"exp\":%lu,\"jti\":\"%08lx\"}",
+                            (unsigned long)iat, (unsigned long)(iat + 300U), (unsigned long)seq);
+}
+
+/**
+ * @brief Compare direct and cached-header ES256 token minting
+ *
+ * Direct: encode header and claims, sign the signing input with
+ * psa_sign_message() and encode the signature. Cached: jws_mint(), which
+ * starts from the encoded header and its hash midstate. Both format the
+ * same claims for every token.
+ */
+static void jws_token_benchmark(void)
+{
+    static const char header[] = JWS_HEADER_ES256_JWT;
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    char claims[JWS_BENCH_CLAIMS_MAX];
+    char token[JWS_BENCH_TOKEN_MAX];
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    size_t token_len = 0;
+    uint64_t direct_cycles = 0;
+    uint64_t cached_cycles = 0;
+    uint32_t direct_mean;
+    uint32_t cached_mean;
+    jws_minter_t minter;
+    signing_key_t key;
+    psa_status_t status;
+
+    status = jws_self_test();
+    LOG_PRINT("JWS known-answer test: %s\r\n", (status == PSA_SUCCESS) ? "pass" : "FAIL");
+
+    status = signing_key_generate(&config, &key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("JWS: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+    status = jws_minter_init(&minter, &key, header, sizeof(header) - 1U);
+
+    for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < SIGNING_BENCH_RUNS); r++)
+    {
+        size_t claims_len;
+        size_t len;
+        uint32_t start = cycle_counter_read();
+
+        claims_len = jws_claims_format(claims, sizeof(claims), r);
+        len = jws_base64url_encode((const uint8_t *)header, sizeof(header) - 1U, token);
+        token[len++] = '.';
+        len += jws_base64url_encode((const uint8_t *)claims, claims_len, &token[len]);
+        status = signing_sign(&key, (const uint8_t *)token, len, signature, sizeof(signature), &signature_len);
+        token[len++] = '.';
+        len += jws_base64url_encode(signature, signature_len, &token[len]);
+        token[len] = '\0';
+        direct_cycles += cycle_counter_read() - start;
+
+        if (status == PSA_SUCCESS)
+        {
+            start = cycle_counter_read();
+            claims_len = jws_claims_format(claims, sizeof(claims), r);
+            status = jws_mint(&minter, claims, claims_len, token, sizeof(token), &token_len);
+            cached_cycles += cycle_counter_read() - start;
+        }
+    }
+    if (status == PSA_SUCCESS)
+    {
+        /* Check the last cached token: header.claims is the signing input */
+        size_t signing_input_len = token_len - 1U - JWS_BASE64URL_SIZE(JWS_ES256_SIGNATURE_SIZE);
+
+        if (jws_base64url_decode(&token[signing_input_len + 1U], token_len - signing_input_len - 1U,
+                                 signature, sizeof(signature)) != JWS_ES256_SIGNATURE_SIZE)
+        {
+            status = PSA_ERROR_CORRUPTION_DETECTED;
+        }
+        else
+        {
+            status = signing_verify(&key, (const uint8_t *)token, signing_input_len,
+                                    signature, JWS_ES256_SIGNATURE_SIZE);
+        }
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("JWS ES256 minting failed (%ld)\r\n", (long)status);
+    }
+    else
+    {
+        direct_mean = (uint32_t)(direct_cycles / SIGNING_BENCH_RUNS);
+        cached_mean = (uint32_t)(cached_cycles / SIGNING_BENCH_RUNS);
+        LOG_PRINT("JWS ES256 minting, %lu B tokens (mean cycles, tokens/s):\r\n", (unsigned long)token_len);
+        LOG_PRINT("  direct         %9lu  %lu\r\n", (unsigned long)direct_mean,
+                  (unsigned long)(SystemCoreClock / (direct_mean + 1U)));
+        LOG_PRINT("  cached header  %9lu  %lu\r\n", (unsigned long)cached_mean,
+                  (unsigned long)(SystemCoreClock / (cached_mean + 1U)));
+    }
+    jws_minter_free(&minter);
+    signing_key_destroy(&key);
+    LOG_PRINT("\r\n");
+}
+
+/**
+ * @brief Transcode a batch of stored signatures and parse mutated records
+ *
+ * DER_BATCH_SIGNATURES P-256 signatures (pseudo-random r || s, so leading
+ * zeros and set top bits occur) go to DER and back. Then DER_MUTATIONS
+ * copies of those records get one to three random byte flips, cuts or
+ * appends; whatever the decoder accepts must encode back to the same
+ * bytes, i.e. only canonical DER gets through.
+ */
+static void ecdsa_der_benchmark(void)
+{
+    static uint8_t raw[DER_BATCH_SIGNATURES][64];
+    static uint8_t back[DER_BATCH_SIGNATURES][64];
+    static uint8_t der[DER_BATCH_SIGNATURES * ECDSA_DER_MAX_SIZE(32U)];
+    uint8_t record[ECDSA_DER_MAX_SIZE(32U) + 4U];
+    uint8_t decoded[64];
+    size_t der_len = 0;
+    size_t done = 0;
+    uint32_t encode_cycles;
+    uint32_t decode_cycles = 0;
+    uint32_t accepted = 0;
+    uint32_t lcg = 7U;
+    uint32_t start;
+    psa_status_t status;
+
+    status = ecdsa_der_self_test();
+    LOG_PRINT("ECDSA DER known-answer test: %s\r\n", (status == PSA_SUCCESS) ? "pass" : "FAIL");
+
+    for (uint32_t i = 0; i < DER_BATCH_SIGNATURES; i++)
+    {
+        for (uint32_t b = 0; b < 64U; b++)
+        {
+            lcg = (lcg * 1103515245UL) + 12345UL;
+            raw[i][b] = (uint8_t)(lcg >> 16);
+        }
+        /* Every fourth r starts with zero bytes */
+        memset(raw[i], 0, ((i % 4U) == 0U) ? (i % 7U) : 0U);
+    }
+
+    start = cycle_counter_read();
+    status = ecdsa_raw_to_der_batch(&raw[0][0], 32U, DER_BATCH_SIGNATURES, der, sizeof(der), &der_len, &done);
+    encode_cycles = cycle_counter_read() - start;
+    if (status == PSA_SUCCESS)
+    {
+        start = cycle_counter_read();
+        status = ecdsa_der_to_raw_batch(der, der_len, 32U, &back[0][0], DER_BATCH_SIGNATURES, &done);
+        decode_cycles = cycle_counter_read() - start;
+    }
+    if ((status == PSA_SUCCESS) &&
+        ((done != DER_BATCH_SIGNATURES) || (memcmp(raw, back, sizeof(raw)) != 0)))
+    {
+        status = PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("ECDSA DER batch failed at %lu (%ld)\r\n\n", (unsigned long)done, (long)status);
+        return;
+    }
+    LOG_PRINT("ECDSA DER batch of %lu P-256 signatures, %lu B of DER:\r\n",
+              (unsigned long)DER_BATCH_SIGNATURES, (unsigned long)der_len);
+    LOG_PRINT("  cycles per signature: raw to DER %lu, DER to raw %lu\r\n",
+              (unsigned long)(encode_cycles / DER_BATCH_SIGNATURES),
+              (unsigned long)(decode_cycles / DER_BATCH_SIGNATURES));
+
+    for (uint32_t m = 0; (status == PSA_SUCCESS) && (m < DER_MUTATIONS); m++)
+    {
+        size_t len = 0;
+        size_t check_len = 0;
+        uint32_t edits;
+
+        (void)ecdsa_raw_to_der(raw[m % DER_BATCH_SIGNATURES], 64U, record, sizeof(record), &len);
+        lcg = (lcg * 1103515245UL) + 12345UL;
+        edits = 1U + ((lcg >> 16) % 3U);
+        for (uint32_t e = 0; e < edits; e++)
+        {
+            lcg = (lcg * 1103515245UL) + 12345UL;
+            switch ((lcg >> 16) % 3U)
+            {
+                case 0U:
+                    record[(lcg >> 18) % len] ^= (uint8_t)(1U << ((lcg >> 26) % 8U));
+                    break;
+                case 1U:
+                    len -= (len > 1U) ? 1U : 0U;
+                    break;
+                default:
+                    if (len < sizeof(record))
+                    {
+                        record[len++] = (uint8_t)(lcg >> 24);
+                    }
+                    break;
+            }
+        }
+        if (ecdsa_der_to_raw(record, len, 32U, decoded, sizeof(decoded)) == PSA_SUCCESS)
+        {
+            accepted++;
+            status = ecdsa_raw_to_der(decoded, sizeof(decoded), der, sizeof(der), &check_len);
+            if ((status == PSA_SUCCESS) && ((check_len != len) || (memcmp(der, record, len) != 0)))
+            {
+                status = PSA_ERROR_CORRUPTION_DETECTED;
+            }
+        }
+    }
+    LOG_PRINT("  %lu mutated records, %lu accepted, all canonical: %s\r\n\n", (unsigned long)DER_MUTATIONS,
+              (unsigned long)accepted, (status == PSA_SUCCESS) ? "yes" : "NO");
+}
+
+#if (APP_PS_BENCHMARKS)
+/** @brief Export callback: one console line per 32 bytes of a record */
+static void audit_log_print(void *arg, audit_log_record_t type, const uint8_t *data, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    char line[65];
+
+    (void)arg;
+    for (size_t off = 0; off < len; off += 32U)
+    {
+        size_t n = ((len - off) < 32U) ? (len - off) : 32U;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            line[2U * i] = hex[data[off + i] >> 4];
+            line[(2U * i) + 1U] = hex[data[off + i] & 0x0FU];
+        }
+        line[2U * n] = '\0';
+        LOG_PRINT("AUDIT %c %lu %s\r\n", (char)type, (unsigned long)off, line);
+    }
+}
+
+/** @brief Append @p count pseudo-random events; cycles in *cycles */
+static psa_status_t audit_log_fill(audit_log_t *log, uint32_t count, uint32_t *lcg, uint32_t *cycles)
+{
+    uint8_t data[8];
+    uint32_t start = cycle_counter_read();
+    psa_status_t status = PSA_SUCCESS;
+
+    for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < count); i++)
+    {
+        for (uint32_t b = 0; b < sizeof(data); b++)
+        {
+            *lcg = (*lcg * 1103515245UL) + 12345UL;
+            data[b] = (uint8_t)(*lcg >> 16);
+        }
+        status = audit_log_append(log, i, (uint16_t)(data[0] % 8U), data, sizeof(data), 0U);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_checkpoint(log);
+    }
+    *cycles = cycle_counter_read() - start;
+    return status;
+}
+
+/**
+ * @brief Audit log throughput, recovery and tamper check
+ *
+ * Appends AUDIT_BENCH_SINGLE events with a commit and a checkpoint per
+ * entry, then AUDIT_BENCH_ENTRIES in full segments with a checkpoint every
+ * AUDIT_BENCH_CHECKPOINT commits, and reports entries/s for both (the
+ * times include the storage writes). The second log is reopened from
+ * storage as after a reset, verified, exported, and verified again with
+ * one byte flipped in a stored segment. The assets are removed at the end.
+ * The event time is the arrival number, so only batch_entries bounds the
+ * loss window here.
+ */
+static void audit_log_benchmark(void)
+{
+    static audit_log_t log;
+    static audit_log_t resumed;
+    static uint8_t segment[AUDIT_LOG_SEGMENT_SIZE(AUDIT_LOG_BATCH_MAX)];
+    const signing_key_config_t key_config = SIGNING_KEY_CONFIG_DEFAULT;
+    audit_log_config_t config =
+    {
+        AUDIT_BENCH_UID_BASE, NULL, 1U, 0U, 1U
+    };
+    audit_log_verify_info_t info;
+    signing_key_t key;
+    size_t len = 0;
+    psa_storage_uid_t uid;
+    uint32_t single_cycles = 0;
+    uint32_t batch_cycles = 0;
+    uint32_t lcg = 17U;
+    psa_status_t status;
+    psa_status_t tampered;
+
+    status = signing_key_generate(&key_config, &key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Audit log: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+    config.key = &key;
+
+    /* Per entry: one segment write and one signed checkpoint each */
+    status = audit_log_open(&log, &config);
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_erase(&log);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_fill(&log, AUDIT_BENCH_SINGLE, &lcg, &single_cycles);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_erase(&log);
+    }
+
+    /* Batched */
+    config.batch_entries = AUDIT_LOG_BATCH_MAX;
+    config.checkpoint_batches = AUDIT_BENCH_CHECKPOINT;
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_open(&log, &config);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_fill(&log, AUDIT_BENCH_ENTRIES, &lcg, &batch_cycles);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Audit log benchmark failed (%ld)\r\n\n", (long)status);
+        (void)audit_log_erase(&log);
+        signing_key_destroy(&key);
+        return;
+    }
+
+    LOG_PRINT("Audit log in Protected Storage, %lu B entries (entries/s):\r\n",
+              (unsigned long)AUDIT_LOG_ENTRY_SIZE);
+    LOG_PRINT("  commit and checkpoint per entry  %lu\r\n",
+              (unsigned long)(((uint64_t)AUDIT_BENCH_SINGLE * SystemCoreClock) / (single_cycles + 1U)));
+    LOG_PRINT("  %lu per commit, checkpoint every %lu  %lu\r\n", (unsigned long)AUDIT_LOG_BATCH_MAX,
+              (unsigned long)AUDIT_BENCH_CHECKPOINT,
+              (unsigned long)(((uint64_t)AUDIT_BENCH_ENTRIES * SystemCoreClock) / (batch_cycles + 1U)));
+    LOG_PRINT("  mean cycles: commit %lu, checkpoint %lu; loss window < %lu entries\r\n",
+              (unsigned long)(log.stats.commit_cycles / log.stats.commits),
+              (unsigned long)(log.stats.checkpoint_cycles / log.stats.checkpoints),
+              (unsigned long)AUDIT_LOG_BATCH_MAX);
+    LOG_PRINT("  %lu-segment ring: %lu segments replaced unexported under the checkpoint, %lu appends refused\r\n",
+              (unsigned long)AUDIT_LOG_SEGMENTS, (unsigned long)log.stats.segments_dropped,
+              (unsigned long)log.stats.refused);
+
+    /* As after a reset: the chain resumes from storage */
+    status = audit_log_open(&resumed, &config);
+    LOG_PRINT("  reopened: %s at entry %lu\r\n",
+              ((status == PSA_SUCCESS) && (resumed.next_seq == log.next_seq) &&
+               (memcmp(resumed.head, log.head, sizeof(log.head)) == 0)) ? "resumes" : "DOES NOT RESUME",
+              (unsigned long)resumed.next_seq);
+
+    status = audit_log_verify(&log, &info);
+    LOG_PRINT("  verify: %s, entries %lu..%lu stored, %lu signed\r\n",
+              (status == PSA_SUCCESS) ? "intact" : "FAILED", (unsigned long)info.first_seq,
+              (unsigned long)(info.first_seq + info.entries - 1U), (unsigned long)info.signed_entries);
+#if AUDIT_BENCH_EXPORT
+    if (status == PSA_SUCCESS)
+    {
+        (void)audit_log_export(&log, audit_log_print, NULL);
+    }
+#endif
+
+    /* Flip one data byte of the oldest stored entry behind the log's back */
+    uid = AUDIT_BENCH_UID_BASE + (log.next_batch % AUDIT_LOG_SEGMENTS);
+    tampered = psa_ps_get(uid, 0U, sizeof(segment), segment, &len);
+    if (tampered == PSA_SUCCESS)
+    {
+        segment[AUDIT_LOG_SEGMENT_HEADER_SIZE + 12U] ^= 0x01U;
+        tampered = psa_ps_set(uid, len, segment, PSA_STORAGE_FLAG_NONE);
+    }
+    if (tampered == PSA_SUCCESS)
+    {
+        tampered = audit_log_verify(&log, NULL);
+    }
+    LOG_PRINT("  one byte flipped in storage: %s\r\n\n",
+              (tampered == PSA_ERROR_INVALID_SIGNATURE) ? "rejected" : "NOT REJECTED");
+
+    (void)audit_log_erase(&log);
+    signing_key_destroy(&key);
+}
+
+/**
+ * @brief Trust store lookups and lazy loading
+ *
+ * Index: 16, 256 and TRUST_BENCH_INDEX_MAX random key identifiers are
+ * indexed and looked up TRUST_BENCH_LOOKUPS times each (all hits), next
+ * to a linear scan of the same identifiers; the hashed lookup should cost
+ * the same at every size. Store: TRUST_BENCH_KEYS fresh P-256 keys go in
+ * as version 1 and the store is reopened as after a reset. A command
+ * signed by one of them is verified twice (first with the PS read and
+ * import, then from the cached handle), a replayed version 1 update and
+ * an unknown identifier are refused, and every key is looked up once to
+ * show the handle limit. The assets are removed at the end.
+ */
+static void trust_store_benchmark(void)
+{
+    static uint64_t kids[TRUST_BENCH_INDEX_MAX];
+    static uint16_t slots[2U * TRUST_BENCH_INDEX_MAX];
+    static trust_store_entry_t entries[TRUST_BENCH_KEYS];
+    static trust_store_t store;
+    static const uint32_t sizes[] = { 16U, 256U, TRUST_BENCH_INDEX_MAX };
+    static const uint8_t command[] = "{\"cmd\":\"set\",\"param\":\"interval\",\"value\":30}";
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    trust_index_t index;
+    signing_key_t key;
+    psa_key_id_t handle = PSA_KEY_ID_NULL;
+    size_t signature_len = 0;
+    size_t len = 0;
+    uint64_t sender = 0;
+    uint32_t first_cycles = 0;
+    uint32_t cached_cycles = 0;
+    uint32_t lcg = 23U;
+    uint32_t start;
+    psa_status_t status = PSA_SUCCESS;
+    psa_status_t replay;
+    psa_status_t unknown;
+
+    LOG_PRINT("Trust store key lookup (mean cycles, hashed index vs linear scan):\r\n");
+    for (uint32_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        uint32_t n = sizes[s];
+        uint32_t hashed_cycles;
+        uint32_t scan_cycles;
+        uint32_t found = 0;
+
+        trust_index_init(&index, slots, 2U * n, kids);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            lcg = (lcg * 1103515245UL) + 12345UL;
+            kids[i] = ((uint64_t)lcg << 32);
+            lcg = (lcg * 1103515245UL) + 12345UL;
+            kids[i] |= lcg;
+            (void)trust_index_insert(&index, (uint16_t)i);
+        }
+
+        start = cycle_counter_read();
+        for (uint32_t l = 0; l < TRUST_BENCH_LOOKUPS; l++)
+        {
+            found += (trust_index_find(&index, kids[(l * 7919U) % n]) >= 0) ? 1U : 0U;
+        }
+        hashed_cycles = cycle_counter_read() - start;
+
+        start = cycle_counter_read();
+        for (uint32_t l = 0; l < TRUST_BENCH_LOOKUPS; l++)
+        {
+            uint64_t kid = kids[(l * 7919U) % n];
+            uint32_t i = 0;
+
+            while ((i < n) && (kids[i] != kid))
+            {
+                i++;
+            }
+            found += (i < n) ? 1U : 0U;
+        }
+        scan_cycles = cycle_counter_read() - start;
+
+        LOG_PRINT("  %5lu keys  %5lu  %7lu%s\r\n", (unsigned long)n,
+                  (unsigned long)(hashed_cycles / TRUST_BENCH_LOOKUPS), (unsigned long)(scan_cycles / TRUST_BENCH_LOOKUPS),
+                  (found == (2U * TRUST_BENCH_LOOKUPS)) ? "" : "  MISSED");
+    }
+
+    /* Senders: fresh key pairs; only the last one keeps its private key for signing */
+    for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < TRUST_BENCH_KEYS); i++)
+    {
+        status = signing_key_generate(&config, &key);
+        if (status == PSA_SUCCESS)
+        {
+            status = psa_export_public_key(key.key_id, entries[i].public_key,
+                                           sizeof(entries[i].public_key), &len);
+            entries[i].permissions = 1UL << (i % 4U);
+        }
+        if ((status != PSA_SUCCESS) || (i != (TRUST_BENCH_KEYS - 1U)))
+        {
+            signing_key_destroy(&key);
+        }
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Trust store: key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+    sender = trust_store_key_id(entries[TRUST_BENCH_KEYS - 1U].public_key, TRUST_STORE_PUBLIC_KEY_SIZE);
+    status = signing_sign(&key, command, sizeof(command) - 1U, signature, sizeof(signature), &signature_len);
+    signing_key_destroy(&key);
+
+    if (status == PSA_SUCCESS)
+    {
+        status = trust_store_open(&store, TRUST_BENCH_UID_BASE);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = trust_store_erase(&store);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = trust_store_update(&store, 1U, entries, TRUST_BENCH_KEYS);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        trust_store_close(&store);
+        status = trust_store_open(&store, TRUST_BENCH_UID_BASE);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        start = cycle_counter_read();
+        status = trust_store_verify(&store, sender, entries[TRUST_BENCH_KEYS - 1U].permissions,
+                                    command, sizeof(command) - 1U, signature, signature_len);
+        first_cycles = cycle_counter_read() - start;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        start = cycle_counter_read();
+        status = trust_store_verify(&store, sender, 0U, command, sizeof(command) - 1U, signature, signature_len);
+        cached_cycles = cycle_counter_read() - start;
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Trust store: command verification failed (%ld)\r\n\n", (long)status);
+        (void)trust_store_erase(&store);
+        return;
+    }
+
+    replay = trust_store_update(&store, 1U, entries, TRUST_BENCH_KEYS);
+    unknown = trust_store_find(&store, sender ^ 1U, 0U, &handle);
+    for (uint32_t i = 0; i < TRUST_BENCH_KEYS; i++)
+    {
+        (void)trust_store_find(&store, trust_store_key_id(entries[i].public_key, TRUST_STORE_PUBLIC_KEY_SIZE),
+                               0U, &handle);
+    }
+
+    LOG_PRINT("Trust store, %lu keys of version %lu in PS:\r\n", (unsigned long)store.count,
+              (unsigned long)store.version);
+    LOG_PRINT("  command verify: first %lu cycles (PS read and import), then %lu\r\n",
+              (unsigned long)first_cycles, (unsigned long)cached_cycles);
+    LOG_PRINT("  version 1 again: %s; unknown key: %s\r\n",
+              (replay == PSA_ERROR_NOT_PERMITTED) ? "refused" : "NOT REFUSED",
+              (unknown == PSA_ERROR_DOES_NOT_EXIST) ? "refused" : "NOT REFUSED");
+    LOG_PRINT("  %lu loads, %lu evictions, %lu of %lu handles held\r\n\n", (unsigned long)store.stats.loads,
+              (unsigned long)store.stats.evictions, (unsigned long)store.loaded,
+              (unsigned long)TRUST_STORE_LOADED_MAX);
+
+    (void)trust_store_erase(&store);
+}
+#endif /* (APP_PS_BENCHMARKS) */
+
+/**
+ * @brief Revocation hook of the chain benchmark: @p arg points to the
+ *        certificate currently listed as revoked, or to NULL
+ */
+static bool x509_bench_revoked(void *arg, const x509_cert_t *cert)
+{
+    const x509_cert_t *listed = *(const x509_cert_t *const *)arg;
+
+    return (listed != NULL) &&
+           (cert->serial_len == listed->serial_len) && (memcmp(cert->serial, listed->serial, cert->serial_len) == 0) &&
+           (cert->issuer_len == listed->issuer_len) && (memcmp(cert->issuer, listed->issuer, cert->issuer_len) == 0);
+}
+
+/**
+ * @brief X.509 chain verification: full path vs cached intermediate
+ *
+ * The demo chain (x509_demo_certs.h) is verified X509_BENCH_ROUNDS times
+ * from an empty cache: leaf 1 and intermediate, two signatures, up to the
+ * root. Leaf 2 then follows with the intermediate cached: one signature,
+ * the intermediate is not even parsed. A leaf with a flipped signature
+ * byte and a revoked leaf must be refused, so must the intermediate once
+ * it is listed as revoked and dropped from the cache with
+ * x509_chain_revoke(), and any chain after the leaves expire.
+ */
+static void x509_chain_benchmark(void)
+{
+    static x509_chain_t chain;
+    static uint8_t tampered[512];
+    const x509_cert_t *listed = NULL;
+    const x509_chain_config_t config =
+    {
+        x509_demo_root, x509_demo_root_len, X509_BENCH_TTL, x509_bench_revoked, &listed
+    };
+    const uint8_t *const full[] = { x509_demo_leaf1, x509_demo_intermediate, x509_demo_root };
+    const size_t full_lens[] = { x509_demo_leaf1_len, x509_demo_intermediate_len, x509_demo_root_len };
+    const uint8_t *const next[] = { x509_demo_leaf2, x509_demo_intermediate };
+    const size_t next_lens[] = { x509_demo_leaf2_len, x509_demo_intermediate_len };
+    const uint8_t *const bad[] = { tampered, x509_demo_intermediate };
+    x509_cert_t leaf;
+    x509_cert_t intermediate;
+    uint64_t now = x509_time_from_date(2027U, 1U, 1U, 0U, 0U, 0U);
+    uint64_t full_cycles = 0;
+    uint64_t cached_cycles = 0;
+    uint32_t full_mean;
+    uint32_t cached_mean;
+    uint32_t start;
+    psa_status_t status;
+    psa_status_t tamper;
+    psa_status_t expired;
+    psa_status_t revoked_leaf;
+    psa_status_t revoked_ca;
+    bool dropped;
+
+    status = x509_chain_init(&chain, &config);
+    for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < X509_BENCH_ROUNDS); r++)
+    {
+        x509_chain_flush(&chain);
+        start = cycle_counter_read();
+        status = x509_chain_verify(&chain, full, full_lens, 3U, now, &leaf);
+        full_cycles += cycle_counter_read() - start;
+    }
+    for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < X509_BENCH_ROUNDS); r++)
+    {
+        start = cycle_counter_read();
+        status = x509_chain_verify(&chain, next, next_lens, 2U, now, NULL);
+        cached_cycles += cycle_counter_read() - start;
+    }
+    if ((status == PSA_SUCCESS) && (x509_demo_leaf1_len > sizeof(tampered)))
+    {
+        status = PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("X.509 chain verification failed (%ld)\r\n\n", (long)status);
+        x509_chain_deinit(&chain);
+        return;
+    }
+
+    /* The last byte of a certificate is the last byte of s */
+    memcpy(tampered, x509_demo_leaf1, x509_demo_leaf1_len);
+    tampered[x509_demo_leaf1_len - 1U] ^= 0x01U;
+    tamper = x509_chain_verify(&chain, bad, full_lens, 2U, now, NULL);
+    listed = &leaf;
+    revoked_leaf = x509_chain_verify(&chain, full, full_lens, 3U, now, NULL);
+    (void)x509_parse(x509_demo_intermediate, x509_demo_intermediate_len, &intermediate);
+    listed = &intermediate;
+    dropped = x509_chain_revoke(&chain, intermediate.ski, intermediate.ski_len);
+    revoked_ca = x509_chain_verify(&chain, next, next_lens, 2U, now, NULL);
+    listed = NULL;
+    expired = x509_chain_verify(&chain, next, next_lens, 2U,
+                                x509_time_from_date(2032U, 1U, 1U, 0U, 0U, 0U), NULL);
+
+    full_mean = (uint32_t)(full_cycles / X509_BENCH_ROUNDS);
+    cached_mean = (uint32_t)(cached_cycles / X509_BENCH_ROUNDS);
+    LOG_PRINT("X.509 chain verify, root / intermediate / leaf, P-256 (mean cycles, chains/s):\r\n");
+    LOG_PRINT("  full path          %9lu  %lu\r\n", (unsigned long)full_mean,
+              (unsigned long)(SystemCoreClock / (full_mean + 1U)));
+    LOG_PRINT("  cached CA          %9lu  %lu\r\n", (unsigned long)cached_mean,
+              (unsigned long)(SystemCoreClock / (cached_mean + 1U)));
+    LOG_PRINT("  %lu chains, %lu signatures checked, %lu cache hits\r\n", (unsigned long)chain.stats.chains,
+              (unsigned long)chain.stats.signatures, (unsigned long)chain.stats.cache_hits);
+    LOG_PRINT("  tampered leaf: %s; revoked leaf: %s\r\n",
+              (tamper == PSA_ERROR_INVALID_SIGNATURE) ? "refused" : "NOT REFUSED",
+              (revoked_leaf == PSA_ERROR_NOT_PERMITTED) ? "refused" : "NOT REFUSED");
+    LOG_PRINT("  revoked CA: %s%s; expired: %s\r\n\n",
+              (revoked_ca == PSA_ERROR_NOT_PERMITTED) ? "refused" : "NOT REFUSED",
+              dropped ? " (dropped from cache)" : "",
+              (expired == PSA_ERROR_NOT_PERMITTED) ? "refused" : "NOT REFUSED");
+
+    x509_chain_deinit(&chain);
+}
+
+/** @brief der_sink_fn_t printing PEM lines to the console, one per call */
+static void csr_bench_console(void *arg, const uint8_t *data, size_t len)
+{
+    char line[CSR_PEM_LINE + 2U];
+
+    (void)arg;
+    if (len >= sizeof(line))
+    {
+        len = sizeof(line) - 1U;
+    }
+    memcpy(line, data, len);
+    if ((len != 0U) && (line[len - 1U] == '\n'))
+    {
+        len--;
+    }
+    line[len] = '\0';
+    LOG_PRINT("%s\r\n", line);
+}
+
+/**
+ * @brief Stack used by one csr_write() call
+ *
+ * A CSR_BENCH_STACK_WINDOW window starting CSR_BENCH_STACK_MARGIN below
+ * the active stack pointer (MSP bare-metal, the task's PSP with FreeRTOS)
+ * is painted, the request written, and the window measured. The margin
+ * keeps stack_usage_paint() from painting its own frame; it is added
+ * back, so the figure is the depth below this function's frame.
+ *
+ * @param[out] full  True if the whole window was used (the figure is a floor)
+ */
+static uint32_t csr_bench_stack(signing_key_t *key, const csr_subject_t *subject,
+                                uint8_t *out, size_t out_size, bool *full)
+{
+    uint32_t sp = ((__get_CONTROL() & CONTROL_SPSEL_Msk) != 0U) ? __get_PSP() : __get_MSP();
+    uint32_t *top = (uint32_t *)((sp - CSR_BENCH_STACK_MARGIN) & ~3UL);
+    uint32_t *limit = top - (CSR_BENCH_STACK_WINDOW / sizeof(uint32_t));
+    uint32_t used;
+
+    stack_usage_paint(limit, top);
+    (void)csr_write_buffer(key, subject, CSR_FORMAT_DER, out, out_size, NULL);
+    used = stack_usage_measure(limit, top);
+    *full = (used >= CSR_BENCH_STACK_WINDOW);
+    return used + CSR_BENCH_STACK_MARGIN;
+}
+
+/**
+ * @brief PKCS#10 request generation with the streaming DER writer
+ *
+ * After the known-answer test, a fresh device key signs CSR_BENCH_ROUNDS
+ * DER requests into a buffer; the mean covers encoding, hashing and
+ * psa_sign_hash(). The stack of one call is measured with a painted
+ * window, then the request is printed as PEM straight from the encoder;
+ * paste it into csr.pem and check it with
+ * "openssl req -in csr.pem -noout -verify -text". tools/host/csr_write_sim
+ * runs the same encoder against OpenSSL in the host checks.
+ */
+static void csr_benchmark(void)
+{
+    static uint8_t request[512];
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    const csr_subject_t subject = { "psoc-edge-demo", "TESA", "TH", "0001" };
+    signing_key_t key;
+    uint64_t cycles = 0;
+    uint32_t mean;
+    uint32_t stack;
+    uint32_t start;
+    size_t der_len = 0;
+    size_t pem_len = 0;
+    psa_status_t status;
+    bool full = false;
+
+    status = csr_self_test();
+    if (status == PSA_SUCCESS)
+    {
+        status = signing_key_generate(&config, &key);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("CSR self-test / key generation failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+
+    for (uint32_t r = 0; (status == PSA_SUCCESS) && (r < CSR_BENCH_ROUNDS); r++)
+    {
+        start = cycle_counter_read();
+        status = csr_write_buffer(&key, &subject, CSR_FORMAT_DER, request, sizeof(request), &der_len);
+        cycles += cycle_counter_read() - start;
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("CSR generation failed (%ld)\r\n\n", (long)status);
+        signing_key_destroy(&key);
+        return;
+    }
+    stack = csr_bench_stack(&key, &subject, request, sizeof(request), &full);
+
+    mean = (uint32_t)(cycles / CSR_BENCH_ROUNDS);
+    LOG_PRINT("PKCS#10 CSR, ECDSA P-256, streaming DER writer (self-test passed):\r\n");
+    LOG_PRINT("  %lu byte request, %lu cycles (%lu/s)\r\n", (unsigned long)der_len, (unsigned long)mean,
+              (unsigned long)(SystemCoreClock / (mean + 1U)));
+    LOG_PRINT("  stack %s%lu bytes, DER writer state %lu bytes, no request buffer\r\n",
+              full ? ">= " : "", (unsigned long)stack, (unsigned long)sizeof(der_writer_t));
+    LOG_PRINT("  PEM follows, verify with: openssl req -in csr.pem -noout -verify -text\r\n");
+    status = csr_write(&key, &subject, CSR_FORMAT_PEM, csr_bench_console, NULL, &pem_len);
+    LOG_PRINT("  %lu PEM bytes (%ld)\r\n\n", (unsigned long)pem_len, (long)status);
+
+    signing_key_destroy(&key);
+}
+
+/**
+ * @brief Progress callback of the image verification: count chunks and let
+ *        the caller serve M55 requests
+ */
+static void image_verify_progress(void *arg, uint32_t done, uint32_t total)
+{
+    (void)done;
+    (void)total;
+    (*(uint32_t *)arg)++;
+    if (bench_serve != NULL)
+    {
+        bench_serve();
+    }
+}
+
+/**
+ * @brief Verify a staged image and the CM55 image in external flash
+ *
+ * A MCUboot image (header, IMAGE_DEMO_SIZE of image, SHA-256 and DER
+ * ECDSA P-256 TLVs) is staged in RAM, signed with a fresh key and verified
+ * through the memory-mapped backend, once intact and once with one byte
+ * flipped. The CM55 slot is then checked in place (hash TLV only, the
+ * signing key lives with the bootloader).
+ *
+ * Both builds run it after the CM55 is started: in the bare-metal build
+ * the progress callback keeps the relay served through bench_serve, in
+ * the RTOS build the BSP relay threads do.
+ */
+static void image_verify_demo(void)
+{
+    static uint8_t staged[CYBSP_MCUBOOT_HEADER_SIZE + IMAGE_DEMO_SIZE + 128U];
+    static image_verify_t verifier;
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    image_flash_t flash;
+    image_verify_info_t info;
+    signing_key_t key;
+    size_t signature_len = 0;
+    size_t der_len = 0;
+    uint32_t pos = CYBSP_MCUBOOT_HEADER_SIZE + IMAGE_DEMO_SIZE;
+    uint32_t chunks = 0;
+    uint32_t lcg = 11U;
+    uint32_t cycles;
+    uint32_t start;
+    psa_status_t status;
+    psa_status_t tampered;
+
+    /* struct image_header: magic, load address, header size, image size, version 1.2.3+4 */
+    memset(staged, 0, sizeof(staged));
+    staged[0] = 0x3D;
+    staged[1] = 0xB8;
+    staged[2] = 0xF3;
+    staged[3] = 0x96;
+    staged[8] = (uint8_t)CYBSP_MCUBOOT_HEADER_SIZE;
+    staged[9] = (uint8_t)(CYBSP_MCUBOOT_HEADER_SIZE >> 8);
+    staged[12] = (uint8_t)IMAGE_DEMO_SIZE;
+    staged[13] = (uint8_t)(IMAGE_DEMO_SIZE >> 8);
+    staged[20] = 1U;
+    staged[21] = 2U;
+    staged[22] = 3U;
+    staged[24] = 4U;
+    for (uint32_t i = CYBSP_MCUBOOT_HEADER_SIZE; i < pos; i++)
+    {
+        lcg = (lcg * 1103515245UL) + 12345UL;
+        staged[i] = (uint8_t)(lcg >> 16);
+    }
+
+    /* TLV area: info, SHA-256, ECDSA signature (DER) */
+    status = crypto_dispatch_sha256(staged, pos, digest);
+    if (status == PSA_SUCCESS)
+    {
+        status = signing_key_generate(&config, &key);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Image verification: setup failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+    status = psa_sign_hash(key.key_id, key.alg, digest, sizeof(digest),
+                           signature, sizeof(signature), &signature_len);
+    if (status == PSA_SUCCESS)
+    {
+        status = ecdsa_raw_to_der(signature, signature_len, &staged[pos + 44U],
+                                  sizeof(staged) - pos - 44U, &der_len);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("Image verification: staging failed (%ld)\r\n\n", (long)status);
+        signing_key_destroy(&key);
+        return;
+    }
+    staged[pos] = 0x07;
+    staged[pos + 1U] = 0x69;
+    staged[pos + 2U] = (uint8_t)(44U + der_len);
+    staged[pos + 4U] = 0x10;
+    staged[pos + 6U] = SHA256_SW_DIGEST_SIZE;
+    memcpy(&staged[pos + 8U], digest, sizeof(digest));
+    staged[pos + 40U] = 0x22;
+    staged[pos + 42U] = (uint8_t)der_len;
+
+    image_flash_init_mapped(&flash, staged, sizeof(staged));
+    image_verify_init(&verifier, &flash, image_verify_progress, &chunks);
+    start = cycle_counter_read();
+    status = image_verify_mcuboot(&verifier, key.key_id, &info);
+    cycles = cycle_counter_read() - start;
+
+    image_verify_init(&verifier, &flash, NULL, NULL);
+    staged[CYBSP_MCUBOOT_HEADER_SIZE + 100U] ^= 0x01U;
+    tampered = image_verify_mcuboot(&verifier, key.key_id, NULL);
+    signing_key_destroy(&key);
+
+    LOG_PRINT("Image verification, staged %lu B image in %lu B chunks:\r\n",
+              (unsigned long)pos, (unsigned long)IMAGE_VERIFY_CHUNK_SIZE);
+    LOG_PRINT("  intact: %s in %lu cycles, %lu progress calls; tampered: %s\r\n",
+              (status == PSA_SUCCESS) ? "valid" : "INVALID", (unsigned long)cycles, (unsigned long)chunks,
+              (tampered == PSA_ERROR_INVALID_SIGNATURE) ? "rejected" : "NOT REJECTED");
+
+    /* CM55 image in place, through the XIP window */
+    image_flash_init_mapped(&flash, (const void *)CYMEM_CM33_0_m55_nvm_START, CYMEM_CM33_0_m55_nvm_SIZE);
+    image_verify_init(&verifier, &flash, image_verify_progress, &chunks);
+    start = cycle_counter_read();
+    status = image_verify_mcuboot(&verifier, PSA_KEY_ID_NULL, &info);
+    cycles = cycle_counter_read() - start;
+    if (status == PSA_ERROR_INVALID_ARGUMENT)
+    {
+        LOG_PRINT("  CM55 slot: no MCUboot image\r\n\n");
+    }
+    else if ((status != PSA_SUCCESS) && (status != PSA_ERROR_INVALID_SIGNATURE))
+    {
+        LOG_PRINT("  CM55 slot: read failed (%ld)\r\n\n", (long)status);
+    }
+    else
+    {
+        LOG_PRINT("  CM55 image %u.%u.%u, %lu B: ", (unsigned int)info.version_major,
+                  (unsigned int)info.version_minor, (unsigned int)info.version_revision,
+                  (unsigned long)info.hashed_len);
+        LOG_PRINT("hash %s, %lu cycles, %lu B per kcycle\r\n\n",
+                  (status == PSA_SUCCESS) ? "matches" : "MISMATCH", (unsigned long)cycles,
+                  (unsigned long)(((uint64_t)info.hashed_len * 1000U) / (cycles + 1U)));
+    }
+}
+
+/**
+ * @brief Compare HSS/LMS and ECDSA P-256 verification time
+ *
+ * Both go through signing_verify(): the built-in HSS vector with its
+ * public key imported as a verify-only key (on this core), and an ECDSA
+ * P-256 signature through TF-M, SIGNING_BENCH_RUNS times each.
+ */
+static void lms_verify_compare(void)
+{
+    const lms_vector_t *v = &lms_test_vector;
+    const signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    const signing_key_config_t hss_config =
+    {
+        SIGNING_SCHEME_HSS_SHA256, SIGNING_NONCE_RANDOM, PSA_KEY_LIFETIME_VOLATILE
+    };
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    signing_key_t key;
+    uint32_t lms_mean;
+    uint32_t ecdsa_mean;
+    uint32_t stddev;
+    psa_status_t status;
+
+    status = lms_self_test();
+    LOG_PRINT("RFC 8554 HSS self test: %s\r\n", (status == PSA_SUCCESS) ? "OK" : "FAIL");
+    if (status != PSA_SUCCESS)
+    {
+        return;
+    }
+
+    status = signing_key_import(&hss_config, v->public_key, v->public_key_len, &key);
+    for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < SIGNING_BENCH_RUNS); i++)
+    {
+        status = signing_verify(&key, v->message, v->message_len, v->signature, v->signature_len);
+    }
+    signing_latency_summary(&key.verify_latency, &lms_mean, &stddev);
+    signing_key_destroy(&key);
+    if (status != PSA_SUCCESS)
+    {
+        LOG_PRINT("HSS verify through signing_verify() failed (%ld)\r\n\n", (long)status);
+        return;
+    }
+
+    status = signing_key_generate(&config, &key);
+    if (status == PSA_SUCCESS)
+    {
+        status = signing_sign(&key, v->message, v->message_len,
+                              signature, sizeof(signature), &signature_len);
+    }
+    for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < SIGNING_BENCH_RUNS); i++)
+    {
+        status = signing_verify(&key, v->message, v->message_len, signature, signature_len);
+    }
+    signing_latency_summary(&key.verify_latency, &ecdsa_mean, &stddev);
+    signing_key_destroy(&key);
+
+    LOG_PRINT("Verify (mean cycles / us): HSS H5/W4 %lu / %lu",
+              (unsigned long)lms_mean, (unsigned long)cycle_counter_to_us(lms_mean));
+    LOG_PRINT(", ECDSA P-256 %lu / %lu\r\n\n",
+              (unsigned long)ecdsa_mean, (unsigned long)cycle_counter_to_us(ecdsa_mean));
+}
+
+
+void app_benchmarks_run(void)
+{
+    signing_latency_compare();
+    signing_cost_table();
+    log_token_benchmark();
+    lms_verify_compare();
+    signing_prefix_benchmark();
+    signing_iov_benchmark();
+    verify_cache_replay();
+    cose_sign1_benchmark();
+    jws_token_benchmark();
+    ecdsa_der_benchmark();
+#if (APP_PS_BENCHMARKS)
+    audit_log_benchmark();
+    trust_store_benchmark();
+#endif
+    x509_chain_benchmark();
+    csr_benchmark();
+}
+
+void app_benchmarks_run_cm55(app_benchmarks_serve_t serve)
+{
+    bench_serve = serve;
+    image_verify_demo();
+    bench_serve = NULL;
+}
+
+#endif /* (APP_BENCHMARKS) */
+
+/* [] END OF FILE */
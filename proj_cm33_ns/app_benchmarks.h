@@ -0,0 +1,90 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Boot benchmarks
+ * Purpose : Signing, encoding, storage and verification benchmarks of the
+ *           application modules, run once at boot in a BENCHMARK_BUILD=1
+ *           image. The default image does not contain them.
+ ********************************************************************************
+ * @file    app_benchmarks.h
+ * @brief   Boot-time benchmarks of the CM33 NS application modules
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef APP_BENCHMARKS_H
+#define APP_BENCHMARKS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Run the signing, encoding and storage benchmarks at boot (BENCHMARK_BUILD=1) */
+#ifndef APP_BENCHMARKS
+#define APP_BENCHMARKS                (0)
+#endif
+
+/**
+ * @brief Also run the audit log and trust store benchmarks, which write
+ *        to Protected Storage (BENCHMARK_BUILD=1 PS_BENCHMARK_BUILD=1)
+ */
+#ifndef APP_PS_BENCHMARKS
+#define APP_PS_BENCHMARKS             (0)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Called between steps of a long benchmark, so the caller can keep
+ *        serving M55 requests
+ */
+typedef void (*app_benchmarks_serve_t)(void);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Run the benchmarks that use this core and TF-M only
+ *
+ * Call before the CM55 is started. With APP_PS_BENCHMARKS this includes
+ * the audit log and trust store benchmarks, which rewrite their Protected
+ * Storage assets.
+ */
+void app_benchmarks_run(void);
+
+/**
+ * @brief Run the benchmarks that need the CM55 image (image verification)
+ *
+ * Call after the CM55 is started.
+ *
+ * @param[in] serve  Called between image chunks, or NULL if M55 requests
+ *                   are served elsewhere (RTOS build)
+ */
+void app_benchmarks_run_cm55(app_benchmarks_serve_t serve);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* APP_BENCHMARKS_H */
+/* [] END OF FILE */
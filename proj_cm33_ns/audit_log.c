@@ -0,0 +1,618 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Security audit log
+ * Purpose : Entry chaining, segment commits, checkpoints, recovery,
+ *           verification and export.
+ ********************************************************************************
+ * @file    audit_log.c
+ * @brief   Hash-chained, batch-committed audit log with signed checkpoints
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <string.h>
+
+#include "audit_log.h"
+#include "crypto_dispatch.h"
+#include "cycle_counter.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Record magics, "ALSG" and "ALCP" as little-endian words */
+#define AUDIT_LOG_SEGMENT_MAGIC       (0x47534C41UL)
+#define AUDIT_LOG_CHECKPOINT_MAGIC    (0x50434C41UL)
+
+/** @brief Entry field offsets */
+#define AUDIT_LOG_ENTRY_TIME          (4U)
+#define AUDIT_LOG_ENTRY_EVENT         (8U)
+#define AUDIT_LOG_ENTRY_LEN           (10U)
+#define AUDIT_LOG_ENTRY_DATA          (12U)
+#define AUDIT_LOG_ENTRY_PREV          (32U)
+
+/** @brief Segment and checkpoint field offsets */
+#define AUDIT_LOG_HDR_BATCH           (4U)
+#define AUDIT_LOG_HDR_SEQ             (8U)
+#define AUDIT_LOG_HDR_COUNT           (12U)
+#define AUDIT_LOG_CP_ENTRIES          (4U)
+#define AUDIT_LOG_CP_BATCH            (8U)
+#define AUDIT_LOG_CP_HEAD             (16U)
+
+/** @brief Uncompressed P-256 public key size */
+#define AUDIT_LOG_PUBLIC_KEY_SIZE     (65U)
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void audit_log_put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t audit_log_get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static psa_storage_uid_t audit_log_segment_uid(const audit_log_t *log, uint32_t batch)
+{
+    return log->config.uid_base + (batch % AUDIT_LOG_SEGMENTS);
+}
+
+static psa_storage_uid_t audit_log_checkpoint_uid(const audit_log_t *log)
+{
+    return log->config.uid_base + AUDIT_LOG_SEGMENTS;
+}
+
+static void audit_log_reset(audit_log_t *log)
+{
+    memset(log->head, 0, sizeof(log->head));
+    log->next_seq = 0;
+    log->next_batch = 0;
+    log->pending = 0;
+    log->oldest_time = 0;
+    log->batches_unsigned = 0;
+    log->exported_batch = 0;
+}
+
+/**
+ * @brief Whether the next commit's ring slot still holds a batch that no
+ *        export has passed on
+ */
+static bool audit_log_slot_unexported(const audit_log_t *log)
+{
+    return (log->next_batch >= AUDIT_LOG_SEGMENTS) &&
+           ((log->next_batch - AUDIT_LOG_SEGMENTS) >= log->exported_batch);
+}
+
+/**
+ * @brief Whether the next commit may replace its ring slot
+ *
+ * The slot holds batch next_batch - AUDIT_LOG_SEGMENTS. It may be replaced
+ * once an export has passed it on, or once the checkpoint covers it, which
+ * is when fewer than AUDIT_LOG_SEGMENTS batches are unsigned
+ * (batches_unsigned equals next_batch while there is no checkpoint).
+ */
+static bool audit_log_slot_free(const audit_log_t *log)
+{
+    return !audit_log_slot_unexported(log) || (log->batches_unsigned < AUDIT_LOG_SEGMENTS);
+}
+
+/**
+ * @brief Check one entry against the chain and advance it
+ *
+ * @param[in]     entry     Entry bytes
+ * @param[in,out] seq       Expected sequence number
+ * @param[in,out] head      Hash of the previous entry, then of this one
+ * @param[in]     anchored  false to accept any previous hash (oldest stored entry)
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE if the entry does not
+ *         link, or the hash error
+ */
+static psa_status_t audit_log_link(const uint8_t *entry, uint32_t *seq, uint8_t head[SHA256_SW_DIGEST_SIZE],
+                                   bool anchored)
+{
+    psa_status_t status;
+
+    if ((audit_log_get_le32(entry) != *seq) || (entry[AUDIT_LOG_ENTRY_LEN] > AUDIT_LOG_DATA_MAX) ||
+        (anchored && (memcmp(&entry[AUDIT_LOG_ENTRY_PREV], head, SHA256_SW_DIGEST_SIZE) != 0)))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    status = crypto_dispatch_sha256(entry, AUDIT_LOG_ENTRY_SIZE, head);
+    if (status == PSA_SUCCESS)
+    {
+        (*seq)++;
+    }
+    return status;
+}
+
+/**
+ * @brief Batch numbers of the oldest and newest stored segment
+ *
+ * @return PSA_SUCCESS with *count segments found, or a storage error
+ */
+static psa_status_t audit_log_scan(audit_log_t *log, uint32_t *oldest, uint32_t *newest, uint32_t *count)
+{
+    uint8_t hdr[AUDIT_LOG_SEGMENT_HEADER_SIZE];
+
+    *count = 0;
+    for (uint32_t s = 0; s < AUDIT_LOG_SEGMENTS; s++)
+    {
+        size_t len = 0;
+        uint32_t batch;
+        psa_status_t status = psa_ps_get(log->config.uid_base + s, 0U, sizeof(hdr), hdr, &len);
+
+        if (status == PSA_ERROR_DOES_NOT_EXIST)
+        {
+            continue;
+        }
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        batch = audit_log_get_le32(&hdr[AUDIT_LOG_HDR_BATCH]);
+        if ((len != sizeof(hdr)) || (audit_log_get_le32(hdr) != AUDIT_LOG_SEGMENT_MAGIC) ||
+            ((batch % AUDIT_LOG_SEGMENTS) != s))
+        {
+            return PSA_ERROR_INVALID_SIGNATURE;
+        }
+        if ((*count == 0U) || (batch < *oldest))
+        {
+            *oldest = batch;
+        }
+        if ((*count == 0U) || (batch > *newest))
+        {
+            *newest = batch;
+        }
+        (*count)++;
+    }
+    return PSA_SUCCESS;
+}
+
+/**
+ * @brief Read segment @p batch into log->segment
+ *
+ * @return PSA_SUCCESS with *count entries, PSA_ERROR_INVALID_SIGNATURE if the
+ *         asset is not that segment, or a storage error
+ */
+static psa_status_t audit_log_read_segment(audit_log_t *log, uint32_t batch, uint32_t *count)
+{
+    size_t len = 0;
+    psa_status_t status;
+
+    status = psa_ps_get(audit_log_segment_uid(log, batch), 0U, sizeof(log->segment), log->segment, &len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    *count = (len >= AUDIT_LOG_SEGMENT_HEADER_SIZE) ? audit_log_get_le32(&log->segment[AUDIT_LOG_HDR_COUNT]) : 0U;
+    if ((len < AUDIT_LOG_SEGMENT_HEADER_SIZE) || (audit_log_get_le32(log->segment) != AUDIT_LOG_SEGMENT_MAGIC) ||
+        (audit_log_get_le32(&log->segment[AUDIT_LOG_HDR_BATCH]) != batch) ||
+        (*count == 0U) || (*count > AUDIT_LOG_BATCH_MAX) || (len != AUDIT_LOG_SEGMENT_SIZE(*count)))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return PSA_SUCCESS;
+}
+
+/** @brief Read the checkpoint; PSA_ERROR_DOES_NOT_EXIST if there is none */
+static psa_status_t audit_log_read_checkpoint(audit_log_t *log, uint8_t cp[AUDIT_LOG_CHECKPOINT_SIZE])
+{
+    size_t len = 0;
+    psa_status_t status;
+
+    status = psa_ps_get(audit_log_checkpoint_uid(log), 0U, AUDIT_LOG_CHECKPOINT_SIZE, cp, &len);
+    if ((status == PSA_SUCCESS) &&
+        ((len != AUDIT_LOG_CHECKPOINT_SIZE) || (audit_log_get_le32(cp) != AUDIT_LOG_CHECKPOINT_MAGIC)))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return status;
+}
+
+/** @brief Sign the chain head; all entries must be committed */
+static psa_status_t audit_log_sign(audit_log_t *log)
+{
+    uint8_t cp[AUDIT_LOG_CHECKPOINT_SIZE];
+    size_t signature_len = 0;
+    uint32_t start = cycle_counter_read();
+    psa_status_t status;
+
+    memset(cp, 0, AUDIT_LOG_CHECKPOINT_SIGNED);
+    audit_log_put_le32(cp, AUDIT_LOG_CHECKPOINT_MAGIC);
+    audit_log_put_le32(&cp[AUDIT_LOG_CP_ENTRIES], log->next_seq);
+    audit_log_put_le32(&cp[AUDIT_LOG_CP_BATCH], log->next_batch - 1U);
+    memcpy(&cp[AUDIT_LOG_CP_HEAD], log->head, SHA256_SW_DIGEST_SIZE);
+
+    status = signing_sign(log->config.key, cp, AUDIT_LOG_CHECKPOINT_SIGNED, &cp[AUDIT_LOG_CHECKPOINT_SIGNED],
+                          AUDIT_LOG_CHECKPOINT_SIZE - AUDIT_LOG_CHECKPOINT_SIGNED, &signature_len);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_ps_set(audit_log_checkpoint_uid(log), sizeof(cp), cp, PSA_STORAGE_FLAG_NONE);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        log->batches_unsigned = 0;
+        log->stats.checkpoints++;
+        log->stats.checkpoint_cycles += cycle_counter_read() - start;
+    }
+    return status;
+}
+
+/** @brief Write the RAM segment, then sign if a checkpoint is due */
+static psa_status_t audit_log_commit(audit_log_t *log)
+{
+    bool dropped;
+    uint32_t start;
+    psa_status_t status;
+
+    if (log->pending == 0U)
+    {
+        return PSA_SUCCESS;
+    }
+
+    memset(log->segment, 0, AUDIT_LOG_SEGMENT_HEADER_SIZE);
+    audit_log_put_le32(log->segment, AUDIT_LOG_SEGMENT_MAGIC);
+    audit_log_put_le32(&log->segment[AUDIT_LOG_HDR_BATCH], log->next_batch);
+    audit_log_put_le32(&log->segment[AUDIT_LOG_HDR_SEQ], log->next_seq - log->pending);
+    audit_log_put_le32(&log->segment[AUDIT_LOG_HDR_COUNT], log->pending);
+
+    /* Appends refuse to start a segment whose slot is not free, so this only sees free slots */
+    dropped = audit_log_slot_unexported(log);
+    start = cycle_counter_read();
+    status = psa_ps_set(audit_log_segment_uid(log, log->next_batch), AUDIT_LOG_SEGMENT_SIZE(log->pending),
+                        log->segment, PSA_STORAGE_FLAG_NONE);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    log->stats.commit_cycles += cycle_counter_read() - start;
+    log->stats.commits++;
+    if (dropped)
+    {
+        log->stats.segments_dropped++;
+    }
+    log->next_batch++;
+    log->pending = 0;
+    log->batches_unsigned++;
+
+    if ((log->config.checkpoint_batches != 0U) && (log->batches_unsigned >= log->config.checkpoint_batches))
+    {
+        status = audit_log_sign(log);
+    }
+    return status;
+}
+
+psa_status_t audit_log_open(audit_log_t *log, const audit_log_config_t *config)
+{
+    uint8_t cp[AUDIT_LOG_CHECKPOINT_SIZE];
+    uint32_t oldest = 0;
+    uint32_t newest = 0;
+    uint32_t found = 0;
+    uint32_t count = 0;
+    uint32_t seq;
+    psa_status_t status;
+
+    if ((config->key == NULL) || (config->key->scheme != SIGNING_SCHEME_ECDSA_P256) ||
+        (config->batch_entries == 0U) || (config->batch_entries > AUDIT_LOG_BATCH_MAX))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    log->config = *config;
+    memset(&log->stats, 0, sizeof(log->stats));
+    audit_log_reset(log);
+
+    status = audit_log_scan(log, &oldest, &newest, &found);
+    if ((status != PSA_SUCCESS) || (found == 0U))
+    {
+        return (status == PSA_ERROR_INVALID_SIGNATURE) ? PSA_ERROR_CORRUPTION_DETECTED : status;
+    }
+
+    /* Resume after the newest segment; its first link points at older data */
+    status = audit_log_read_segment(log, newest, &count);
+    if (status != PSA_SUCCESS)
+    {
+        return (status == PSA_ERROR_INVALID_SIGNATURE) ? PSA_ERROR_CORRUPTION_DETECTED : status;
+    }
+    seq = audit_log_get_le32(&log->segment[AUDIT_LOG_HDR_SEQ]);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        status = audit_log_link(&log->segment[AUDIT_LOG_SEGMENT_SIZE(i)], &seq, log->head, i != 0U);
+        if (status != PSA_SUCCESS)
+        {
+            audit_log_reset(log);
+            return (status == PSA_ERROR_INVALID_SIGNATURE) ? PSA_ERROR_CORRUPTION_DETECTED : status;
+        }
+    }
+    log->next_seq = seq;
+    log->next_batch = newest + 1U;
+    log->batches_unsigned = log->next_batch;
+
+    status = audit_log_read_checkpoint(log, cp);
+    if (status == PSA_SUCCESS)
+    {
+        log->batches_unsigned = newest - audit_log_get_le32(&cp[AUDIT_LOG_CP_BATCH]);
+    }
+    return ((status == PSA_SUCCESS) || (status == PSA_ERROR_DOES_NOT_EXIST)) ? PSA_SUCCESS : status;
+}
+
+psa_status_t audit_log_append(audit_log_t *log, uint32_t time, uint16_t event,
+                              const uint8_t *data, size_t len, uint32_t flags)
+{
+    uint8_t *entry;
+    psa_status_t status;
+
+    if ((len > AUDIT_LOG_DATA_MAX) || ((data == NULL) && (len != 0U)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* A previous commit failed and the segment is still full */
+    if (log->pending >= log->config.batch_entries)
+    {
+        status = audit_log_commit(log);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+    }
+    if (log->pending == 0U)
+    {
+        /* The stored log is never overwritten before an export or the checkpoint covers it */
+        if (!audit_log_slot_free(log))
+        {
+            log->stats.refused++;
+            return PSA_ERROR_INSUFFICIENT_STORAGE;
+        }
+        log->oldest_time = time;
+    }
+
+    entry = &log->segment[AUDIT_LOG_SEGMENT_SIZE(log->pending)];
+    memset(entry, 0, AUDIT_LOG_ENTRY_SIZE);
+    audit_log_put_le32(entry, log->next_seq);
+    audit_log_put_le32(&entry[AUDIT_LOG_ENTRY_TIME], time);
+    entry[AUDIT_LOG_ENTRY_EVENT] = (uint8_t)event;
+    entry[AUDIT_LOG_ENTRY_EVENT + 1U] = (uint8_t)(event >> 8);
+    entry[AUDIT_LOG_ENTRY_LEN] = (uint8_t)len;
+    if (len != 0U)
+    {
+        memcpy(&entry[AUDIT_LOG_ENTRY_DATA], data, len);
+    }
+    memcpy(&entry[AUDIT_LOG_ENTRY_PREV], log->head, SHA256_SW_DIGEST_SIZE);
+    status = crypto_dispatch_sha256(entry, AUDIT_LOG_ENTRY_SIZE, log->head);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    log->next_seq++;
+    log->pending++;
+    log->stats.entries++;
+
+    if (((flags & AUDIT_LOG_URGENT) != 0U) || (log->pending >= log->config.batch_entries))
+    {
+        return audit_log_commit(log);
+    }
+    return audit_log_poll(log, time);
+}
+
+psa_status_t audit_log_poll(audit_log_t *log, uint32_t now)
+{
+    if ((log->pending != 0U) && (log->config.max_age != 0U) && ((now - log->oldest_time) >= log->config.max_age))
+    {
+        return audit_log_commit(log);
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t audit_log_flush(audit_log_t *log)
+{
+    return audit_log_commit(log);
+}
+
+psa_status_t audit_log_checkpoint(audit_log_t *log)
+{
+    psa_status_t status = audit_log_commit(log);
+
+    /* The commit may have signed already */
+    if ((status == PSA_SUCCESS) && (log->batches_unsigned != 0U))
+    {
+        status = audit_log_sign(log);
+    }
+    return status;
+}
+
+psa_status_t audit_log_verify(audit_log_t *log, audit_log_verify_info_t *info)
+{
+    uint8_t cp[AUDIT_LOG_CHECKPOINT_SIZE];
+    uint8_t head[SHA256_SW_DIGEST_SIZE];
+    uint32_t oldest = 0;
+    uint32_t newest = 0;
+    uint32_t found = 0;
+    uint32_t first_seq = 0;
+    uint32_t seq = 0;
+    uint32_t cp_entries = 0;
+    bool cp_present;
+    bool cp_matched = false;
+    psa_status_t status;
+
+    status = audit_log_commit(log);
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_scan(log, &oldest, &newest, &found);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    status = audit_log_read_checkpoint(log, cp);
+    if ((status != PSA_SUCCESS) && (status != PSA_ERROR_DOES_NOT_EXIST))
+    {
+        return status;
+    }
+    cp_present = (status == PSA_SUCCESS);
+    if (cp_present)
+    {
+        cp_entries = audit_log_get_le32(&cp[AUDIT_LOG_CP_ENTRIES]);
+    }
+
+    /* Segments must be consecutive batches with consecutive entries */
+    memset(head, 0, sizeof(head));
+    for (uint32_t b = oldest; (found != 0U) && (b <= newest); b++)
+    {
+        uint32_t count = 0;
+
+        status = audit_log_read_segment(log, b, &count);
+        if (status == PSA_ERROR_DOES_NOT_EXIST)
+        {
+            status = PSA_ERROR_INVALID_SIGNATURE;
+        }
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        if (b == oldest)
+        {
+            first_seq = audit_log_get_le32(&log->segment[AUDIT_LOG_HDR_SEQ]);
+            seq = first_seq;
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            /* The very first entry links to all zeros; an older one to data no longer stored */
+            status = audit_log_link(&log->segment[AUDIT_LOG_SEGMENT_SIZE(i)], &seq, head,
+                                    (seq != first_seq) || (first_seq == 0U));
+            if (status != PSA_SUCCESS)
+            {
+                return status;
+            }
+            if (cp_present && (seq == cp_entries) &&
+                (memcmp(&cp[AUDIT_LOG_CP_HEAD], head, sizeof(head)) == 0))
+            {
+                cp_matched = true;
+            }
+        }
+    }
+
+    /* The stored chain must end where this log is, and the checkpoint must not be ahead of it */
+    if ((seq != log->next_seq) || (memcmp(head, log->head, sizeof(head)) != 0) ||
+        (cp_present && (cp_entries > seq)) ||
+        (cp_present && (cp_entries > first_seq) && !cp_matched))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    if (cp_matched)
+    {
+        status = signing_verify(log->config.key, cp, AUDIT_LOG_CHECKPOINT_SIGNED,
+                                &cp[AUDIT_LOG_CHECKPOINT_SIGNED], AUDIT_LOG_CHECKPOINT_SIZE - AUDIT_LOG_CHECKPOINT_SIGNED);
+        if (status != PSA_SUCCESS)
+        {
+            return PSA_ERROR_INVALID_SIGNATURE;
+        }
+    }
+
+    if (info != NULL)
+    {
+        info->first_seq = first_seq;
+        info->entries = seq - first_seq;
+        info->signed_entries = cp_matched ? (cp_entries - first_seq) : 0U;
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t audit_log_export(audit_log_t *log, audit_log_export_fn_t fn, void *arg)
+{
+    uint8_t cp[AUDIT_LOG_CHECKPOINT_SIZE];
+    uint8_t public_key[AUDIT_LOG_PUBLIC_KEY_SIZE];
+    size_t public_key_len = 0;
+    uint32_t oldest = 0;
+    uint32_t newest = 0;
+    uint32_t found = 0;
+    psa_status_t status;
+
+    status = audit_log_commit(log);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_export_public_key(log->config.key->key_id, public_key, sizeof(public_key), &public_key_len);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        fn(arg, AUDIT_LOG_RECORD_PUBLIC_KEY, public_key, public_key_len);
+        status = audit_log_scan(log, &oldest, &newest, &found);
+    }
+
+    /* Missing or foreign segments are passed over; the verifier reports the gap */
+    for (uint32_t b = oldest; (status == PSA_SUCCESS) && (found != 0U) && (b <= newest); b++)
+    {
+        uint32_t count = 0;
+
+        status = audit_log_read_segment(log, b, &count);
+        if (status == PSA_SUCCESS)
+        {
+            fn(arg, AUDIT_LOG_RECORD_SEGMENT, log->segment, AUDIT_LOG_SEGMENT_SIZE(count));
+        }
+        else if ((status == PSA_ERROR_DOES_NOT_EXIST) || (status == PSA_ERROR_INVALID_SIGNATURE))
+        {
+            status = PSA_SUCCESS;
+        }
+    }
+    if (status == PSA_SUCCESS)
+    {
+        /* Every stored batch has been handed over; their slots may be reused */
+        log->exported_batch = log->next_batch;
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = audit_log_read_checkpoint(log, cp);
+        if (status == PSA_SUCCESS)
+        {
+            fn(arg, AUDIT_LOG_RECORD_CHECKPOINT, cp, sizeof(cp));
+        }
+        else if (status == PSA_ERROR_DOES_NOT_EXIST)
+        {
+            status = PSA_SUCCESS;
+        }
+    }
+    return status;
+}
+
+psa_status_t audit_log_erase(audit_log_t *log)
+{
+    psa_status_t result = PSA_SUCCESS;
+
+    for (uint32_t s = 0; s <= AUDIT_LOG_SEGMENTS; s++)
+    {
+        psa_status_t status = psa_ps_remove(log->config.uid_base + s);
+
+        if ((status != PSA_SUCCESS) && (status != PSA_ERROR_DOES_NOT_EXIST))
+        {
+            result = status;
+        }
+    }
+    audit_log_reset(log);
+    return result;
+}
+
+/* [] END OF FILE */
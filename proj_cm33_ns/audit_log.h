@@ -0,0 +1,268 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Security audit log
+ * Purpose : Append-only, tamper-evident log of security events in TF-M
+ *           Protected Storage, without a signature and a storage write per
+ *           event.
+ * Design  : Every entry carries the SHA-256 of its predecessor, so the log
+ *           is a hash chain; changing, dropping or reordering an entry
+ *           breaks every link after it. Entries are built in a RAM segment
+ *           and the segment is written with one psa_ps_set() when
+ *           batch_entries are buffered, when the oldest has waited max_age
+ *           or when an entry is appended with AUDIT_LOG_URGENT. A power
+ *           failure therefore loses at most the uncommitted segment: fewer
+ *           than batch_entries entries, none older than max_age (provided
+ *           audit_log_poll() runs at that rate). psa_ps_set() replaces an
+ *           asset atomically, so a segment is either old or new, never torn.
+ *
+ *           Every checkpoint_batches commits the chain head (entry count
+ *           and hash of the last entry) is signed and stored as its own
+ *           asset; entries up to it are then authenticated, later ones are
+ *           linked but not yet signed. Segments form a ring of
+ *           AUDIT_LOG_SEGMENTS assets from uid_base on, the checkpoint sits
+ *           at uid_base + AUDIT_LOG_SEGMENTS. audit_log_open() resumes the
+ *           chain from the newest segment after a reset.
+ *
+ *           Retention: storage holds the newest AUDIT_LOG_SEGMENTS commits,
+ *           i.e. between AUDIT_LOG_SEGMENTS entries (urgent or max-age
+ *           commits of one entry each) and AUDIT_LOG_SEGMENTS *
+ *           batch_entries. A segment is only replaced once
+ *           audit_log_export() has passed it on or the checkpoint covers
+ *           it. Until then audit_log_append() refuses to start a new
+ *           segment with PSA_ERROR_INSUFFICIENT_STORAGE and counts the
+ *           refusal; the event is not logged, and the caller exports or
+ *           checkpoints and appends again. A segment replaced under the
+ *           checkpoint alone is lost to the host and counted in
+ *           segments_dropped; its entries stay signed, and first_seq of
+ *           audit_log_verify() and audit_verify.py show where the stored log
+ *           starts. checkpoint_batches of 1..AUDIT_LOG_SEGMENTS therefore
+ *           keeps the ring turning, with every loss counted; 0 or more
+ *           than AUDIT_LOG_SEGMENTS stops the log when it is full until it
+ *           is exported. The export mark lives in RAM: after a reset, the
+ *           ring is only reused under the stored checkpoint or after a new
+ *           export.
+ *
+ *           Layouts (little-endian):
+ *             entry       seq (4) | time (4) | event (2) | len (1) | 0 (1)
+ *                         | data (20) | prev hash (32)
+ *             segment     "ALSG" | batch (4) | first seq (4) | count (2)
+ *                         | 0 (2) | count entries
+ *             checkpoint  "ALCP" | entries (4) | batch (4) | 0 (4)
+ *                         | head hash (32) | signature (64)
+ *           The signature is ECDSA P-256 over the first 48 bytes of the
+ *           checkpoint. tools/audit_verify.py checks an exported log on a
+ *           host.
+ ********************************************************************************
+ * @file    audit_log.h
+ * @brief   Hash-chained, batch-committed audit log with signed checkpoints
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef AUDIT_LOG_H
+#define AUDIT_LOG_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+#include "psa/protected_storage.h"
+#include "sha256_sw.h"
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest batch; sets the size of the RAM segment */
+#ifndef AUDIT_LOG_BATCH_MAX
+#define AUDIT_LOG_BATCH_MAX           (16U)
+#endif
+
+/** @brief Segment assets in the ring; the log keeps the newest this many batches (see Retention) */
+#ifndef AUDIT_LOG_SEGMENTS
+#define AUDIT_LOG_SEGMENTS            (4U)
+#endif
+
+/** @brief Event data bytes per entry */
+#define AUDIT_LOG_DATA_MAX            (20U)
+
+/** @brief Record sizes */
+#define AUDIT_LOG_ENTRY_SIZE          (64U)
+#define AUDIT_LOG_SEGMENT_HEADER_SIZE (16U)
+#define AUDIT_LOG_SEGMENT_SIZE(count) (AUDIT_LOG_SEGMENT_HEADER_SIZE + ((count) * AUDIT_LOG_ENTRY_SIZE))
+#define AUDIT_LOG_CHECKPOINT_SIGNED   (48U)
+#define AUDIT_LOG_CHECKPOINT_SIZE     (AUDIT_LOG_CHECKPOINT_SIGNED + 64U)
+
+/** @brief audit_log_append() flag: commit the segment now */
+#define AUDIT_LOG_URGENT              (0x01U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Log configuration */
+typedef struct
+{
+    psa_storage_uid_t  uid_base;            /**< First of AUDIT_LOG_SEGMENTS + 1 PS assets   */
+    signing_key_t     *key;                 /**< ECDSA P-256 checkpoint key                  */
+    uint32_t           batch_entries;       /**< Commit at this many entries, 1..BATCH_MAX   */
+    uint32_t           max_age;             /**< ... or when the oldest is this old (time units of append) */
+    uint32_t           checkpoint_batches;  /**< Sign the head every this many commits; 0: on request */
+} audit_log_config_t;
+
+/** @brief Work done since audit_log_open() */
+typedef struct
+{
+    uint32_t entries;
+    uint32_t commits;
+    uint32_t checkpoints;
+    uint32_t segments_dropped;              /**< Replaced unexported, under the checkpoint */
+    uint32_t refused;                       /**< Appends refused while storage was full    */
+    uint64_t commit_cycles;                 /**< In psa_ps_set() for segments      */
+    uint64_t checkpoint_cycles;             /**< Signing and storing checkpoints   */
+} audit_log_stats_t;
+
+/** @brief Log state and the RAM segment */
+typedef struct
+{
+    audit_log_config_t config;
+    uint8_t            head[SHA256_SW_DIGEST_SIZE];    /**< Hash of the last entry      */
+    uint32_t           next_seq;
+    uint32_t           next_batch;
+    uint32_t           pending;             /**< Uncommitted entries in segment     */
+    uint32_t           oldest_time;         /**< Time of the first of them          */
+    uint32_t           batches_unsigned;    /**< Commits since the last checkpoint  */
+    uint32_t           exported_batch;      /**< Batches below this were exported   */
+    audit_log_stats_t  stats;
+    uint8_t            segment[AUDIT_LOG_SEGMENT_SIZE(AUDIT_LOG_BATCH_MAX)];
+} audit_log_t;
+
+/** @brief Record kinds passed to an audit_log_export_fn_t */
+typedef enum
+{
+    AUDIT_LOG_RECORD_PUBLIC_KEY = 'K',      /**< Uncompressed checkpoint public key */
+    AUDIT_LOG_RECORD_SEGMENT    = 'S',
+    AUDIT_LOG_RECORD_CHECKPOINT = 'C'
+} audit_log_record_t;
+
+/**
+ * @brief Receives the stored log, one record per call
+ *
+ * @param[in] arg   Caller context
+ * @param[in] type  Record kind
+ * @param[in] data  Record bytes in the layouts above
+ * @param[in] len   Length of @p data
+ */
+typedef void (*audit_log_export_fn_t)(void *arg, audit_log_record_t type, const uint8_t *data, size_t len);
+
+/** @brief What audit_log_verify() established */
+typedef struct
+{
+    uint32_t first_seq;         /**< Oldest entry still stored          */
+    uint32_t entries;           /**< Stored entries, all chain-linked   */
+    uint32_t signed_entries;    /**< Entries covered by the checkpoint  */
+} audit_log_verify_info_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Open the log at @p config->uid_base, resuming a stored chain
+ *
+ * @param[out] log     Log; holds one segment of RAM
+ * @param[in]  config  Configuration; the key must stay valid while @p log is used
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT for a bad configuration,
+ *         PSA_ERROR_CORRUPTION_DETECTED if the newest segment does not
+ *         chain, or a Protected Storage error
+ */
+psa_status_t audit_log_open(audit_log_t *log, const audit_log_config_t *config);
+
+/**
+ * @brief Append an event
+ *
+ * The entry is chained and buffered; the segment is committed if it is
+ * full, its oldest entry has reached max_age, or @p flags has
+ * AUDIT_LOG_URGENT. A failed commit keeps the entries buffered and is
+ * retried with the next append. An entry that would start a new segment
+ * is refused while that segment's ring slot holds a batch that neither an
+ * export nor the checkpoint covers (see Retention above).
+ *
+ * @param[in] time   Caller's clock, any unit matching max_age
+ * @param[in] event  Event code
+ * @param[in] data   Event data, or NULL
+ * @param[in] len    Length of @p data, at most AUDIT_LOG_DATA_MAX
+ * @param[in] flags  0 or AUDIT_LOG_URGENT
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT,
+ *         PSA_ERROR_INSUFFICIENT_STORAGE if storage is full of unexported,
+ *         unsigned batches (the entry is not added), or the commit or
+ *         checkpoint error; if the segment is still full from a failed
+ *         commit and cannot be committed now, the entry is not added
+ */
+psa_status_t audit_log_append(audit_log_t *log, uint32_t time, uint16_t event,
+                              const uint8_t *data, size_t len, uint32_t flags);
+
+/** @brief Commit the segment if its oldest entry has reached max_age at @p now */
+psa_status_t audit_log_poll(audit_log_t *log, uint32_t now);
+
+/** @brief Commit buffered entries now */
+psa_status_t audit_log_flush(audit_log_t *log);
+
+/** @brief Commit buffered entries and sign the chain head */
+psa_status_t audit_log_checkpoint(audit_log_t *log);
+
+/**
+ * @brief Check the stored log: links, sequence and checkpoint signature
+ *
+ * Reads the stored segments oldest first (buffered entries are committed
+ * first) and recomputes the chain. The checkpoint, if it falls inside the
+ * stored range, must match the chain and verify under the key.
+ *
+ * @param[out] info  Result, or NULL
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE on a broken link, gap
+ *         or bad checkpoint, or a Protected Storage error
+ */
+psa_status_t audit_log_verify(audit_log_t *log, audit_log_verify_info_t *info);
+
+/**
+ * @brief Pass the public key, the stored segments (oldest first) and the
+ *        checkpoint to @p fn, after committing buffered entries
+ *
+ * The exported segments' ring slots may then be reused by later commits.
+ */
+psa_status_t audit_log_export(audit_log_t *log, audit_log_export_fn_t fn, void *arg);
+
+/** @brief Remove all assets of the log and start a new chain */
+psa_status_t audit_log_erase(audit_log_t *log);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* AUDIT_LOG_H */
+/* [] END OF FILE */
@@ -0,0 +1,187 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CBOR writer
+ * Purpose : Item heads, strings and scalars.
+ ********************************************************************************
+ * @file    cbor_write.c
+ * @brief   Streaming CBOR encoder with optional hashing and size-only mode
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cbor_write.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Additional information values of the initial byte */
+#define CBOR_AI_1BYTE                 (24U)
+#define CBOR_AI_2BYTE                 (25U)
+#define CBOR_AI_4BYTE                 (26U)
+#define CBOR_AI_8BYTE                 (27U)
+
+#define CBOR_SIMPLE_FALSE             (20U)
+#define CBOR_SIMPLE_TRUE              (21U)
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+void cbor_writer_init(cbor_writer_t *w, uint8_t *buf, size_t size)
+{
+    w->buf = buf;
+    w->size = (buf != NULL) ? size : 0U;
+    w->len = 0;
+    w->hash = NULL;
+    w->overflow = false;
+}
+
+void cbor_put_raw(cbor_writer_t *w, const void *data, size_t len)
+{
+    if (w->overflow)
+    {
+        return;
+    }
+    if (w->buf != NULL)
+    {
+        if (len > (w->size - w->len))
+        {
+            w->overflow = true;
+            return;
+        }
+        memcpy(&w->buf[w->len], data, len);
+    }
+    if (w->hash != NULL)
+    {
+        sha256_sw_update(w->hash, (const uint8_t *)data, len);
+    }
+    w->len += len;
+}
+
+size_t cbor_head_size(uint64_t value)
+{
+    if (value < CBOR_AI_1BYTE)
+    {
+        return 1U;
+    }
+    if (value <= 0xFFU)
+    {
+        return 2U;
+    }
+    if (value <= 0xFFFFU)
+    {
+        return 3U;
+    }
+    return (value <= 0xFFFFFFFFUL) ? 5U : 9U;
+}
+
+void cbor_put_head(cbor_writer_t *w, uint8_t major, uint64_t value)
+{
+    uint8_t head[CBOR_HEAD_MAX];
+    size_t len = cbor_head_size(value);
+    uint8_t ai;
+
+    switch (len)
+    {
+        case 1U:  ai = (uint8_t)value; break;
+        case 2U:  ai = CBOR_AI_1BYTE;  break;
+        case 3U:  ai = CBOR_AI_2BYTE;  break;
+        case 5U:  ai = CBOR_AI_4BYTE;  break;
+        default:  ai = CBOR_AI_8BYTE;  break;
+    }
+    head[0] = (uint8_t)((major << 5) | ai);
+    for (size_t i = 1; i < len; i++)
+    {
+        head[i] = (uint8_t)(value >> (8U * (len - 1U - i)));
+    }
+    cbor_put_raw(w, head, len);
+}
+
+void cbor_put_uint(cbor_writer_t *w, uint64_t value)
+{
+    cbor_put_head(w, CBOR_MAJOR_UINT, value);
+}
+
+void cbor_put_int(cbor_writer_t *w, int64_t value)
+{
+    if (value < 0)
+    {
+        /* -1 - n without overflowing at INT64_MIN */
+        cbor_put_head(w, CBOR_MAJOR_NINT, ~(uint64_t)value);
+    }
+    else
+    {
+        cbor_put_head(w, CBOR_MAJOR_UINT, (uint64_t)value);
+    }
+}
+
+void cbor_put_bstr(cbor_writer_t *w, const uint8_t *data, size_t len)
+{
+    cbor_put_head(w, CBOR_MAJOR_BSTR, len);
+    cbor_put_raw(w, data, len);
+}
+
+void cbor_put_tstr(cbor_writer_t *w, const char *text)
+{
+    size_t len = strlen(text);
+
+    cbor_put_head(w, CBOR_MAJOR_TSTR, len);
+    cbor_put_raw(w, text, len);
+}
+
+void cbor_put_array(cbor_writer_t *w, size_t count)
+{
+    cbor_put_head(w, CBOR_MAJOR_ARRAY, count);
+}
+
+void cbor_put_map(cbor_writer_t *w, size_t pairs)
+{
+    cbor_put_head(w, CBOR_MAJOR_MAP, pairs);
+}
+
+void cbor_put_tag(cbor_writer_t *w, uint64_t tag)
+{
+    cbor_put_head(w, CBOR_MAJOR_TAG, tag);
+}
+
+void cbor_put_bool(cbor_writer_t *w, bool value)
+{
+    uint8_t item = (uint8_t)((CBOR_MAJOR_SIMPLE << 5) | (value ? CBOR_SIMPLE_TRUE : CBOR_SIMPLE_FALSE));
+
+    cbor_put_raw(w, &item, 1U);
+}
+
+void cbor_put_float(cbor_writer_t *w, float value)
+{
+    uint8_t item[5];
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    item[0] = (uint8_t)((CBOR_MAJOR_SIMPLE << 5) | CBOR_AI_4BYTE);
+    item[1] = (uint8_t)(bits >> 24);
+    item[2] = (uint8_t)(bits >> 16);
+    item[3] = (uint8_t)(bits >> 8);
+    item[4] = (uint8_t)bits;
+    cbor_put_raw(w, item, sizeof(item));
+}
+
+/* [] END OF FILE */
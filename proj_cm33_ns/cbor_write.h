@@ -0,0 +1,140 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CBOR writer
+ * Purpose : Encode CBOR (RFC 8949) items straight into a caller buffer.
+ * Design  : Definite lengths and shortest-form heads only. A writer with a
+ *           NULL buffer only counts, so running the same encoding code
+ *           twice gives the size first without a scratch buffer. A writer
+ *           can also feed every byte it emits into a software SHA-256, which
+ *           is how COSE signs while it serializes. Errors are sticky: after
+ *           an overflow further writes are ignored and cbor_writer_ok()
+ *           returns false.
+ ********************************************************************************
+ * @file    cbor_write.h
+ * @brief   Streaming CBOR encoder with optional hashing and size-only mode
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef CBOR_WRITE_H
+#define CBOR_WRITE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256_sw.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief CBOR major types */
+#define CBOR_MAJOR_UINT               (0U)
+#define CBOR_MAJOR_NINT               (1U)
+#define CBOR_MAJOR_BSTR               (2U)
+#define CBOR_MAJOR_TSTR               (3U)
+#define CBOR_MAJOR_ARRAY              (4U)
+#define CBOR_MAJOR_MAP                (5U)
+#define CBOR_MAJOR_TAG                (6U)
+#define CBOR_MAJOR_SIMPLE             (7U)
+
+/** @brief Largest encoded head (initial byte and 8-byte argument) */
+#define CBOR_HEAD_MAX                 (9U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Output position of an encoding */
+typedef struct
+{
+    uint8_t         *buf;       /**< Output, or NULL to only count         */
+    size_t           size;      /**< Capacity of buf                       */
+    size_t           len;       /**< Bytes written (or counted)            */
+    sha256_sw_ctx_t *hash;      /**< Fed with every byte written, or NULL  */
+    bool             overflow;  /**< A write did not fit                   */
+} cbor_writer_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Start writing at the beginning of @p buf
+ *
+ * @param[out] w     Writer
+ * @param[in]  buf   Output buffer, or NULL to count bytes only
+ * @param[in]  size  Capacity of @p buf (ignored when counting)
+ */
+void cbor_writer_init(cbor_writer_t *w, uint8_t *buf, size_t size);
+
+/** @brief True while every write so far fitted */
+static inline bool cbor_writer_ok(const cbor_writer_t *w)
+{
+    return !w->overflow;
+}
+
+/** @brief Append raw bytes, e.g. an item encoded elsewhere */
+void cbor_put_raw(cbor_writer_t *w, const void *data, size_t len);
+
+/** @brief Append the head of an item: major type and argument */
+void cbor_put_head(cbor_writer_t *w, uint8_t major, uint64_t value);
+
+/** @brief Unsigned integer */
+void cbor_put_uint(cbor_writer_t *w, uint64_t value);
+
+/** @brief Signed integer */
+void cbor_put_int(cbor_writer_t *w, int64_t value);
+
+/** @brief Byte string */
+void cbor_put_bstr(cbor_writer_t *w, const uint8_t *data, size_t len);
+
+/** @brief Text string, NUL terminated */
+void cbor_put_tstr(cbor_writer_t *w, const char *text);
+
+/** @brief Array of @p count items; the items follow */
+void cbor_put_array(cbor_writer_t *w, size_t count);
+
+/** @brief Map of @p pairs key/value pairs; the pairs follow */
+void cbor_put_map(cbor_writer_t *w, size_t pairs);
+
+/** @brief Tag; the tagged item follows */
+void cbor_put_tag(cbor_writer_t *w, uint64_t tag);
+
+/** @brief true or false */
+void cbor_put_bool(cbor_writer_t *w, bool value);
+
+/** @brief Single-precision float */
+void cbor_put_float(cbor_writer_t *w, float value);
+
+/** @brief Encoded size of an item head with argument @p value */
+size_t cbor_head_size(uint64_t value);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CBOR_WRITE_H */
+/* [] END OF FILE */
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : COBS framing
+ * Purpose : Encoder and in-place decoder, no platform dependencies.
+ ********************************************************************************
+ * @file    cobs.c
+ * @brief   COBS encoder and in-place decoder
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "cobs.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+size_t cobs_encode(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_size)
+{
+    size_t code_pos = 0;
+    size_t out = 1;
+    uint8_t code = 1;
+
+    if (dst_size < COBS_ENCODED_MAX(len))
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (src[i] != 0U)
+        {
+            dst[out++] = src[i];
+            code++;
+        }
+        if ((src[i] == 0U) || (code == 0xFFU))
+        {
+            dst[code_pos] = code;
+            code = 1;
+            code_pos = out++;
+        }
+    }
+    dst[code_pos] = code;
+
+    /* A block ended by the length limit right at the end needs no empty
+     * trailing block */
+    if ((code == 1U) && (len > 0U) && (src[len - 1U] != 0U))
+    {
+        out--;
+    }
+    return out;
+}
+
+size_t cobs_decode(uint8_t *buf, size_t len)
+{
+    size_t in = 0;
+    size_t out = 0;
+
+    while (in < len)
+    {
+        uint8_t code = buf[in++];
+
+        if ((code == 0U) || ((in + code - 1U) > len))
+        {
+            return SIZE_MAX;
+        }
+        /* out never passes in, so copying forward in place is safe */
+        for (uint8_t i = 1; i < code; i++)
+        {
+            buf[out++] = buf[in++];
+        }
+        if ((code != 0xFFU) && (in < len))
+        {
+            buf[out++] = 0;
+        }
+    }
+    return out;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,78 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : COBS framing
+ * Purpose : Consistent Overhead Byte Stuffing: removes every 0x00 from a
+ *           packet so that 0x00 can delimit frames on a byte stream. The
+ *           overhead is one byte per 254 bytes of data plus one.
+ ********************************************************************************
+ * @file    cobs.h
+ * @brief   COBS encoder and in-place decoder
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef COBS_H
+#define COBS_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest encoding of @p len bytes, without the 0x00 delimiter */
+#define COBS_ENCODED_MAX(len)         ((len) + ((len) / 254U) + 1U)
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Encode a packet
+ *
+ * @param[in]  src       Packet
+ * @param[in]  len       Length of @p src
+ * @param[out] dst       Encoded output, must not overlap @p src
+ * @param[in]  dst_size  Size of @p dst
+ *
+ * @return Encoded length (no delimiter), or 0 if @p dst is too small
+ */
+size_t cobs_encode(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_size);
+
+/**
+ * @brief Decode a frame in place
+ *
+ * @param[in,out] buf  Encoded frame without the delimiter; receives the packet
+ * @param[in]     len  Length of the encoded frame
+ *
+ * @return Packet length, or SIZE_MAX if the frame is malformed
+ */
+size_t cobs_decode(uint8_t *buf, size_t len);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* COBS_H */
+/* [] END OF FILE */
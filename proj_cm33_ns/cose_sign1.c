@@ -0,0 +1,246 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : COSE_Sign1 encoder
+ * Purpose : Header encoding, Sig_structure hashing and the interoperability
+ *           self-test.
+ ********************************************************************************
+ * @file    cose_sign1.c
+ * @brief   Single-pass COSE_Sign1 (ES256) encoder
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cose_sign1.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief COSE header labels */
+#define COSE_HEADER_ALG               (1U)
+#define COSE_HEADER_KID               (4U)
+
+/** @brief Encoded protected header {1: -7} */
+#define COSE_PROTECTED_SIZE           (3U)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief cose-wg Examples key "11" (P-256 private scalar) */
+static const uint8_t cose_test_key[32] =
+{
+    0x57, 0xC9, 0x20, 0x77, 0x66, 0x41, 0x46, 0xE8, 0x76, 0x76, 0x0C, 0x95, 0x20, 0xD0, 0x54, 0xAA,
+    0x93, 0xC3, 0xAF, 0xB0, 0x4E, 0x30, 0x67, 0x05, 0xDB, 0x60, 0x90, 0x30, 0x85, 0x07, 0xB4, 0xD3
+};
+
+/** @brief sign1-pass-01 with an RFC 6979 signature under cose_test_key */
+static const uint8_t cose_test_message[] =
+{
+    0xD2, 0x84, 0x43, 0xA1, 0x01, 0x26, 0xA1, 0x04, 0x42, 0x31, 0x31, 0x54, 0x54, 0x68, 0x69, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E,
+    0x58, 0x40, 0x8E, 0xB3, 0x3E, 0x4C, 0xA3, 0x1D, 0x1C, 0x46, 0x5A, 0xB0, 0x5A, 0xAC, 0x34, 0xCC,
+    0x6B, 0x23, 0xD5, 0x8F, 0xEF, 0x5C, 0x08, 0x31, 0x06, 0xC4, 0xD2, 0x5A, 0x91, 0xAE, 0xF0, 0xB0,
+    0x11, 0x7E, 0x2A, 0xF9, 0xA2, 0x91, 0xAA, 0x32, 0xE1, 0x4A, 0xB8, 0x34, 0xDC, 0x56, 0xED, 0x2A,
+    0x22, 0x34, 0x44, 0x54, 0x7E, 0x01, 0xF1, 0x1D, 0x3B, 0x09, 0x16, 0xE5, 0xA4, 0xC3, 0x45, 0xCA,
+    0xCB, 0x36
+};
+
+/** @brief SHA-256 of the Sig_structure of cose_test_message */
+static const uint8_t cose_test_digest[SHA256_SW_DIGEST_SIZE] =
+{
+    0x4C, 0x33, 0x63, 0xB4, 0x99, 0xE1, 0xDA, 0xC4, 0xAA, 0xFC, 0x8D, 0x69, 0x23, 0xF1, 0xCA, 0x65,
+    0x77, 0xDF, 0xDA, 0x80, 0xDA, 0x24, 0xE5, 0x4F, 0xB9, 0x24, 0x24, 0x90, 0x64, 0x82, 0x7C, 0x88
+};
+
+static const uint8_t cose_test_kid[] = { 0x31, 0x31 };  /* "11" */
+static const char    cose_test_payload[] = "This is the content.";
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief Hash CBOR items that appear in the Sig_structure only */
+static void cose_hash_head(cose_sign1_t *ctx, uint8_t major, uint64_t value)
+{
+    uint8_t head[CBOR_HEAD_MAX];
+    cbor_writer_t w;
+
+    cbor_writer_init(&w, head, sizeof(head));
+    w.hash = &ctx->hash;
+    cbor_put_head(&w, major, value);
+}
+
+psa_status_t cose_sign1_begin(cose_sign1_t *ctx, signing_key_t *key,
+                              const uint8_t *kid, size_t kid_len,
+                              const uint8_t *external_aad, size_t aad_len,
+                              size_t payload_len, uint8_t *out, size_t out_size)
+{
+    if (key->scheme != SIGNING_SCHEME_ECDSA_P256)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    ctx->key = key;
+    sha256_sw_init(&ctx->hash);
+    cbor_writer_init(&ctx->out, out, out_size);
+
+    /* Sig_structure: [ "Signature1", */
+    cose_hash_head(ctx, CBOR_MAJOR_ARRAY, 4U);
+    cose_hash_head(ctx, CBOR_MAJOR_TSTR, 10U);
+    sha256_sw_update(&ctx->hash, (const uint8_t *)"Signature1", 10U);
+
+    /* Message: 18([ */
+    cbor_put_tag(&ctx->out, COSE_SIGN1_TAG);
+    cbor_put_array(&ctx->out, 4U);
+
+    /* Both: protected header bstr */
+    ctx->out.hash = &ctx->hash;
+    cbor_put_head(&ctx->out, CBOR_MAJOR_BSTR, COSE_PROTECTED_SIZE);
+    cbor_put_map(&ctx->out, 1U);
+    cbor_put_uint(&ctx->out, COSE_HEADER_ALG);
+    cbor_put_int(&ctx->out, COSE_ALG_ES256);
+    ctx->out.hash = NULL;
+
+    /* Message: unprotected header */
+    if (kid != NULL)
+    {
+        cbor_put_map(&ctx->out, 1U);
+        cbor_put_uint(&ctx->out, COSE_HEADER_KID);
+        cbor_put_bstr(&ctx->out, kid, kid_len);
+    }
+    else
+    {
+        cbor_put_map(&ctx->out, 0U);
+    }
+
+    /* Sig_structure: external_aad */
+    cose_hash_head(ctx, CBOR_MAJOR_BSTR, aad_len);
+    if (aad_len > 0U)
+    {
+        sha256_sw_update(&ctx->hash, external_aad, aad_len);
+    }
+
+    /* Both: payload bstr, head here and content through cose_sign1_payload() */
+    ctx->out.hash = &ctx->hash;
+    cbor_put_head(&ctx->out, CBOR_MAJOR_BSTR, payload_len);
+    ctx->payload_end = ctx->out.len + payload_len;
+
+    return cbor_writer_ok(&ctx->out) ? PSA_SUCCESS : PSA_ERROR_BUFFER_TOO_SMALL;
+}
+
+cbor_writer_t *cose_sign1_payload(cose_sign1_t *ctx)
+{
+    return &ctx->out;
+}
+
+psa_status_t cose_sign1_finish(cose_sign1_t *ctx, size_t *out_len)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    size_t signature_len;
+    psa_status_t status;
+
+    if (!cbor_writer_ok(&ctx->out))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (ctx->out.len != ctx->payload_end)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    sha256_sw_finish(&ctx->hash, digest);
+    ctx->out.hash = NULL;
+
+    cbor_put_head(&ctx->out, CBOR_MAJOR_BSTR, COSE_ES256_SIGNATURE_SIZE);
+    if (!cbor_writer_ok(&ctx->out) || ((ctx->out.size - ctx->out.len) < COSE_ES256_SIGNATURE_SIZE))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    /* PSA ECDSA signatures are r || s, the COSE layout */
+    status = psa_sign_hash(ctx->key->key_id, ctx->key->alg, digest, sizeof(digest),
+                           &ctx->out.buf[ctx->out.len], COSE_ES256_SIGNATURE_SIZE, &signature_len);
+    if (status == PSA_SUCCESS)
+    {
+        ctx->out.len += signature_len;
+        *out_len = ctx->out.len;
+    }
+    return status;
+}
+
+psa_status_t cose_sign1_self_test(void)
+{
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    const size_t payload_len = sizeof(cose_test_payload) - 1U;
+    const size_t signed_len = sizeof(cose_test_message) - COSE_ES256_SIGNATURE_SIZE;
+    uint8_t out[COSE_SIGN1_SIZE(sizeof(cose_test_kid), sizeof(cose_test_payload))];
+    cose_sign1_t ctx;
+    signing_key_t key;
+    size_t out_len = 0;
+    psa_status_t status;
+
+    status = signing_key_import(&config, cose_test_key, sizeof(cose_test_key), &key);
+    if (status == PSA_ERROR_NOT_SUPPORTED)
+    {
+        config.nonce = SIGNING_NONCE_RANDOM;
+        status = signing_key_import(&config, cose_test_key, sizeof(cose_test_key), &key);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = cose_sign1_begin(&ctx, &key, cose_test_kid, sizeof(cose_test_kid), NULL, 0,
+                              payload_len, out, sizeof(out));
+    if (status == PSA_SUCCESS)
+    {
+        cbor_put_raw(cose_sign1_payload(&ctx), cose_test_payload, payload_len);
+        status = cose_sign1_finish(&ctx, &out_len);
+    }
+    if ((status == PSA_SUCCESS) &&
+        ((out_len != sizeof(cose_test_message)) || (memcmp(out, cose_test_message, signed_len) != 0)))
+    {
+        status = PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        if (config.nonce == SIGNING_NONCE_DETERMINISTIC)
+        {
+            if (memcmp(&out[signed_len], &cose_test_message[signed_len], COSE_ES256_SIGNATURE_SIZE) != 0)
+            {
+                status = PSA_ERROR_CORRUPTION_DETECTED;
+            }
+        }
+        else if (psa_verify_hash(key.key_id, key.alg, cose_test_digest, sizeof(cose_test_digest),
+                                 &out[signed_len], COSE_ES256_SIGNATURE_SIZE) != PSA_SUCCESS)
+        {
+            status = PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    signing_key_destroy(&key);
+
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,150 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : COSE_Sign1 encoder
+ * Purpose : Produce signed telemetry as COSE_Sign1 (RFC 9052, ES256) in one
+ *           pass over one output buffer.
+ * Design  : The message is
+ *             18([ bstr({1: -7}), {4: kid}, bstr(payload), bstr(signature) ])
+ *           and the signature covers
+ *             [ "Signature1", bstr({1: -7}), bstr(external_aad), bstr(payload) ]
+ *           Both contain the protected header and the payload with the same
+ *           bytes, so the encoder writes them to the output once while a
+ *           software SHA-256 absorbs them, and hashes the few bytes that only
+ *           the Sig_structure has on the side. The payload is encoded with
+ *           the CBOR writer returned by cose_sign1_payload(); its length must
+ *           be known up front (run the payload encoder once on a counting
+ *           cbor_writer_t). cose_sign1_finish() signs the digest with
+ *           psa_sign_hash() and appends the 64-byte signature.
+ ********************************************************************************
+ * @file    cose_sign1.h
+ * @brief   Single-pass COSE_Sign1 (ES256) encoder
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef COSE_SIGN1_H
+#define COSE_SIGN1_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cbor_write.h"
+#include "psa/crypto.h"
+#include "sha256_sw.h"
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief COSE algorithm identifier of ECDSA P-256 with SHA-256 */
+#define COSE_ALG_ES256                (-7)
+
+/** @brief CBOR tag of a COSE_Sign1 message */
+#define COSE_SIGN1_TAG                (18U)
+
+/** @brief ES256 signature size (r || s) */
+#define COSE_ES256_SIGNATURE_SIZE     (64U)
+
+/** @brief Output size needed for a message with the given kid and payload lengths */
+#define COSE_SIGN1_SIZE(kid_len, payload_len) \
+    (2U + 4U + 2U + CBOR_HEAD_MAX + (kid_len) + CBOR_HEAD_MAX + (payload_len) + \
+     2U + COSE_ES256_SIGNATURE_SIZE)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Encoder state from cose_sign1_begin() to cose_sign1_finish() */
+typedef struct
+{
+    signing_key_t   *key;
+    sha256_sw_ctx_t  hash;          /**< Sig_structure digest so far      */
+    cbor_writer_t    out;           /**< Output, feeding @ref hash        */
+    size_t           payload_end;   /**< Output offset the payload ends at */
+} cose_sign1_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Write the headers and start the payload
+ *
+ * @param[out] ctx           Encoder
+ * @param[in]  key           ECDSA P-256 key
+ * @param[in]  kid           Key identifier for the unprotected header, or NULL
+ * @param[in]  kid_len       Length of @p kid
+ * @param[in]  external_aad  Data authenticated but not sent, or NULL
+ * @param[in]  aad_len       Length of @p external_aad
+ * @param[in]  payload_len   Exact length of the payload that will follow
+ * @param[out] out           Output buffer, see COSE_SIGN1_SIZE()
+ * @param[in]  out_size      Capacity of @p out
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_NOT_SUPPORTED for a key other than ECDSA
+ *         P-256, or PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t cose_sign1_begin(cose_sign1_t *ctx, signing_key_t *key,
+                              const uint8_t *kid, size_t kid_len,
+                              const uint8_t *external_aad, size_t aad_len,
+                              size_t payload_len, uint8_t *out, size_t out_size);
+
+/**
+ * @brief Writer for the payload bytes
+ *
+ * Encode the payload with the cbor_put_*() functions, or copy opaque bytes
+ * with cbor_put_raw(). Exactly payload_len bytes must be written.
+ */
+cbor_writer_t *cose_sign1_payload(cose_sign1_t *ctx);
+
+/**
+ * @brief Sign and append the signature
+ *
+ * @param[in]  ctx      Encoder
+ * @param[out] out_len  Length of the complete message
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT if the payload length
+ *         differs from the announced one, PSA_ERROR_BUFFER_TOO_SMALL, or
+ *         the psa_sign_hash() error
+ */
+psa_status_t cose_sign1_finish(cose_sign1_t *ctx, size_t *out_len);
+
+/**
+ * @brief Check the encoder against a COSE interoperability vector
+ *
+ * Encodes the cose-wg "sign1-pass-01" message (key "11", payload "This is
+ * the content.") with a deterministic ECDSA key and compares it with the
+ * expected bytes. If TF-M has no deterministic ECDSA, everything but the
+ * signature is compared and the signature is verified instead.
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_CORRUPTION_DETECTED on a mismatch
+ */
+psa_status_t cose_sign1_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* COSE_SIGN1_H */
+/* [] END OF FILE */
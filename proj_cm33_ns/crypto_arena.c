@@ -0,0 +1,323 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Static arena allocator for crypto scratch memory
+ * Purpose : Deterministic calloc/free over static storage.
+ * Design  : A block's class is found from its address, so blocks carry no
+ *           header. The requested size of every block is kept in a side
+ *           table to account for slack (internal fragmentation).
+ *           Bump blocks carry their requested size in an 8-byte header,
+ *           with CRYPTO_ARENA_BUMP_FREED set once freed, so
+ *           crypto_arena_reset() can walk the region and release the
+ *           blocks an operation left behind.
+ ********************************************************************************
+ * @file    crypto_arena.c
+ * @brief   Size-class pools and bump region with calloc/free compatible API
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cy_syslib.h"
+#include "crypto_arena.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define CRYPTO_ARENA_ALIGN            (8U)
+#define CRYPTO_ARENA_ALIGN_UP(n)      (((n) + (CRYPTO_ARENA_ALIGN - 1U)) & ~(size_t)(CRYPTO_ARENA_ALIGN - 1U))
+
+#define CRYPTO_ARENA_TOTAL_BLOCKS     (CRYPTO_ARENA_COUNT_32 + CRYPTO_ARENA_COUNT_64 + \
+                                       CRYPTO_ARENA_COUNT_128 + CRYPTO_ARENA_COUNT_256 + \
+                                       CRYPTO_ARENA_COUNT_512)
+
+/** @brief Bump block header flag: the block has been freed */
+#define CRYPTO_ARENA_BUMP_FREED       (0x80000000UL)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct
+{
+    uint8_t  *base;         /**< First block                               */
+    void     *free_list;    /**< Next free block, link stored in the block */
+    uint16_t *req_size;     /**< Requested size per block, 0 when free     */
+    crypto_arena_class_stats_t stats;
+} crypto_arena_class_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint64_t crypto_arena_pool_32[CRYPTO_ARENA_COUNT_32 * 32U / sizeof(uint64_t)];
+static uint64_t crypto_arena_pool_64[CRYPTO_ARENA_COUNT_64 * 64U / sizeof(uint64_t)];
+static uint64_t crypto_arena_pool_128[CRYPTO_ARENA_COUNT_128 * 128U / sizeof(uint64_t)];
+static uint64_t crypto_arena_pool_256[CRYPTO_ARENA_COUNT_256 * 256U / sizeof(uint64_t)];
+static uint64_t crypto_arena_pool_512[CRYPTO_ARENA_COUNT_512 * 512U / sizeof(uint64_t)];
+static uint64_t crypto_arena_bump[CRYPTO_ARENA_BUMP_SIZE / sizeof(uint64_t)];
+
+static uint16_t crypto_arena_req_sizes[CRYPTO_ARENA_TOTAL_BLOCKS];
+
+static crypto_arena_class_t crypto_arena_classes[CRYPTO_ARENA_CLASSES];
+
+static uint32_t crypto_arena_bump_top;
+static uint32_t crypto_arena_bump_live;
+static crypto_arena_stats_t crypto_arena_stats;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void crypto_arena_class_init(crypto_arena_class_t *cls, void *pool,
+                                    uint16_t block_size, uint16_t blocks,
+                                    uint16_t *req_size)
+{
+    uint8_t *block = (uint8_t *)pool;
+
+    cls->base = block;
+    cls->req_size = req_size;
+    cls->free_list = NULL;
+    cls->stats = (crypto_arena_class_stats_t){ block_size, blocks, 0U, 0U };
+
+    /* Thread the free list from the end so blocks come out in address order */
+    for (uint32_t i = blocks; i > 0U; i--)
+    {
+        void **link = (void **)(void *)&block[(i - 1U) * block_size];
+        *link = cls->free_list;
+        cls->free_list = link;
+        req_size[i - 1U] = 0U;
+    }
+}
+
+void crypto_arena_init(void)
+{
+    uint16_t *req = crypto_arena_req_sizes;
+    uint32_t irq_state = Cy_SysLib_EnterCriticalSection();
+
+    crypto_arena_class_init(&crypto_arena_classes[0], crypto_arena_pool_32,  32U,  CRYPTO_ARENA_COUNT_32,  req);
+    req += CRYPTO_ARENA_COUNT_32;
+    crypto_arena_class_init(&crypto_arena_classes[1], crypto_arena_pool_64,  64U,  CRYPTO_ARENA_COUNT_64,  req);
+    req += CRYPTO_ARENA_COUNT_64;
+    crypto_arena_class_init(&crypto_arena_classes[2], crypto_arena_pool_128, 128U, CRYPTO_ARENA_COUNT_128, req);
+    req += CRYPTO_ARENA_COUNT_128;
+    crypto_arena_class_init(&crypto_arena_classes[3], crypto_arena_pool_256, 256U, CRYPTO_ARENA_COUNT_256, req);
+    req += CRYPTO_ARENA_COUNT_256;
+    crypto_arena_class_init(&crypto_arena_classes[4], crypto_arena_pool_512, 512U, CRYPTO_ARENA_COUNT_512, req);
+
+    crypto_arena_bump_top = 0U;
+    crypto_arena_bump_live = 0U;
+    memset(&crypto_arena_stats, 0, sizeof(crypto_arena_stats));
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+}
+
+/**
+ * @brief Account for a new allocation. Called with interrupts masked.
+ */
+static void crypto_arena_account(size_t request, size_t granted)
+{
+    crypto_arena_stats.allocs++;
+    crypto_arena_stats.bytes_in_use += (uint32_t)request;
+    crypto_arena_stats.slack_bytes += (uint32_t)(granted - request);
+    if (crypto_arena_stats.bytes_in_use > crypto_arena_stats.bytes_peak)
+    {
+        crypto_arena_stats.bytes_peak = crypto_arena_stats.bytes_in_use;
+    }
+}
+
+void *crypto_arena_calloc(size_t count, size_t size)
+{
+    size_t request;
+    void *block = NULL;
+    uint32_t irq_state;
+
+    if ((count == 0U) || (size == 0U) || (count > (SIZE_MAX / size)))
+    {
+        return NULL;
+    }
+    request = count * size;
+
+    irq_state = Cy_SysLib_EnterCriticalSection();
+
+    for (uint32_t i = 0; i < CRYPTO_ARENA_CLASSES; i++)
+    {
+        crypto_arena_class_t *cls = &crypto_arena_classes[i];
+
+        if ((request > cls->stats.block_size) || (cls->free_list == NULL))
+        {
+            continue;
+        }
+        if ((i > 0U) && (request <= crypto_arena_classes[i - 1U].stats.block_size))
+        {
+            crypto_arena_stats.fallbacks++;
+        }
+
+        block = cls->free_list;
+        cls->free_list = *(void **)block;
+        cls->req_size[((uint8_t *)block - cls->base) / cls->stats.block_size] = (uint16_t)request;
+        cls->stats.in_use++;
+        if (cls->stats.in_use > cls->stats.peak)
+        {
+            cls->stats.peak = cls->stats.in_use;
+        }
+        crypto_arena_account(request, cls->stats.block_size);
+        break;
+    }
+
+    if (block == NULL)
+    {
+        /* Each bump block is preceded by its size so free() can account for it */
+        size_t need = CRYPTO_ARENA_ALIGN + CRYPTO_ARENA_ALIGN_UP(request);
+
+        if ((request <= (CRYPTO_ARENA_BUMP_SIZE - CRYPTO_ARENA_ALIGN)) &&
+            (need <= (CRYPTO_ARENA_BUMP_SIZE - crypto_arena_bump_top)))
+        {
+            uint8_t *base = (uint8_t *)crypto_arena_bump + crypto_arena_bump_top;
+
+            *(uint32_t *)(void *)base = (uint32_t)request;
+            block = base + CRYPTO_ARENA_ALIGN;
+            crypto_arena_bump_top += (uint32_t)need;
+            crypto_arena_bump_live++;
+            if (crypto_arena_bump_top > crypto_arena_stats.bump_peak)
+            {
+                crypto_arena_stats.bump_peak = crypto_arena_bump_top;
+            }
+            crypto_arena_account(request, need - CRYPTO_ARENA_ALIGN);
+        }
+        else
+        {
+            crypto_arena_stats.failures++;
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+
+    if (block != NULL)
+    {
+        memset(block, 0, request);
+    }
+    return block;
+}
+
+void crypto_arena_free(void *ptr)
+{
+    uint8_t *addr = (uint8_t *)ptr;
+    uint32_t irq_state;
+
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    irq_state = Cy_SysLib_EnterCriticalSection();
+
+    if ((addr >= (uint8_t *)crypto_arena_bump) &&
+        (addr < ((uint8_t *)crypto_arena_bump + sizeof(crypto_arena_bump))))
+    {
+        uint32_t *header = (uint32_t *)(void *)(addr - CRYPTO_ARENA_ALIGN);
+        uint32_t request = *header;
+
+        /* Double free, or a block released by crypto_arena_reset() */
+        CY_ASSERT((crypto_arena_bump_live > 0U) && ((request & CRYPTO_ARENA_BUMP_FREED) == 0U));
+        *header = request | CRYPTO_ARENA_BUMP_FREED;
+        crypto_arena_stats.bytes_in_use -= request;
+        crypto_arena_stats.slack_bytes -= (uint32_t)(CRYPTO_ARENA_ALIGN_UP(request) - request);
+        crypto_arena_bump_live--;
+        if (crypto_arena_bump_live == 0U)
+        {
+            crypto_arena_bump_top = 0U;
+        }
+    }
+    else
+    {
+        uint32_t i;
+
+        for (i = 0; i < CRYPTO_ARENA_CLASSES; i++)
+        {
+            crypto_arena_class_t *cls = &crypto_arena_classes[i];
+            size_t span = (size_t)cls->stats.block_size * cls->stats.blocks;
+
+            if ((addr >= cls->base) && (addr < (cls->base + span)))
+            {
+                uint32_t index = (uint32_t)((addr - cls->base) / cls->stats.block_size);
+                uint16_t request = cls->req_size[index];
+
+                /* Double free or pointer into the middle of a block */
+                CY_ASSERT((request != 0U) && (addr == (cls->base + (index * cls->stats.block_size))));
+
+                cls->req_size[index] = 0U;
+                *(void **)ptr = cls->free_list;
+                cls->free_list = ptr;
+                cls->stats.in_use--;
+                crypto_arena_stats.bytes_in_use -= request;
+                crypto_arena_stats.slack_bytes -= (uint32_t)(cls->stats.block_size - request);
+                break;
+            }
+        }
+        /* Not an arena pointer */
+        CY_ASSERT(i < CRYPTO_ARENA_CLASSES);
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+}
+
+void crypto_arena_reset(void)
+{
+    uint32_t offset = 0;
+    uint32_t irq_state = Cy_SysLib_EnterCriticalSection();
+
+    /* Release the bump blocks that are still allocated */
+    while ((crypto_arena_bump_live > 0U) && (offset < crypto_arena_bump_top))
+    {
+        uint32_t header = *(uint32_t *)(void *)((uint8_t *)crypto_arena_bump + offset);
+        uint32_t request = header & ~CRYPTO_ARENA_BUMP_FREED;
+
+        if ((header & CRYPTO_ARENA_BUMP_FREED) == 0U)
+        {
+            crypto_arena_stats.bytes_in_use -= request;
+            crypto_arena_stats.slack_bytes -= (uint32_t)(CRYPTO_ARENA_ALIGN_UP(request) - request);
+            crypto_arena_stats.bump_reclaimed++;
+            crypto_arena_bump_live--;
+        }
+        offset += (uint32_t)(CRYPTO_ARENA_ALIGN + CRYPTO_ARENA_ALIGN_UP(request));
+    }
+    CY_ASSERT(crypto_arena_bump_live == 0U);
+    crypto_arena_bump_top = 0U;
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+}
+
+void crypto_arena_get_stats(crypto_arena_stats_t *stats)
+{
+    uint32_t irq_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = crypto_arena_stats;
+    stats->bump_used = crypto_arena_bump_top;
+    for (uint32_t i = 0; i < CRYPTO_ARENA_CLASSES; i++)
+    {
+        stats->classes[i] = crypto_arena_classes[i].stats;
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+}
+
+/* [] END OF FILE */
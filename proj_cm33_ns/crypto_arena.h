@@ -0,0 +1,146 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Static arena allocator for crypto scratch memory
+ * Purpose : Serve the short-lived allocations of crypto code from fixed
+ *           storage, so long-running devices see neither heap fragmentation
+ *           nor allocator-dependent latency.
+ * Design  : Five size-class pools (32..512 bytes) with O(1) free lists, plus
+ *           a bump region for larger blocks. The bump region rewinds when its
+ *           last block is freed, and crypto_arena_reset() at the end of an
+ *           operation releases whatever the operation left in it.
+ ********************************************************************************
+ * @file    crypto_arena.h
+ * @brief   Size-class pools and bump region with calloc/free compatible API
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *
+ * The allocation functions have the signatures expected by
+ * mbedtls_platform_set_calloc_free(), so a Mbed TLS build on this core can
+ * be pointed at the arena with:
+ *
+ *   mbedtls_platform_set_calloc_free(crypto_arena_calloc, crypto_arena_free);
+ *******************************************************************************/
+
+#ifndef CRYPTO_ARENA_H
+#define CRYPTO_ARENA_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Blocks per size class (32, 64, 128, 256, 512 bytes) */
+#ifndef CRYPTO_ARENA_COUNT_32
+#define CRYPTO_ARENA_COUNT_32         (32U)
+#endif
+#ifndef CRYPTO_ARENA_COUNT_64
+#define CRYPTO_ARENA_COUNT_64         (16U)
+#endif
+#ifndef CRYPTO_ARENA_COUNT_128
+#define CRYPTO_ARENA_COUNT_128        (8U)
+#endif
+#ifndef CRYPTO_ARENA_COUNT_256
+#define CRYPTO_ARENA_COUNT_256        (4U)
+#endif
+#ifndef CRYPTO_ARENA_COUNT_512
+#define CRYPTO_ARENA_COUNT_512        (4U)
+#endif
+
+/** @brief Size of the bump region for blocks larger than 512 bytes */
+#ifndef CRYPTO_ARENA_BUMP_SIZE
+#define CRYPTO_ARENA_BUMP_SIZE        (4096U)
+#endif
+
+/** @brief Number of size classes */
+#define CRYPTO_ARENA_CLASSES          (5U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Usage counters of one size class */
+typedef struct
+{
+    uint16_t block_size;    /**< Bytes per block                        */
+    uint16_t blocks;        /**< Blocks in the pool                     */
+    uint16_t in_use;        /**< Blocks currently allocated             */
+    uint16_t peak;          /**< Most blocks allocated at once          */
+} crypto_arena_class_stats_t;
+
+/** @brief Arena telemetry */
+typedef struct
+{
+    crypto_arena_class_stats_t classes[CRYPTO_ARENA_CLASSES];
+    uint32_t bytes_in_use;      /**< Requested bytes currently allocated         */
+    uint32_t bytes_peak;        /**< Most requested bytes allocated at once      */
+    uint32_t slack_bytes;       /**< Block bytes allocated but not requested     */
+    uint32_t bump_used;         /**< Current bump region offset                  */
+    uint32_t bump_peak;         /**< Highest bump region offset                  */
+    uint32_t allocs;            /**< Successful allocations                      */
+    uint32_t fallbacks;         /**< Served by a larger class than the best fit  */
+    uint32_t failures;          /**< Requests that could not be served           */
+    uint32_t bump_reclaimed;    /**< Bump blocks released by crypto_arena_reset() */
+} crypto_arena_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Build the free lists and clear the counters. Call once at start-up. */
+void crypto_arena_init(void);
+
+/**
+ * @brief Allocate zeroed memory for @p count elements of @p size bytes
+ *
+ * Blocks are 8-byte aligned. A request goes to the smallest class that
+ * fits, then to larger classes, then to the bump region.
+ *
+ * @return Pointer to the block, or NULL if the arena cannot serve it
+ */
+void *crypto_arena_calloc(size_t count, size_t size);
+
+/** @brief Release a block from crypto_arena_calloc(); NULL is ignored */
+void crypto_arena_free(void *ptr);
+
+/**
+ * @brief End of a crypto operation: release every bump block and rewind
+ *        the bump region
+ *
+ * Blocks the operation did not free are released too and counted in
+ * bump_reclaimed; their pointers must not be used or freed afterwards.
+ * Pool blocks are not affected.
+ */
+void crypto_arena_reset(void);
+
+/** @brief Snapshot of the arena counters */
+void crypto_arena_get_stats(crypto_arena_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CRYPTO_ARENA_H */
+/* [] END OF FILE */
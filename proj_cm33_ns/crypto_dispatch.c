@@ -0,0 +1,264 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Per-operation crypto backend dispatch
+ * Purpose : Calibration and size-bucket lookup.
+ ********************************************************************************
+ * @file    crypto_dispatch.c
+ * @brief   Calibrated size-based selection between crypto backends
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "crypto_dispatch.h"
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest calibration size, also the size of the calibration buffer */
+#define CRYPTO_DISPATCH_CAL_MAX       (4096U)
+
+/** @brief Marks a backend that failed during calibration */
+#define CRYPTO_DISPATCH_TICKS_FAILED  (UINT32_MAX)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static const size_t crypto_dispatch_sizes[CRYPTO_DISPATCH_BUCKETS] = CRYPTO_DISPATCH_CAL_SIZES;
+
+static psa_status_t crypto_dispatch_sha256_psa(const uint8_t *input, size_t input_len,
+                                               uint8_t *output, size_t output_size,
+                                               size_t *output_len);
+static psa_status_t crypto_dispatch_sha256_sw(const uint8_t *input, size_t input_len,
+                                              uint8_t *output, size_t output_size,
+                                              size_t *output_len);
+
+/* Built in from reset so callers work before crypto_dispatch_init() (all on PSA) */
+static crypto_dispatch_fn_t    crypto_dispatch_fns[CRYPTO_OP_COUNT][CRYPTO_BACKEND_COUNT] =
+{
+    [CRYPTO_OP_SHA256] = { crypto_dispatch_sha256_psa, crypto_dispatch_sha256_sw },
+};
+static crypto_dispatch_table_t crypto_dispatch_table;
+static crypto_dispatch_stats_t crypto_dispatch_stats[CRYPTO_OP_COUNT];
+
+/** @brief Output size needed by each operation during calibration */
+static const size_t crypto_dispatch_out_size[CRYPTO_OP_COUNT] =
+{
+    [CRYPTO_OP_SHA256] = PSA_HASH_LENGTH(PSA_ALG_SHA_256),
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static psa_status_t crypto_dispatch_sha256_psa(const uint8_t *input, size_t input_len,
+                                               uint8_t *output, size_t output_size,
+                                               size_t *output_len)
+{
+    return psa_hash_compute(PSA_ALG_SHA_256, input, input_len, output, output_size, output_len);
+}
+
+static psa_status_t crypto_dispatch_sha256_sw(const uint8_t *input, size_t input_len,
+                                              uint8_t *output, size_t output_size,
+                                              size_t *output_len)
+{
+    if (output_size < SHA256_SW_DIGEST_SIZE)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    sha256_sw(input, input_len, output);
+    *output_len = SHA256_SW_DIGEST_SIZE;
+    return PSA_SUCCESS;
+}
+
+/** @brief Bucket index for an input length; larger inputs use the last bucket */
+static uint32_t crypto_dispatch_bucket(size_t len)
+{
+    uint32_t i = 0;
+
+    while ((i < (CRYPTO_DISPATCH_BUCKETS - 1U)) && (len > crypto_dispatch_sizes[i]))
+    {
+        i++;
+    }
+    return i;
+}
+
+void crypto_dispatch_init(void)
+{
+    memset(crypto_dispatch_fns, 0, sizeof(crypto_dispatch_fns));
+    memset(&crypto_dispatch_table, CRYPTO_BACKEND_PSA, sizeof(crypto_dispatch_table));
+    memset(crypto_dispatch_stats, 0, sizeof(crypto_dispatch_stats));
+
+    crypto_dispatch_fns[CRYPTO_OP_SHA256][CRYPTO_BACKEND_PSA] = crypto_dispatch_sha256_psa;
+    crypto_dispatch_fns[CRYPTO_OP_SHA256][CRYPTO_BACKEND_SW] = crypto_dispatch_sha256_sw;
+}
+
+void crypto_dispatch_register(crypto_op_t op, crypto_backend_t backend, crypto_dispatch_fn_t fn)
+{
+    crypto_dispatch_fns[op][backend] = fn;
+}
+
+/**
+ * @brief Median time of one backend at one size
+ *
+ * @return Ticks per call, or CRYPTO_DISPATCH_TICKS_FAILED
+ */
+static uint32_t crypto_dispatch_time(crypto_dispatch_fn_t fn, const uint8_t *input,
+                                     size_t input_len, size_t output_size)
+{
+    uint8_t output[PSA_HASH_MAX_SIZE];
+    uint32_t runs[CRYPTO_DISPATCH_CAL_RUNS];
+    size_t output_len;
+
+    if ((fn == NULL) || (output_size > sizeof(output)))
+    {
+        return CRYPTO_DISPATCH_TICKS_FAILED;
+    }
+
+    /* Untimed first call: warms caches and any lazy setup on the secure side */
+    if (fn(input, input_len, output, output_size, &output_len) != PSA_SUCCESS)
+    {
+        return CRYPTO_DISPATCH_TICKS_FAILED;
+    }
+
+    for (uint32_t r = 0; r < CRYPTO_DISPATCH_CAL_RUNS; r++)
+    {
+        uint32_t start = CRYPTO_DISPATCH_CLOCK();
+        psa_status_t status = fn(input, input_len, output, output_size, &output_len);
+
+        runs[r] = CRYPTO_DISPATCH_CLOCK() - start;
+        if (status != PSA_SUCCESS)
+        {
+            /* A backend that fails fast must not win the bucket */
+            return CRYPTO_DISPATCH_TICKS_FAILED;
+        }
+
+        /* Insertion sort, the run count is tiny */
+        for (uint32_t j = r; (j > 0U) && (runs[j - 1U] > runs[j]); j--)
+        {
+            uint32_t t = runs[j];
+            runs[j] = runs[j - 1U];
+            runs[j - 1U] = t;
+        }
+    }
+    return runs[CRYPTO_DISPATCH_CAL_RUNS / 2U];
+}
+
+psa_status_t crypto_dispatch_calibrate(void)
+{
+    static uint8_t input[CRYPTO_DISPATCH_CAL_MAX];
+    psa_status_t status = PSA_SUCCESS;
+
+    CRYPTO_DISPATCH_CLOCK_INIT();
+    for (uint32_t i = 0; i < sizeof(input); i++)
+    {
+        input[i] = (uint8_t)i;
+    }
+
+    for (uint32_t op = 0; op < CRYPTO_OP_COUNT; op++)
+    {
+        crypto_dispatch_stats_t *stats = &crypto_dispatch_stats[op];
+
+        for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+        {
+            uint32_t best = CRYPTO_DISPATCH_TICKS_FAILED;
+
+            for (uint32_t be = 0; be < CRYPTO_BACKEND_COUNT; be++)
+            {
+                uint32_t ticks = crypto_dispatch_time(crypto_dispatch_fns[op][be], input,
+                                                      crypto_dispatch_sizes[b],
+                                                      crypto_dispatch_out_size[op]);
+
+                stats->ticks[b][be] = ticks;
+                if (ticks < best)
+                {
+                    best = ticks;
+                    crypto_dispatch_table.backend[op][b] = (uint8_t)be;
+                }
+            }
+            if (best == CRYPTO_DISPATCH_TICKS_FAILED)
+            {
+                status = PSA_ERROR_NOT_SUPPORTED;
+            }
+        }
+    }
+
+    return status;
+}
+
+psa_status_t crypto_dispatch_set_table(const crypto_dispatch_table_t *table)
+{
+    for (uint32_t op = 0; op < CRYPTO_OP_COUNT; op++)
+    {
+        for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+        {
+            if (table->backend[op][b] >= CRYPTO_BACKEND_COUNT)
+            {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+        }
+    }
+    crypto_dispatch_table = *table;
+    return PSA_SUCCESS;
+}
+
+void crypto_dispatch_get_table(crypto_dispatch_table_t *table)
+{
+    *table = crypto_dispatch_table;
+}
+
+void crypto_dispatch_get_stats(crypto_op_t op, crypto_dispatch_stats_t *stats)
+{
+    *stats = crypto_dispatch_stats[op];
+}
+
+psa_status_t crypto_dispatch_run(crypto_op_t op, const uint8_t *input, size_t input_len,
+                                 uint8_t *output, size_t output_size, size_t *output_len)
+{
+    uint32_t backend;
+    crypto_dispatch_fn_t fn;
+
+    if (op >= CRYPTO_OP_COUNT)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    backend = crypto_dispatch_table.backend[op][crypto_dispatch_bucket(input_len)];
+    fn = crypto_dispatch_fns[op][backend];
+    if (fn == NULL)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    crypto_dispatch_stats[op].calls[backend]++;
+    return fn(input, input_len, output, output_size, output_len);
+}
+
+psa_status_t crypto_dispatch_sha256(const uint8_t *input, size_t input_len, uint8_t *digest)
+{
+    size_t digest_len;
+
+    return crypto_dispatch_run(CRYPTO_OP_SHA256, input, input_len,
+                               digest, PSA_HASH_LENGTH(PSA_ALG_SHA_256), &digest_len);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,177 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Per-operation crypto backend dispatch
+ * Purpose : Choose, per operation and input size, between the TF-M crypto
+ *           service (secure call, hardware acceleration behind it) and a
+ *           software implementation on this core. For short inputs the
+ *           secure call overhead can exceed the cost of doing the work here.
+ * Design  : Each operation has one function per backend. A calibration run
+ *           times every backend at a ladder of input sizes and records the
+ *           fastest one per size bucket. The table can also be stored and
+ *           restored with crypto_dispatch_set_table(). One-shot digests in
+ *           the application (audit log chain, X.509 signatures, command
+ *           and image digests) go through crypto_dispatch_sha256().
+ *           Incremental hashes, trust store key ids and the LMS reference
+ *           verifier call sha256_sw directly: the dispatcher has no
+ *           incremental operation.
+ ********************************************************************************
+ * @file    crypto_dispatch.h
+ * @brief   Calibrated size-based selection between crypto backends
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef CRYPTO_DISPATCH_H
+#define CRYPTO_DISPATCH_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Input sizes timed by the calibration; each is the upper bound of a bucket */
+#define CRYPTO_DISPATCH_CAL_SIZES     { 16U, 64U, 256U, 1024U, 4096U }
+#define CRYPTO_DISPATCH_BUCKETS       (5U)
+
+/** @brief Timed runs per backend and size; the median is kept */
+#ifndef CRYPTO_DISPATCH_CAL_RUNS
+#define CRYPTO_DISPATCH_CAL_RUNS      (5U)
+#endif
+
+/**
+ * @brief Time source for the calibration, in arbitrary monotonic ticks
+ *
+ * Defaults to the DWT cycle counter. Override to run the dispatcher off
+ * target (e.g. with mock backends on a host).
+ */
+#ifndef CRYPTO_DISPATCH_CLOCK
+#include "cycle_counter.h"
+#define CRYPTO_DISPATCH_CLOCK()       cycle_counter_read()
+#define CRYPTO_DISPATCH_CLOCK_INIT()  cycle_counter_init()
+#endif
+#ifndef CRYPTO_DISPATCH_CLOCK_INIT
+#define CRYPTO_DISPATCH_CLOCK_INIT()
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Operations with more than one backend */
+typedef enum
+{
+    CRYPTO_OP_SHA256 = 0,           /**< SHA-256 digest of a buffer */
+    CRYPTO_OP_COUNT
+} crypto_op_t;
+
+/** @brief Backends */
+typedef enum
+{
+    CRYPTO_BACKEND_PSA = 0,         /**< TF-M crypto service        */
+    CRYPTO_BACKEND_SW,              /**< Software on this core      */
+    CRYPTO_BACKEND_COUNT
+} crypto_backend_t;
+
+/**
+ * @brief Backend implementation of an operation
+ *
+ * @param[in]  input        Input data
+ * @param[in]  input_len    Input length
+ * @param[out] output       Result buffer
+ * @param[in]  output_size  Size of @p output
+ * @param[out] output_len   Bytes written to @p output
+ */
+typedef psa_status_t (*crypto_dispatch_fn_t)(const uint8_t *input, size_t input_len,
+                                             uint8_t *output, size_t output_size,
+                                             size_t *output_len);
+
+/** @brief Selected backend per operation and size bucket */
+typedef struct
+{
+    uint8_t backend[CRYPTO_OP_COUNT][CRYPTO_DISPATCH_BUCKETS];
+} crypto_dispatch_table_t;
+
+/** @brief Calibration result of one operation */
+typedef struct
+{
+    uint32_t ticks[CRYPTO_DISPATCH_BUCKETS][CRYPTO_BACKEND_COUNT];  /**< Median per call */
+    uint32_t calls[CRYPTO_BACKEND_COUNT];   /**< Dispatched calls per backend since init */
+} crypto_dispatch_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Reinstall the built-in backends and reset the table and counters;
+ *        every operation goes to PSA until calibrated or given a table
+ */
+void crypto_dispatch_init(void);
+
+/** @brief Replace one backend implementation, e.g. with a mock */
+void crypto_dispatch_register(crypto_op_t op, crypto_backend_t backend, crypto_dispatch_fn_t fn);
+
+/**
+ * @brief Time every backend at each calibration size and select the fastest
+ *
+ * A backend that returns an error on any call is never selected for that
+ * size. Takes a few milliseconds; run it before the dispatcher is shared
+ * between threads, and store the table to skip it on later boots.
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_NOT_SUPPORTED if an operation has no
+ *         working backend
+ */
+psa_status_t crypto_dispatch_calibrate(void);
+
+/**
+ * @brief Use a stored selection table instead of calibrating
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_INVALID_ARGUMENT if an entry names no
+ *         backend; the current table is then kept
+ */
+psa_status_t crypto_dispatch_set_table(const crypto_dispatch_table_t *table);
+
+/** @brief Current selection table, e.g. to store it */
+void crypto_dispatch_get_table(crypto_dispatch_table_t *table);
+
+/** @brief Calibration timings and call counters of an operation */
+void crypto_dispatch_get_stats(crypto_op_t op, crypto_dispatch_stats_t *stats);
+
+/** @brief Run @p op on the backend selected for @p input_len */
+psa_status_t crypto_dispatch_run(crypto_op_t op, const uint8_t *input, size_t input_len,
+                                 uint8_t *output, size_t output_size, size_t *output_len);
+
+/** @brief SHA-256 through the dispatcher; @p digest holds 32 bytes */
+psa_status_t crypto_dispatch_sha256(const uint8_t *input, size_t input_len, uint8_t *digest);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CRYPTO_DISPATCH_H */
+/* [] END OF FILE */
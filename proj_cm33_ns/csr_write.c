@@ -0,0 +1,486 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Certificate signing request
+ * Purpose : PKCS#10 encoding, signing, the PEM line encoder and the
+ *           known-answer self-test.
+ ********************************************************************************
+ * @file    csr_write.c
+ * @brief   Streaming PKCS#10 CSR generation, ECDSA P-256, DER or PEM
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "csr_write.h"
+#include "ecdsa_der.h"
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief PEM armor (RFC 7468) */
+#define CSR_PEM_BEGIN                 "-----BEGIN CERTIFICATE REQUEST-----\n"
+#define CSR_PEM_END                   "-----END CERTIFICATE REQUEST-----\n"
+
+/** @brief Uncompressed P-256 public key and its coordinate size */
+#define CSR_PUBLIC_KEY_SIZE           (65U)
+#define CSR_COORD_SIZE                (32U)
+
+/** @brief Bytes of the OIDs of the name attributes (2.5.4.x) */
+#define CSR_NAME_OID_SIZE             (3U)
+
+/** @brief Position of the info in csr_test_request */
+#define CSR_TEST_INFO_OFFSET          (3U)
+#define CSR_TEST_INFO_SIZE            (168U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Base64 line encoder in front of the caller's sink */
+typedef struct
+{
+    der_sink_fn_t sink;
+    void         *arg;
+    size_t        len;          /**< Characters passed on          */
+    uint8_t       group[3];     /**< Bytes waiting for a full group */
+    uint8_t       group_len;
+    uint8_t       line_len;
+    char          line[CSR_PEM_LINE + 1U];
+} csr_pem_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief RFC 4648 section 4 alphabet */
+static const char csr_b64_alphabet[64] =
+{
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+/** @brief id-at-countryName, organizationName, commonName, serialNumber */
+static const uint8_t csr_oid_country[CSR_NAME_OID_SIZE]       = { 0x55, 0x04, 0x06 };
+static const uint8_t csr_oid_organization[CSR_NAME_OID_SIZE]  = { 0x55, 0x04, 0x0A };
+static const uint8_t csr_oid_common_name[CSR_NAME_OID_SIZE]   = { 0x55, 0x04, 0x03 };
+static const uint8_t csr_oid_serial_number[CSR_NAME_OID_SIZE] = { 0x55, 0x04, 0x05 };
+
+/** @brief AlgorithmIdentifier contents: id-ecPublicKey, prime256v1 */
+static const uint8_t csr_alg_ec_p256[] =
+{
+    0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01,
+    0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07
+};
+
+/** @brief AlgorithmIdentifier contents: ecdsa-with-SHA256, no parameters */
+static const uint8_t csr_alg_ecdsa_sha256[] =
+{
+    0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02
+};
+
+/** @brief RFC 6979 A.2.5 P-256 private key */
+static const uint8_t csr_test_key[32] =
+{
+    0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21, 0x57, 0x67, 0xB1, 0xD6, 0x93,
+    0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8, 0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21
+};
+
+/** @brief Subject of the self-test request */
+static const csr_subject_t csr_test_subject = { "csr-self-test", "TESA", "TH", "0001" };
+
+/** @brief Expected request, RFC 6979 signature under csr_test_key; OpenSSL verifies it */
+static const uint8_t csr_test_request[] =
+{
+    0x30, 0x81, 0xFF, 0x30, 0x81, 0xA5, 0x02, 0x01, 0x00, 0x30, 0x43, 0x31, 0x0B, 0x30, 0x09, 0x06,
+    0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x54, 0x48, 0x31, 0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04,
+    0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x03,
+    0x0C, 0x0D, 0x63, 0x73, 0x72, 0x2D, 0x73, 0x65, 0x6C, 0x66, 0x2D, 0x74, 0x65, 0x73, 0x74, 0x31,
+    0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x05, 0x13, 0x04, 0x30, 0x30, 0x30, 0x31, 0x30, 0x59,
+    0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48,
+    0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D,
+    0x31, 0xC9, 0x61, 0xEB, 0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61, 0xFA,
+    0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6, 0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC,
+    0x99, 0xA4, 0x1A, 0xE9, 0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E, 0x9F,
+    0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99, 0xA0, 0x00, 0x30, 0x0A, 0x06, 0x08, 0x2A,
+    0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x49, 0x00, 0x30, 0x46, 0x02, 0x21, 0x00, 0xDA,
+    0xB3, 0x47, 0x9A, 0xBE, 0x79, 0x7D, 0x00, 0x80, 0x61, 0xD1, 0x1B, 0x12, 0xDC, 0x7E, 0xB2, 0x24,
+    0x4D, 0x49, 0x82, 0x98, 0x09, 0x90, 0x76, 0x27, 0x79, 0x1A, 0xB5, 0x6B, 0x31, 0x6A, 0x7E, 0x02,
+    0x21, 0x00, 0xD3, 0xA9, 0xEC, 0x37, 0xC9, 0x62, 0xAB, 0xCA, 0xCE, 0x30, 0x67, 0x75, 0x97, 0xB2,
+    0x41, 0x20, 0x5A, 0xB5, 0x20, 0xD0, 0xA1, 0x52, 0x17, 0x70, 0x19, 0xB1, 0x43, 0x23, 0x9D, 0x4E,
+    0xD4, 0x84
+};
+
+/** @brief SHA-256 of the info of csr_test_request */
+static const uint8_t csr_test_digest[SHA256_SW_DIGEST_SIZE] =
+{
+    0x21, 0x0C, 0x5F, 0xC0, 0x39, 0x24, 0x60, 0x73, 0x9D, 0x4C, 0xD5, 0x79, 0xBA, 0x91, 0xE1, 0xA3,
+    0x21, 0x36, 0xE7, 0x4D, 0x8C, 0x9E, 0xB4, 0xA3, 0x57, 0x11, 0x06, 0xCF, 0x5F, 0x3E, 0x9B, 0x52
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void csr_pem_init(csr_pem_t *pem, der_sink_fn_t sink, void *arg)
+{
+    memset(pem, 0, sizeof(*pem));
+    pem->sink = sink;
+    pem->arg = arg;
+}
+
+static void csr_pem_text(csr_pem_t *pem, const char *text)
+{
+    size_t len = strlen(text);
+
+    pem->sink(pem->arg, (const uint8_t *)text, len);
+    pem->len += len;
+}
+
+static void csr_pem_flush_line(csr_pem_t *pem)
+{
+    pem->line[pem->line_len] = '\n';
+    pem->sink(pem->arg, (const uint8_t *)pem->line, pem->line_len + 1U);
+    pem->len += pem->line_len + 1U;
+    pem->line_len = 0;
+}
+
+/** @brief Encode the waiting group, padding a short one with '=' */
+static void csr_pem_put_group(csr_pem_t *pem)
+{
+    uint32_t bits = ((uint32_t)pem->group[0] << 16) | ((uint32_t)pem->group[1] << 8) | pem->group[2];
+    char *out = &pem->line[pem->line_len];
+
+    out[0] = csr_b64_alphabet[(bits >> 18) & 0x3FU];
+    out[1] = csr_b64_alphabet[(bits >> 12) & 0x3FU];
+    out[2] = (pem->group_len > 1U) ? csr_b64_alphabet[(bits >> 6) & 0x3FU] : '=';
+    out[3] = (pem->group_len > 2U) ? csr_b64_alphabet[bits & 0x3FU] : '=';
+    pem->line_len += 4U;
+    pem->group_len = 0;
+    memset(pem->group, 0, sizeof(pem->group));
+
+    /* CSR_PEM_LINE is a multiple of 4: groups never straddle lines */
+    if (pem->line_len == CSR_PEM_LINE)
+    {
+        csr_pem_flush_line(pem);
+    }
+}
+
+/** @brief der_sink_fn_t that base64-encodes into PEM lines */
+static void csr_pem_sink(void *arg, const uint8_t *data, size_t len)
+{
+    csr_pem_t *pem = (csr_pem_t *)arg;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        pem->group[pem->group_len++] = data[i];
+        if (pem->group_len == 3U)
+        {
+            csr_pem_put_group(pem);
+        }
+    }
+}
+
+static void csr_pem_finish(csr_pem_t *pem)
+{
+    if (pem->group_len != 0U)
+    {
+        csr_pem_put_group(pem);
+    }
+    if (pem->line_len != 0U)
+    {
+        csr_pem_flush_line(pem);
+    }
+    csr_pem_text(pem, CSR_PEM_END);
+}
+
+/** @brief PrintableString character set (X.680, 41.4) */
+static bool csr_printable(const char *text)
+{
+    static const char extra[] = " '()+,-./:=?";
+
+    for (; *text != '\0'; text++)
+    {
+        char c = *text;
+
+        if (!(((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) || ((c >= '0') && (c <= '9')) ||
+              (strchr(extra, c) != NULL)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool csr_attribute_ok(const char *text)
+{
+    size_t len = strlen(text);
+
+    return (len > 0U) && (len <= CSR_ATTRIBUTE_MAX);
+}
+
+static bool csr_subject_ok(const csr_subject_t *subject)
+{
+    return (subject->common_name != NULL) && csr_attribute_ok(subject->common_name) &&
+           ((subject->organization == NULL) || csr_attribute_ok(subject->organization)) &&
+           ((subject->country == NULL) ||
+            ((strlen(subject->country) == 2U) && csr_printable(subject->country))) &&
+           ((subject->serial_number == NULL) ||
+            (csr_attribute_ok(subject->serial_number) && csr_printable(subject->serial_number)));
+}
+
+/** @brief RelativeDistinguishedName with one attribute */
+static void csr_put_attribute(der_writer_t *w, const uint8_t *oid, uint8_t tag, const char *value)
+{
+    der_open(w, DER_TAG_SET);
+    der_open(w, DER_TAG_SEQUENCE);
+    der_put_tlv(w, DER_TAG_OID, oid, CSR_NAME_OID_SIZE);
+    der_put_string(w, tag, value);
+    der_close(w);
+    der_close(w);
+}
+
+/** @brief CertificationRequestInfo; the same calls run in every pass */
+static void csr_put_info(der_writer_t *w, const csr_subject_t *subject, const uint8_t *public_key)
+{
+    static const uint8_t version = 0U;
+
+    der_open(w, DER_TAG_SEQUENCE);
+    der_put_tlv(w, DER_TAG_INTEGER, &version, 1U);
+
+    der_open(w, DER_TAG_SEQUENCE);
+    if (subject->country != NULL)
+    {
+        csr_put_attribute(w, csr_oid_country, DER_TAG_PRINTABLE_STRING, subject->country);
+    }
+    if (subject->organization != NULL)
+    {
+        csr_put_attribute(w, csr_oid_organization, DER_TAG_UTF8_STRING, subject->organization);
+    }
+    csr_put_attribute(w, csr_oid_common_name, DER_TAG_UTF8_STRING, subject->common_name);
+    if (subject->serial_number != NULL)
+    {
+        csr_put_attribute(w, csr_oid_serial_number, DER_TAG_PRINTABLE_STRING, subject->serial_number);
+    }
+    der_close(w);
+
+    der_open(w, DER_TAG_SEQUENCE);
+    der_put_tlv(w, DER_TAG_SEQUENCE, csr_alg_ec_p256, sizeof(csr_alg_ec_p256));
+    der_put_bit_string(w, public_key, CSR_PUBLIC_KEY_SIZE);
+    der_close(w);
+
+    /* attributes [0] IMPLICIT SET OF Attribute: required, empty */
+    der_open(w, DER_TAG_CONTEXT(0U));
+    der_close(w);
+
+    der_close(w);
+}
+
+psa_status_t csr_write(signing_key_t *key, const csr_subject_t *subject, csr_format_t format,
+                       der_sink_fn_t sink, void *arg, size_t *out_len)
+{
+    der_writer_t w;
+    sha256_sw_ctx_t hash;
+    csr_pem_t pem;
+    uint8_t public_key[CSR_PUBLIC_KEY_SIZE];
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t signature[ECDSA_DER_MAX_SIZE(CSR_COORD_SIZE)];
+    size_t public_key_len = 0;
+    size_t signature_len = 0;
+    size_t info_len;
+    size_t tail_len;
+    psa_status_t status;
+
+    if (key->scheme != SIGNING_SCHEME_ECDSA_P256)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if ((subject == NULL) || (sink == NULL) || !csr_subject_ok(subject))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    status = psa_export_public_key(key->key_id, public_key, sizeof(public_key), &public_key_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (public_key_len != CSR_PUBLIC_KEY_SIZE)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    /* Lengths, then the info into the hash only */
+    der_writer_init(&w);
+    csr_put_info(&w, subject, public_key);
+    sha256_sw_init(&hash);
+    der_writer_emit(&w, NULL, NULL, &hash);
+    csr_put_info(&w, subject, public_key);
+    info_len = w.len;
+    sha256_sw_finish(&hash, digest);
+    if (!der_writer_ok(&w))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    status = psa_sign_hash(key->key_id, key->alg, digest, sizeof(digest),
+                           signature, 2U * CSR_COORD_SIZE, &signature_len);
+    if (status == PSA_SUCCESS)
+    {
+        status = ecdsa_raw_to_der(signature, signature_len, signature, sizeof(signature), &signature_len);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    /* The signature length fixes the outer header; stream everything */
+    tail_len = 2U + sizeof(csr_alg_ecdsa_sha256) + der_header_size(signature_len + 1U) + signature_len + 1U;
+    if (format == CSR_FORMAT_PEM)
+    {
+        csr_pem_init(&pem, sink, arg);
+        csr_pem_text(&pem, CSR_PEM_BEGIN);
+        der_writer_emit(&w, csr_pem_sink, &pem, NULL);
+    }
+    else
+    {
+        der_writer_emit(&w, sink, arg, NULL);
+    }
+    der_put_header(&w, DER_TAG_SEQUENCE, info_len + tail_len);
+    csr_put_info(&w, subject, public_key);
+    der_put_tlv(&w, DER_TAG_SEQUENCE, csr_alg_ecdsa_sha256, sizeof(csr_alg_ecdsa_sha256));
+    der_put_bit_string(&w, signature, signature_len);
+    if (format == CSR_FORMAT_PEM)
+    {
+        csr_pem_finish(&pem);
+    }
+    if (!der_writer_ok(&w))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (out_len != NULL)
+    {
+        *out_len = (format == CSR_FORMAT_PEM) ? pem.len : w.len;
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t csr_write_buffer(signing_key_t *key, const csr_subject_t *subject, csr_format_t format,
+                              uint8_t *out, size_t out_size, size_t *out_len)
+{
+    der_buffer_t buffer;
+    psa_status_t status;
+
+    der_buffer_init(&buffer, out, out_size);
+    status = csr_write(key, subject, format, der_sink_buffer, &buffer, NULL);
+    if ((status == PSA_SUCCESS) && buffer.overflow)
+    {
+        status = PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    if ((status == PSA_SUCCESS) && (out_len != NULL))
+    {
+        *out_len = buffer.len;
+    }
+    return status;
+}
+
+/**
+ * @brief Check the signature at the end of a random-nonce test request
+ *
+ * @param[in] out      Request
+ * @param[in] out_len  Its length
+ * @param[in] info_at  Offset of the info
+ */
+static psa_status_t csr_self_test_signature(const signing_key_t *key, const uint8_t *out, size_t out_len,
+                                            size_t info_at)
+{
+    /* info | 30 0A ecdsa-with-SHA256 | 03 len 00 | DER signature */
+    size_t sig_at = info_at + CSR_TEST_INFO_SIZE + 2U + sizeof(csr_alg_ecdsa_sha256) + 3U;
+    uint8_t raw[2U * CSR_COORD_SIZE];
+
+    if ((sig_at >= out_len) ||
+        (ecdsa_der_to_raw(&out[sig_at], out_len - sig_at, CSR_COORD_SIZE, raw, sizeof(raw)) != PSA_SUCCESS) ||
+        (psa_verify_hash(key->key_id, key->alg, csr_test_digest, sizeof(csr_test_digest),
+                         raw, sizeof(raw)) != PSA_SUCCESS))
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t csr_self_test(void)
+{
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    uint8_t out[sizeof(csr_test_request) + 2U];
+    signing_key_t key;
+    size_t out_len = 0;
+    size_t info_at;
+    psa_status_t status;
+
+    status = signing_key_import(&config, csr_test_key, sizeof(csr_test_key), &key);
+    if (status == PSA_ERROR_NOT_SUPPORTED)
+    {
+        config.nonce = SIGNING_NONCE_RANDOM;
+        status = signing_key_import(&config, csr_test_key, sizeof(csr_test_key), &key);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = csr_write_buffer(&key, &csr_test_subject, CSR_FORMAT_DER, out, sizeof(out), &out_len);
+    if (status == PSA_SUCCESS)
+    {
+        if (config.nonce == SIGNING_NONCE_DETERMINISTIC)
+        {
+            if ((out_len != sizeof(csr_test_request)) || (memcmp(out, csr_test_request, out_len) != 0))
+            {
+                status = PSA_ERROR_CORRUPTION_DETECTED;
+            }
+        }
+        else
+        {
+            /* The signature length may move the info by a byte */
+            info_at = ((out[1] & 0x80U) != 0U) ? (2U + (out[1] & 0x7FU)) : 2U;
+            if ((out_len < (info_at + CSR_TEST_INFO_SIZE)) ||
+                (memcmp(&out[info_at], &csr_test_request[CSR_TEST_INFO_OFFSET], CSR_TEST_INFO_SIZE) != 0))
+            {
+                status = PSA_ERROR_CORRUPTION_DETECTED;
+            }
+            else
+            {
+                status = csr_self_test_signature(&key, out, out_len, info_at);
+            }
+        }
+    }
+    signing_key_destroy(&key);
+
+    return status;
+}
+
+/* [] END OF FILE */
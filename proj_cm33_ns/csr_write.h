@@ -0,0 +1,139 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Certificate signing request
+ * Purpose : Produce the PKCS#10 (RFC 2986) request a device sends to the
+ *           enrollment CA, signed with its own PSA key, in DER or PEM,
+ *           without a buffer for the whole request.
+ * Design  : The request is
+ *             SEQUENCE { info, ecdsa-with-SHA256, BIT STRING signature }
+ *             info = SEQUENCE { 0, subject, SubjectPublicKeyInfo, [0] {} }
+ *           The info is encoded with the DER writer: a counting pass for
+ *           the lengths, an emitting pass into a software SHA-256 only,
+ *           then psa_sign_hash(); the DER signature fixes the outer length,
+ *           and a last emitting pass streams the whole request to the
+ *           sink, through a base64 line encoder for PEM. Nothing but the
+ *           writer's length table, the hash state, the public key and the
+ *           signature is held, all on the stack; the request size does not
+ *           change that.
+ *
+ *           The subject has a common name and optional organization,
+ *           country and serialNumber attributes; no extension request is
+ *           added, the CA sets usage and lifetime.
+ ********************************************************************************
+ * @file    csr_write.h
+ * @brief   Streaming PKCS#10 CSR generation, ECDSA P-256, DER or PEM
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef CSR_WRITE_H
+#define CSR_WRITE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "der_write.h"
+#include "psa/crypto.h"
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Base64 characters per PEM line (RFC 7468) */
+#define CSR_PEM_LINE                  (64U)
+
+/** @brief Longest subject attribute value */
+#define CSR_ATTRIBUTE_MAX             (64U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Output encoding */
+typedef enum
+{
+    CSR_FORMAT_DER,
+    CSR_FORMAT_PEM              /**< "-----BEGIN CERTIFICATE REQUEST-----", LF line ends */
+} csr_format_t;
+
+/** @brief Subject distinguished name; NULL leaves an attribute out */
+typedef struct
+{
+    const char *common_name;    /**< Required, UTF8String             */
+    const char *organization;   /**< UTF8String                       */
+    const char *country;        /**< Two letters, PrintableString     */
+    const char *serial_number;  /**< PrintableString, e.g. device UID */
+} csr_subject_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Write a signed request to a sink
+ *
+ * @param[in]  key      ECDSA P-256 key; its public half goes in the request
+ * @param[in]  subject  Subject name
+ * @param[in]  format   DER or PEM
+ * @param[in]  sink     Receives the output in pieces; for PEM one call per
+ *                      line, including its LF
+ * @param[in]  arg      Context of @p sink
+ * @param[out] out_len  Bytes passed to @p sink, or NULL
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_NOT_SUPPORTED for a key other than ECDSA
+ *         P-256, PSA_ERROR_INVALID_ARGUMENT for a missing common name or
+ *         an attribute that is too long or not printable, or the
+ *         psa_export_public_key() / psa_sign_hash() error
+ */
+psa_status_t csr_write(signing_key_t *key, const csr_subject_t *subject, csr_format_t format,
+                       der_sink_fn_t sink, void *arg, size_t *out_len);
+
+/**
+ * @brief csr_write() into a buffer
+ *
+ * @return As csr_write(), or PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t csr_write_buffer(signing_key_t *key, const csr_subject_t *subject, csr_format_t format,
+                              uint8_t *out, size_t out_size, size_t *out_len);
+
+/**
+ * @brief Check the encoder against a known answer
+ *
+ * Writes a DER request for a fixed subject with the RFC 6979 A.2.5 key
+ * and a deterministic nonce and compares it with the expected bytes,
+ * which OpenSSL verifies. If TF-M has no deterministic ECDSA, the info is
+ * compared and the signature verified instead.
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_CORRUPTION_DETECTED on a mismatch, or the
+ *         key import or csr_write() error
+ */
+psa_status_t csr_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CSR_WRITE_H */
+/* [] END OF FILE */
@@ -0,0 +1,242 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : DER writer
+ * Purpose : Length recording, header emission, primitive elements and the
+ *           buffer sink.
+ ********************************************************************************
+ * @file    der_write.c
+ * @brief   Streaming two-pass DER encoder with optional hashing
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "der_write.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+void der_writer_init(der_writer_t *w)
+{
+    memset(w, 0, sizeof(*w));
+    w->counting = true;
+}
+
+void der_writer_emit(der_writer_t *w, der_sink_fn_t sink, void *arg, sha256_sw_ctx_t *hash)
+{
+    if (w->depth != 0U)
+    {
+        w->error = true;                /* Unbalanced der_open() / der_close() */
+    }
+    if (w->counting)
+    {
+        w->elements = w->count;
+        w->counting = false;
+    }
+    w->sink = sink;
+    w->sink_arg = arg;
+    w->hash = hash;
+    w->len = 0;
+    w->depth = 0;
+    w->count = 0;
+}
+
+void der_put_raw(der_writer_t *w, const void *data, size_t len)
+{
+    if (w->error)
+    {
+        return;
+    }
+    if (!w->counting)
+    {
+        if (w->hash != NULL)
+        {
+            sha256_sw_update(w->hash, (const uint8_t *)data, len);
+        }
+        if (w->sink != NULL)
+        {
+            w->sink(w->sink_arg, (const uint8_t *)data, len);
+        }
+    }
+    w->len += len;
+}
+
+size_t der_header_size(size_t len)
+{
+    if (len < 0x80U)
+    {
+        return 2U;
+    }
+    return (len <= 0xFFU) ? 3U : 4U;
+}
+
+void der_put_header(der_writer_t *w, uint8_t tag, size_t len)
+{
+    uint8_t head[DER_HEADER_MAX];
+    size_t size = der_header_size(len);
+
+    if (len > 0xFFFFU)
+    {
+        w->error = true;
+        return;
+    }
+    head[0] = tag;
+    if (size == 2U)
+    {
+        head[1] = (uint8_t)len;
+    }
+    else
+    {
+        head[1] = (uint8_t)(0x80U | (size - 2U));
+        head[2] = (uint8_t)(len >> (8U * (size - 3U)));
+        head[3] = (uint8_t)len;
+    }
+    der_put_raw(w, head, size);
+}
+
+void der_put_tlv(der_writer_t *w, uint8_t tag, const void *data, size_t len)
+{
+    der_put_header(w, tag, len);
+    der_put_raw(w, data, len);
+}
+
+void der_put_uint(der_writer_t *w, const uint8_t *be, size_t len)
+{
+    static const uint8_t zero = 0U;
+
+    while ((len > 1U) && (be[0] == 0U))
+    {
+        be++;
+        len--;
+    }
+    if (len == 0U)
+    {
+        der_put_tlv(w, DER_TAG_INTEGER, &zero, 1U);
+    }
+    else if ((be[0] & 0x80U) != 0U)
+    {
+        der_put_header(w, DER_TAG_INTEGER, len + 1U);
+        der_put_raw(w, &zero, 1U);
+        der_put_raw(w, be, len);
+    }
+    else
+    {
+        der_put_tlv(w, DER_TAG_INTEGER, be, len);
+    }
+}
+
+void der_put_bit_string(der_writer_t *w, const uint8_t *data, size_t len)
+{
+    static const uint8_t unused = 0U;
+
+    der_put_header(w, DER_TAG_BIT_STRING, len + 1U);
+    der_put_raw(w, &unused, 1U);
+    der_put_raw(w, data, len);
+}
+
+void der_put_string(der_writer_t *w, uint8_t tag, const char *text)
+{
+    der_put_tlv(w, tag, text, strlen(text));
+}
+
+void der_open(der_writer_t *w, uint8_t tag)
+{
+    uint8_t element = w->count;
+
+    if ((w->depth >= DER_WRITER_DEPTH_MAX) || (element >= DER_WRITER_ELEMENTS_MAX) ||
+        (!w->counting && (element >= w->elements)))
+    {
+        w->error = true;
+    }
+    if (w->error)
+    {
+        return;
+    }
+
+    if (w->counting)
+    {
+        /* The header size is only known at der_close() */
+        w->lengths[element] = 0U;
+    }
+    else
+    {
+        der_put_header(w, tag, w->lengths[element]);
+    }
+    w->count++;
+    w->open[w->depth] = element;
+    w->start[w->depth] = w->len;
+    w->depth++;
+}
+
+void der_close(der_writer_t *w)
+{
+    size_t contents;
+    uint8_t element;
+
+    if (w->depth == 0U)
+    {
+        w->error = true;
+    }
+    if (w->error)
+    {
+        return;
+    }
+
+    w->depth--;
+    element = w->open[w->depth];
+    contents = w->len - w->start[w->depth];
+    if (w->counting)
+    {
+        if (contents > 0xFFFFU)
+        {
+            w->error = true;
+            return;
+        }
+        w->lengths[element] = (uint16_t)contents;
+        w->len += der_header_size(contents);
+    }
+    else if (contents != w->lengths[element])
+    {
+        w->error = true;
+    }
+}
+
+void der_buffer_init(der_buffer_t *b, uint8_t *buf, size_t size)
+{
+    b->buf = buf;
+    b->size = size;
+    b->len = 0;
+    b->overflow = false;
+}
+
+void der_sink_buffer(void *arg, const uint8_t *data, size_t len)
+{
+    der_buffer_t *b = (der_buffer_t *)arg;
+
+    if (b->overflow || (len > (b->size - b->len)))
+    {
+        b->overflow = true;
+        return;
+    }
+    memcpy(&b->buf[b->len], data, len);
+    b->len += len;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,185 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : DER writer
+ * Purpose : Encode ASN.1 DER structures to a byte sink without building
+ *           them in a buffer first.
+ * Design  : DER puts the length of every constructed element before its
+ *           contents. The encoding code therefore runs twice over one
+ *           der_writer_t: a counting pass records the contents length of
+ *           each der_open() / der_close() pair, in opening order, in a
+ *           fixed table of DER_WRITER_ELEMENTS_MAX entries; an emitting
+ *           pass writes every header from that table and hands each byte
+ *           to the sink and, if set, a software SHA-256. The emitting pass
+ *           can be repeated (e.g. once into a hash only, once to the
+ *           output). The writer holds no output, only the table, so its
+ *           size is fixed whatever is encoded. Errors are sticky: nesting
+ *           too deep, too many elements, contents over 0xFFFF bytes or an
+ *           emitting pass that differs from the count make
+ *           der_writer_ok() return false.
+ ********************************************************************************
+ * @file    der_write.h
+ * @brief   Streaming two-pass DER encoder with optional hashing
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef DER_WRITE_H
+#define DER_WRITE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha256_sw.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Constructed elements open at once */
+#ifndef DER_WRITER_DEPTH_MAX
+#define DER_WRITER_DEPTH_MAX          (8U)
+#endif
+
+/** @brief Constructed elements per encoding */
+#ifndef DER_WRITER_ELEMENTS_MAX
+#define DER_WRITER_ELEMENTS_MAX       (32U)
+#endif
+
+/** @brief Largest header: tag and a 2-byte length (contents up to 0xFFFF) */
+#define DER_HEADER_MAX                (4U)
+
+/** @brief ASN.1 universal tags */
+#define DER_TAG_INTEGER               (0x02U)
+#define DER_TAG_BIT_STRING            (0x03U)
+#define DER_TAG_OCTET_STRING          (0x04U)
+#define DER_TAG_OID                   (0x06U)
+#define DER_TAG_UTF8_STRING           (0x0CU)
+#define DER_TAG_PRINTABLE_STRING      (0x13U)
+#define DER_TAG_SEQUENCE              (0x30U)
+#define DER_TAG_SET                   (0x31U)
+
+/** @brief Context-specific constructed tag [n] */
+#define DER_TAG_CONTEXT(n)            (0xA0U | (n))
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Receives encoded bytes in order
+ *
+ * @param[in] arg   Caller context
+ * @param[in] data  Next bytes
+ * @param[in] len   Length of @p data
+ */
+typedef void (*der_sink_fn_t)(void *arg, const uint8_t *data, size_t len);
+
+/** @brief Encoder state */
+typedef struct
+{
+    der_sink_fn_t    sink;      /**< Emitting pass output, or NULL        */
+    void            *sink_arg;
+    sha256_sw_ctx_t *hash;      /**< Fed with every byte emitted, or NULL */
+    size_t           len;       /**< Bytes emitted (or counted) this pass */
+    bool             counting;
+    bool             error;
+    uint8_t          depth;     /**< Elements open                        */
+    uint8_t          count;     /**< Elements opened this pass            */
+    uint8_t          elements;  /**< Elements of the counting pass        */
+    uint8_t          open[DER_WRITER_DEPTH_MAX];        /**< Element number per level */
+    size_t           start[DER_WRITER_DEPTH_MAX];       /**< len after its header     */
+    uint16_t         lengths[DER_WRITER_ELEMENTS_MAX];  /**< Contents length          */
+} der_writer_t;
+
+/** @brief der_sink_buffer() target */
+typedef struct
+{
+    uint8_t *buf;
+    size_t   size;
+    size_t   len;
+    bool     overflow;
+} der_buffer_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Start the counting pass */
+void der_writer_init(der_writer_t *w);
+
+/**
+ * @brief Start an emitting pass over the same encoding
+ *
+ * @param[in] sink  Output, or NULL (e.g. to hash only)
+ * @param[in] arg   Context of @p sink
+ * @param[in] hash  Digest fed with the emitted bytes, or NULL
+ */
+void der_writer_emit(der_writer_t *w, der_sink_fn_t sink, void *arg, sha256_sw_ctx_t *hash);
+
+/** @brief True while the encoding is consistent */
+static inline bool der_writer_ok(const der_writer_t *w)
+{
+    return !w->error;
+}
+
+/** @brief Append bytes, e.g. contents or an element encoded elsewhere */
+void der_put_raw(der_writer_t *w, const void *data, size_t len);
+
+/** @brief Append a tag and a contents length */
+void der_put_header(der_writer_t *w, uint8_t tag, size_t len);
+
+/** @brief Append a primitive element */
+void der_put_tlv(der_writer_t *w, uint8_t tag, const void *data, size_t len);
+
+/** @brief Unsigned INTEGER from big-endian bytes (leading zeros dropped, sign byte added) */
+void der_put_uint(der_writer_t *w, const uint8_t *be, size_t len);
+
+/** @brief BIT STRING without unused bits */
+void der_put_bit_string(der_writer_t *w, const uint8_t *data, size_t len);
+
+/** @brief String element, NUL terminated */
+void der_put_string(der_writer_t *w, uint8_t tag, const char *text);
+
+/** @brief Open a constructed element; its contents follow */
+void der_open(der_writer_t *w, uint8_t tag);
+
+/** @brief Close the innermost open element */
+void der_close(der_writer_t *w);
+
+/** @brief Encoded size of a header for @p len contents bytes */
+size_t der_header_size(size_t len);
+
+/** @brief Start a buffer sink */
+void der_buffer_init(der_buffer_t *b, uint8_t *buf, size_t size);
+
+/** @brief der_sink_fn_t appending to a der_buffer_t; sets overflow if full */
+void der_sink_buffer(void *arg, const uint8_t *data, size_t len);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DER_WRITE_H */
+/* [] END OF FILE */
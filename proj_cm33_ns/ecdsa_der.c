@@ -0,0 +1,401 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : ECDSA signature encoding
+ * Purpose : Constant-time INTEGER encoding, strict DER parsing, batch
+ *           conversion and the known-answer self-test.
+ ********************************************************************************
+ * @file    ecdsa_der.c
+ * @brief   Raw r || s and DER ECDSA signature conversion
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "ecdsa_der.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief ASN.1 tags */
+#define ECDSA_DER_TAG_INTEGER         (0x02U)
+#define ECDSA_DER_TAG_SEQUENCE        (0x30U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief DER input the decoder must reject */
+typedef struct
+{
+    const uint8_t *der;
+    size_t         len;
+} ecdsa_der_reject_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief RFC 6979 A.2.5 "sample" signature: both integers need a 0x00 pad */
+static const uint8_t ecdsa_der_kat1_raw[64] =
+{
+    0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD, 0x9C, 0xD4, 0x5E, 0x81, 0xD6,
+    0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16,
+    0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36, 0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65,
+    0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06, 0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8
+};
+
+static const uint8_t ecdsa_der_kat1_der[] =
+{
+    0x30, 0x46, 0x02, 0x21, 0x00, 0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD,
+    0x9C, 0xD4, 0x5E, 0x81, 0xD6, 0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D, 0x0E,
+    0xA8, 0x4E, 0xAF, 0x37, 0x16, 0x02, 0x21, 0x00, 0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41,
+    0xD4, 0x36, 0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65, 0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06,
+    0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8
+};
+
+/** @brief r with two leading zero bytes and s == 1: both integers shrink */
+static const uint8_t ecdsa_der_kat2_raw[64] =
+{
+    0x00, 0x00, 0x7F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+static const uint8_t ecdsa_der_kat2_der[] =
+{
+    0x30, 0x23, 0x02, 0x1E, 0x7F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x02, 0x01, 0x01
+};
+
+/* P-256 encodings that are BER at best */
+static const uint8_t ecdsa_der_bad_pad[]      = { 0x30, 0x07, 0x02, 0x02, 0x00, 0x01, 0x02, 0x01, 0x01 };
+static const uint8_t ecdsa_der_bad_negative[] = { 0x30, 0x06, 0x02, 0x01, 0x80, 0x02, 0x01, 0x01 };
+static const uint8_t ecdsa_der_bad_empty[]    = { 0x30, 0x05, 0x02, 0x00, 0x02, 0x01, 0x01 };
+static const uint8_t ecdsa_der_bad_trailing[] = { 0x30, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00 };
+static const uint8_t ecdsa_der_bad_long[]     = { 0x30, 0x81, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01 };
+static const uint8_t ecdsa_der_bad_inner[]    = { 0x30, 0x06, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01 };
+static const uint8_t ecdsa_der_bad_tag[]      = { 0x30, 0x06, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01 };
+
+static const ecdsa_der_reject_t ecdsa_der_rejects[] =
+{
+    { ecdsa_der_bad_pad,      sizeof(ecdsa_der_bad_pad)      },
+    { ecdsa_der_bad_negative, sizeof(ecdsa_der_bad_negative) },
+    { ecdsa_der_bad_empty,    sizeof(ecdsa_der_bad_empty)    },
+    { ecdsa_der_bad_trailing, sizeof(ecdsa_der_bad_trailing) },
+    { ecdsa_der_bad_long,     sizeof(ecdsa_der_bad_long)     },
+    { ecdsa_der_bad_inner,    sizeof(ecdsa_der_bad_inner)    },
+    { ecdsa_der_bad_tag,      sizeof(ecdsa_der_bad_tag)      }
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief All ones if bit 0 of @p bit is set, else zero */
+static inline uint32_t ecdsa_der_mask(uint32_t bit)
+{
+    return 0U - (bit & 1U);
+}
+
+/**
+ * @brief Build the contents of one INTEGER without value-dependent branches
+ *
+ * @param[in]  value  Big-endian coordinate, @p n bytes
+ * @param[in]  n      Coordinate size
+ * @param[out] t      Contents, left aligned; n + 1 bytes are written
+ *
+ * @return Length of the contents
+ */
+static size_t ecdsa_der_int_encode(const uint8_t *value, size_t n, uint8_t *t)
+{
+    uint32_t seen = 0;
+    uint32_t zeros = 0;
+    uint32_t first = 0;
+    uint32_t shift;
+
+    /* t = 0x00 || value; count the leading zero bytes and find the first
+     * non-zero one */
+    t[0] = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t b = value[i];
+        uint32_t nonzero = (b | (0U - b)) >> 31;
+
+        first |= b & ecdsa_der_mask(nonzero & ~seen);
+        seen |= nonzero;
+        zeros += 1U - seen;
+        t[i + 1U] = (uint8_t)b;
+    }
+    /* Zero is one 0x00 byte; a set top bit keeps the 0x00 in front */
+    zeros -= 1U - seen;
+    shift = zeros + 1U - (first >> 7);
+
+    /* Shift t left by 0..n bytes, one conditional power-of-two step at a time */
+    for (uint32_t k = 0, step = 1U; step <= n; k++, step <<= 1)
+    {
+        uint32_t m = ecdsa_der_mask(shift >> k);
+
+        for (size_t i = 0; i <= n; i++)
+        {
+            uint32_t src = ((i + step) <= n) ? t[i + step] : 0U;
+
+            t[i] = (uint8_t)((t[i] & ~m) | (src & m));
+        }
+    }
+    return (n + 1U) - shift;
+}
+
+/**
+ * @brief Parse one strict DER INTEGER into a zero-padded coordinate
+ *
+ * @return Position after the INTEGER, or NULL if it is malformed or longer
+ *         than @p n bytes
+ */
+static const uint8_t *ecdsa_der_int_decode(const uint8_t *p, const uint8_t *end, size_t n, uint8_t *out)
+{
+    size_t len;
+
+    if (((size_t)(end - p) < 2U) || (p[0] != ECDSA_DER_TAG_INTEGER))
+    {
+        return NULL;
+    }
+    len = p[1];
+    p += 2;
+    if ((len == 0U) || (len >= 0x80U) || (len > (size_t)(end - p)) || ((p[0] & 0x80U) != 0U))
+    {
+        return NULL;
+    }
+    if (p[0] == 0U)
+    {
+        /* A leading zero is only allowed in front of a set top bit */
+        if ((len > 1U) && ((p[1] & 0x80U) == 0U))
+        {
+            return NULL;
+        }
+        if (len > 1U)
+        {
+            p++;
+            len--;
+        }
+    }
+    if (len > n)
+    {
+        return NULL;
+    }
+    memset(out, 0, n - len);
+    memcpy(&out[n - len], p, len);
+    return p + len;
+}
+
+psa_status_t ecdsa_raw_to_der(const uint8_t *raw, size_t raw_len,
+                              uint8_t *der, size_t der_size, size_t *der_len)
+{
+    uint8_t r[ECDSA_DER_COORD_MAX + 1U];
+    uint8_t s[ECDSA_DER_COORD_MAX + 1U];
+    size_t n = raw_len / 2U;
+    size_t r_len;
+    size_t s_len;
+    size_t body;
+
+    if ((n == 0U) || (n > ECDSA_DER_COORD_MAX) || ((raw_len % 2U) != 0U))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Both integers are built before the output is touched, so der may be raw */
+    r_len = ecdsa_der_int_encode(raw, n, r);
+    s_len = ecdsa_der_int_encode(&raw[n], n, s);
+    body = 2U + r_len + 2U + s_len;
+    if (der_size < (2U + body))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    der[0] = ECDSA_DER_TAG_SEQUENCE;
+    der[1] = (uint8_t)body;
+    der[2] = ECDSA_DER_TAG_INTEGER;
+    der[3] = (uint8_t)r_len;
+    memcpy(&der[4], r, r_len);
+    der[4U + r_len] = ECDSA_DER_TAG_INTEGER;
+    der[5U + r_len] = (uint8_t)s_len;
+    memcpy(&der[6U + r_len], s, s_len);
+    *der_len = 2U + body;
+    return PSA_SUCCESS;
+}
+
+psa_status_t ecdsa_der_to_raw(const uint8_t *der, size_t der_len, size_t coord_size,
+                              uint8_t *raw, size_t raw_size)
+{
+    uint8_t r[ECDSA_DER_COORD_MAX];
+    uint8_t s[ECDSA_DER_COORD_MAX];
+    const uint8_t *end = der + der_len;
+    const uint8_t *p;
+
+    if ((coord_size == 0U) || (coord_size > ECDSA_DER_COORD_MAX))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (raw_size < (2U * coord_size))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    if ((der_len < 2U) || (der[0] != ECDSA_DER_TAG_SEQUENCE) || (der[1] >= 0x80U) ||
+        (((size_t)der[1] + 2U) != der_len))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+
+    p = ecdsa_der_int_decode(&der[2], end, coord_size, r);
+    if (p != NULL)
+    {
+        p = ecdsa_der_int_decode(p, end, coord_size, s);
+    }
+    if (p != end)
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    memcpy(raw, r, coord_size);
+    memcpy(&raw[coord_size], s, coord_size);
+    return PSA_SUCCESS;
+}
+
+psa_status_t ecdsa_raw_to_der_batch(const uint8_t *raw, size_t coord_size, size_t count,
+                                    uint8_t *der, size_t der_size, size_t *der_len, size_t *done)
+{
+    psa_status_t status = PSA_SUCCESS;
+    size_t len = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        size_t n = 0;
+
+        status = ecdsa_raw_to_der(&raw[i * 2U * coord_size], 2U * coord_size,
+                                  &der[len], der_size - len, &n);
+        if (status != PSA_SUCCESS)
+        {
+            break;
+        }
+        len += n;
+    }
+    *der_len = len;
+    *done = i;
+    return status;
+}
+
+psa_status_t ecdsa_der_to_raw_batch(const uint8_t *der, size_t der_len, size_t coord_size,
+                                    uint8_t *raw, size_t raw_count, size_t *done)
+{
+    psa_status_t status = PSA_SUCCESS;
+    size_t pos = 0;
+    size_t i = 0;
+
+    while (pos < der_len)
+    {
+        size_t record = 0;
+
+        /* The SEQUENCE header delimits the record; the parser checks the rest */
+        if ((der_len - pos) >= 2U)
+        {
+            record = 2U + der[pos + 1U];
+        }
+        if ((record < 2U) || (der[pos + 1U] >= 0x80U) || (record > (der_len - pos)))
+        {
+            status = PSA_ERROR_INVALID_SIGNATURE;
+            break;
+        }
+        if (i == raw_count)
+        {
+            status = PSA_ERROR_BUFFER_TOO_SMALL;
+            break;
+        }
+        status = ecdsa_der_to_raw(&der[pos], record, coord_size, &raw[i * 2U * coord_size], 2U * coord_size);
+        if (status != PSA_SUCCESS)
+        {
+            break;
+        }
+        pos += record;
+        i++;
+    }
+    *done = i;
+    return status;
+}
+
+psa_status_t ecdsa_der_self_test(void)
+{
+    static const struct
+    {
+        const uint8_t *raw;
+        const uint8_t *der;
+        size_t         der_len;
+    } kats[] =
+    {
+        { ecdsa_der_kat1_raw, ecdsa_der_kat1_der, sizeof(ecdsa_der_kat1_der) },
+        { ecdsa_der_kat2_raw, ecdsa_der_kat2_der, sizeof(ecdsa_der_kat2_der) }
+    };
+    uint8_t buf[ECDSA_DER_MAX_SIZE(32U)];
+    uint8_t raw[64];
+    size_t len = 0;
+
+    for (size_t i = 0; i < (sizeof(kats) / sizeof(kats[0])); i++)
+    {
+        /* Both directions in place */
+        memcpy(buf, kats[i].raw, sizeof(raw));
+        if ((ecdsa_raw_to_der(buf, sizeof(raw), buf, sizeof(buf), &len) != PSA_SUCCESS) ||
+            (len != kats[i].der_len) || (memcmp(buf, kats[i].der, len) != 0) ||
+            (ecdsa_der_to_raw(buf, len, 32U, buf, sizeof(buf)) != PSA_SUCCESS) ||
+            (memcmp(buf, kats[i].raw, sizeof(raw)) != 0))
+        {
+            return PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+
+    /* Zero encodes as a single 0x00 byte */
+    memset(raw, 0, sizeof(raw));
+    if ((ecdsa_raw_to_der(raw, sizeof(raw), buf, sizeof(buf), &len) != PSA_SUCCESS) || (len != 8U) ||
+        (buf[3] != 1U) || (buf[4] != 0U))
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+
+    for (size_t i = 0; i < (sizeof(ecdsa_der_rejects) / sizeof(ecdsa_der_rejects[0])); i++)
+    {
+        if (ecdsa_der_to_raw(ecdsa_der_rejects[i].der, ecdsa_der_rejects[i].len, 32U,
+                             raw, sizeof(raw)) != PSA_ERROR_INVALID_SIGNATURE)
+        {
+            return PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+
+    /* Integers one byte longer than the coordinate */
+    if (ecdsa_der_to_raw(ecdsa_der_kat1_der, sizeof(ecdsa_der_kat1_der), 31U,
+                         raw, sizeof(raw)) != PSA_ERROR_INVALID_SIGNATURE)
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    return PSA_SUCCESS;
+}
+
+/* [] END OF FILE */
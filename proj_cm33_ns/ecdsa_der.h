@@ -0,0 +1,142 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : ECDSA signature encoding
+ * Purpose : Convert between the raw r || s signatures PSA produces and the
+ *           DER ECDSA-Sig-Value that X.509, TLS and some backends expect.
+ * Design  : ECDSA-Sig-Value ::= SEQUENCE { r INTEGER, s INTEGER }. Each
+ *           integer drops its leading zero bytes and gets one 0x00 back if
+ *           its top bit is set, so the encoded length depends on the
+ *           value. The encoder finds the length and shifts the value into
+ *           place with masks and a fixed sequence of steps, so its timing
+ *           does not depend on r or s. The decoder accepts strict DER only
+ *           (minimal, positive integers, short-form lengths, no trailing
+ *           bytes); its branches depend on the length fields alone. Both
+ *           use the stack only and may convert in place (output buffer ==
+ *           input buffer). The batch functions convert a fixed-stride array
+ *           of raw signatures to back-to-back DER records and back.
+ ********************************************************************************
+ * @file    ecdsa_der.h
+ * @brief   Raw r || s and DER ECDSA signature conversion
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef ECDSA_DER_H
+#define ECDSA_DER_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest coordinate size supported (P-384) */
+#define ECDSA_DER_COORD_MAX           (48U)
+
+/** @brief Largest DER signature for a coordinate size (P-256: 72, P-384: 104) */
+#define ECDSA_DER_MAX_SIZE(coord_size) (2U + (2U * (3U + (coord_size))))
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Encode a raw r || s signature as DER
+ *
+ * @param[in]  raw       r || s, both coordinates of equal size
+ * @param[in]  raw_len   2 * coordinate size, at most 2 * ECDSA_DER_COORD_MAX
+ * @param[out] der       DER output; may be @p raw
+ * @param[in]  der_size  Capacity of @p der, ECDSA_DER_MAX_SIZE() always fits
+ * @param[out] der_len   Length of the DER signature
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT for an odd or oversized
+ *         @p raw_len, or PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t ecdsa_raw_to_der(const uint8_t *raw, size_t raw_len,
+                              uint8_t *der, size_t der_size, size_t *der_len);
+
+/**
+ * @brief Decode a DER signature to raw r || s
+ *
+ * @param[in]  der         DER signature, exactly @p der_len bytes
+ * @param[in]  der_len     Length of @p der
+ * @param[in]  coord_size  Coordinate size of the curve (32 for P-256)
+ * @param[out] raw         r || s output, 2 * @p coord_size bytes; may be @p der
+ * @param[in]  raw_size    Capacity of @p raw
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE if @p der is not a strict
+ *         DER signature with integers of at most @p coord_size bytes,
+ *         PSA_ERROR_INVALID_ARGUMENT or PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t ecdsa_der_to_raw(const uint8_t *der, size_t der_len, size_t coord_size,
+                              uint8_t *raw, size_t raw_size);
+
+/**
+ * @brief Encode @p count raw signatures as back-to-back DER records
+ *
+ * @param[in]  raw         count * 2 * @p coord_size bytes of r || s
+ * @param[in]  coord_size  Coordinate size of the curve
+ * @param[in]  count       Number of signatures
+ * @param[out] der         DER output, count * ECDSA_DER_MAX_SIZE() always fits
+ * @param[in]  der_size    Capacity of @p der
+ * @param[out] der_len     Bytes written
+ * @param[out] done        Signatures converted; on error, the failing one
+ *
+ * @return PSA_SUCCESS or the first ecdsa_raw_to_der() error
+ */
+psa_status_t ecdsa_raw_to_der_batch(const uint8_t *raw, size_t coord_size, size_t count,
+                                    uint8_t *der, size_t der_size, size_t *der_len, size_t *done);
+
+/**
+ * @brief Decode back-to-back DER records into a fixed-stride raw array
+ *
+ * @param[in]  der         DER records
+ * @param[in]  der_len     Length of @p der
+ * @param[in]  coord_size  Coordinate size of the curve
+ * @param[out] raw         Output, 2 * @p coord_size bytes per signature
+ * @param[in]  raw_count   Capacity of @p raw in signatures
+ * @param[out] done        Signatures converted; on error, the failing one
+ *
+ * @return PSA_SUCCESS once all of @p der is decoded, the first
+ *         ecdsa_der_to_raw() error, or PSA_ERROR_BUFFER_TOO_SMALL if
+ *         @p raw fills up first
+ */
+psa_status_t ecdsa_der_to_raw_batch(const uint8_t *der, size_t der_len, size_t coord_size,
+                                    uint8_t *raw, size_t raw_count, size_t *done);
+
+/**
+ * @brief Check both directions against known answers and malformed input
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_CORRUPTION_DETECTED on a mismatch
+ */
+psa_status_t ecdsa_der_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ECDSA_DER_H */
+/* [] END OF FILE */
@@ -0,0 +1,307 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Streaming image verification
+ * Purpose : Chunked flash hashing (overlapped only with an asynchronous
+ *           backend), the memory-mapped backend and the MCUboot header and
+ *           TLV parser.
+ ********************************************************************************
+ * @file    image_verify.c
+ * @brief   Chunked image hashing and signature check
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "ecdsa_der.h"
+#include "image_verify.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief MCUboot struct image_header size and field offsets */
+#define MCUBOOT_HDR_SIZE              (32U)
+#define MCUBOOT_HDR_HDR_SIZE          (8U)
+#define MCUBOOT_HDR_PROTECT_TLV_SIZE  (10U)
+#define MCUBOOT_HDR_IMG_SIZE          (12U)
+#define MCUBOOT_HDR_VERSION           (20U)
+
+/** @brief TLV area magic and the TLV types used here */
+#define MCUBOOT_TLV_INFO_MAGIC        (0x6907U)
+#define MCUBOOT_TLV_SHA256            (0x10U)
+#define MCUBOOT_TLV_ECDSA_SIG         (0x22U)
+
+/** @brief TLV info and TLV header size */
+#define MCUBOOT_TLV_HEADER_SIZE       (4U)
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static uint16_t image_get_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t image_get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static psa_status_t image_flash_read_mapped(void *ctx, uint32_t offset, uint8_t *buf, size_t len)
+{
+    memcpy(buf, (const uint8_t *)ctx + offset, len);
+    return PSA_SUCCESS;
+}
+
+void image_flash_init_mapped(image_flash_t *flash, const void *base, uint32_t size)
+{
+    flash->read = image_flash_read_mapped;
+    flash->wait = NULL;
+    flash->ctx = (void *)(uintptr_t)base;
+    flash->size = size;
+}
+
+/** @brief Read and wait for completion */
+static psa_status_t image_read(const image_flash_t *flash, uint32_t offset, uint8_t *buf, size_t len)
+{
+    psa_status_t status = flash->read(flash->ctx, offset, buf, len);
+
+    if ((status == PSA_SUCCESS) && (flash->wait != NULL))
+    {
+        status = flash->wait(flash->ctx);
+    }
+    return status;
+}
+
+void image_verify_init(image_verify_t *ctx, const image_flash_t *flash,
+                       image_verify_progress_fn_t progress, void *arg)
+{
+    ctx->flash = flash;
+    ctx->progress = progress;
+    ctx->progress_arg = arg;
+}
+
+psa_status_t image_verify_digest(image_verify_t *ctx, uint32_t offset, uint32_t len,
+                                 uint8_t digest[SHA256_SW_DIGEST_SIZE])
+{
+    const image_flash_t *flash = ctx->flash;
+    sha256_sw_ctx_t sha;
+    psa_status_t status = PSA_SUCCESS;
+    uint32_t done = 0;
+    uint32_t n = (len < IMAGE_VERIFY_CHUNK_SIZE) ? len : IMAGE_VERIFY_CHUNK_SIZE;
+    uint32_t cur = 0;
+
+    if ((offset > flash->size) || (len > (flash->size - offset)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    sha256_sw_init(&sha);
+    if (n != 0U)
+    {
+        status = flash->read(flash->ctx, offset, ctx->buf[cur], n);
+    }
+    while ((status == PSA_SUCCESS) && (done < len))
+    {
+        uint32_t next;
+
+        if (flash->wait != NULL)
+        {
+            status = flash->wait(flash->ctx);
+            if (status != PSA_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        /* Start the next read into the other buffer, then hash this one */
+        next = len - done - n;
+        next = (next < IMAGE_VERIFY_CHUNK_SIZE) ? next : IMAGE_VERIFY_CHUNK_SIZE;
+        if (next != 0U)
+        {
+            status = flash->read(flash->ctx, offset + done + n, ctx->buf[cur ^ 1U], next);
+        }
+        sha256_sw_update(&sha, ctx->buf[cur], n);
+        done += n;
+        if (ctx->progress != NULL)
+        {
+            ctx->progress(ctx->progress_arg, done, len);
+        }
+        cur ^= 1U;
+        n = next;
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        sha256_sw_finish(&sha, digest);
+    }
+    return status;
+}
+
+psa_status_t image_verify_signature(image_verify_t *ctx, uint32_t offset, uint32_t len,
+                                    psa_key_id_t key, const uint8_t *signature, size_t signature_len)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    psa_status_t status;
+
+    status = image_verify_digest(ctx, offset, len, digest);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_verify_hash(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), digest, sizeof(digest),
+                                 signature, signature_len);
+    }
+    return status;
+}
+
+psa_status_t image_verify_mcuboot(image_verify_t *ctx, psa_key_id_t key, image_verify_info_t *info)
+{
+    const image_flash_t *flash = ctx->flash;
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t signature[64];
+    uint8_t *hdr = ctx->buf[0];
+    bool hash_found = false;
+    bool signature_found = false;
+    uint64_t total;
+    uint32_t hashed_len;
+    uint32_t pos;
+    uint32_t end;
+    psa_status_t status;
+
+    if (info != NULL)
+    {
+        memset(info, 0, sizeof(*info));
+    }
+    if (flash->size < MCUBOOT_HDR_SIZE)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    status = image_read(flash, 0U, hdr, MCUBOOT_HDR_SIZE);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if ((image_get_le32(hdr) != IMAGE_MCUBOOT_MAGIC) ||
+        (image_get_le16(&hdr[MCUBOOT_HDR_HDR_SIZE]) < MCUBOOT_HDR_SIZE))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* 64-bit sum: three untrusted sizes must not wrap past the flash end */
+    total = (uint64_t)image_get_le16(&hdr[MCUBOOT_HDR_HDR_SIZE]) + image_get_le32(&hdr[MCUBOOT_HDR_IMG_SIZE]) +
+            image_get_le16(&hdr[MCUBOOT_HDR_PROTECT_TLV_SIZE]);
+    if ((total + MCUBOOT_TLV_HEADER_SIZE) > flash->size)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    hashed_len = (uint32_t)total;
+    if (info != NULL)
+    {
+        info->hashed_len = hashed_len;
+        info->version_major = hdr[MCUBOOT_HDR_VERSION];
+        info->version_minor = hdr[MCUBOOT_HDR_VERSION + 1U];
+        info->version_revision = image_get_le16(&hdr[MCUBOOT_HDR_VERSION + 2U]);
+        info->version_build = image_get_le32(&hdr[MCUBOOT_HDR_VERSION + 4U]);
+    }
+
+    status = image_verify_digest(ctx, 0U, hashed_len, digest);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    /* Unprotected TLV area: info header, then type | len | value entries */
+    status = image_read(flash, hashed_len, hdr, MCUBOOT_TLV_HEADER_SIZE);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if ((image_get_le16(hdr) != MCUBOOT_TLV_INFO_MAGIC) ||
+        (image_get_le16(&hdr[2]) > (flash->size - hashed_len)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    end = hashed_len + image_get_le16(&hdr[2]);
+    pos = hashed_len + MCUBOOT_TLV_HEADER_SIZE;
+
+    while ((status == PSA_SUCCESS) && (pos < end) && ((end - pos) >= MCUBOOT_TLV_HEADER_SIZE))
+    {
+        uint16_t type;
+        uint16_t len;
+
+        status = image_read(flash, pos, hdr, MCUBOOT_TLV_HEADER_SIZE);
+        if (status != PSA_SUCCESS)
+        {
+            break;
+        }
+        type = image_get_le16(hdr);
+        len = image_get_le16(&hdr[2]);
+        pos += MCUBOOT_TLV_HEADER_SIZE;
+        if (len > (end - pos))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (type == MCUBOOT_TLV_SHA256)
+        {
+            if (len != SHA256_SW_DIGEST_SIZE)
+            {
+                return PSA_ERROR_INVALID_SIGNATURE;
+            }
+            status = image_read(flash, pos, hdr, len);
+            if ((status == PSA_SUCCESS) && (memcmp(hdr, digest, len) != 0))
+            {
+                return PSA_ERROR_INVALID_SIGNATURE;
+            }
+            hash_found = true;
+        }
+        else if ((type == MCUBOOT_TLV_ECDSA_SIG) && (key != PSA_KEY_ID_NULL))
+        {
+            if (len > ECDSA_DER_MAX_SIZE(32U))
+            {
+                return PSA_ERROR_INVALID_SIGNATURE;
+            }
+            status = image_read(flash, pos, hdr, len);
+            if (status == PSA_SUCCESS)
+            {
+                status = ecdsa_der_to_raw(hdr, len, 32U, signature, sizeof(signature));
+            }
+            if (status == PSA_SUCCESS)
+            {
+                status = psa_verify_hash(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), digest, sizeof(digest),
+                                         signature, sizeof(signature));
+            }
+            signature_found = true;
+        }
+        pos += len;
+    }
+
+    if ((status == PSA_SUCCESS) && (!hash_found || ((key != PSA_KEY_ID_NULL) && !signature_found)))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    if ((status == PSA_SUCCESS) && (info != NULL))
+    {
+        info->signature_checked = (key != PSA_KEY_ID_NULL);
+    }
+    return status;
+}
+
+/* [] END OF FILE */
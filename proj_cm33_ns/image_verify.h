@@ -0,0 +1,190 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Streaming image verification
+ * Purpose : Check the signature of a firmware image in (external) flash at
+ *           runtime, e.g. a staged CM55 update, without reading the image
+ *           into RAM.
+ * Design  : The image is read through an image_flash_t in chunks of
+ *           IMAGE_VERIFY_CHUNK_SIZE into two buffers: while the software
+ *           SHA-256 hashes one, the next read is already started. Only a
+ *           backend whose read completes asynchronously (SMIF or DMA,
+ *           supplied by the caller) overlaps flash access and hashing. The
+ *           memory-mapped backend provided here (XIP window or RAM) copies
+ *           synchronously, so with it reads and hashing take turns and
+ *           the second buffer gains nothing. A progress callback
+ *           runs after every chunk, so a caller can keep serving the SRF
+ *           relay. The digest is then checked with psa_verify_hash(), which
+ *           is the only secure call.
+ *
+ *           image_verify_mcuboot() reads the MCUboot layout: image header
+ *           (MCUBOOT_HEADER_SIZE reserve), image, protected TLVs, then the
+ *           TLV area with the SHA-256 of everything before it and the DER
+ *           ECDSA P-256 signature of that hash.
+ ********************************************************************************
+ * @file    image_verify.h
+ * @brief   Chunked image hashing and signature check
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef IMAGE_VERIFY_H
+#define IMAGE_VERIFY_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+#include "sha256_sw.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Bytes per flash read; each of the two buffers has this size */
+#ifndef IMAGE_VERIFY_CHUNK_SIZE
+#define IMAGE_VERIFY_CHUNK_SIZE       (1024U)
+#endif
+
+/** @brief MCUboot image header magic */
+#define IMAGE_MCUBOOT_MAGIC           (0x96F3B83DUL)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Flash access used by the verifier */
+typedef struct
+{
+    /**
+     * Start reading @p len bytes at @p offset into @p buf. May return
+     * before the data is there if @ref wait is set.
+     */
+    psa_status_t (*read)(void *ctx, uint32_t offset, uint8_t *buf, size_t len);
+    /** Wait for the read in progress; NULL if read() is synchronous */
+    psa_status_t (*wait)(void *ctx);
+    void     *ctx;      /**< Backend state                   */
+    uint32_t  size;     /**< Readable bytes from offset 0    */
+} image_flash_t;
+
+/**
+ * @brief Called after every chunk
+ *
+ * @param[in] arg    Caller context
+ * @param[in] done   Bytes hashed so far
+ * @param[in] total  Bytes to hash
+ */
+typedef void (*image_verify_progress_fn_t)(void *arg, uint32_t done, uint32_t total);
+
+/** @brief Verifier state and read buffers */
+typedef struct
+{
+    const image_flash_t        *flash;
+    image_verify_progress_fn_t  progress;       /**< May be NULL */
+    void                       *progress_arg;
+    uint8_t                     buf[2][IMAGE_VERIFY_CHUNK_SIZE];
+} image_verify_t;
+
+/** @brief What image_verify_mcuboot() found */
+typedef struct
+{
+    uint32_t hashed_len;        /**< Header, image and protected TLVs        */
+    uint8_t  version_major;
+    uint8_t  version_minor;
+    uint16_t version_revision;
+    uint32_t version_build;
+    bool     signature_checked; /**< false if no key was given               */
+} image_verify_info_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Flash backend for memory-mapped storage (XIP window or RAM)
+ *
+ * @param[out] flash  Backend
+ * @param[in]  base   Address of offset 0
+ * @param[in]  size   Readable bytes
+ */
+void image_flash_init_mapped(image_flash_t *flash, const void *base, uint32_t size);
+
+/**
+ * @brief Prepare a verifier
+ *
+ * @param[out] ctx       Verifier; holds 2 * IMAGE_VERIFY_CHUNK_SIZE of buffers
+ * @param[in]  flash     Flash backend; must stay valid while @p ctx is used
+ * @param[in]  progress  Progress callback, or NULL
+ * @param[in]  arg       Passed to @p progress
+ */
+void image_verify_init(image_verify_t *ctx, const image_flash_t *flash,
+                       image_verify_progress_fn_t progress, void *arg);
+
+/**
+ * @brief SHA-256 of a flash range
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT for a range outside the
+ *         flash, or the backend's read error
+ */
+psa_status_t image_verify_digest(image_verify_t *ctx, uint32_t offset, uint32_t len,
+                                 uint8_t digest[SHA256_SW_DIGEST_SIZE]);
+
+/**
+ * @brief Check an ECDSA P-256 signature over a flash range
+ *
+ * @param[in] key            Public key or key pair
+ * @param[in] signature      Raw r || s
+ * @param[in] signature_len  Length of @p signature
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE, or an
+ *         image_verify_digest() error
+ */
+psa_status_t image_verify_signature(image_verify_t *ctx, uint32_t offset, uint32_t len,
+                                    psa_key_id_t key, const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Verify the MCUboot image at flash offset 0
+ *
+ * Hashes header, image and protected TLVs and compares the result with the
+ * SHA-256 TLV. If @p key is not PSA_KEY_ID_NULL, the ECDSA P-256 signature
+ * TLV must be present and verify under it.
+ *
+ * @param[in]  ctx   Verifier
+ * @param[in]  key   Public key, or PSA_KEY_ID_NULL to check the hash only
+ * @param[out] info  Image details, or NULL. Cleared first; only
+ *                   hashed_len and the version are set once the header
+ *                   parses, signature_checked on success
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT if the layout is not a
+ *         MCUboot image, PSA_ERROR_INVALID_SIGNATURE if the hash or the
+ *         signature does not match or is missing, or a read error
+ */
+psa_status_t image_verify_mcuboot(image_verify_t *ctx, psa_key_id_t key, image_verify_info_t *info);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* IMAGE_VERIFY_H */
+/* [] END OF FILE */
@@ -0,0 +1,325 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : JWS token minting
+ * Purpose : Base64url codec, header caching, token assembly and the
+ *           known-answer self-test.
+ ********************************************************************************
+ * @file    jws_token.c
+ * @brief   ES256 compact JWS minting with a cached header
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+#include <string.h>
+
+#include "jws_token.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Base64url known answer */
+typedef struct
+{
+    const char *in;
+    const char *out;
+} jws_b64_kat_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief RFC 4648 section 5 alphabet */
+static const char jws_b64url_alphabet[64] =
+{
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '_'
+};
+
+/** @brief RFC 4648 section 10 vectors, without padding */
+static const jws_b64_kat_t jws_b64_kats[] =
+{
+    { "",       ""         },
+    { "f",      "Zg"       },
+    { "fo",     "Zm8"      },
+    { "foo",    "Zm9v"     },
+    { "foob",   "Zm9vYg"   },
+    { "fooba",  "Zm9vYmE"  },
+    { "foobar", "Zm9vYmFy" }
+};
+
+/** @brief "f" and "fo" with nonzero unused bits in the last character */
+static const char *const jws_b64_noncanonical[] = { "Zh", "Zm9" };
+
+/** @brief RFC 6979 A.2.5 private key */
+static const uint8_t jws_test_key[32] =
+{
+    0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21, 0x57, 0x67, 0xB1, 0xD6, 0x93,
+    0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8, 0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21
+};
+
+/** @brief RFC 7515 A.3 header and payload */
+static const char jws_test_header[] = "{\"alg\":\"ES256\"}";
+static const char jws_test_claims[] =
+    "{\"iss\":\"joe\",\r\n \"exp\":1300819380,\r\n \"http://example.com/is_root\":true}";
+
+/** @brief Expected token; the signature is the RFC 6979 one under jws_test_key */
+static const char jws_test_token[] =
+    "eyJhbGciOiJFUzI1NiJ9"
+    ".eyJpc3MiOiJqb2UiLA0KICJleHAiOjEzMDA4MTkzODAsDQogImh0dHA6Ly9leGFtcGxlLmNvbS9pc19yb290Ijp0cnVlfQ"
+    ".SIB29dreyjzVyQVF6GnlL3sbJE6ikfr8BXK8hgKZ5bAhgp9clQSCZM9cmEiia3SJl1IskBfQySGX53VD6UDRlQ";
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+size_t jws_base64url_encode(const uint8_t *in, size_t len, char *out)
+{
+    char *start = out;
+
+    for (; len >= 3U; len -= 3U, in += 3U)
+    {
+        uint32_t v = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+
+        out[0] = jws_b64url_alphabet[v >> 18];
+        out[1] = jws_b64url_alphabet[(v >> 12) & 0x3FU];
+        out[2] = jws_b64url_alphabet[(v >> 6) & 0x3FU];
+        out[3] = jws_b64url_alphabet[v & 0x3FU];
+        out += 4;
+    }
+    if (len != 0U)
+    {
+        uint32_t v = (uint32_t)in[0] << 16;
+
+        if (len == 2U)
+        {
+            v |= (uint32_t)in[1] << 8;
+        }
+        *out++ = jws_b64url_alphabet[v >> 18];
+        *out++ = jws_b64url_alphabet[(v >> 12) & 0x3FU];
+        if (len == 2U)
+        {
+            *out++ = jws_b64url_alphabet[(v >> 6) & 0x3FU];
+        }
+    }
+    return (size_t)(out - start);
+}
+
+/** @brief Value of a base64url character, or 64 if it is none */
+static uint32_t jws_b64url_value(char c)
+{
+    if ((c >= 'A') && (c <= 'Z'))
+    {
+        return (uint32_t)(c - 'A');
+    }
+    if ((c >= 'a') && (c <= 'z'))
+    {
+        return (uint32_t)(c - 'a') + 26U;
+    }
+    if ((c >= '0') && (c <= '9'))
+    {
+        return (uint32_t)(c - '0') + 52U;
+    }
+    if (c == '-')
+    {
+        return 62U;
+    }
+    return (c == '_') ? 63U : 64U;
+}
+
+size_t jws_base64url_decode(const char *in, size_t len, uint8_t *out, size_t out_size)
+{
+    uint32_t v = 0;
+    uint32_t bits = 0;
+    size_t n = 0;
+
+    /* A single character left over in the last group carries no full byte */
+    if ((len % 4U) == 1U)
+    {
+        return SIZE_MAX;
+    }
+    for (size_t i = 0; i < len; i++)
+    {
+        uint32_t c = jws_b64url_value(in[i]);
+
+        if (c == 64U)
+        {
+            return SIZE_MAX;
+        }
+        v = (v << 6) | c;
+        bits += 6U;
+        if (bits >= 8U)
+        {
+            bits -= 8U;
+            if (n == out_size)
+            {
+                return SIZE_MAX;
+            }
+            out[n++] = (uint8_t)(v >> bits);
+        }
+    }
+    /* The bits left over must be zero, so each value has one encoding */
+    if ((v & ((1UL << bits) - 1U)) != 0U)
+    {
+        return SIZE_MAX;
+    }
+    return n;
+}
+
+psa_status_t jws_minter_init(jws_minter_t *ctx, signing_key_t *key,
+                             const char *header, size_t header_len)
+{
+    ctx->prefix.psa = psa_hash_operation_init();
+    if (key->scheme != SIGNING_SCHEME_ECDSA_P256)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (header_len > JWS_HEADER_MAX)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    ctx->header_len = jws_base64url_encode((const uint8_t *)header, header_len, ctx->header);
+    ctx->header[ctx->header_len++] = '.';
+    return signing_prefix_init(&ctx->prefix, key, (const uint8_t *)ctx->header, ctx->header_len);
+}
+
+psa_status_t jws_mint(jws_minter_t *ctx, const char *claims, size_t claims_len,
+                      char *token, size_t token_size, size_t *token_len)
+{
+    uint8_t signature[JWS_ES256_SIGNATURE_SIZE];
+    size_t signature_len = 0;
+    size_t claims_b64_len = JWS_BASE64URL_SIZE(claims_len);
+    size_t len = ctx->header_len;
+    psa_status_t status;
+
+    if (token_size < (len + claims_b64_len + 1U + JWS_BASE64URL_SIZE(JWS_ES256_SIGNATURE_SIZE) + 1U))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    memcpy(token, ctx->header, len);
+    len += jws_base64url_encode((const uint8_t *)claims, claims_len, &token[len]);
+
+    /* The midstate already holds "header."; hash the encoded claims only */
+    status = signing_prefix_sign(&ctx->prefix, (const uint8_t *)&token[ctx->header_len], claims_b64_len,
+                                 signature, sizeof(signature), &signature_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    token[len++] = '.';
+    len += jws_base64url_encode(signature, signature_len, &token[len]);
+    token[len] = '\0';
+    *token_len = len;
+    return PSA_SUCCESS;
+}
+
+void jws_minter_free(jws_minter_t *ctx)
+{
+    signing_prefix_free(&ctx->prefix);
+}
+
+psa_status_t jws_self_test(void)
+{
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    const size_t token_expected_len = sizeof(jws_test_token) - 1U;
+    const size_t signing_input_len = token_expected_len - 1U - JWS_BASE64URL_SIZE(JWS_ES256_SIGNATURE_SIZE);
+    char token[JWS_TOKEN_SIZE(sizeof(jws_test_header), sizeof(jws_test_claims))];
+    uint8_t signature[JWS_ES256_SIGNATURE_SIZE];
+    jws_minter_t minter;
+    signing_key_t key;
+    size_t token_len = 0;
+    psa_status_t status;
+
+    for (size_t i = 0; i < (sizeof(jws_b64_kats) / sizeof(jws_b64_kats[0])); i++)
+    {
+        const jws_b64_kat_t *kat = &jws_b64_kats[i];
+        size_t len = jws_base64url_encode((const uint8_t *)kat->in, strlen(kat->in), token);
+
+        if ((len != strlen(kat->out)) || (memcmp(token, kat->out, len) != 0) ||
+            (jws_base64url_decode(kat->out, len, signature, sizeof(signature)) != strlen(kat->in)) ||
+            (memcmp(signature, kat->in, strlen(kat->in)) != 0))
+        {
+            return PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    for (size_t i = 0; i < (sizeof(jws_b64_noncanonical) / sizeof(jws_b64_noncanonical[0])); i++)
+    {
+        if (jws_base64url_decode(jws_b64_noncanonical[i], strlen(jws_b64_noncanonical[i]),
+                                 signature, sizeof(signature)) != SIZE_MAX)
+        {
+            return PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+
+    status = signing_key_import(&config, jws_test_key, sizeof(jws_test_key), &key);
+    if (status == PSA_ERROR_NOT_SUPPORTED)
+    {
+        config.nonce = SIGNING_NONCE_RANDOM;
+        status = signing_key_import(&config, jws_test_key, sizeof(jws_test_key), &key);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = jws_minter_init(&minter, &key, jws_test_header, sizeof(jws_test_header) - 1U);
+    if (status == PSA_SUCCESS)
+    {
+        status = jws_mint(&minter, jws_test_claims, sizeof(jws_test_claims) - 1U,
+                          token, sizeof(token), &token_len);
+    }
+    if ((status == PSA_SUCCESS) &&
+        ((token_len != token_expected_len) || (memcmp(token, jws_test_token, signing_input_len) != 0)))
+    {
+        status = PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        if (config.nonce == SIGNING_NONCE_DETERMINISTIC)
+        {
+            if (memcmp(token, jws_test_token, token_len) != 0)
+            {
+                status = PSA_ERROR_CORRUPTION_DETECTED;
+            }
+        }
+        else if ((jws_base64url_decode(&token[signing_input_len + 1U], token_len - signing_input_len - 1U,
+                                       signature, sizeof(signature)) != sizeof(signature)) ||
+                 (signing_verify(&key, (const uint8_t *)token, signing_input_len,
+                                 signature, sizeof(signature)) != PSA_SUCCESS))
+        {
+            status = PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    jws_minter_free(&minter);
+    signing_key_destroy(&key);
+
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,167 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : JWS token minting
+ * Purpose : Mint short-lived ES256 compact JWS / JWT tokens for backend
+ *           authentication.
+ * Design  : A compact JWS is
+ *             b64url(header) "." b64url(claims) "." b64url(r || s)
+ *           and the signature covers everything before the second dot. The
+ *           header is the same for every token, so jws_minter_init()
+ *           encodes it once and hashes "b64url(header)." into a
+ *           signing_prefix_t midstate. jws_mint() copies the encoded header
+ *           into the caller's buffer, encodes the claims right behind it,
+ *           hashes only those and appends the encoded signature: one output
+ *           buffer, no intermediate copies. Base64url (RFC 4648 section 5,
+ *           no padding) is table driven, three bytes to four characters
+ *           per step.
+ ********************************************************************************
+ * @file    jws_token.h
+ * @brief   ES256 compact JWS minting with a cached header
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef JWS_TOKEN_H
+#define JWS_TOKEN_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest JSON header accepted by jws_minter_init() */
+#ifndef JWS_HEADER_MAX
+#define JWS_HEADER_MAX                (96U)
+#endif
+
+/** @brief Header of a plain ES256 JWT */
+#define JWS_HEADER_ES256_JWT          "{\"alg\":\"ES256\",\"typ\":\"JWT\"}"
+
+/** @brief ES256 signature size (r || s) */
+#define JWS_ES256_SIGNATURE_SIZE      (64U)
+
+/** @brief Unpadded base64url length of @p n bytes */
+#define JWS_BASE64URL_SIZE(n)         ((((n) * 4U) + 2U) / 3U)
+
+/** @brief Buffer size for a token, terminating NUL included */
+#define JWS_TOKEN_SIZE(header_len, claims_len) \
+    (JWS_BASE64URL_SIZE(header_len) + 1U + JWS_BASE64URL_SIZE(claims_len) + 1U + \
+     JWS_BASE64URL_SIZE(JWS_ES256_SIGNATURE_SIZE) + 1U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Token minter for one key and header */
+typedef struct
+{
+    signing_prefix_t prefix;        /**< Midstate over the encoded header and "." */
+    size_t           header_len;    /**< Length of @ref header, dot included      */
+    char             header[JWS_BASE64URL_SIZE(JWS_HEADER_MAX) + 1U];
+} jws_minter_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Base64url encode without padding
+ *
+ * @param[in]  in   Bytes to encode
+ * @param[in]  len  Number of bytes
+ * @param[out] out  JWS_BASE64URL_SIZE(len) characters; not NUL terminated
+ *
+ * @return Number of characters written
+ */
+size_t jws_base64url_encode(const uint8_t *in, size_t len, char *out);
+
+/**
+ * @brief Decode unpadded base64url
+ *
+ * @param[in]  in        Characters to decode
+ * @param[in]  len       Number of characters
+ * @param[out] out       Decoded bytes
+ * @param[in]  out_size  Capacity of @p out
+ *
+ * @return Number of bytes written, or SIZE_MAX if the input is not
+ *         canonical base64url (unused bits of the last character must be
+ *         zero) or does not fit
+ */
+size_t jws_base64url_decode(const char *in, size_t len, uint8_t *out, size_t out_size);
+
+/**
+ * @brief Encode and hash the protected header once
+ *
+ * @param[out] ctx         Minter
+ * @param[in]  key         ECDSA P-256 key; must stay valid while @p ctx is used
+ * @param[in]  header      JSON header, e.g. JWS_HEADER_ES256_JWT
+ * @param[in]  header_len  Length of @p header, at most JWS_HEADER_MAX
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_NOT_SUPPORTED for a key other than ECDSA
+ *         P-256, or PSA_ERROR_INVALID_ARGUMENT for an oversized header
+ */
+psa_status_t jws_minter_init(jws_minter_t *ctx, signing_key_t *key,
+                             const char *header, size_t header_len);
+
+/**
+ * @brief Mint one token
+ *
+ * @param[in]  ctx         Minter
+ * @param[in]  claims      JSON claims, e.g. {"sub":"dev-17","iat":..,"exp":..}
+ * @param[in]  claims_len  Length of @p claims
+ * @param[out] token       NUL-terminated compact JWS
+ * @param[in]  token_size  Capacity of @p token, see JWS_TOKEN_SIZE()
+ * @param[out] token_len   Token length without the NUL
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_BUFFER_TOO_SMALL, or the signing error
+ */
+psa_status_t jws_mint(jws_minter_t *ctx, const char *claims, size_t claims_len,
+                      char *token, size_t token_size, size_t *token_len);
+
+/** @brief Release the header midstate */
+void jws_minter_free(jws_minter_t *ctx);
+
+/**
+ * @brief Check base64url and minting against known answers
+ *
+ * Encodes the RFC 4648 test vectors, then mints a token with the RFC 7515
+ * (A.3) header and payload under the RFC 6979 (A.2.5) P-256 key and
+ * compares it with the expected token. Without deterministic ECDSA in
+ * TF-M, the signing input is compared and the signature verified instead.
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_CORRUPTION_DETECTED on a mismatch
+ */
+psa_status_t jws_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* JWS_TOKEN_H */
+/* [] END OF FILE */
@@ -0,0 +1,539 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : LMS / HSS signature verification
+ * Purpose : RFC 8554 section 6.3 / 5.4.2 / 4.6 verification on sha256_sw.
+ ********************************************************************************
+ * @file    lms_verify.c
+ * @brief   RFC 8554 LMS and HSS signature verification
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "lms_verify.h"
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Domain separators */
+#define LMS_D_PBLC                    (0x8080U)
+#define LMS_D_MESG                    (0x8181U)
+#define LMS_D_LEAF                    (0x8282U)
+#define LMS_D_INTR                    (0x8383U)
+
+/** @brief Size of the key pair identifier I */
+#define LMS_I_SIZE                    (16U)
+
+/** @brief Type codes */
+#define LMOTS_SHA256_N32_W1           (1U)
+#define LMOTS_SHA256_N32_W8           (4U)
+#define LMS_SHA256_M32_H5             (5U)
+#define LMS_SHA256_M32_H25            (9U)
+
+/** @brief Tree height of an LMS type: 5, 10, 15, 20 or 25 */
+#define LMS_HEIGHT(type)              (5U * (((type) - LMS_SHA256_M32_H5) + 1U))
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief LM-OTS parameters (RFC 8554 table 1) */
+typedef struct
+{
+    uint8_t  w;                     /**< Winternitz parameter in bits    */
+    uint16_t p;                     /**< Number of hash chains           */
+    uint8_t  ls;                    /**< Checksum left shift             */
+} lmots_param_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief Indexed by LM-OTS type - 1 */
+static const lmots_param_t lmots_params[] =
+{
+    { 1U, 265U, 7U },
+    { 2U, 133U, 6U },
+    { 4U,  67U, 4U },
+    { 8U,  34U, 0U },
+};
+
+/** @brief Built-in vector, generated with a separate implementation of RFC 8554 */
+static const uint8_t lms_kat_public_key[60] =
+{
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x23, 0x9A, 0x3F, 0xBD,
+    0xA7, 0xD1, 0x6F, 0x71, 0x79, 0x4C, 0x09, 0x0F, 0x31, 0x42, 0x08, 0x17, 0x16, 0x9F, 0x58, 0x00,
+    0x12, 0xCA, 0xD3, 0x52, 0xC3, 0x44, 0x08, 0x2A, 0x67, 0xA3, 0x33, 0x8E
+};
+
+static const uint8_t lms_kat_signature[2352] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x56, 0x14, 0x9F, 0x08,
+    0x79, 0xA6, 0xD7, 0x0C, 0x47, 0xCF, 0xA7, 0x6A, 0x12, 0xCD, 0x2A, 0x78, 0x00, 0x7E, 0x58, 0x1C,
+    0x39, 0xB2, 0x16, 0x71, 0x62, 0x0B, 0xB4, 0xDE, 0xCE, 0x26, 0x5D, 0xBC, 0x13, 0x51, 0x91, 0x80,
+    0x0B, 0xDF, 0x23, 0xC2, 0xEE, 0xD2, 0x0B, 0x34, 0x4F, 0x1B, 0xA1, 0xA3, 0x84, 0xFF, 0x9D, 0xFD,
+    0x10, 0xB0, 0xE3, 0x7A, 0x5B, 0xA1, 0xEE, 0x0D, 0x5F, 0xCC, 0x50, 0xE2, 0x4B, 0xD2, 0xBF, 0x69,
+    0xFB, 0x7A, 0x3B, 0x3E, 0xBF, 0xB7, 0x84, 0x55, 0x57, 0xAE, 0xAA, 0x6A, 0xEE, 0x7F, 0xD3, 0x33,
+    0xEA, 0x65, 0x29, 0xE9, 0x8E, 0xD3, 0x3D, 0x18, 0x4F, 0xE0, 0xF2, 0xD1, 0x9C, 0x97, 0xF3, 0x04,
+    0x7B, 0x8B, 0x3C, 0xA3, 0xE2, 0x24, 0xE9, 0x9E, 0x81, 0xCF, 0x75, 0xF8, 0x74, 0xA2, 0xB4, 0xC0,
+    0x8D, 0xD6, 0x5D, 0x9F, 0xBA, 0x78, 0x13, 0xE9, 0x77, 0x69, 0x67, 0x4A, 0xE6, 0xA6, 0x3F, 0xA0,
+    0x95, 0x40, 0x8E, 0xE3, 0xA6, 0x1F, 0x6F, 0xD2, 0xFD, 0x63, 0xEF, 0xE6, 0xF2, 0xE9, 0x22, 0x7B,
+    0x5B, 0x62, 0x4F, 0x7E, 0x67, 0x96, 0x61, 0x8D, 0xE0, 0x74, 0x84, 0x36, 0x4E, 0x7A, 0x31, 0x16,
+    0x39, 0x91, 0x72, 0x45, 0xC8, 0x62, 0xDB, 0x35, 0x73, 0xE9, 0xFB, 0x85, 0x8A, 0x43, 0xCD, 0x81,
+    0x43, 0xEC, 0x94, 0x49, 0x86, 0xC7, 0xB1, 0x12, 0xBB, 0x85, 0x51, 0x63, 0xA3, 0x68, 0x6E, 0xE5,
+    0xBE, 0x86, 0x62, 0x20, 0xC1, 0x0F, 0x3D, 0x87, 0xC6, 0x83, 0xCE, 0x23, 0x69, 0x3A, 0x4F, 0xB7,
+    0xF1, 0x56, 0x13, 0x05, 0xA1, 0xD5, 0xB2, 0x26, 0x5B, 0x79, 0x3F, 0x70, 0x36, 0x0F, 0x80, 0x1A,
+    0x96, 0xA6, 0xD9, 0x44, 0x15, 0x07, 0x7E, 0xDD, 0xA2, 0x20, 0x9C, 0x82, 0x73, 0x2A, 0x85, 0x66,
+    0x19, 0xF6, 0x1C, 0xF9, 0xD3, 0xDD, 0x6F, 0xD3, 0x93, 0x51, 0x36, 0x9F, 0xD5, 0xE8, 0x16, 0x06,
+    0xFD, 0x6E, 0x23, 0x2A, 0x4F, 0x7D, 0xAA, 0x9C, 0x90, 0x20, 0x7D, 0x6E, 0x99, 0x10, 0x9C, 0x21,
+    0x5D, 0x4A, 0xC1, 0xF5, 0xBB, 0x63, 0xA2, 0xE5, 0xFE, 0x67, 0xCB, 0x05, 0x77, 0xE2, 0xF3, 0xA0,
+    0x28, 0x63, 0x4E, 0xBA, 0x2C, 0x36, 0x3E, 0x43, 0x16, 0x84, 0x65, 0x39, 0xB6, 0x99, 0x37, 0xB6,
+    0xC1, 0xF0, 0x64, 0xC0, 0x05, 0xA2, 0x2C, 0x05, 0xB2, 0x53, 0xD0, 0x06, 0x88, 0x8B, 0x7A, 0xDA,
+    0xE7, 0x9C, 0x5B, 0x39, 0x04, 0x1B, 0x76, 0xDD, 0x78, 0x44, 0x00, 0x1F, 0x8F, 0x51, 0x84, 0x4C,
+    0x1C, 0xDF, 0xDF, 0xC1, 0x13, 0x48, 0x4D, 0x58, 0xAA, 0x07, 0x88, 0x5F, 0xF2, 0xB7, 0x64, 0x27,
+    0x25, 0x46, 0xA7, 0x98, 0x7E, 0x73, 0xBF, 0x39, 0x7F, 0xD7, 0x30, 0x86, 0x18, 0x07, 0x45, 0x96,
+    0xDD, 0x2D, 0xB7, 0xC1, 0xBC, 0xA9, 0x37, 0xA8, 0xD2, 0x26, 0xCC, 0xD3, 0x8E, 0xFD, 0x64, 0x7A,
+    0x12, 0x5D, 0x2D, 0x8D, 0x4A, 0xA5, 0xE6, 0x5C, 0xD7, 0x7A, 0x47, 0x78, 0x40, 0xB9, 0xA1, 0xEE,
+    0x3F, 0x4E, 0x29, 0xF9, 0x48, 0x1D, 0x18, 0xFC, 0xBD, 0x64, 0x7C, 0x1D, 0xFA, 0x33, 0x5E, 0x57,
+    0xF1, 0x0F, 0x31, 0xD3, 0x53, 0xD0, 0x23, 0x15, 0x13, 0x30, 0x13, 0xA1, 0x78, 0xFA, 0x5C, 0xBF,
+    0x23, 0x6E, 0x84, 0xBD, 0xEF, 0x9D, 0xF4, 0x6C, 0xE2, 0x6E, 0x32, 0x69, 0xAC, 0x95, 0x25, 0x49,
+    0xA3, 0x85, 0x10, 0x62, 0xC5, 0x2E, 0x55, 0xEC, 0x28, 0xC6, 0xD8, 0x15, 0x01, 0xB2, 0x29, 0xA1,
+    0xD7, 0xEB, 0xCC, 0x5E, 0xBF, 0x90, 0x71, 0xC7, 0x64, 0x95, 0x81, 0x47, 0x01, 0xE7, 0x22, 0xA1,
+    0xDC, 0x7D, 0x25, 0x79, 0x23, 0xF9, 0xD3, 0x7A, 0x7A, 0x3F, 0x3F, 0xA0, 0x6F, 0xE8, 0xC3, 0x4B,
+    0xA1, 0x44, 0x93, 0xF8, 0x70, 0x35, 0x2D, 0x1F, 0x59, 0xA6, 0x8F, 0xDE, 0xD0, 0xB8, 0xDD, 0x38,
+    0x86, 0xE8, 0x0F, 0x74, 0x35, 0xC6, 0x8A, 0x5B, 0x6D, 0xE2, 0x78, 0x4E, 0x87, 0x10, 0x0D, 0xB6,
+    0x4E, 0x1F, 0x29, 0xBE, 0x08, 0xE1, 0xFC, 0xE3, 0xCB, 0xEC, 0x8A, 0x80, 0xD3, 0x75, 0xD8, 0x3E,
+    0x01, 0x29, 0x6E, 0x11, 0x69, 0x9E, 0x57, 0xE8, 0x83, 0x87, 0xBE, 0xD0, 0x9B, 0x67, 0x37, 0x04,
+    0xD2, 0xF2, 0xAD, 0x75, 0x52, 0x6D, 0x28, 0xCD, 0x63, 0x95, 0xDA, 0xF4, 0xDD, 0x22, 0x71, 0x89,
+    0xFA, 0xF8, 0xE1, 0xC0, 0x72, 0x57, 0x34, 0x38, 0x7C, 0xD8, 0x3A, 0xE1, 0xC1, 0xF5, 0x70, 0x43,
+    0xAC, 0x32, 0x01, 0xEA, 0xD2, 0xFB, 0x2A, 0x68, 0xE2, 0xE5, 0xDC, 0x97, 0xEE, 0xA2, 0x11, 0x12,
+    0xDF, 0x27, 0xBB, 0x3C, 0xDC, 0x88, 0xE6, 0xF1, 0x64, 0xE5, 0xA7, 0x72, 0xEE, 0x2F, 0x47, 0x5F,
+    0x88, 0xDC, 0x7A, 0xE7, 0x45, 0xC9, 0x19, 0x77, 0x78, 0xD5, 0xB7, 0x1E, 0xA8, 0x82, 0x10, 0xDD,
+    0x30, 0x9F, 0x8A, 0x58, 0x5A, 0x93, 0xB3, 0x2A, 0xD3, 0xEC, 0x26, 0xA1, 0xA7, 0xE5, 0x2B, 0x6A,
+    0x7F, 0xD2, 0x98, 0xBE, 0xE2, 0x30, 0xE7, 0x29, 0x38, 0x3D, 0xE2, 0x6B, 0xFA, 0x7F, 0xDC, 0xFE,
+    0xF0, 0x95, 0x89, 0x0D, 0x30, 0x01, 0x11, 0xA6, 0x89, 0x44, 0xEA, 0x0B, 0x31, 0xF2, 0x7A, 0x7C,
+    0x3F, 0xE8, 0x04, 0x36, 0x6F, 0x41, 0x5F, 0xD5, 0x16, 0x35, 0x08, 0x7D, 0x26, 0x12, 0xAC, 0xBA,
+    0x21, 0x18, 0x97, 0x36, 0x72, 0xF8, 0xAB, 0x13, 0x92, 0xAB, 0x81, 0x2A, 0x51, 0x67, 0x61, 0x97,
+    0xDF, 0xE0, 0xD2, 0xE7, 0xE2, 0x96, 0x9D, 0x6C, 0x8E, 0x7F, 0x86, 0x53, 0xD0, 0x7B, 0x7E, 0x3C,
+    0x68, 0x71, 0xD7, 0xEB, 0x0C, 0xB3, 0xF2, 0x53, 0xE9, 0xB0, 0xEF, 0x11, 0x50, 0x14, 0x83, 0xB3,
+    0xC3, 0x2E, 0x88, 0xDD, 0x47, 0xCC, 0x9D, 0xFC, 0x63, 0x40, 0x48, 0x88, 0x10, 0x05, 0x63, 0x8F,
+    0xFD, 0xBC, 0x1C, 0x59, 0xC7, 0xAE, 0x38, 0x98, 0x34, 0x3A, 0xDF, 0xC9, 0x30, 0x73, 0x16, 0xE2,
+    0x52, 0xFC, 0x19, 0x2C, 0xDB, 0x9C, 0xE8, 0xB4, 0xFC, 0x94, 0x3F, 0xEC, 0x25, 0x80, 0x30, 0x26,
+    0x2D, 0x07, 0x02, 0xE1, 0xDB, 0x9C, 0x4E, 0x49, 0x3F, 0x2C, 0x16, 0xD6, 0xBA, 0xC5, 0x1D, 0x61,
+    0xB1, 0x96, 0x07, 0x99, 0x23, 0x41, 0xB3, 0xAA, 0xD3, 0x26, 0x91, 0x0E, 0xDE, 0xC4, 0xC5, 0x30,
+    0x49, 0x6A, 0x94, 0x5F, 0xCF, 0x76, 0xF0, 0x81, 0xD5, 0x6B, 0xEF, 0xD2, 0xC2, 0x8A, 0x62, 0x5E,
+    0xF9, 0xDF, 0xB5, 0x56, 0x15, 0xAA, 0xE2, 0xA3, 0x14, 0x03, 0xE0, 0x5B, 0x00, 0x63, 0x29, 0x1A,
+    0x61, 0xAA, 0x57, 0xD8, 0x18, 0x13, 0x33, 0xCD, 0xCB, 0x95, 0x30, 0x7E, 0xD2, 0x6A, 0x87, 0x08,
+    0xD1, 0x3A, 0x63, 0x0C, 0x18, 0x55, 0x37, 0xCE, 0xD0, 0x91, 0x7B, 0x70, 0xA3, 0xB9, 0xF9, 0x5B,
+    0x2E, 0xB5, 0xE5, 0xF7, 0xCC, 0xB2, 0x69, 0xA9, 0x78, 0x4B, 0x93, 0xAF, 0xF4, 0x6F, 0x20, 0x8B,
+    0x8B, 0xE1, 0xFF, 0xBB, 0x4E, 0xE3, 0xAF, 0x01, 0xA3, 0xBB, 0x91, 0x5C, 0x31, 0x5A, 0xBF, 0xD6,
+    0x3D, 0x09, 0xAF, 0x2F, 0x55, 0xCE, 0x2F, 0xBE, 0xC3, 0xCE, 0x10, 0x7E, 0x25, 0x2B, 0x39, 0x46,
+    0x18, 0x9B, 0x8A, 0x75, 0xF2, 0x5D, 0xE8, 0x64, 0x36, 0x73, 0x1E, 0x01, 0x16, 0x93, 0x99, 0xF1,
+    0xFF, 0x2E, 0x05, 0x1A, 0x0E, 0x94, 0x44, 0x71, 0x57, 0xC2, 0x86, 0x04, 0x29, 0x58, 0xF2, 0xE5,
+    0x92, 0x1F, 0x17, 0xAC, 0x91, 0x1A, 0xC5, 0xF3, 0x0C, 0x13, 0x64, 0x0F, 0xCD, 0x45, 0xF0, 0xBB,
+    0xE3, 0xFA, 0x16, 0xEB, 0xCB, 0x4A, 0xDF, 0x4B, 0x4C, 0x26, 0x76, 0xD7, 0x9A, 0x92, 0x0E, 0xA7,
+    0xCA, 0x3A, 0x32, 0xB2, 0x1E, 0x08, 0x69, 0x3B, 0x11, 0x18, 0x63, 0xA3, 0x4F, 0xCF, 0x9D, 0x05,
+    0x7E, 0x7A, 0xEC, 0x34, 0x1C, 0x5F, 0x33, 0x47, 0xD8, 0x92, 0x68, 0x7A, 0x1D, 0x43, 0xF1, 0xC2,
+    0xEF, 0xBD, 0xB9, 0x3C, 0xC2, 0x7A, 0xCB, 0xE5, 0xA3, 0x7E, 0xA0, 0xCC, 0xED, 0x90, 0xDC, 0xAF,
+    0x3F, 0x2C, 0xCD, 0xA6, 0xE8, 0x54, 0x14, 0x51, 0xE3, 0xF4, 0x42, 0x2D, 0xA2, 0x67, 0x27, 0xCB,
+    0x52, 0x65, 0x28, 0xBB, 0x96, 0x06, 0x0E, 0xF1, 0x7D, 0xA5, 0x40, 0x41, 0x52, 0x57, 0x62, 0xBE,
+    0xBA, 0x20, 0x34, 0x07, 0x3E, 0x85, 0x5F, 0xE9, 0xC4, 0x72, 0xDD, 0x5B, 0xEB, 0x17, 0x41, 0xD5,
+    0x55, 0x46, 0x0E, 0x9A, 0x5A, 0x58, 0xFE, 0x2C, 0xC8, 0x44, 0xA2, 0x23, 0xE0, 0x6E, 0xA2, 0x0E,
+    0x7C, 0x78, 0x24, 0x46, 0x9E, 0x04, 0x22, 0x4F, 0x23, 0x7A, 0x37, 0x13, 0xCA, 0xAD, 0x2F, 0xDC,
+    0xFB, 0x84, 0xCD, 0xA7, 0x3B, 0x6D, 0x75, 0x29, 0x36, 0x96, 0x25, 0x30, 0xA6, 0x75, 0xFC, 0x95,
+    0xCB, 0x39, 0x38, 0xED, 0x88, 0x2E, 0x1C, 0x9E, 0x14, 0x8D, 0xCC, 0x2A, 0x18, 0xF6, 0x61, 0x07,
+    0x4C, 0xFF, 0xF5, 0x08, 0xA7, 0xCA, 0xE2, 0x1A, 0xE8, 0x5F, 0xF2, 0x58, 0x23, 0x35, 0x75, 0x26,
+    0x07, 0xED, 0xB9, 0xE8, 0xAE, 0x95, 0x9A, 0xFC, 0xCA, 0xE8, 0x03, 0x4D, 0x09, 0xC4, 0x50, 0x65,
+    0x97, 0x14, 0xA3, 0x6A, 0xF7, 0x1A, 0x96, 0x55, 0xA4, 0x65, 0xC7, 0x27, 0x2B, 0x2D, 0xCC, 0x13,
+    0x3F, 0x81, 0xD4, 0x51, 0x57, 0x77, 0xC4, 0x8C, 0x45, 0xE8, 0xF6, 0x88, 0xEA, 0xA3, 0x4C, 0xBD,
+    0x2D, 0x72, 0x07, 0x27, 0x67, 0xA7, 0x2C, 0x55, 0xB8, 0xB4, 0x4F, 0xFF, 0x56, 0xF1, 0xBD, 0xF1,
+    0xEC, 0xE0, 0x1D, 0x4E, 0xEE, 0xE7, 0x43, 0xE5, 0x6F, 0x9E, 0x68, 0x14, 0xD5, 0xCE, 0x31, 0x47,
+    0x3F, 0x21, 0x9C, 0x4F, 0xED, 0x10, 0x52, 0x88, 0xAF, 0xC9, 0x66, 0x26, 0x09, 0x27, 0x7A, 0x58,
+    0x04, 0xDC, 0x67, 0xA9, 0x7D, 0x00, 0x07, 0x1A, 0x4F, 0xF2, 0x00, 0xC5, 0x53, 0x8C, 0x78, 0x46,
+    0xBB, 0x16, 0xF0, 0x4F, 0x1D, 0x59, 0xB0, 0x7F, 0xA8, 0x2A, 0x48, 0x98, 0xE3, 0x5E, 0x03, 0x9D,
+    0xA0, 0x66, 0x0C, 0x98, 0xF2, 0x86, 0x3A, 0x0F, 0xFE, 0x1C, 0x99, 0x3E, 0xC4, 0x39, 0x83, 0x7B,
+    0x19, 0x68, 0x01, 0x8F, 0xC7, 0x67, 0x40, 0xA1, 0x13, 0x40, 0xE0, 0x3A, 0x96, 0x73, 0x14, 0x44,
+    0x24, 0xB9, 0x82, 0x5A, 0x4C, 0x11, 0x53, 0x35, 0xCB, 0x26, 0xCA, 0x78, 0x64, 0x42, 0x39, 0x05,
+    0x3D, 0xFC, 0x78, 0x58, 0xDA, 0xF7, 0x94, 0xFE, 0x4F, 0xB3, 0xFD, 0x65, 0xAA, 0x51, 0x7E, 0x6B,
+    0xBA, 0x17, 0xCD, 0x72, 0xDD, 0xC6, 0xCD, 0xEC, 0x2A, 0x7A, 0x33, 0x92, 0x16, 0xE4, 0x87, 0x52,
+    0xBD, 0x90, 0x35, 0x36, 0x6B, 0x95, 0xA0, 0x37, 0xFD, 0x48, 0xD9, 0xA8, 0xD9, 0x24, 0xE9, 0x75,
+    0x65, 0xAE, 0x98, 0xB5, 0xA8, 0xAB, 0x91, 0x56, 0x0C, 0x34, 0x8C, 0x7A, 0xFB, 0x95, 0x16, 0x84,
+    0x8A, 0xEF, 0x2E, 0xBB, 0x6F, 0x75, 0xEC, 0xDD, 0x58, 0x8B, 0x5F, 0x85, 0xBF, 0x17, 0xD1, 0xCA,
+    0xFF, 0x73, 0x44, 0x44, 0xB1, 0xA8, 0xC0, 0xD4, 0x88, 0xEB, 0x40, 0xB9, 0xAE, 0xFA, 0xDB, 0xDC,
+    0xEA, 0xA3, 0x9F, 0x5B, 0x36, 0xAE, 0xB2, 0x0A, 0x51, 0x71, 0xEE, 0xFC, 0x93, 0x4C, 0x78, 0x64,
+    0x7B, 0xE2, 0x24, 0xD9, 0x4E, 0x7D, 0x54, 0xA7, 0xDE, 0x0C, 0x00, 0x40, 0x4C, 0xEC, 0x88, 0x7F,
+    0x87, 0x48, 0x77, 0xBB, 0xD7, 0xC2, 0xBE, 0x8F, 0xE8, 0x65, 0x53, 0x8C, 0x13, 0xCB, 0x8D, 0xD8,
+    0xBD, 0xF3, 0x63, 0xD2, 0xBB, 0xD6, 0x6A, 0xE2, 0x1F, 0x9F, 0xCF, 0xAF, 0x1B, 0xC5, 0x18, 0xF6,
+    0xC7, 0x02, 0x56, 0xEE, 0x64, 0xBB, 0x80, 0xD1, 0x2B, 0x55, 0x58, 0x2C, 0x6D, 0x41, 0x9C, 0xDA,
+    0xAA, 0x2C, 0x0E, 0x3B, 0xF7, 0x57, 0xA4, 0xCF, 0xE3, 0xB5, 0x27, 0xB4, 0x8B, 0x5D, 0xF8, 0x5D,
+    0xAB, 0x34, 0x5A, 0xBB, 0xD3, 0x86, 0xC8, 0x53, 0xB2, 0x04, 0x33, 0x53, 0xF6, 0x39, 0xFA, 0x8A,
+    0x8F, 0xCC, 0xA4, 0x85, 0x59, 0x49, 0x8C, 0xE6, 0x9C, 0x8F, 0xC3, 0xEE, 0x4D, 0xFF, 0x24, 0xBE,
+    0x06, 0x3B, 0x83, 0xA4, 0xB7, 0xCD, 0x7E, 0xAA, 0xE0, 0x39, 0xEE, 0xA3, 0xAF, 0xCA, 0xB7, 0xCA,
+    0x76, 0xAA, 0x7B, 0xAC, 0x4D, 0x75, 0x3D, 0x08, 0x4D, 0x63, 0x60, 0x64, 0x10, 0xA1, 0x2E, 0x59,
+    0x37, 0xC0, 0x94, 0xE5, 0xE3, 0x74, 0x93, 0xCC, 0x1C, 0x32, 0xCD, 0x0C, 0x53, 0xA0, 0xFA, 0x71,
+    0x5D, 0xB6, 0x99, 0x1D, 0x95, 0x61, 0xBA, 0xEB, 0x8A, 0xA5, 0xB0, 0x83, 0x72, 0xA8, 0x62, 0xC4,
+    0xEA, 0xE1, 0x23, 0x6D, 0xB0, 0x21, 0xF3, 0x25, 0x80, 0xAE, 0xF7, 0xAC, 0xA0, 0x1E, 0x12, 0x6A,
+    0x0A, 0x43, 0x1A, 0xAB, 0xB9, 0x74, 0x79, 0x54, 0x62, 0xC8, 0x91, 0xD2, 0x87, 0x78, 0xBF, 0x74,
+    0xE2, 0x5D, 0xDB, 0x8B, 0xA1, 0x81, 0x44, 0xB3, 0x8D, 0x70, 0xFD, 0xCE, 0x4C, 0x99, 0x3A, 0x69,
+    0x6A, 0x5C, 0xCD, 0xD3, 0xCC, 0x4E, 0xA9, 0x67, 0x13, 0x0F, 0x32, 0xBE, 0x93, 0x21, 0x81, 0x27,
+    0x91, 0x15, 0x62, 0x92, 0x4C, 0x21, 0x1A, 0x8E, 0x21, 0x9F, 0xBB, 0xC8, 0xE0, 0x38, 0xB0, 0x4D,
+    0xE8, 0x66, 0xF0, 0xA2, 0x79, 0x66, 0x9D, 0x15, 0x06, 0xF2, 0x79, 0xF0, 0x71, 0x8F, 0xEE, 0xE1,
+    0xC0, 0x69, 0x9C, 0x99, 0x97, 0x43, 0x04, 0xE7, 0xF9, 0x8C, 0xEB, 0x41, 0x27, 0x11, 0x1E, 0x76,
+    0x0C, 0x6E, 0xED, 0x18, 0xEB, 0x37, 0xE8, 0x16, 0x30, 0xF4, 0xB9, 0x64, 0xCA, 0x3D, 0x09, 0x9D,
+    0x2B, 0x70, 0x8C, 0x5B, 0x1B, 0x2D, 0x51, 0x2B, 0xDD, 0x85, 0x4D, 0x40, 0x9A, 0x53, 0x0D, 0xE7,
+    0xEC, 0x49, 0xA4, 0xB3, 0xD3, 0xC8, 0x73, 0x53, 0xD9, 0x97, 0xAF, 0xC3, 0xEA, 0x9D, 0xB0, 0xA5,
+    0x82, 0xDD, 0x81, 0xEB, 0x9D, 0x8C, 0xFB, 0xC6, 0xCF, 0xBE, 0xF0, 0xF9, 0x93, 0xED, 0x15, 0xEC,
+    0xC6, 0x07, 0xF7, 0x7B, 0xF6, 0x44, 0xCD, 0xFF, 0xE4, 0x0A, 0x8C, 0x39, 0x85, 0xD0, 0x71, 0xA6,
+    0x5B, 0x30, 0xE4, 0x82, 0x58, 0xB1, 0xF5, 0x85, 0x06, 0x01, 0x8E, 0xDD, 0x40, 0x68, 0x7F, 0x6F,
+    0x7D, 0x7D, 0x92, 0x42, 0x59, 0x9B, 0x37, 0x9D, 0xC6, 0x39, 0x76, 0x33, 0x9B, 0x4A, 0xBA, 0x03,
+    0x84, 0xF0, 0xEB, 0x4E, 0xF5, 0xD9, 0x54, 0x85, 0x51, 0x80, 0x17, 0xF6, 0xE5, 0xDD, 0xA8, 0xF1,
+    0x76, 0x10, 0xD5, 0x4B, 0x58, 0x2A, 0x7B, 0x74, 0xAB, 0x12, 0x6F, 0x83, 0xAD, 0x9C, 0x39, 0x62,
+    0x03, 0xAB, 0xF9, 0x99, 0x18, 0x06, 0xBF, 0x4D, 0x80, 0x4B, 0x18, 0xB9, 0x27, 0xE5, 0x84, 0xF3,
+    0x4F, 0x20, 0x6B, 0x9D, 0x22, 0xAD, 0x85, 0xAF, 0x25, 0xA5, 0x08, 0x2F, 0xC5, 0x09, 0x4E, 0x2C,
+    0x24, 0xCF, 0xAE, 0xBD, 0x5E, 0x9C, 0x0D, 0x36, 0xF2, 0xA9, 0xEF, 0x58, 0xD2, 0x37, 0xDE, 0x04,
+    0x41, 0x4D, 0x0F, 0x2C, 0x7B, 0xFF, 0x75, 0x28, 0xE5, 0x76, 0xED, 0x23, 0x3F, 0x44, 0x1E, 0x12,
+    0x8A, 0xDD, 0x97, 0xA3, 0xE4, 0x1D, 0x3C, 0x3D, 0x7E, 0x0B, 0x1B, 0x9F, 0xBF, 0x4C, 0xE1, 0x9C,
+    0xB2, 0x17, 0xDC, 0x86, 0xB3, 0x1D, 0x6C, 0xA7, 0xAD, 0xAD, 0x3F, 0xF6, 0xAC, 0xF3, 0xE7, 0x6B,
+    0x51, 0xAB, 0x18, 0x99, 0x82, 0xEE, 0xBE, 0x15, 0xAB, 0x06, 0x1A, 0x62, 0x6E, 0xB8, 0xE0, 0x10,
+    0x0E, 0x36, 0x48, 0xE0, 0x46, 0x7D, 0x4F, 0x2D, 0x21, 0xA4, 0x7F, 0x95, 0xE9, 0xA5, 0x1A, 0x26,
+    0x5F, 0xED, 0x89, 0x10, 0x73, 0xE2, 0x2B, 0xFD, 0xF1, 0xDA, 0xEA, 0xBE, 0x27, 0x40, 0x7B, 0xC8,
+    0x85, 0xA4, 0x78, 0x7A, 0x37, 0xC0, 0xD2, 0xAB, 0x3A, 0xF2, 0x38, 0xB9, 0xDE, 0x81, 0x4A, 0x78,
+    0x60, 0xF0, 0x31, 0x5D, 0xA3, 0xC3, 0x89, 0xA9, 0x79, 0x67, 0x32, 0x1B, 0x5D, 0xBD, 0xF2, 0x86,
+    0x89, 0xA9, 0x54, 0x5A, 0x06, 0xFB, 0xEA, 0x81, 0xBD, 0x7B, 0x01, 0xE8, 0x14, 0xC8, 0xDC, 0x97,
+    0x84, 0xC3, 0x99, 0x4A, 0x7C, 0xA4, 0xC8, 0xD0, 0xE0, 0x22, 0x6A, 0x73, 0x39, 0xA9, 0x95, 0xE7,
+    0x43, 0x44, 0xE0, 0x84, 0xE6, 0xE0, 0xE3, 0x65, 0x75, 0x08, 0x47, 0xC2, 0x26, 0x78, 0x24, 0x9D,
+    0x01, 0xCB, 0x9C, 0x46, 0x33, 0x30, 0xD2, 0xEB, 0x26, 0x72, 0x5A, 0x32, 0x48, 0x2B, 0x79, 0xDE,
+    0x1C, 0x39, 0xE6, 0xA6, 0x74, 0x03, 0x6F, 0x78, 0xE2, 0x69, 0x99, 0x83, 0x2F, 0x16, 0x27, 0x2D,
+    0xA4, 0x24, 0xA4, 0x9E, 0x93, 0x57, 0x9F, 0xE2, 0xE6, 0xD9, 0x4F, 0x72, 0x00, 0x00, 0x00, 0x05,
+    0x26, 0x5D, 0xE1, 0x3C, 0x43, 0x71, 0x75, 0x73, 0xA3, 0x00, 0xCB, 0x52, 0xC9, 0xA0, 0xF0, 0x21,
+    0x9D, 0x10, 0xDC, 0xEA, 0xE3, 0x88, 0xD8, 0x30, 0x5B, 0xA4, 0xCE, 0x33, 0x4A, 0x0C, 0x70, 0x35,
+    0xF3, 0x6D, 0x34, 0x7E, 0x41, 0x58, 0xE2, 0x36, 0x9C, 0xD9, 0xF1, 0x47, 0xD2, 0x2C, 0x7C, 0x6B,
+    0x9C, 0x0E, 0x9A, 0x7D, 0x12, 0x50, 0xC8, 0x56, 0xFC, 0x21, 0xB4, 0x70, 0xAF, 0x92, 0x8D, 0xD6,
+    0x2D, 0xFD, 0x66, 0x3B, 0xB5, 0xD8, 0x7C, 0x8E, 0x5A, 0xE8, 0xC0, 0x36, 0xC8, 0x4E, 0x3A, 0x8C,
+    0x2D, 0xD3, 0xD3, 0xF1, 0x7E, 0x3B, 0x16, 0x45, 0xE1, 0xA1, 0xAE, 0x36, 0xAC, 0x2E, 0x3E, 0x87,
+    0x07, 0x78, 0x7E, 0xD6, 0xC8, 0xCB, 0xEB, 0x79, 0x73, 0xC3, 0xBD, 0x44, 0xB0, 0x0B, 0x37, 0x71,
+    0x60, 0x2D, 0x36, 0x41, 0x32, 0x01, 0x82, 0x53, 0x43, 0xC5, 0x1B, 0x31, 0x02, 0xF2, 0x8D, 0xCD,
+    0x70, 0x94, 0xFF, 0x35, 0xC5, 0x26, 0x5D, 0xB3, 0xC9, 0x29, 0xC3, 0x19, 0x0B, 0x05, 0xFD, 0xC3,
+    0x4F, 0x10, 0x2F, 0x1A, 0x3C, 0xCB, 0x8C, 0xE2, 0x71, 0xE2, 0xB4, 0xDB, 0xCC, 0xE6, 0x41, 0x08
+};
+
+static const uint8_t lms_kat_message[] = "app-manifest: version=1.0.0";
+
+const lms_vector_t lms_test_vector =
+{
+    lms_kat_public_key, sizeof(lms_kat_public_key),
+    lms_kat_message, sizeof(lms_kat_message) - 1U,
+    lms_kat_signature, sizeof(lms_kat_signature),
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static uint32_t lms_get_u32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void lms_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/** @brief coef(S, i, w) of RFC 8554 section 3.1.3 */
+static uint32_t lmots_coef(const uint8_t *s, uint32_t i, uint32_t w)
+{
+    uint32_t mask = (1UL << w) - 1U;
+    uint32_t shift = 8U - ((w * (i % (8U / w))) + w);
+
+    return mask & ((uint32_t)s[(i * w) / 8U] >> shift);
+}
+
+/**
+ * @brief Candidate LM-OTS public key from a signature (algorithm 4b)
+ *
+ * @param[in]  prefix   I || u32str(q), 20 bytes
+ * @param[in]  param    LM-OTS parameters
+ * @param[in]  c        Randomizer C
+ * @param[in]  y        p chain values
+ * @param[out] kc       Candidate public key
+ */
+static void lmots_candidate(const uint8_t *prefix, const lmots_param_t *param,
+                            const uint8_t *c, const uint8_t *y,
+                            const uint8_t *message, size_t message_len, uint8_t kc[LMS_N])
+{
+    sha256_sw_ctx_t ctx;
+    sha256_sw_ctx_t kc_ctx;
+    uint8_t q_cksm[LMS_N + 2U];
+    uint8_t chain[LMS_I_SIZE + 4U + 2U + 1U + LMS_N];
+    uint32_t max = (1UL << param->w) - 1U;
+    uint32_t sum = 0;
+    uint16_t dom = LMS_D_MESG;
+
+    /* Q = H(I || u32str(q) || u16str(D_MESG) || C || message) */
+    sha256_sw_init(&ctx);
+    sha256_sw_update(&ctx, prefix, LMS_I_SIZE + 4U);
+    q_cksm[0] = (uint8_t)(dom >> 8);
+    q_cksm[1] = (uint8_t)dom;
+    sha256_sw_update(&ctx, q_cksm, 2U);
+    sha256_sw_update(&ctx, c, LMS_N);
+    sha256_sw_update(&ctx, message, message_len);
+    sha256_sw_finish(&ctx, q_cksm);
+
+    /* Checksum over the n * 8 / w digits of Q, appended big endian */
+    for (uint32_t i = 0; i < ((LMS_N * 8U) / param->w); i++)
+    {
+        sum += max - lmots_coef(q_cksm, i, param->w);
+    }
+    sum <<= param->ls;
+    q_cksm[LMS_N] = (uint8_t)(sum >> 8);
+    q_cksm[LMS_N + 1U] = (uint8_t)sum;
+
+    /* Kc = H(I || u32str(q) || u16str(D_PBLC) || z[0] || ... || z[p-1]) */
+    sha256_sw_init(&kc_ctx);
+    sha256_sw_update(&kc_ctx, prefix, LMS_I_SIZE + 4U);
+    chain[0] = (uint8_t)(LMS_D_PBLC >> 8);
+    chain[1] = (uint8_t)LMS_D_PBLC;
+    sha256_sw_update(&kc_ctx, chain, 2U);
+
+    /* Chain step input: I || u32str(q) || u16str(i) || u8str(j) || tmp,
+     * 55 bytes, so every step is a single compression */
+    memcpy(chain, prefix, LMS_I_SIZE + 4U);
+    for (uint32_t i = 0; i < param->p; i++)
+    {
+        uint8_t *tmp = &chain[LMS_I_SIZE + 7U];
+
+        chain[LMS_I_SIZE + 4U] = (uint8_t)(i >> 8);
+        chain[LMS_I_SIZE + 5U] = (uint8_t)i;
+        memcpy(tmp, &y[i * LMS_N], LMS_N);
+        for (uint32_t j = lmots_coef(q_cksm, i, param->w); j < max; j++)
+        {
+            chain[LMS_I_SIZE + 6U] = (uint8_t)j;
+            sha256_sw(chain, sizeof(chain), tmp);
+        }
+        sha256_sw_update(&kc_ctx, tmp, LMS_N);
+    }
+    sha256_sw_finish(&kc_ctx, kc);
+}
+
+/**
+ * @brief Length of the LMS signature at the start of @p signature
+ *
+ * Checks that the types in the signature match the key (RFC 8554
+ * section 5.4.2, steps 2b and 2f) and that the buffer holds the whole
+ * signature.
+ *
+ * @param[out] sig_len  Bytes taken by the LMS signature
+ */
+static psa_status_t lms_signature_length(const uint8_t *public_key, const uint8_t *signature,
+                                         size_t signature_len, size_t *sig_len)
+{
+    uint32_t lms_type = lms_get_u32(public_key);
+    uint32_t ots_type = lms_get_u32(&public_key[4]);
+    size_t ots_len;
+
+    if ((lms_type < LMS_SHA256_M32_H5) || (lms_type > LMS_SHA256_M32_H25) ||
+        (ots_type < LMOTS_SHA256_N32_W1) || (ots_type > LMOTS_SHA256_N32_W8))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    ots_len = 4U + LMS_N + ((size_t)lmots_params[ots_type - 1U].p * LMS_N);
+    *sig_len = 4U + ots_len + 4U + ((size_t)LMS_HEIGHT(lms_type) * LMS_N);
+
+    if ((signature_len < *sig_len) ||
+        (lms_get_u32(&signature[4]) != ots_type) ||
+        (lms_get_u32(&signature[4U + ots_len]) != lms_type))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return PSA_SUCCESS;
+}
+
+/**
+ * @brief Verify an LMS signature whose length was checked by
+ *        lms_signature_length() (algorithm 6a)
+ */
+static psa_status_t lms_verify_checked(const uint8_t *public_key,
+                                       const uint8_t *message, size_t message_len,
+                                       const uint8_t *signature)
+{
+    const lmots_param_t *param = &lmots_params[lms_get_u32(&public_key[4]) - 1U];
+    uint32_t height = LMS_HEIGHT(lms_get_u32(public_key));
+    size_t ots_len = 4U + LMS_N + ((size_t)param->p * LMS_N);
+    const uint8_t *path = &signature[4U + ots_len + 4U];
+    uint8_t prefix[LMS_I_SIZE + 4U];
+    uint8_t node[LMS_I_SIZE + 4U + 2U + (2U * LMS_N)];
+    uint8_t *tmp = &node[LMS_I_SIZE + 6U];
+    uint32_t q = lms_get_u32(signature);
+    uint32_t node_num;
+
+    if (q >= (1UL << height))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+
+    memcpy(prefix, &public_key[8], LMS_I_SIZE);
+    lms_put_u32(&prefix[LMS_I_SIZE], q);
+    lmots_candidate(prefix, param, &signature[8], &signature[8U + LMS_N],
+                    message, message_len, tmp);
+
+    /* Leaf: H(I || u32str(node_num) || u16str(D_LEAF) || Kc) */
+    memcpy(node, &public_key[8], LMS_I_SIZE);
+    node_num = (1UL << height) + q;
+    lms_put_u32(&node[LMS_I_SIZE], node_num);
+    node[LMS_I_SIZE + 4U] = (uint8_t)(LMS_D_LEAF >> 8);
+    node[LMS_I_SIZE + 5U] = (uint8_t)LMS_D_LEAF;
+    sha256_sw(node, LMS_I_SIZE + 6U + LMS_N, tmp);
+
+    /* Interior: H(I || u32str(node_num / 2) || u16str(D_INTR) || left || right) */
+    node[LMS_I_SIZE + 4U] = (uint8_t)(LMS_D_INTR >> 8);
+    node[LMS_I_SIZE + 5U] = (uint8_t)LMS_D_INTR;
+    for (uint32_t i = 0; node_num > 1U; i++, node_num >>= 1)
+    {
+        if ((node_num & 1U) != 0U)
+        {
+            memmove(&tmp[LMS_N], tmp, LMS_N);
+            memcpy(tmp, &path[i * LMS_N], LMS_N);
+        }
+        else
+        {
+            memcpy(&tmp[LMS_N], &path[i * LMS_N], LMS_N);
+        }
+        lms_put_u32(&node[LMS_I_SIZE], node_num >> 1);
+        sha256_sw(node, sizeof(node), tmp);
+    }
+
+    return (memcmp(tmp, &public_key[8U + LMS_I_SIZE], LMS_N) == 0) ?
+           PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+}
+
+psa_status_t lms_verify(const uint8_t *public_key, size_t public_key_len,
+                        const uint8_t *message, size_t message_len,
+                        const uint8_t *signature, size_t signature_len)
+{
+    psa_status_t status;
+    size_t sig_len;
+
+    if (public_key_len != LMS_PUBLIC_KEY_SIZE)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    status = lms_signature_length(public_key, signature, signature_len, &sig_len);
+    if ((status == PSA_SUCCESS) && (sig_len != signature_len))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = lms_verify_checked(public_key, message, message_len, signature);
+    }
+    return status;
+}
+
+psa_status_t hss_verify(const uint8_t *public_key, size_t public_key_len,
+                        const uint8_t *message, size_t message_len,
+                        const uint8_t *signature, size_t signature_len)
+{
+    const uint8_t *key;
+    uint32_t levels;
+    uint32_t nspk;
+    size_t sig_len;
+    psa_status_t status;
+
+    if (public_key_len != HSS_PUBLIC_KEY_SIZE)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    levels = lms_get_u32(public_key);
+    if ((levels == 0U) || (levels > HSS_MAX_LEVELS))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if ((signature_len < 4U) || ((lms_get_u32(signature) + 1U) != levels))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+    nspk = levels - 1U;
+    key = &public_key[4];
+    signature += 4;
+    signature_len -= 4U;
+
+    /* signed_pub_key[i] = LMS signature of the next public key || that key */
+    for (uint32_t i = 0; i < nspk; i++)
+    {
+        const uint8_t *next;
+
+        status = lms_signature_length(key, signature, signature_len, &sig_len);
+        if ((status == PSA_SUCCESS) && ((signature_len - sig_len) < LMS_PUBLIC_KEY_SIZE))
+        {
+            status = PSA_ERROR_INVALID_SIGNATURE;
+        }
+        if (status == PSA_SUCCESS)
+        {
+            next = &signature[sig_len];
+            status = lms_verify_checked(key, next, LMS_PUBLIC_KEY_SIZE, signature);
+        }
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        key = next;
+        signature = &next[LMS_PUBLIC_KEY_SIZE];
+        signature_len -= sig_len + LMS_PUBLIC_KEY_SIZE;
+    }
+
+    return lms_verify(key, LMS_PUBLIC_KEY_SIZE, message, message_len, signature, signature_len);
+}
+
+psa_status_t lms_self_test(void)
+{
+    const lms_vector_t *v = &lms_test_vector;
+    uint8_t message[sizeof(lms_kat_message)];
+    psa_status_t status;
+
+    status = hss_verify(v->public_key, v->public_key_len, v->message, v->message_len,
+                        v->signature, v->signature_len);
+    if (status == PSA_SUCCESS)
+    {
+        /* One flipped bit in the message must be rejected */
+        memcpy(message, v->message, v->message_len);
+        message[0] ^= 0x01U;
+        if (hss_verify(v->public_key, v->public_key_len, message, v->message_len,
+                       v->signature, v->signature_len) != PSA_ERROR_INVALID_SIGNATURE)
+        {
+            status = PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    else
+    {
+        status = PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    return status;
+}
+
+/* [] END OF FILE */
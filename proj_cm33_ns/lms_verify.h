@@ -0,0 +1,129 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : LMS / HSS signature verification
+ * Purpose : Verify hash-based signatures (RFC 8554) on this core, e.g. for
+ *           firmware manifests. Verification is a few hundred to a few
+ *           thousand SHA-256 compressions and needs no TF-M call.
+ * Design  : SHA-256 parameter sets only (n = m = 32). All LM-OTS types
+ *           (W1, W2, W4, W8) and LMS heights 5 to 25 are accepted. Inputs
+ *           are parsed in place; nothing is allocated. Signing is not
+ *           provided: LMS private keys are stateful and belong on the
+ *           signing server.
+ ********************************************************************************
+ * @file    lms_verify.h
+ * @brief   RFC 8554 LMS and HSS signature verification
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef LMS_VERIFY_H
+#define LMS_VERIFY_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Hash output and tree node size (SHA-256) */
+#define LMS_N                         (32U)
+
+/** @brief Size of an LMS public key: type, OTS type, I, T[1] */
+#define LMS_PUBLIC_KEY_SIZE           (4U + 4U + 16U + LMS_N)
+
+/** @brief Size of an HSS public key: levels and the top LMS public key */
+#define HSS_PUBLIC_KEY_SIZE           (4U + LMS_PUBLIC_KEY_SIZE)
+
+/** @brief Deepest HSS hierarchy accepted (RFC 8554 allows 8) */
+#ifndef HSS_MAX_LEVELS
+#define HSS_MAX_LEVELS                (8U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief A public key, message and signature that verify */
+typedef struct
+{
+    const uint8_t *public_key;
+    size_t         public_key_len;
+    const uint8_t *message;
+    size_t         message_len;
+    const uint8_t *signature;
+    size_t         signature_len;
+} lms_vector_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief Built-in HSS vector (one level, LMS_SHA256_M32_H5, LMOTS_SHA256_N32_W4) */
+extern const lms_vector_t lms_test_vector;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Verify an LMS signature
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE if the signature does not
+ *         match or is malformed, or PSA_ERROR_NOT_SUPPORTED for an unknown
+ *         LMS or LM-OTS type
+ */
+psa_status_t lms_verify(const uint8_t *public_key, size_t public_key_len,
+                        const uint8_t *message, size_t message_len,
+                        const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Verify an HSS signature
+ *
+ * Each level's signed public key is checked with the key above it, then
+ * the message with the bottom key.
+ *
+ * @return As lms_verify()
+ */
+psa_status_t hss_verify(const uint8_t *public_key, size_t public_key_len,
+                        const uint8_t *message, size_t message_len,
+                        const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Check lms_test_vector and a corrupted copy of it
+ *
+ * @return PSA_SUCCESS, or PSA_ERROR_CORRUPTION_DETECTED if either result is
+ *         wrong
+ */
+psa_status_t lms_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LMS_VERIFY_H */
+/* [] END OF FILE */
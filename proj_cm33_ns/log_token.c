@@ -0,0 +1,179 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Tokenized (deferred binary) logging
+ * Purpose : Frame encoder for LOG_PRINT() and the plain-text fallback.
+ ********************************************************************************
+ * @file    log_token.c
+ * @brief   Tokenized frame encoder and text fallback over ifx_platform_log_msg
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cycle_counter.h"
+#include "ifx_platform_api.h"
+#include "log_token.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest frame: marker + len + up to 255 payload bytes */
+#define LOG_TOKEN_FRAME_MAX           (2U + 255U)
+
+/** @brief Largest formatted text message */
+#define LOG_TOKEN_TEXT_MAX            (256U)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static log_token_stats_t log_token_stats;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Append an unsigned LEB128 value
+ *
+ * @return Bytes written, 0 if it does not fit
+ */
+static size_t log_token_put_varint(uint8_t *dst, size_t room, uint32_t value)
+{
+    size_t n = 0;
+
+    do
+    {
+        if (n == room)
+        {
+            return 0;
+        }
+        dst[n] = (uint8_t)(value & 0x7FU);
+        value >>= 7;
+        if (value != 0U)
+        {
+            dst[n] |= 0x80U;
+        }
+        n++;
+    } while (value != 0U);
+
+    return n;
+}
+
+/**
+ * @brief Account for one message and hand it to the platform log
+ *
+ * @param[in] start  Cycle count when encoding of the message began
+ */
+static void log_token_write(uint8_t *buf, size_t len, uint32_t start)
+{
+    log_token_stats.encode_cycles += cycle_counter_read() - start;
+    log_token_stats.messages++;
+    log_token_stats.bytes += (uint32_t)len;
+    ifx_platform_log_msg(buf, (int)len);
+}
+
+void log_token_emit(uint32_t token, uint32_t argc, uint32_t types, ...)
+{
+    uint32_t start = cycle_counter_read();
+    uint8_t frame[LOG_TOKEN_FRAME_MAX];
+    size_t pos = 0;
+    va_list args;
+
+    frame[pos++] = LOG_TOKEN_FRAME_MARKER;
+    pos++;                                      /* len, patched below */
+    frame[pos++] = (uint8_t)(token);
+    frame[pos++] = (uint8_t)(token >> 8);
+    frame[pos++] = (uint8_t)(token >> 16);
+    frame[pos++] = (uint8_t)(token >> 24);
+    frame[pos++] = (uint8_t)types;
+
+    va_start(args, types);
+    for (uint32_t i = 0; (i < argc) && (i < LOG_TOKEN_MAX_ARGS); i++)
+    {
+        uint32_t value = va_arg(args, uint32_t);
+        size_t room = sizeof(frame) - pos;
+        size_t n;
+
+        if ((types & (1UL << i)) != 0U)
+        {
+            const char *str = (const char *)(uintptr_t)value;
+            size_t str_len = strlen(str);
+
+            /* Truncate rather than drop the message */
+            if (str_len + 2U > room)
+            {
+                str_len = (room > 2U) ? (room - 2U) : 0U;
+            }
+            n = log_token_put_varint(&frame[pos], room, (uint32_t)str_len);
+            if ((n == 0U) || ((n + str_len) > room))
+            {
+                break;
+            }
+            memcpy(&frame[pos + n], str, str_len);
+            n += str_len;
+        }
+        else
+        {
+            n = log_token_put_varint(&frame[pos], room, value);
+            if (n == 0U)
+            {
+                break;
+            }
+        }
+        pos += n;
+    }
+    va_end(args);
+
+    frame[1] = (uint8_t)(pos - 2U);
+    log_token_write(frame, pos, start);
+}
+
+void log_token_printf(const char *fmt, ...)
+{
+    uint32_t start = cycle_counter_read();
+    unsigned char out_buf[LOG_TOKEN_TEXT_MAX];
+    va_list args;
+    int buf_size;
+
+    va_start(args, fmt);
+    buf_size = vsnprintf((char*)out_buf, sizeof(out_buf), fmt, args);
+    va_end(args);
+
+    if (buf_size < 0)
+    {
+        return;
+    }
+    if ((size_t)buf_size >= sizeof(out_buf))
+    {
+        buf_size = (int)sizeof(out_buf) - 1;
+    }
+    log_token_write(out_buf, (size_t)buf_size, start);
+}
+
+void log_token_get_stats(log_token_stats_t *stats)
+{
+    *stats = log_token_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,269 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Tokenized (deferred binary) logging
+ * Purpose : Replace constant format strings on the UART by a 32-bit token plus
+ *           the raw arguments. The format strings are kept in a non-loaded
+ *           ELF section (.log_tokens) from which tools/log_detokenize.py
+ *           rebuilds the text on the host.
+ * Design  : The token is a 65599 polynomial hash of the string length and its
+ *           first LOG_TOKEN_HASH_LEN characters, computed by the compiler.
+ *           Build with DEFINES+=LOG_TOKENIZED=1 (GCC_ARM only); otherwise
+ *           LOG_PRINT() formats text with vsnprintf as before.
+ ********************************************************************************
+ * @file    log_token.h
+ * @brief   LOG_PRINT() macro, token hashing and frame format
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *
+ * Frame on the wire (all integers little endian):
+ *
+ *   | 0xA5 | len | token (4) | arg types (1) | args ... |
+ *
+ *   len       number of bytes after the len field
+ *   arg types bit i set: argument i is a string, else an integer
+ *   integer   unsigned LEB128 of the 32-bit value
+ *   string    LEB128 length followed by the bytes (no terminator)
+ *
+ * The marker byte is outside the ASCII range so frames can be interleaved
+ * with plain text lines printed by TF-M.
+ *******************************************************************************/
+
+#ifndef LOG_TOKEN_H
+#define LOG_TOKEN_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#if !defined(LOG_TOKENIZED)
+#define LOG_TOKENIZED                 (0)
+#endif
+
+#if (LOG_TOKENIZED) && !(defined(__GNUC__) && !defined(__ARMCC_VERSION))
+#error "LOG_TOKENIZED needs the .log_tokens section, only provided by the GCC_ARM linker script"
+#endif
+
+/** @brief Start-of-frame marker */
+#define LOG_TOKEN_FRAME_MARKER        (0xA5U)
+
+/** @brief Magic at the start of every .log_tokens entry */
+#define LOG_TOKEN_ENTRY_MAGIC         (0xBAA98DEEUL)
+
+/** @brief Maximum number of arguments per LOG_PRINT() */
+#define LOG_TOKEN_MAX_ARGS            (4U)
+
+/** @brief Number of leading characters that go into the token hash */
+#define LOG_TOKEN_HASH_LEN            (80U)
+
+/* Token hash. Generated: term i multiplies character i by 65599^(i+1). */
+#define LOG_TOKEN_HASH_CHAR(s, i) \
+    ((uint32_t)(((i) < (sizeof(s) - 1U)) ? (uint8_t)(s)[((i) < (sizeof(s) - 1U)) ? (i) : 0U] : 0U))
+#define LOG_TOKEN_HASH_TERM(s, i, k)  ((uint32_t)(k) * LOG_TOKEN_HASH_CHAR(s, i))
+#define LOG_TOKEN_HASH(s) \
+    ((uint32_t)((uint32_t)(sizeof(s) - 1U) + \
+     LOG_TOKEN_HASH_TERM(s,  0U, 0x0001003FUL) + \
+     LOG_TOKEN_HASH_TERM(s,  1U, 0x007E0F81UL) + \
+     LOG_TOKEN_HASH_TERM(s,  2U, 0x2E86D0BFUL) + \
+     LOG_TOKEN_HASH_TERM(s,  3U, 0x43EC5F01UL) + \
+     LOG_TOKEN_HASH_TERM(s,  4U, 0x162C613FUL) + \
+     LOG_TOKEN_HASH_TERM(s,  5U, 0xD62AEE81UL) + \
+     LOG_TOKEN_HASH_TERM(s,  6U, 0xA311B1BFUL) + \
+     LOG_TOKEN_HASH_TERM(s,  7U, 0xD319BE01UL) + \
+     LOG_TOKEN_HASH_TERM(s,  8U, 0xB156C23FUL) + \
+     LOG_TOKEN_HASH_TERM(s,  9U, 0x6698CD81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 10U, 0x0D1B92BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 11U, 0xCC881D01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 12U, 0x7280233FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 13U, 0x50C7AC81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 14U, 0x8DA473BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 15U, 0x4F377C01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 16U, 0xFAA8843FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 17U, 0x33B78B81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 18U, 0x45AC54BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 19U, 0x7A27DB01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 20U, 0xEACFE53FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 21U, 0xAE686A81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 22U, 0x563335BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 23U, 0x6C593A01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 24U, 0xE3F6463FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 25U, 0x5FDA4981UL) + \
+     LOG_TOKEN_HASH_TERM(s, 26U, 0xE03916BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 27U, 0x44CB9901UL) + \
+     LOG_TOKEN_HASH_TERM(s, 28U, 0x871BA73FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 29U, 0xE70D2881UL) + \
+     LOG_TOKEN_HASH_TERM(s, 30U, 0x04BDF7BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 31U, 0x227EF801UL) + \
+     LOG_TOKEN_HASH_TERM(s, 32U, 0x7540083FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 33U, 0xE3010781UL) + \
+     LOG_TOKEN_HASH_TERM(s, 34U, 0xE4C1D8BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 35U, 0x24735701UL) + \
+     LOG_TOKEN_HASH_TERM(s, 36U, 0x4F63693FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 37U, 0xF2B5E681UL) + \
+     LOG_TOKEN_HASH_TERM(s, 38U, 0xA144B9BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 39U, 0x69A8B601UL) + \
+     LOG_TOKEN_HASH_TERM(s, 40U, 0xB685CA3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 41U, 0xB52BC581UL) + \
+     LOG_TOKEN_HASH_TERM(s, 42U, 0x5B469ABFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 43U, 0x111F1501UL) + \
+     LOG_TOKEN_HASH_TERM(s, 44U, 0x4BA72B3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 45U, 0xC962A481UL) + \
+     LOG_TOKEN_HASH_TERM(s, 46U, 0x33C77BBFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 47U, 0x39D67401UL) + \
+     LOG_TOKEN_HASH_TERM(s, 48U, 0xAFC78C3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 49U, 0xCE5A8381UL) + \
+     LOG_TOKEN_HASH_TERM(s, 50U, 0x4BC75CBFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 51U, 0x02CED301UL) + \
+     LOG_TOKEN_HASH_TERM(s, 52U, 0x83E6ED3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 53U, 0x63136281UL) + \
+     LOG_TOKEN_HASH_TERM(s, 54U, 0xC4463DBFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 55U, 0x8B083201UL) + \
+     LOG_TOKEN_HASH_TERM(s, 56U, 0x69054E3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 57U, 0x268D4181UL) + \
+     LOG_TOKEN_HASH_TERM(s, 58U, 0xBE441EBFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 59U, 0xF1829101UL) + \
+     LOG_TOKEN_HASH_TERM(s, 60U, 0x0022AF3FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 61U, 0xB7C82081UL) + \
+     LOG_TOKEN_HASH_TERM(s, 62U, 0x5AC0FFBFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 63U, 0x553DF001UL) + \
+     LOG_TOKEN_HASH_TERM(s, 64U, 0xEA3F103FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 65U, 0xB5C3FF81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 66U, 0xBABCE0BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 67U, 0xD53A4F01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 68U, 0xC85A713FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 69U, 0xBF80DE81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 70U, 0xFF37C1BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 71U, 0x9077AE01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 72U, 0x3B74D23FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 73U, 0x73FEBD81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 74U, 0x4931A2BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 75U, 0xA5F60D01UL) + \
+     LOG_TOKEN_HASH_TERM(s, 76U, 0xE48E333FUL) + \
+     LOG_TOKEN_HASH_TERM(s, 77U, 0x723D9C81UL) + \
+     LOG_TOKEN_HASH_TERM(s, 78U, 0xB9AA83BFUL) + \
+     LOG_TOKEN_HASH_TERM(s, 79U, 0x34B56C01UL)))
+
+/* Per-argument type bit and value */
+#define LOG_TOKEN_ARG_IS_STR(a) \
+    _Generic((a), char *: 1U, const char *: 1U, unsigned char *: 1U, const unsigned char *: 1U, default: 0U)
+#define LOG_TOKEN_TYPE(a, i)          ((uint8_t)(LOG_TOKEN_ARG_IS_STR(a) << (i)))
+#if (LOG_TOKENIZED)
+#define LOG_TOKEN_VAL(a)              ((uint32_t)(uintptr_t)(a))
+#else
+#define LOG_TOKEN_VAL(a)              (a)
+#endif
+
+#if (LOG_TOKENIZED)
+
+/**
+ * @brief Store the format string in .log_tokens and emit a binary frame
+ *
+ * The section is marked INFO in the linker script: it is kept in the ELF
+ * for the host decoder but takes no space in flash.
+ */
+#define LOG_TOKEN_EMIT(fmt, n, types, ...)                                        \
+    do                                                                           \
+    {                                                                            \
+        static const struct                                                      \
+        {                                                                        \
+            uint32_t magic;                                                      \
+            uint32_t token;                                                      \
+            uint32_t len;                                                        \
+            char     str[sizeof(fmt)];                                           \
+        } log_token_entry __attribute__((section(".log_tokens"), used)) =        \
+            { LOG_TOKEN_ENTRY_MAGIC, LOG_TOKEN_HASH(fmt), sizeof(fmt) - 1U, fmt }; \
+        log_token_emit(LOG_TOKEN_HASH(fmt), (n), (types), ##__VA_ARGS__);       \
+    } while (0)
+
+#else
+
+#define LOG_TOKEN_EMIT(fmt, n, types, ...)  log_token_printf(fmt, ##__VA_ARGS__)
+
+#endif /* (LOG_TOKENIZED) */
+
+#define LOG_TOKEN_0(fmt) \
+    LOG_TOKEN_EMIT(fmt, 0U, 0U)
+#define LOG_TOKEN_1(fmt, a) \
+    LOG_TOKEN_EMIT(fmt, 1U, LOG_TOKEN_TYPE(a, 0), LOG_TOKEN_VAL(a))
+#define LOG_TOKEN_2(fmt, a, b) \
+    LOG_TOKEN_EMIT(fmt, 2U, LOG_TOKEN_TYPE(a, 0) | LOG_TOKEN_TYPE(b, 1), \
+                   LOG_TOKEN_VAL(a), LOG_TOKEN_VAL(b))
+#define LOG_TOKEN_3(fmt, a, b, c) \
+    LOG_TOKEN_EMIT(fmt, 3U, LOG_TOKEN_TYPE(a, 0) | LOG_TOKEN_TYPE(b, 1) | LOG_TOKEN_TYPE(c, 2), \
+                   LOG_TOKEN_VAL(a), LOG_TOKEN_VAL(b), LOG_TOKEN_VAL(c))
+#define LOG_TOKEN_4(fmt, a, b, c, d) \
+    LOG_TOKEN_EMIT(fmt, 4U, LOG_TOKEN_TYPE(a, 0) | LOG_TOKEN_TYPE(b, 1) | LOG_TOKEN_TYPE(c, 2) | \
+                   LOG_TOKEN_TYPE(d, 3), \
+                   LOG_TOKEN_VAL(a), LOG_TOKEN_VAL(b), LOG_TOKEN_VAL(c), LOG_TOKEN_VAL(d))
+#define LOG_TOKEN_SELECT(fmt, a, b, c, d, name, ...)  name
+
+/**
+ * @brief Log a message with a literal format string and up to four
+ *        integer or string arguments
+ *
+ * Integer arguments are sent as 32-bit values; use only conversions that fit
+ * (%d, %u, %x, %c, %ld, %lu, %zu, ...). In text mode all printf
+ * conversions work, but keep to the same subset so both modes agree.
+ */
+#define LOG_PRINT(...) \
+    LOG_TOKEN_SELECT(__VA_ARGS__, LOG_TOKEN_4, LOG_TOKEN_3, LOG_TOKEN_2, LOG_TOKEN_1, LOG_TOKEN_0, _)(__VA_ARGS__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Bytes written by the logger, for comparing the two modes */
+typedef struct
+{
+    uint32_t messages;      /**< LOG_PRINT() calls                  */
+    uint32_t bytes;         /**< Bytes passed to the platform log   */
+    uint64_t encode_cycles; /**< Building frames or formatting text,
+                                 not counting the platform log write */
+} log_token_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Encode and send one tokenized frame; use LOG_PRINT() instead */
+void log_token_emit(uint32_t token, uint32_t argc, uint32_t types, ...);
+
+/** @brief Format and send one text message; use LOG_PRINT() instead */
+void log_token_printf(const char *fmt, ...);
+
+/**
+ * @brief Snapshot of the message, byte and encode cycle counters
+ *
+ * encode_cycles only advances while the DWT cycle counter runs
+ * (cycle_counter_init()).
+ */
+void log_token_get_stats(log_token_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LOG_TOKEN_H */
+/* [] END OF FILE */
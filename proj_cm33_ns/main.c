@@ -38,7 +38,9 @@
 /* --------------------   */
 /* Standard Library       */
 /* --------------------   */
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 /* --------------------   */
 /* Infineon Libraries     */
@@ -54,16 +56,60 @@
 #include "os_wrapper/common.h"
 #include "psa/crypto.h"
 
+/* --------------------   */
+/* Application Modules    */
+/* --------------------   */
+#include "app_benchmarks.h"
+#include "crypto_arena.h"
+#include "crypto_dispatch.h"
+#include "log_token.h"
+#include "relay_coalesce.h"
+#include "signing.h"
+#include "stack_usage.h"
+
+#if defined(COMPONENT_RTOS_AWARE)
+/* --------------------   */
+/* RTOS (RTOS_BUILD=1)    */
+/* --------------------   */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cyabs_rtos.h"
+#include "sign_service_uart.h"
+#include "sign_worker.h"
+#include "task_stats.h"
+#endif
+
 
 /* -------------------------------------------------------------------- */
 /* Macros                                                               */
 /* -------------------------------------------------------------------- */
 
-/** @brief ECDSA P-256 key size in bits */
-#define EC_KEY_BITS                   ((size_t) 256)
+/** @brief Signature scheme of the demo key (SIGNING_SCHEME_ECDSA_P256, _P384, ED25519) */
+#ifndef SIGNING_DEMO_SCHEME
+#define SIGNING_DEMO_SCHEME           SIGNING_SCHEME_ECDSA_P256
+#endif
+
+/** @brief Nonce mode of the demo key (SIGNING_NONCE_RANDOM or _DETERMINISTIC) */
+#ifndef SIGNING_DEMO_NONCE
+#define SIGNING_DEMO_NONCE            SIGNING_NONCE_RANDOM
+#endif
 
-/** @brief ECDSA signature size (R + S components, 32 bytes each) */
-#define EC_SIGNATURE_SIZE             (2*(EC_KEY_BITS/8))
+/** @brief Bare-metal relay: coalesce queue interrupts under load (RELAY_COALESCE=1) */
+#ifndef RELAY_COALESCE
+#define RELAY_COALESCE                (0)
+#endif
+
+/**
+ * @brief SHA-256 size buckets served in software (bit 0: up to 16 bytes ...
+ *        bit 4: over 1 KB); a BENCHMARK_BUILD=1 boot calibrates and logs
+ *        the value for the current build
+ */
+#ifndef CRYPTO_DISPATCH_SW_BUCKETS
+#define CRYPTO_DISPATCH_SW_BUCKETS    (0x00U)
+#endif
+
+/** @brief Bare-metal relay with RELAY_COALESCE: requests between latency reports */
+#define RELAY_STATS_REPORT_REQUESTS   (1024U)
 
 /** @brief Number of bytes to print per line in hex dump */
 #define PRNT_BYTES_PER_LINE           (16u)
@@ -75,17 +121,59 @@
 #define CM55_APP_BOOT_ADDR            (CYMEM_CM33_0_m55_nvm_START + \
                                         CYBSP_MCUBOOT_HEADER_SIZE)
 
+#if defined(COMPONENT_RTOS_AWARE)
+/** @brief Stack size of the application task in bytes */
+#ifndef APP_TASK_STACK_SIZE
+#define APP_TASK_STACK_SIZE           (4096U)
+#endif
+
+/** @brief Application task priority */
+#define APP_TASK_PRIORITY             (CY_RTOS_PRIORITY_NORMAL)
+
+/** @brief Signing jobs queued to the worker pool per reporting period */
+#define WORKER_JOBS_PER_PERIOD        (16U)
+
+/** @brief Interval between worker pool / task statistics reports */
+#define STATS_REPORT_PERIOD_MS        (5000U)
+#endif
+
 
 /* -------------------------------------------------------------------- */
 /* Global Variables                                                     */
 /* -------------------------------------------------------------------- */
-/* (None) */
+
+/** @brief Message signed by the demo */
+static const unsigned char input_data[] = "Hello World";
+
+/** @brief Key used by the demo and the signing workers */
+static signing_key_t demo_key;
+
+#if defined(COMPONENT_RTOS_AWARE)
+static cy_thread_t app_task_handle;
+static uint64_t    app_task_stack[APP_TASK_STACK_SIZE / sizeof(uint64_t)];
+static cy_semaphore_t worker_done_sema;
+static sign_job_t  worker_jobs[WORKER_JOBS_PER_PERIOD];
+static uint8_t     worker_signatures[WORKER_JOBS_PER_PERIOD][SIGNING_SIGNATURE_MAX_SIZE];
+#endif
 
 
 /* -------------------------------------------------------------------- */
 /* Function Prototypes                                                  */
 /* -------------------------------------------------------------------- */
-/* (None) */
+static void signing_demo(signing_key_t *key);
+static void memory_usage_report(void);
+static void crypto_dispatch_setup(void);
+#if defined(COMPONENT_RTOS_AWARE)
+static void app_task(cy_thread_arg_t arg);
+#else
+static cy_rslt_t relay_service(void);
+#if (RELAY_COALESCE)
+static void relay_stats_report(void);
+#endif
+#if (APP_BENCHMARKS)
+static void relay_serve_pending(void);
+#endif
+#endif
 
 
 /* -------------------------------------------------------------------- */
@@ -93,78 +181,44 @@
 /* -------------------------------------------------------------------- */
 
 /**
- * @brief Main function - ECDSA signing and verification demo
+ * @brief ECDSA signing and verification demo
  *
  * Demonstrates the complete flow of digital signature operations:
- * 1. Generate an ephemeral ECDSA P-256 key pair
+ * 1. Generate an ephemeral key pair (ECDSA P-256 unless SIGNING_DEMO_SCHEME)
  * 2. Sign a test message using the private key
  * 3. Verify the signature using the public key
  *
  * The demo uses PSA Crypto API which abstracts the underlying hardware
  * (OPTIGA Trust M) for cryptographic operations.
  *
- * @return int  Exit status (never returns in normal operation)
+ * @param[out] key  Generated key; the caller destroys it
  *
  * @note This is a simplified demo using ephemeral keys. Production systems
  *       would use persistent device keys stored in OPTIGA Trust M.
  */
-int main(void)
+static void signing_demo(signing_key_t *key)
 {
-    cy_rslt_t result;
-    uint32_t rslt;
     psa_status_t status;
-    const unsigned char input_data[] = "Hello World";
-    uint8_t signature[EC_SIGNATURE_SIZE];
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
     size_t signature_len;
-    psa_key_id_t ec_key_id;
-    psa_key_attributes_t ec_key_attributes;
+    signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
     unsigned char out_buf[256];
     int buf_size;
 
-    /* Initialize the device and board peripherals */
-    result = cybsp_init();
-
-    /* Board init failed. Stop program execution */
-    if (result != CY_RSLT_SUCCESS)
-    {
-        CY_ASSERT(0);
-    }
-
-    /* Enable global interrupts */
-    __enable_irq();
-
-    /* Initialize TF-M interface */
-    rslt = tfm_ns_interface_init();
-    if(rslt != OS_WRAPPER_SUCCESS)
-    {
-        CY_ASSERT(0);
-    }
-
     /* Clear screen and print banner */
-    buf_size = sprintf((char*)out_buf, "\x1b[2J\x1b[;H"
-                "=======================================================\r\n"
-                "  OPTIGA Trust M - Digital Signatures (ECDSA)\r\n"
-                "  PSoC Edge E84 | TF-M Secure Platform\r\n"
-                "=======================================================\r\n\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("\x1b[2J\x1b[;H"
+              "=======================================================\r\n"
+              "  OPTIGA Trust M - Digital Signatures (ECDSA)\r\n"
+              "  PSoC Edge E84 | TF-M Secure Platform\r\n"
+              "=======================================================\r\n\n");
 
     /* Initialize PSA Crypto subsystem */
-    psa_crypto_init();
-
-    /* ========== Step 1: Generate ECDSA Key Pair ========== */
-    buf_size = sprintf((char*)out_buf, "========== Step 1: Generate ECDSA Key Pair ==========\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    signing_init();
 
-    buf_size = sprintf((char*)out_buf, "Generating EC P-256 key pair...\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    /* ========== Step 1: Generate Key Pair ========== */
+    LOG_PRINT("========== Step 1: Generate Key Pair ==========\r\n");
 
-    /* Set key attributes for ECDSA P-256 */
-    psa_set_key_usage_flags(&ec_key_attributes,
-              PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
-    psa_set_key_algorithm(&ec_key_attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
-    psa_set_key_type(&ec_key_attributes,
-            PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
-    psa_set_key_bits(&ec_key_attributes, EC_KEY_BITS);
+    LOG_PRINT("Generating %s key pair...\r\n", signing_scheme_name(SIGNING_DEMO_SCHEME));
 
     /* LEARNING DEMO: Use ephemeral (volatile) key for simplicity
      *
@@ -178,52 +232,50 @@ int main(void)
      *   - Private key never leaves secure hardware
      *   - See Part 3 tutorial for production implementation
      */
-    psa_set_key_lifetime(&ec_key_attributes, PSA_KEY_LIFETIME_VOLATILE);
+    config.lifetime = PSA_KEY_LIFETIME_VOLATILE;
+    config.scheme = SIGNING_DEMO_SCHEME;
+    config.nonce = SIGNING_DEMO_NONCE;
 
     /* Generate ephemeral key pair */
-    status = psa_generate_key(&ec_key_attributes, &ec_key_id);
+    status = signing_key_generate(&config, key);
+    if ((status == PSA_ERROR_NOT_SUPPORTED) && (config.nonce == SIGNING_NONCE_DETERMINISTIC))
+    {
+        LOG_PRINT("    Deterministic ECDSA not supported, using randomized\r\n");
+        config.nonce = SIGNING_NONCE_RANDOM;
+        status = signing_key_generate(&config, key);
+    }
     if(status != PSA_SUCCESS)
     {
-        buf_size = sprintf((char*)out_buf, "    [FAIL] Key generation failed\r\n\n");
-        ifx_platform_log_msg(out_buf, buf_size);
+        LOG_PRINT("    [FAIL] Key generation failed\r\n\n");
         CY_ASSERT(0);
     }
 
-    buf_size = sprintf((char*)out_buf, "    [OK] EC P-256 key pair generated\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
-
-    buf_size = sprintf((char*)out_buf, "    - Algorithm: ECDSA with SHA-256\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("    [OK] %s key pair generated\r\n", signing_scheme_name(key->scheme));
 
-    buf_size = sprintf((char*)out_buf, "    - Curve: NIST P-256 (secp256r1)\r\n\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("    - Signature: %lu bytes, %s\r\n\n",
+              (unsigned long)signing_signature_size(key),
+              ((key->scheme == SIGNING_SCHEME_ED25519) || (config.nonce == SIGNING_NONCE_DETERMINISTIC)) ?
+              "deterministic" : "randomized nonce");
 
     /* ========== Step 2: Sign Message ========== */
-    buf_size = sprintf((char*)out_buf, "========== Step 2: Sign Message ==========\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("========== Step 2: Sign Message ==========\r\n");
 
-    buf_size = sprintf((char*)out_buf, "Message: \"%s\"\r\n", input_data);
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("Message: \"%s\"\r\n", input_data);
 
-    buf_size = sprintf((char*)out_buf, "Signing with EC private key...\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("Signing with EC private key...\r\n");
 
     /* Sign message using ECDSA with SHA-256 */
-    status = psa_sign_message(ec_key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256),
-                              input_data, sizeof(input_data), signature,
-                              sizeof(signature), &signature_len);
+    status = signing_sign(key, input_data, sizeof(input_data), signature,
+                          sizeof(signature), &signature_len);
     if(status != PSA_SUCCESS)
     {
-        buf_size = sprintf((char*)out_buf, "    [FAIL] Signature generation failed\r\n\n");
-        ifx_platform_log_msg(out_buf, buf_size);
+        LOG_PRINT("    [FAIL] Signature generation failed\r\n\n");
         CY_ASSERT(0);
     }
 
-    buf_size = sprintf((char*)out_buf, "    [OK] Signature generated (%d bytes)\r\n\n", signature_len);
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("    [OK] Signature generated (%d bytes)\r\n\n", signature_len);
 
-    buf_size = sprintf((char*)out_buf, "Signature (hex):\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("Signature (hex):\r\n");
 
     /* Print signature in hex format */
     for(int i = 0; i < ((signature_len/PRNT_BYTES_PER_LINE) + ((signature_len%PRNT_BYTES_PER_LINE) ? 1: 0)); i++)
@@ -242,60 +294,375 @@ int main(void)
         ifx_platform_log_msg(out_buf, ((j*5) + buf_size));
     }
 
-    buf_size = sprintf((char*)out_buf, "\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("\r\n");
 
     /* ========== Step 3: Verify Signature ========== */
-    buf_size = sprintf((char*)out_buf, "========== Step 3: Verify Signature ==========\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("========== Step 3: Verify Signature ==========\r\n");
 
-    buf_size = sprintf((char*)out_buf, "Verifying signature with EC public key...\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("Verifying signature with EC public key...\r\n");
 
     /* Verify signature using ECDSA */
-    status = psa_verify_message(ec_key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256),
-               input_data, sizeof(input_data), signature, signature_len);
+    status = signing_verify(key, input_data, sizeof(input_data), signature, signature_len);
     if(status != PSA_SUCCESS)
     {
-        buf_size = sprintf((char*)out_buf, "    [FAIL] Signature verification failed\r\n\n");
-        ifx_platform_log_msg(out_buf, buf_size);
+        LOG_PRINT("    [FAIL] Signature verification failed\r\n\n");
         CY_ASSERT(0);
     }
 
-    buf_size = sprintf((char*)out_buf, "    [OK] Signature verified\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("    [OK] Signature verified\r\n");
 
-    buf_size = sprintf((char*)out_buf, "    [OK] Message authenticity confirmed\r\n\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("    [OK] Message authenticity confirmed\r\n\n");
 
-    buf_size = sprintf((char*)out_buf, "=======================================================\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("=======================================================\r\n");
 
-    buf_size = sprintf((char*)out_buf, "  Demo completed successfully!\r\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("  Demo completed successfully!\r\n");
 
-    buf_size = sprintf((char*)out_buf, "=======================================================\r\n\n");
-    ifx_platform_log_msg(out_buf, buf_size);
+    LOG_PRINT("=======================================================\r\n\n");
+}
 
-    /* Destroy key when done */
-    psa_destroy_key(ec_key_id);
+
+/**
+ * @brief Set up the crypto dispatcher from the stored table
+ *
+ * The table comes from CRYPTO_DISPATCH_SW_BUCKETS, so a default boot does
+ * not time anything. With APP_BENCHMARKS the TF-M and software SHA-256 are
+ * timed at each calibration size, the faster one is used per size bucket,
+ * and the value to store is logged.
+ */
+static void crypto_dispatch_setup(void)
+{
+    crypto_dispatch_table_t stored;
+#if (APP_BENCHMARKS)
+    static const uint32_t sizes[CRYPTO_DISPATCH_BUCKETS] = CRYPTO_DISPATCH_CAL_SIZES;
+    crypto_dispatch_table_t table;
+    crypto_dispatch_stats_t stats;
+    uint32_t sw_buckets = 0;
+#endif
+
+    memset(&stored, CRYPTO_BACKEND_PSA, sizeof(stored));
+    for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+    {
+        if ((((uint32_t)CRYPTO_DISPATCH_SW_BUCKETS >> b) & 1U) != 0U)
+        {
+            stored.backend[CRYPTO_OP_SHA256][b] = CRYPTO_BACKEND_SW;
+        }
+    }
+
+    crypto_dispatch_init();
+    (void)crypto_dispatch_set_table(&stored);
+
+#if (APP_BENCHMARKS)
+    if (crypto_dispatch_calibrate() != PSA_SUCCESS)
+    {
+        LOG_PRINT("Crypto dispatch: calibration incomplete, using the stored table\r\n");
+        (void)crypto_dispatch_set_table(&stored);
+        return;
+    }
+
+    crypto_dispatch_get_table(&table);
+    crypto_dispatch_get_stats(CRYPTO_OP_SHA256, &stats);
+    LOG_PRINT("SHA-256 backend (cycles per call: PSA / SW):\r\n");
+    for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+    {
+        bool sw = (table.backend[CRYPTO_OP_SHA256][b] == CRYPTO_BACKEND_SW);
+
+        sw_buckets |= sw ? (1UL << b) : 0U;
+        LOG_PRINT("  <= %4lu B: %7lu / %7lu -> %s\r\n",
+                  (unsigned long)sizes[b],
+                  (unsigned long)stats.ticks[b][CRYPTO_BACKEND_PSA],
+                  (unsigned long)stats.ticks[b][CRYPTO_BACKEND_SW],
+                  sw ? "SW" : "PSA");
+    }
+    LOG_PRINT("Store with CRYPTO_DISPATCH_SW_BUCKETS=0x%02lx (built with 0x%02lx)\r\n\n",
+              (unsigned long)sw_buckets, (unsigned long)CRYPTO_DISPATCH_SW_BUCKETS);
+#endif
+}
+
+/**
+ * @brief Log peak main stack, heap and crypto arena use of this image
+ *
+ * The stack figure covers everything that ran on the main stack since
+ * reset (bare-metal main loop, or startup and interrupts in the RTOS build).
+ */
+static void memory_usage_report(void)
+{
+    stack_usage_t usage;
+    crypto_arena_stats_t arena;
+
+    stack_usage_get(&usage);
+    LOG_PRINT("Main stack: %lu of %lu bytes used\r\n",
+              (unsigned long)usage.stack_peak, (unsigned long)usage.stack_size);
+    LOG_PRINT("Heap: %lu of %lu bytes peak, %lu in use\r\n",
+              (unsigned long)usage.heap_peak, (unsigned long)usage.heap_size,
+              (unsigned long)usage.heap_in_use);
+
+    crypto_arena_get_stats(&arena);
+    LOG_PRINT("Crypto arena: %lu bytes peak, %lu bump peak, %lu failed, %lu reclaimed\r\n",
+              (unsigned long)arena.bytes_peak, (unsigned long)arena.bump_peak,
+              (unsigned long)arena.failures, (unsigned long)arena.bump_reclaimed);
+}
+
+#if !defined(COMPONENT_RTOS_AWARE)
+/**
+ * @brief Receive and forward one round of M55 requests to TF-M
+ *
+ * Default: block for one request and process it, one queue interrupt per
+ * request. RELAY_COALESCE=1: relay_coalesce_service() polls on with the
+ * interrupt masked while requests keep arriving.
+ *
+ * @return cy_rslt_t  CY_RSLT_SUCCESS, or the IPC error
+ */
+static cy_rslt_t relay_service(void)
+{
+#if (RELAY_COALESCE)
+    return relay_coalesce_service();
+#else
+    cy_rslt_t result;
+
+    result = mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, MTB_IPC_NEVER_TIMEOUT);
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = mtb_srf_ipc_process_pending_request(&cybsp_mtb_srf_relay_context);
+    }
+    return result;
+#endif
+}
+
+#if (APP_BENCHMARKS)
+/** @brief Forward M55 requests that are already waiting; app_benchmarks_run_cm55() hook */
+static void relay_serve_pending(void)
+{
+#if (RELAY_COALESCE)
+    (void)relay_coalesce_service_pending();
+#else
+    while (mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, 0UL) == CY_RSLT_SUCCESS)
+    {
+        (void)mtb_srf_ipc_process_pending_request(&cybsp_mtb_srf_relay_context);
+    }
+#endif
+}
+#endif
+
+#if (RELAY_COALESCE)
+/**
+ * @brief Log relay counters and latency every RELAY_STATS_REPORT_REQUESTS
+ *        M55 requests
+ */
+static void relay_stats_report(void)
+{
+    static uint32_t reported;
+    relay_coalesce_stats_t stats;
+
+    relay_coalesce_get_stats(&stats);
+    if ((stats.requests - reported) < RELAY_STATS_REPORT_REQUESTS)
+    {
+        return;
+    }
+    reported = stats.requests;
+    LOG_PRINT("M55 relay: %lu requests, %lu interrupts, %lu polled, burst limit %lu\r\n",
+              (unsigned long)stats.requests, (unsigned long)stats.interrupts,
+              (unsigned long)stats.polled, (unsigned long)stats.batch_limit);
+    LOG_PRINT("  arrival to reply p50/p90/p99 <= %lu / %lu / %lu us\r\n",
+              (unsigned long)stats.latency_p50_us, (unsigned long)stats.latency_p90_us,
+              (unsigned long)stats.latency_p99_us);
+}
+#endif /* (RELAY_COALESCE) */
+#endif
+
+#if defined(COMPONENT_RTOS_AWARE)
+/**
+ * @brief Worker pool completion callback, runs on a worker thread
+ *
+ * @param[in] job  Completed job
+ */
+static void worker_job_done(sign_job_t *job)
+{
+    CY_UNUSED_PARAMETER(job);
+    cy_rtos_semaphore_set(&worker_done_sema);
+}
+
+/**
+ * @brief Application task for the RTOS build
+ *
+ * Runs the signing demo, starts the CM55, then keeps the signing worker
+ * pool busy and periodically logs per-worker and per-task statistics.
+ * M55 requests are relayed by the BSP receive/process threads; with
+ * SIGN_SERVICE_UART_HW defined the UART signing service is started too.
+ *
+ * @param[in] arg  Unused
+ */
+static void app_task(cy_thread_arg_t arg)
+{
+    cy_rslt_t result;
+    sign_worker_stats_t stats;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    signing_demo(&demo_key);
+    /* Pick TF-M or software per operation size */
+    crypto_dispatch_setup();
+
+#if (APP_BENCHMARKS)
+    app_benchmarks_run();
+#endif
 
     /* Enable CM55 */
     Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
 
+#if (APP_BENCHMARKS)
+    /* Runs while M55 is up: the BSP relay threads keep serving it */
+    app_benchmarks_run_cm55(NULL);
+#endif
+
+    result = cy_rtos_semaphore_init(&worker_done_sema, WORKER_JOBS_PER_PERIOD, 0);
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = sign_worker_init();
+    }
+#if defined(SIGN_SERVICE_UART_HW)
+    /* Serve gateway sign/verify requests with the demo key */
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = sign_service_uart_start(&demo_key);
+    }
+#endif
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
     for (;;)
     {
-        /* Receive and forward IPC requests from M55 to TF-M */
-        result = mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, MTB_IPC_NEVER_TIMEOUT);
-        if(result != CY_RSLT_SUCCESS)
+        for (uint32_t i = 0; i < WORKER_JOBS_PER_PERIOD; i++)
         {
-            CY_ASSERT(0);
+            worker_jobs[i] = (sign_job_t)
+            {
+                .key_id         = demo_key.key_id,
+                .alg            = demo_key.alg,
+                .input          = input_data,
+                .input_len      = sizeof(input_data),
+                .signature      = worker_signatures[i],
+                .signature_size = sizeof(worker_signatures[i]),
+                .on_done        = worker_job_done,
+            };
+            result = sign_worker_submit(&worker_jobs[i], CY_RTOS_NEVER_TIMEOUT);
+            CY_ASSERT(result == CY_RSLT_SUCCESS);
+        }
+        for (uint32_t i = 0; i < WORKER_JOBS_PER_PERIOD; i++)
+        {
+            cy_rtos_semaphore_get(&worker_done_sema, CY_RTOS_NEVER_TIMEOUT);
+        }
+
+        for (uint32_t i = 0; i < SIGN_WORKER_COUNT; i++)
+        {
+            sign_worker_get_stats(i, &stats);
+            LOG_PRINT("Worker %lu: %lu jobs, %lu failed, %lu cycles/job\r\n",
+                      (unsigned long)i, (unsigned long)stats.jobs,
+                      (unsigned long)stats.failures,
+                      (unsigned long)((stats.jobs > 0U) ? (stats.busy_cycles / stats.jobs) : 0U));
         }
-        result =  mtb_srf_ipc_process_pending_request(&cybsp_mtb_srf_relay_context);
+        task_stats_report();
+        memory_usage_report();
+
+        cy_rtos_delay_milliseconds(STATS_REPORT_PERIOD_MS);
+    }
+}
+#endif /* defined(COMPONENT_RTOS_AWARE) */
+
+/**
+ * @brief Main function - board bring-up, signing demo and M55 request relay
+ *
+ * Bare-metal build: runs the demo, starts the CM55 and then relays M55
+ * secure requests to TF-M in the main loop.
+ * RTOS build (RTOS_BUILD=1): the BSP relay threads handle M55 requests and
+ * the demo runs from an application task.
+ *
+ * @return int  Exit status (never returns in normal operation)
+ */
+int main(void)
+{
+    cy_rslt_t result;
+    uint32_t rslt;
+
+    /* Initialize the device and board peripherals */
+    result = cybsp_init();
+
+    /* Board init failed. Stop program execution */
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+    /* Enable global interrupts */
+    __enable_irq();
+
+    /* Initialize TF-M interface */
+    rslt = tfm_ns_interface_init();
+    if(rslt != OS_WRAPPER_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+    /* Scratch memory for crypto code running on this core */
+    crypto_arena_init();
+
+#if defined(COMPONENT_RTOS_AWARE)
+    result = cy_rtos_thread_create(&app_task_handle, &app_task, "App Task",
+                                   app_task_stack, sizeof(app_task_stack),
+                                   APP_TASK_PRIORITY, NULL);
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+    /* Hands over to the BSP relay threads and the application task */
+    vTaskStartScheduler();
+
+    /* Only reached if there is not enough heap for the idle task */
+    CY_ASSERT(0);
+    for (;;)
+    {
+    }
+#else
+    signing_demo(&demo_key);
+
+    /* Destroy key when done */
+    signing_key_destroy(&demo_key);
+
+    /* Pick TF-M or software per operation size */
+    crypto_dispatch_setup();
+
+#if (APP_BENCHMARKS)
+    app_benchmarks_run();
+#endif
+
+    memory_usage_report();
+
+#if (RELAY_COALESCE)
+    /* Coalesce IPC queue interrupts while M55 requests arrive back-to-back */
+    relay_coalesce_init();
+#endif
+
+    /* Enable CM55 */
+    Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+
+#if (APP_BENCHMARKS)
+    /* Runs while M55 is up: relay_serve_pending() keeps the relay served */
+    app_benchmarks_run_cm55(relay_serve_pending);
+#endif
+
+    for (;;)
+    {
+        /* Receive and forward IPC requests from M55 to TF-M */
+        result = relay_service();
         if(result != CY_RSLT_SUCCESS)
         {
             CY_ASSERT(0);
         }
+#if (RELAY_COALESCE)
+        relay_stats_report();
+#endif
     }
+#endif /* defined(COMPONENT_RTOS_AWARE) */
 }
 /* [] END OF FILE */
@@ -0,0 +1,289 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : SRF relay with IPC interrupt coalescing
+ * Purpose : Serve M55 secure requests in bursts with the IPC queue interrupt
+ *           masked. Events raised while masked stay pending in the NVIC and
+ *           are taken as a single interrupt when the burst ends.
+ * Design  : Two thresholds adapt to the observed traffic:
+ *           - poll window: doubled when polling found another request,
+ *             halved when it expired empty;
+ *           - burst limit: doubled when a burst was cut by the limit,
+ *             halved when it ended well below it.
+ *           Latency runs from arrival to the reply. A request that woke the
+ *           relay arrived when its queue interrupt fired. For a request
+ *           that was already waiting or found by polling, the arrival is
+ *           taken as the previous pickup or empty poll. Several requests
+ *           queued at once are not told apart, so time spent waiting
+ *           behind more than one earlier request is missed and the figure
+ *           errs low under backlog (tools/host/relay_coalesce_sim prints
+ *           it next to the true latency).
+ ********************************************************************************
+ * @file    relay_coalesce.c
+ * @brief   Adaptive interrupt-coalescing SRF relay loop for the bare-metal build
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "relay_coalesce.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief NVIC line of the SRF relay queue interrupt (see cybsp.c) */
+#define RELAY_QUEUE_IRQN              ((IRQn_Type)CY_IPC_INTR_MUX(MTB_IPC_IRQ_QUEUE_SRF_RELAY))
+
+/** @brief Latency histogram: bucket b holds latencies in [2^b, 2^(b+1)) us */
+#define RELAY_LATENCY_BUCKETS         (24U)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static relay_coalesce_stats_t relay_stats;
+static volatile uint32_t      relay_irq_count;
+static volatile uint32_t      relay_irq_at;       /**< Cycle count at the last queue interrupt   */
+static uint32_t               relay_pickup_irqs;  /**< relay_irq_count at the previous pickup    */
+static uint32_t               relay_empty_at;     /**< Queue last seen without the next request  */
+static uint32_t               relay_latency_hist[RELAY_LATENCY_BUCKETS];
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/* Defined in cybsp.c, not exported through cybsp.h */
+extern void cybsp_srf_ipc_queue_interrupt_handler(void);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Counting wrapper around the BSP queue interrupt handler
+ */
+static void relay_coalesce_queue_isr(void)
+{
+    relay_irq_at = cycle_counter_read();
+    relay_irq_count++;
+    cybsp_srf_ipc_queue_interrupt_handler();
+}
+
+static void relay_coalesce_record_latency(uint32_t cycles)
+{
+    uint32_t us = cycle_counter_to_us(cycles);
+    uint32_t bucket = 0;
+
+    while ((us > 1U) && (bucket < (RELAY_LATENCY_BUCKETS - 1U)))
+    {
+        us >>= 1;
+        bucket++;
+    }
+    relay_latency_hist[bucket]++;
+}
+
+/**
+ * @brief Upper bound (us) of the histogram bucket holding the given percentile
+ */
+static uint32_t relay_coalesce_percentile(uint32_t percent)
+{
+    uint32_t total = 0;
+    uint32_t target;
+    uint32_t seen = 0;
+
+    for (uint32_t b = 0; b < RELAY_LATENCY_BUCKETS; b++)
+    {
+        total += relay_latency_hist[b];
+    }
+    if (total == 0U)
+    {
+        return 0;
+    }
+
+    target = (uint32_t)(((uint64_t)total * percent + 99U) / 100U);
+    for (uint32_t b = 0; b < RELAY_LATENCY_BUCKETS; b++)
+    {
+        seen += relay_latency_hist[b];
+        if (seen >= target)
+        {
+            return 2UL << b;
+        }
+    }
+    return 2UL << (RELAY_LATENCY_BUCKETS - 1U);
+}
+
+/**
+ * @brief Arrival time of the request just received (see file header)
+ */
+static uint32_t relay_coalesce_arrival(void)
+{
+    uint32_t now = cycle_counter_read();
+    uint32_t irqs = relay_irq_count;
+    uint32_t arrived = (irqs != relay_pickup_irqs) ? relay_irq_at : relay_empty_at;
+
+    relay_pickup_irqs = irqs;
+    relay_empty_at = now;
+    return arrived;
+}
+
+/**
+ * @brief Forward one received request to TF-M and time it from its arrival
+ */
+static cy_rslt_t relay_coalesce_forward(void)
+{
+    uint32_t arrived = relay_coalesce_arrival();
+    cy_rslt_t result = mtb_srf_ipc_process_pending_request(&cybsp_mtb_srf_relay_context);
+
+    relay_coalesce_record_latency(cycle_counter_read() - arrived);
+    relay_stats.requests++;
+    return result;
+}
+
+/**
+ * @brief Poll for another request until the poll window expires
+ *
+ * @return true if a request was received
+ */
+static bool relay_coalesce_poll(void)
+{
+    uint32_t window = cycle_counter_from_us(relay_stats.poll_window_us);
+    uint32_t start = cycle_counter_read();
+    uint32_t now;
+
+    do
+    {
+        now = cycle_counter_read();
+        if (mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, 0UL) == CY_RSLT_SUCCESS)
+        {
+            return true;
+        }
+        relay_empty_at = now;
+    } while ((now - start) < window);
+
+    return false;
+}
+
+void relay_coalesce_init(void)
+{
+    memset(&relay_stats, 0, sizeof(relay_stats));
+    memset(relay_latency_hist, 0, sizeof(relay_latency_hist));
+    relay_irq_count = 0;
+    relay_pickup_irqs = 0;
+    relay_stats.poll_window_us = RELAY_COALESCE_POLL_MIN_US;
+    relay_stats.batch_limit = RELAY_COALESCE_BATCH_MIN;
+
+    cycle_counter_init();
+    relay_empty_at = cycle_counter_read();
+    Cy_SysInt_SetVector(RELAY_QUEUE_IRQN, relay_coalesce_queue_isr);
+}
+
+cy_rslt_t relay_coalesce_service(void)
+{
+    cy_rslt_t result;
+    uint32_t burst = 0;
+    bool more;
+
+    /* First request of a burst: sleep on the interrupt-driven wait. An
+     * interrupt taken before this point (the one left pending by the last
+     * burst) belongs to requests already served. */
+    relay_pickup_irqs = relay_irq_count;
+    result = mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, MTB_IPC_NEVER_TIMEOUT);
+    if (result != CY_RSLT_SUCCESS)
+    {
+        return result;
+    }
+    relay_stats.bursts++;
+
+    NVIC_DisableIRQ(RELAY_QUEUE_IRQN);
+
+    do
+    {
+        result = relay_coalesce_forward();
+        burst++;
+        if ((result != CY_RSLT_SUCCESS) || (burst >= relay_stats.batch_limit))
+        {
+            break;
+        }
+
+        more = relay_coalesce_poll();
+        if (more)
+        {
+            relay_stats.polled++;
+            if (relay_stats.poll_window_us < RELAY_COALESCE_POLL_MAX_US)
+            {
+                relay_stats.poll_window_us *= 2U;
+            }
+        }
+        else if (relay_stats.poll_window_us > RELAY_COALESCE_POLL_MIN_US)
+        {
+            relay_stats.poll_window_us /= 2U;
+        }
+    } while (more);
+
+    /* Adapt the burst limit to how long bursts actually are */
+    if ((burst >= relay_stats.batch_limit) && (relay_stats.batch_limit < RELAY_COALESCE_BATCH_MAX))
+    {
+        relay_stats.batch_limit *= 2U;
+    }
+    else if (((burst * 2U) < relay_stats.batch_limit) && (relay_stats.batch_limit > RELAY_COALESCE_BATCH_MIN))
+    {
+        relay_stats.batch_limit /= 2U;
+    }
+
+    /* Queue events raised during the burst are still pending: take them once */
+    NVIC_EnableIRQ(RELAY_QUEUE_IRQN);
+
+    return result;
+}
+
+cy_rslt_t relay_coalesce_service_pending(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for (uint32_t burst = 0; burst < relay_stats.batch_limit; burst++)
+    {
+        if (mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, 0UL) != CY_RSLT_SUCCESS)
+        {
+            break;
+        }
+        relay_stats.polled++;
+        result = relay_coalesce_forward();
+        if (result != CY_RSLT_SUCCESS)
+        {
+            break;
+        }
+    }
+    return result;
+}
+
+void relay_coalesce_get_stats(relay_coalesce_stats_t *stats)
+{
+    *stats = relay_stats;
+    stats->interrupts = relay_irq_count;
+    stats->latency_p50_us = relay_coalesce_percentile(50U);
+    stats->latency_p90_us = relay_coalesce_percentile(90U);
+    stats->latency_p99_us = relay_coalesce_percentile(99U);
+}
+
+/* [] END OF FILE */
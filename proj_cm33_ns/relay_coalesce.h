@@ -0,0 +1,117 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : SRF relay with IPC interrupt coalescing
+ * Purpose : Serve M55 secure requests in bursts. The first request of a burst
+ *           is interrupt driven; following requests are picked up by polling
+ *           with the IPC queue interrupt masked, so back-to-back requests cost
+ *           one interrupt entry instead of one each.
+ ********************************************************************************
+ * @file    relay_coalesce.h
+ * @brief   Adaptive interrupt-coalescing SRF relay loop for the bare-metal build
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef RELAY_COALESCE_H
+#define RELAY_COALESCE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Bounds of the adaptive poll window (time spent polling after a request) */
+#ifndef RELAY_COALESCE_POLL_MIN_US
+#define RELAY_COALESCE_POLL_MIN_US    (2U)
+#endif
+#ifndef RELAY_COALESCE_POLL_MAX_US
+#define RELAY_COALESCE_POLL_MAX_US    (200U)
+#endif
+
+/** @brief Bounds of the adaptive burst limit (requests served with the IRQ masked) */
+#ifndef RELAY_COALESCE_BATCH_MIN
+#define RELAY_COALESCE_BATCH_MIN      (1U)
+#endif
+#ifndef RELAY_COALESCE_BATCH_MAX
+#define RELAY_COALESCE_BATCH_MAX      (32U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Relay counters and current adaptive thresholds */
+typedef struct
+{
+    uint32_t requests;        /**< Requests forwarded to TF-M                     */
+    uint32_t interrupts;      /**< IPC queue interrupt entries                    */
+    uint32_t polled;          /**< Requests picked up by polling                  */
+    uint32_t bursts;          /**< Interrupt-driven wake-ups                      */
+    uint32_t poll_window_us;  /**< Current poll window                            */
+    uint32_t batch_limit;     /**< Current burst limit                            */
+    uint32_t latency_p50_us;  /**< Arrival-to-reply latency percentiles (upper    */
+    uint32_t latency_p90_us;  /**< bound of a power-of-two histogram bucket)      */
+    uint32_t latency_p99_us;
+} relay_coalesce_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Take over the SRF relay queue interrupt and reset the counters
+ *
+ * Call after cybsp_init().
+ */
+void relay_coalesce_init(void);
+
+/**
+ * @brief Wait for the next request and serve the burst that follows it
+ *
+ * @return CY_RSLT_SUCCESS, or the first SRF IPC error encountered
+ */
+cy_rslt_t relay_coalesce_service(void);
+
+/**
+ * @brief Serve requests that are already waiting, without blocking
+ *
+ * For long-running work in the main loop (e.g. a progress callback), so M55
+ * requests keep being forwarded. Serves at most the current burst limit.
+ *
+ * @return CY_RSLT_SUCCESS, or the first SRF IPC error encountered
+ */
+cy_rslt_t relay_coalesce_service_pending(void);
+
+/** @brief Snapshot of counters, thresholds and latency percentiles */
+void relay_coalesce_get_stats(relay_coalesce_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RELAY_COALESCE_H */
+/* [] END OF FILE */
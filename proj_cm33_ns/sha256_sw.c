@@ -0,0 +1,193 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Software SHA-256
+ * Purpose : Portable FIPS 180-4 implementation, no platform dependencies.
+ ********************************************************************************
+ * @file    sha256_sw.c
+ * @brief   Streaming and one-shot SHA-256
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SHA256_ROTR(x, n)             (((x) >> (n)) | ((x) << (32U - (n))))
+#define SHA256_CH(x, y, z)            (((x) & (y)) ^ (~(x) & (z)))
+#define SHA256_MAJ(x, y, z)           (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SHA256_EP0(x)                 (SHA256_ROTR(x, 2U) ^ SHA256_ROTR(x, 13U) ^ SHA256_ROTR(x, 22U))
+#define SHA256_EP1(x)                 (SHA256_ROTR(x, 6U) ^ SHA256_ROTR(x, 11U) ^ SHA256_ROTR(x, 25U))
+#define SHA256_SIG0(x)                (SHA256_ROTR(x, 7U) ^ SHA256_ROTR(x, 18U) ^ ((x) >> 3U))
+#define SHA256_SIG1(x)                (SHA256_ROTR(x, 17U) ^ SHA256_ROTR(x, 19U) ^ ((x) >> 10U))
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static const uint32_t sha256_k[64] =
+{
+    0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+    0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+    0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+    0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+    0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+    0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+    0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+    0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sha256_sw_compress(uint32_t state[8], const uint8_t block[SHA256_SW_BLOCK_SIZE])
+{
+    uint32_t w[64];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (uint32_t i = 0; i < 16U; i++)
+    {
+        w[i] = ((uint32_t)block[4U * i] << 24) | ((uint32_t)block[(4U * i) + 1U] << 16) |
+               ((uint32_t)block[(4U * i) + 2U] << 8) | (uint32_t)block[(4U * i) + 3U];
+    }
+    for (uint32_t i = 16; i < 64U; i++)
+    {
+        w[i] = SHA256_SIG1(w[i - 2U]) + w[i - 7U] + SHA256_SIG0(w[i - 15U]) + w[i - 16U];
+    }
+
+    for (uint32_t i = 0; i < 64U; i++)
+    {
+        uint32_t t1 = h + SHA256_EP1(e) + SHA256_CH(e, f, g) + sha256_k[i] + w[i];
+        uint32_t t2 = SHA256_EP0(a) + SHA256_MAJ(a, b, c);
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+void sha256_sw_init(sha256_sw_ctx_t *ctx)
+{
+    ctx->state[0] = 0x6a09e667UL;
+    ctx->state[1] = 0xbb67ae85UL;
+    ctx->state[2] = 0x3c6ef372UL;
+    ctx->state[3] = 0xa54ff53aUL;
+    ctx->state[4] = 0x510e527fUL;
+    ctx->state[5] = 0x9b05688cUL;
+    ctx->state[6] = 0x1f83d9abUL;
+    ctx->state[7] = 0x5be0cd19UL;
+    ctx->length = 0;
+    ctx->used = 0;
+}
+
+void sha256_sw_update(sha256_sw_ctx_t *ctx, const uint8_t *data, size_t len)
+{
+    ctx->length += len;
+
+    if (ctx->used > 0U)
+    {
+        size_t take = SHA256_SW_BLOCK_SIZE - ctx->used;
+
+        if (take > len)
+        {
+            take = len;
+        }
+        memcpy(&ctx->block[ctx->used], data, take);
+        ctx->used += (uint32_t)take;
+        data += take;
+        len -= take;
+        if (ctx->used < SHA256_SW_BLOCK_SIZE)
+        {
+            return;
+        }
+        sha256_sw_compress(ctx->state, ctx->block);
+        ctx->used = 0;
+    }
+
+    while (len >= SHA256_SW_BLOCK_SIZE)
+    {
+        sha256_sw_compress(ctx->state, data);
+        data += SHA256_SW_BLOCK_SIZE;
+        len -= SHA256_SW_BLOCK_SIZE;
+    }
+
+    if (len > 0U)
+    {
+        memcpy(ctx->block, data, len);
+        ctx->used = (uint32_t)len;
+    }
+}
+
+void sha256_sw_finish(sha256_sw_ctx_t *ctx, uint8_t digest[SHA256_SW_DIGEST_SIZE])
+{
+    uint64_t bits = ctx->length * 8U;
+
+    ctx->block[ctx->used++] = 0x80U;
+    if (ctx->used > (SHA256_SW_BLOCK_SIZE - 8U))
+    {
+        memset(&ctx->block[ctx->used], 0, SHA256_SW_BLOCK_SIZE - ctx->used);
+        sha256_sw_compress(ctx->state, ctx->block);
+        ctx->used = 0;
+    }
+    memset(&ctx->block[ctx->used], 0, (SHA256_SW_BLOCK_SIZE - 8U) - ctx->used);
+    for (uint32_t i = 0; i < 8U; i++)
+    {
+        ctx->block[(SHA256_SW_BLOCK_SIZE - 1U) - i] = (uint8_t)(bits >> (8U * i));
+    }
+    sha256_sw_compress(ctx->state, ctx->block);
+
+    for (uint32_t i = 0; i < 8U; i++)
+    {
+        digest[4U * i]        = (uint8_t)(ctx->state[i] >> 24);
+        digest[(4U * i) + 1U] = (uint8_t)(ctx->state[i] >> 16);
+        digest[(4U * i) + 2U] = (uint8_t)(ctx->state[i] >> 8);
+        digest[(4U * i) + 3U] = (uint8_t)(ctx->state[i]);
+    }
+}
+
+void sha256_sw(const uint8_t *data, size_t len, uint8_t digest[SHA256_SW_DIGEST_SIZE])
+{
+    sha256_sw_ctx_t ctx;
+
+    sha256_sw_init(&ctx);
+    sha256_sw_update(&ctx, data, len);
+    sha256_sw_finish(&ctx, digest);
+}
+
+/* [] END OF FILE */
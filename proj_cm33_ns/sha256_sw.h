@@ -0,0 +1,83 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Software SHA-256
+ * Purpose : SHA-256 (FIPS 180-4) on the non-secure core, without a TF-M
+ *           round-trip. Used where the call overhead of the secure service
+ *           dominates (short inputs, many small hashes).
+ ********************************************************************************
+ * @file    sha256_sw.h
+ * @brief   Streaming and one-shot SHA-256
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SHA256_SW_H
+#define SHA256_SW_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Digest and block sizes in bytes */
+#define SHA256_SW_DIGEST_SIZE         (32U)
+#define SHA256_SW_BLOCK_SIZE          (64U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Hash state; may be copied to fork a computation */
+typedef struct
+{
+    uint32_t state[8];
+    uint64_t length;                        /**< Bytes hashed so far    */
+    uint8_t  block[SHA256_SW_BLOCK_SIZE];   /**< Partial block          */
+    uint32_t used;                          /**< Bytes in @c block      */
+} sha256_sw_ctx_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Start a new hash */
+void sha256_sw_init(sha256_sw_ctx_t *ctx);
+
+/** @brief Absorb @p len bytes */
+void sha256_sw_update(sha256_sw_ctx_t *ctx, const uint8_t *data, size_t len);
+
+/** @brief Write the digest; the context must be re-initialised to reuse it */
+void sha256_sw_finish(sha256_sw_ctx_t *ctx, uint8_t digest[SHA256_SW_DIGEST_SIZE]);
+
+/** @brief Hash a buffer in one call */
+void sha256_sw(const uint8_t *data, size_t len, uint8_t digest[SHA256_SW_DIGEST_SIZE]);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SHA256_SW_H */
+/* [] END OF FILE */
@@ -0,0 +1,428 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Binary signing service
+ * Purpose : Receive frame slots, request parsing, command handlers and
+ *           out-of-order completion.
+ ********************************************************************************
+ * @file    sign_service.c
+ * @brief   COBS-framed sign/verify/public key/stats request handler
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cobs.h"
+#include "sign_service.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Protects the slot state shared with the receive interrupt and
+ *        the completing threads; override to run off target
+ */
+#ifndef SIGN_SERVICE_LOCK
+#include "cy_syslib.h"
+#define SIGN_SERVICE_LOCK()           Cy_SysLib_EnterCriticalSection()
+#define SIGN_SERVICE_UNLOCK(state)    Cy_SysLib_ExitCriticalSection(state)
+#endif
+
+/** @brief cmd, seq and crc16 around every payload */
+#define SIGN_SERVICE_REQ_OVERHEAD     (4U)
+
+/** @brief cmd, seq and status before every response payload */
+#define SIGN_SERVICE_RSP_HEADER       (6U)
+
+/** @brief Largest response payload: signature, P-384 public key or stats */
+#define SIGN_SERVICE_RSP_PAYLOAD_MAX  (128U)
+
+/** @brief Largest decoded request: VERIFY with a maximum signature and message */
+#define SIGN_SERVICE_REQ_MAX          (SIGN_SERVICE_REQ_OVERHEAD + 1U + \
+                                       SIGNING_SIGNATURE_MAX_SIZE + SIGN_SERVICE_MESSAGE_MAX)
+
+/** @brief Receive slot size, encoded */
+#define SIGN_SERVICE_SLOT_SIZE        COBS_ENCODED_MAX(SIGN_SERVICE_REQ_MAX)
+
+#define SIGN_SERVICE_RSP_MAX          (SIGN_SERVICE_RSP_HEADER + SIGN_SERVICE_RSP_PAYLOAD_MAX + 2U)
+
+/** @brief No slot is being received */
+#define SIGN_SERVICE_NO_SLOT          (0xFFFFFFFFUL)
+
+#if (SIGN_SERVICE_RX_FRAMES < 1U) || (SIGN_SERVICE_RX_FRAMES > 32U)
+#error "SIGN_SERVICE_RX_FRAMES must be 1 to 32"
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct
+{
+    uint8_t             frame[SIGN_SERVICE_SLOT_SIZE];  /**< Encoded, then decoded in place */
+    uint16_t            len;                            /**< Encoded length                 */
+    uint8_t             signature[SIGNING_SIGNATURE_MAX_SIZE];
+    sign_service_sign_t request;                        /**< While offloaded                */
+} sign_service_slot_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static sign_service_slot_t  sign_service_slots[SIGN_SERVICE_RX_FRAMES];
+static volatile uint32_t    sign_service_free;      /**< Bit per free slot        */
+static uint8_t              sign_service_fifo[SIGN_SERVICE_RX_FRAMES];  /**< Complete slots, in arrival order */
+static volatile uint32_t    sign_service_ready;     /**< Entries in the FIFO      */
+static uint32_t             sign_service_fifo_in;
+static uint32_t             sign_service_fifo_out;
+static uint32_t             sign_service_rx_slot;   /**< Slot being received      */
+static uint32_t             sign_service_rx_len;
+static bool                 sign_service_dropping;  /**< Skip to the next 0x00    */
+
+static signing_key_t             *sign_service_key;
+static sign_service_tx_fn_t      sign_service_tx_fn;
+static sign_service_offload_fn_t sign_service_offload;
+static sign_service_stats_t      sign_service_stats;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) */
+static uint16_t sign_service_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (uint32_t b = 0; b < 8U; b++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void sign_service_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/** @brief Bump a counter; they are read by STATS from any thread */
+static void sign_service_count(uint32_t *counter)
+{
+    uint32_t irq_state = SIGN_SERVICE_LOCK();
+
+    (*counter)++;
+    SIGN_SERVICE_UNLOCK(irq_state);
+}
+
+/** @brief Return a slot to the receiver */
+static void sign_service_release(uint32_t slot)
+{
+    uint32_t irq_state = SIGN_SERVICE_LOCK();
+
+    sign_service_free |= (1UL << slot);
+    SIGN_SERVICE_UNLOCK(irq_state);
+}
+
+void sign_service_init(signing_key_t *key, sign_service_tx_fn_t tx)
+{
+    uint32_t irq_state = SIGN_SERVICE_LOCK();
+
+    sign_service_key = key;
+    sign_service_tx_fn = tx;
+    sign_service_offload = NULL;
+    sign_service_free = (uint32_t)((1ULL << SIGN_SERVICE_RX_FRAMES) - 1U);
+    sign_service_ready = 0;
+    sign_service_fifo_in = 0;
+    sign_service_fifo_out = 0;
+    sign_service_rx_slot = SIGN_SERVICE_NO_SLOT;
+    sign_service_rx_len = 0;
+    sign_service_dropping = false;
+    memset(&sign_service_stats, 0, sizeof(sign_service_stats));
+    sign_service_stats.window = SIGN_SERVICE_RX_FRAMES;
+    SIGN_SERVICE_UNLOCK(irq_state);
+}
+
+void sign_service_set_offload(sign_service_offload_fn_t offload)
+{
+    sign_service_offload = offload;
+}
+
+bool sign_service_rx_byte(uint8_t byte)
+{
+    bool complete = false;
+    uint32_t irq_state = SIGN_SERVICE_LOCK();
+    uint32_t slot = sign_service_rx_slot;
+
+    if (byte == 0U)
+    {
+        if (slot != SIGN_SERVICE_NO_SLOT)
+        {
+            sign_service_slots[slot].len = (uint16_t)sign_service_rx_len;
+            sign_service_fifo[sign_service_fifo_in] = (uint8_t)slot;
+            sign_service_fifo_in = (sign_service_fifo_in + 1U) % SIGN_SERVICE_RX_FRAMES;
+            sign_service_ready++;
+            sign_service_rx_slot = SIGN_SERVICE_NO_SLOT;
+            complete = true;
+        }
+        sign_service_dropping = false;
+    }
+    else if (sign_service_dropping)
+    {
+        /* Rest of a dropped frame */
+    }
+    else if (slot == SIGN_SERVICE_NO_SLOT)
+    {
+        /* First byte of a frame: take the lowest free slot */
+        if (sign_service_free == 0U)
+        {
+            sign_service_stats.overruns++;
+            sign_service_dropping = true;
+        }
+        else
+        {
+            for (slot = 0; (sign_service_free & (1UL << slot)) == 0U; slot++)
+            {
+            }
+            sign_service_free &= ~(1UL << slot);
+            sign_service_rx_slot = slot;
+            sign_service_slots[slot].frame[0] = byte;
+            sign_service_rx_len = 1;
+        }
+    }
+    else if (sign_service_rx_len >= SIGN_SERVICE_SLOT_SIZE)
+    {
+        sign_service_stats.oversize++;
+        sign_service_dropping = true;
+        sign_service_rx_slot = SIGN_SERVICE_NO_SLOT;
+        sign_service_free |= (1UL << slot);
+    }
+    else
+    {
+        sign_service_slots[slot].frame[sign_service_rx_len++] = byte;
+    }
+    SIGN_SERVICE_UNLOCK(irq_state);
+    return complete;
+}
+
+/**
+ * @brief Release a request's slot, then send its response
+ *
+ * The slot is released before transmitting, so the credit is back before
+ * the gateway can see the response. Runs on the service thread or, for
+ * offloaded signing, on the completing thread.
+ *
+ * @param[in] slot         Slot holding the decoded request
+ * @param[in] status       Result
+ * @param[in] payload      Response payload (ignored on error)
+ * @param[in] payload_len  Length of @p payload
+ */
+static void sign_service_respond(uint32_t slot, psa_status_t status,
+                                 const uint8_t *payload, size_t payload_len)
+{
+    uint8_t raw[SIGN_SERVICE_RSP_MAX];
+    uint8_t encoded[COBS_ENCODED_MAX(SIGN_SERVICE_RSP_MAX) + 1U];
+    const uint8_t *request = sign_service_slots[slot].frame;
+    size_t len;
+    uint16_t crc;
+
+    if (status != PSA_SUCCESS)
+    {
+        payload_len = 0;
+        sign_service_count(&sign_service_stats.failures);
+    }
+
+    raw[0] = (uint8_t)(request[0] | SIGN_SERVICE_RESPONSE);
+    raw[1] = request[1];
+    sign_service_put_u32(&raw[2], (uint32_t)status);
+    memcpy(&raw[SIGN_SERVICE_RSP_HEADER], payload, payload_len);
+    len = SIGN_SERVICE_RSP_HEADER + payload_len;
+    crc = sign_service_crc16(raw, len);
+    raw[len++] = (uint8_t)crc;
+    raw[len++] = (uint8_t)(crc >> 8);
+
+    len = cobs_encode(raw, len, encoded, sizeof(encoded) - 1U);
+    encoded[len++] = 0;
+
+    sign_service_release(slot);
+    sign_service_tx_fn(encoded, len);
+}
+
+/**
+ * @brief Run one decoded request
+ *
+ * @param[in]  cmd          Command code
+ * @param[in]  payload      Request payload, inside the receive slot
+ * @param[in]  payload_len  Length of @p payload
+ * @param[out] out          Response payload
+ * @param[out] out_len      Length written to @p out
+ */
+static psa_status_t sign_service_dispatch(uint8_t cmd, const uint8_t *payload, size_t payload_len,
+                                          uint8_t *out, size_t *out_len)
+{
+    psa_status_t status;
+    size_t sig_len;
+    sign_service_stats_t stats;
+
+    *out_len = 0;
+    switch (cmd)
+    {
+        case SIGN_SERVICE_CMD_SIGN:
+            if (payload_len > SIGN_SERVICE_MESSAGE_MAX)
+            {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            status = signing_sign(sign_service_key, payload, payload_len,
+                                  out, SIGN_SERVICE_RSP_PAYLOAD_MAX, out_len);
+            break;
+
+        case SIGN_SERVICE_CMD_VERIFY:
+            if ((payload_len < 1U) || ((size_t)payload[0] > (payload_len - 1U)))
+            {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            sig_len = payload[0];
+            status = signing_verify(sign_service_key, &payload[1U + sig_len],
+                                    payload_len - 1U - sig_len, &payload[1], sig_len);
+            break;
+
+        case SIGN_SERVICE_CMD_PUBKEY:
+            status = psa_export_public_key(sign_service_key->key_id, out,
+                                           SIGN_SERVICE_RSP_PAYLOAD_MAX, out_len);
+            break;
+
+        case SIGN_SERVICE_CMD_STATS:
+            sign_service_get_stats(&stats);
+            sign_service_put_u32(&out[0], stats.requests);
+            sign_service_put_u32(&out[4], stats.crc_errors);
+            sign_service_put_u32(&out[8], stats.overruns);
+            sign_service_put_u32(&out[12], stats.oversize);
+            sign_service_put_u32(&out[16], stats.failures);
+            sign_service_put_u32(&out[20], stats.sign_mean_cycles);
+            sign_service_put_u32(&out[24], stats.offloaded);
+            sign_service_put_u32(&out[28], stats.window);
+            *out_len = 32U;
+            status = PSA_SUCCESS;
+            break;
+
+        default:
+            status = PSA_ERROR_NOT_SUPPORTED;
+            break;
+    }
+    return status;
+}
+
+/**
+ * @brief Decode and check the frame in one slot, then answer or offload it
+ */
+static void sign_service_handle(uint32_t slot)
+{
+    sign_service_slot_t *s = &sign_service_slots[slot];
+    uint8_t out[SIGN_SERVICE_RSP_PAYLOAD_MAX];
+    size_t len = cobs_decode(s->frame, s->len);
+    size_t out_len;
+    uint16_t crc;
+    psa_status_t status;
+
+    if ((len == SIZE_MAX) || (len < SIGN_SERVICE_REQ_OVERHEAD))
+    {
+        sign_service_count(&sign_service_stats.crc_errors);
+        sign_service_release(slot);
+        return;
+    }
+    crc = (uint16_t)s->frame[len - 2U] | (uint16_t)((uint16_t)s->frame[len - 1U] << 8);
+    if (crc != sign_service_crc16(s->frame, len - 2U))
+    {
+        sign_service_count(&sign_service_stats.crc_errors);
+        sign_service_release(slot);
+        return;
+    }
+    sign_service_count(&sign_service_stats.requests);
+    len -= SIGN_SERVICE_REQ_OVERHEAD;
+
+    if ((s->frame[0] == SIGN_SERVICE_CMD_SIGN) && (sign_service_offload != NULL) &&
+        (len <= SIGN_SERVICE_MESSAGE_MAX))
+    {
+        s->request.key = sign_service_key;
+        s->request.message = &s->frame[2];
+        s->request.message_len = len;
+        s->request.signature = s->signature;
+        s->request.slot = slot;
+        if (sign_service_offload(&s->request))
+        {
+            sign_service_count(&sign_service_stats.offloaded);
+            return;
+        }
+    }
+
+    status = sign_service_dispatch(s->frame[0], &s->frame[2], len, out, &out_len);
+    sign_service_respond(slot, status, out, out_len);
+}
+
+void sign_service_sign_done(sign_service_sign_t *req, psa_status_t status, size_t signature_len)
+{
+    sign_service_respond(req->slot, status, req->signature, signature_len);
+}
+
+uint32_t sign_service_process(void)
+{
+    uint32_t handled = 0;
+    uint32_t slot;
+    uint32_t irq_state;
+
+    for (;;)
+    {
+        irq_state = SIGN_SERVICE_LOCK();
+        if (sign_service_ready == 0U)
+        {
+            SIGN_SERVICE_UNLOCK(irq_state);
+            break;
+        }
+        slot = sign_service_fifo[sign_service_fifo_out];
+        sign_service_fifo_out = (sign_service_fifo_out + 1U) % SIGN_SERVICE_RX_FRAMES;
+        sign_service_ready--;
+        SIGN_SERVICE_UNLOCK(irq_state);
+
+        sign_service_handle(slot);
+        handled++;
+    }
+    return handled;
+}
+
+void sign_service_get_stats(sign_service_stats_t *stats)
+{
+    uint32_t stddev;
+    uint32_t irq_state = SIGN_SERVICE_LOCK();
+
+    *stats = sign_service_stats;
+    SIGN_SERVICE_UNLOCK(irq_state);
+
+    /* Signing threads update the key's accumulator under the signing lock */
+    signing_latency_summary(&sign_service_key->sign_latency, &stats->sign_mean_cycles, &stddev);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,195 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Binary signing service
+ * Purpose : Let a gateway use the board as a signing appliance over a byte
+ *           stream (UART). Transport independent: the transport feeds
+ *           received bytes in and supplies a transmit function.
+ * Design  : Frames are COBS encoded and end with 0x00. Decoded, a request
+ *           is
+ *             cmd (1) | seq (1) | payload | crc16 (2, LE)
+ *           and a response is
+ *             cmd | 0x80 (1) | seq (1) | status (4, LE psa_status_t) |
+ *             payload | crc16 (2, LE)
+ *           CRC-16/CCITT-FALSE covers everything before it. Frames with a
+ *           bad CRC are dropped and counted; the gateway retries on timeout.
+ *
+ *           Requests are pipelined. Received bytes go straight into one of
+ *           SIGN_SERVICE_RX_FRAMES frame slots, which are decoded in place
+ *           and handed to the command handlers without copying. A slot is
+ *           released just before its response is sent, so each response
+ *           returns one credit: a gateway that keeps at most
+ *           SIGN_SERVICE_RX_FRAMES requests outstanding (the window, also
+ *           reported by STATS) never overruns the receiver. SIGN requests
+ *           can be offloaded to other threads, in which case the next
+ *           request is parsed while TF-M signs and responses may arrive
+ *           out of order; the gateway matches them by seq.
+ *
+ *           Commands:
+ *             SIGN    payload: message           response: signature
+ *             VERIFY  payload: sig_len (1) | signature | message
+ *             PUBKEY  response: exported public key
+ *             STATS   response: sign_service_stats_t fields, u32 LE each
+ ********************************************************************************
+ * @file    sign_service.h
+ * @brief   COBS-framed sign/verify/public key/stats request handler
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SIGN_SERVICE_H
+#define SIGN_SERVICE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "signing.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest message accepted by SIGN and VERIFY */
+#ifndef SIGN_SERVICE_MESSAGE_MAX
+#define SIGN_SERVICE_MESSAGE_MAX      (512U)
+#endif
+
+/**
+ * @brief Receive frame slots, i.e. the request window; a frame arriving
+ *        while all are in use is dropped (at most 32)
+ */
+#ifndef SIGN_SERVICE_RX_FRAMES
+#define SIGN_SERVICE_RX_FRAMES        (4U)
+#endif
+
+/** @brief Command codes */
+#define SIGN_SERVICE_CMD_SIGN         (0x01U)
+#define SIGN_SERVICE_CMD_VERIFY       (0x02U)
+#define SIGN_SERVICE_CMD_PUBKEY       (0x03U)
+#define SIGN_SERVICE_CMD_STATS        (0x04U)
+
+/** @brief Set in the command byte of a response */
+#define SIGN_SERVICE_RESPONSE         (0x80U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Transmit an encoded frame, delimiter included
+ *
+ * @param[in] data  Bytes to send
+ * @param[in] len   Number of bytes
+ */
+typedef void (*sign_service_tx_fn_t)(const uint8_t *data, size_t len);
+
+/** @brief Service counters, in the order STATS sends them */
+typedef struct
+{
+    uint32_t requests;          /**< Frames handled                         */
+    uint32_t crc_errors;        /**< Frames dropped for CRC or COBS errors  */
+    uint32_t overruns;          /**< Frames dropped for lack of a slot      */
+    uint32_t oversize;          /**< Frames dropped for exceeding a slot    */
+    uint32_t failures;          /**< Requests answered with an error status */
+    uint32_t sign_mean_cycles;  /**< Mean inline signing time of the key    */
+    uint32_t offloaded;         /**< SIGN requests handed to sign offload   */
+    uint32_t window;            /**< SIGN_SERVICE_RX_FRAMES                 */
+} sign_service_stats_t;
+
+/** @brief A SIGN request handed to the offload function */
+typedef struct
+{
+    const signing_key_t *key;           /**< Key to sign with               */
+    const uint8_t       *message;       /**< Message, inside the frame slot */
+    size_t               message_len;
+    uint8_t             *signature;     /**< SIGNING_SIGNATURE_MAX_SIZE bytes */
+    uint32_t             slot;          /**< Owning frame slot              */
+} sign_service_sign_t;
+
+/**
+ * @brief Start signing @p req on another thread
+ *
+ * Called from sign_service_process(). The function must eventually call
+ * sign_service_sign_done() for @p req, from any thread.
+ *
+ * @return true if the request was taken, false to have it signed inline
+ */
+typedef bool (*sign_service_offload_fn_t)(sign_service_sign_t *req);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Start the service
+ *
+ * @param[in] key  Key used for all requests; must stay valid
+ * @param[in] tx   Transmit function
+ */
+void sign_service_init(signing_key_t *key, sign_service_tx_fn_t tx);
+
+/**
+ * @brief Feed one received byte; callable from the receive interrupt
+ *
+ * @return true if the byte completed a frame, i.e. sign_service_process()
+ *         has work
+ */
+bool sign_service_rx_byte(uint8_t byte);
+
+/**
+ * @brief Handle every complete frame and send the responses
+ *
+ * Runs in thread context; signing can take milliseconds. The transmit
+ * function may be called from here and, with offload, from the threads
+ * that call sign_service_sign_done(), so it must be thread safe.
+ *
+ * @return Number of frames handled
+ */
+uint32_t sign_service_process(void);
+
+/**
+ * @brief Sign SIGN requests elsewhere instead of in sign_service_process()
+ *
+ * @param[in] offload  Offload function, or NULL to sign inline
+ */
+void sign_service_set_offload(sign_service_offload_fn_t offload);
+
+/**
+ * @brief Complete an offloaded SIGN request and send its response
+ *
+ * @param[in] req            Request passed to the offload function
+ * @param[in] status         Signing result
+ * @param[in] signature_len  Bytes written to req->signature
+ */
+void sign_service_sign_done(sign_service_sign_t *req, psa_status_t status, size_t signature_len);
+
+/** @brief Copy the counters */
+void sign_service_get_stats(sign_service_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGN_SERVICE_H */
+/* [] END OF FILE */
@@ -0,0 +1,580 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Signing keys
+ * Purpose : Scheme table, PSA key handling, timed sign/verify, segment
+ *           list and prefix midstate signing and the RFC 6979 self test.
+ ********************************************************************************
+ * @file    signing.c
+ * @brief   Multi-scheme signing with per-key latency statistics
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cycle_counter.h"
+#include "signing.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Protects the latency accumulators, which signing worker threads
+ *        update concurrently for a shared key; override to run off target
+ */
+#ifndef SIGNING_LOCK
+#include "cy_syslib.h"
+#define SIGNING_LOCK()                Cy_SysLib_EnterCriticalSection()
+#define SIGNING_UNLOCK(state)         Cy_SysLib_ExitCriticalSection(state)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief PSA parameters of a scheme */
+typedef struct
+{
+    const char       *name;
+    psa_key_type_t    key_type;
+    size_t            key_bits;
+    psa_algorithm_t   alg_random;           /**< SIGNING_NONCE_RANDOM        */
+    psa_algorithm_t   alg_deterministic;    /**< SIGNING_NONCE_DETERMINISTIC */
+} signing_scheme_info_t;
+
+typedef struct
+{
+    const char *message;
+    uint8_t     signature[64];      /**< r || s */
+} signing_kat_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+static const signing_scheme_info_t signing_schemes[SIGNING_SCHEME_COUNT] =
+{
+    [SIGNING_SCHEME_ECDSA_P256] =
+    {
+        "ECDSA P-256", PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256U,
+        PSA_ALG_ECDSA(PSA_ALG_SHA_256), PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256)
+    },
+    [SIGNING_SCHEME_ECDSA_P384] =
+    {
+        "ECDSA P-384", PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 384U,
+        PSA_ALG_ECDSA(PSA_ALG_SHA_384), PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_384)
+    },
+    [SIGNING_SCHEME_ED25519] =
+    {
+        "Ed25519", PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_TWISTED_EDWARDS), 255U,
+        PSA_ALG_PURE_EDDSA, PSA_ALG_PURE_EDDSA
+    },
+    /* Verified on this core; no PSA key */
+    [SIGNING_SCHEME_HSS_SHA256] =
+    {
+        "HSS/LMS", 0U, 0U, PSA_ALG_NONE, PSA_ALG_NONE
+    },
+};
+
+/** @brief RFC 6979 A.2.5 private key */
+static const uint8_t signing_kat_key[32] =
+{
+    0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21, 0x57, 0x67, 0xB1, 0xD6, 0x93,
+    0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8, 0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21
+};
+
+/** @brief RFC 6979 A.2.5 signatures with SHA-256 */
+static const signing_kat_t signing_kats[] =
+{
+    {
+        "sample",
+        {
+            0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD, 0x9C, 0xD4, 0x5E, 0x81, 0xD6,
+            0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16,
+            0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36, 0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65,
+            0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06, 0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8
+        }
+    },
+    {
+        "test",
+        {
+            0xF1, 0xAB, 0xB0, 0x23, 0x51, 0x83, 0x51, 0xCD, 0x71, 0xD8, 0x81, 0x56, 0x7B, 0x1E, 0xA6, 0x63,
+            0xED, 0x3E, 0xFC, 0xF6, 0xC5, 0x13, 0x2B, 0x35, 0x4F, 0x28, 0xD3, 0xB0, 0xB7, 0xD3, 0x83, 0x67,
+            0x01, 0x9F, 0x41, 0x13, 0x74, 0x2A, 0x2B, 0x14, 0xBD, 0x25, 0x92, 0x6B, 0x49, 0xC6, 0x49, 0x15,
+            0x5F, 0x26, 0x7E, 0x60, 0xD3, 0x81, 0x4B, 0x4C, 0x0C, 0xC8, 0x42, 0x50, 0xE4, 0x6F, 0x00, 0x83
+        }
+    },
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+psa_status_t signing_init(void)
+{
+    cycle_counter_init();
+    return psa_crypto_init();
+}
+
+/**
+ * @brief Fill in the key attributes for a configuration
+ *
+ * @return PSA_ERROR_INVALID_ARGUMENT for an unknown scheme
+ */
+static psa_status_t signing_key_attributes(const signing_key_config_t *config, signing_key_t *key,
+                                           psa_key_attributes_t *attributes)
+{
+    const signing_scheme_info_t *info;
+
+    memset(key, 0, sizeof(*key));
+    key->key_id = PSA_KEY_ID_NULL;
+    if (config->scheme >= SIGNING_SCHEME_COUNT)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    info = &signing_schemes[config->scheme];
+    key->scheme = config->scheme;
+    key->alg = (config->nonce == SIGNING_NONCE_DETERMINISTIC) ?
+               info->alg_deterministic : info->alg_random;
+
+    psa_set_key_usage_flags(attributes, PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE |
+                                        PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+    psa_set_key_algorithm(attributes, key->alg);
+    psa_set_key_type(attributes, info->key_type);
+    psa_set_key_bits(attributes, info->key_bits);
+    psa_set_key_lifetime(attributes, config->lifetime);
+    return PSA_SUCCESS;
+}
+
+psa_status_t signing_key_generate(const signing_key_config_t *config, signing_key_t *key)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    uint32_t start;
+    psa_status_t status;
+
+    status = signing_key_attributes(config, key, &attributes);
+    if ((status == PSA_SUCCESS) && (key->scheme == SIGNING_SCHEME_HSS_SHA256))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        start = cycle_counter_read();
+        status = psa_generate_key(&attributes, &key->key_id);
+        key->keygen_cycles = cycle_counter_read() - start;
+    }
+    return status;
+}
+
+psa_status_t signing_key_import(const signing_key_config_t *config, const uint8_t *private_key,
+                                size_t private_key_len, signing_key_t *key)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    uint32_t start;
+    psa_status_t status;
+
+    status = signing_key_attributes(config, key, &attributes);
+    if ((status == PSA_SUCCESS) && (key->scheme == SIGNING_SCHEME_HSS_SHA256))
+    {
+        if (private_key_len != HSS_PUBLIC_KEY_SIZE)
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        memcpy(key->hss_public_key, private_key, HSS_PUBLIC_KEY_SIZE);
+        return PSA_SUCCESS;
+    }
+    if (status == PSA_SUCCESS)
+    {
+        start = cycle_counter_read();
+        status = psa_import_key(&attributes, private_key, private_key_len, &key->key_id);
+        key->keygen_cycles = cycle_counter_read() - start;
+    }
+    return status;
+}
+
+void signing_key_destroy(signing_key_t *key)
+{
+    if (key->key_id != PSA_KEY_ID_NULL)
+    {
+        (void)psa_destroy_key(key->key_id);
+        key->key_id = PSA_KEY_ID_NULL;
+    }
+    memset(key->hss_public_key, 0, sizeof(key->hss_public_key));
+}
+
+/** @brief Add one successful operation to a latency accumulator */
+static void signing_latency_add(signing_latency_t *latency, uint32_t cycles)
+{
+    uint32_t irq_state = SIGNING_LOCK();
+
+    if ((latency->count == 0U) || (cycles < latency->min))
+    {
+        latency->min = cycles;
+    }
+    if (cycles > latency->max)
+    {
+        latency->max = cycles;
+    }
+    latency->count++;
+    latency->sum += cycles;
+    latency->sum_sq += (uint64_t)cycles * cycles;
+    SIGNING_UNLOCK(irq_state);
+}
+
+psa_status_t signing_sign(signing_key_t *key, const uint8_t *message, size_t message_len,
+                          uint8_t *signature, size_t signature_size, size_t *signature_len)
+{
+    uint32_t start = cycle_counter_read();
+    uint32_t cycles;
+    psa_status_t status;
+
+    if (key->scheme == SIGNING_SCHEME_HSS_SHA256)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    status = psa_sign_message(key->key_id, key->alg, message, message_len,
+                              signature, signature_size, signature_len);
+    cycles = cycle_counter_read() - start;
+
+    if (status == PSA_SUCCESS)
+    {
+        signing_latency_add(&key->sign_latency, cycles);
+    }
+    return status;
+}
+
+psa_status_t signing_verify(signing_key_t *key, const uint8_t *message, size_t message_len,
+                            const uint8_t *signature, size_t signature_len)
+{
+    uint32_t start = cycle_counter_read();
+    uint32_t cycles;
+    psa_status_t status;
+
+    if (key->scheme == SIGNING_SCHEME_HSS_SHA256)
+    {
+        status = hss_verify(key->hss_public_key, sizeof(key->hss_public_key), message, message_len,
+                            signature, signature_len);
+    }
+    else
+    {
+        status = psa_verify_message(key->key_id, key->alg, message, message_len,
+                                    signature, signature_len);
+    }
+    cycles = cycle_counter_read() - start;
+
+    if (status == PSA_SUCCESS)
+    {
+        signing_latency_add(&key->verify_latency, cycles);
+    }
+    return status;
+}
+
+/**
+ * @brief Hash a segment list with the hash of the key's algorithm
+ *
+ * SHA-256 runs on this core; other hashes use one PSA hash operation.
+ */
+static psa_status_t signing_hash_iov(const signing_key_t *key, const signing_iovec_t *iov,
+                                     size_t iov_cnt, uint8_t *hash, size_t *hash_len)
+{
+    psa_algorithm_t hash_alg;
+    psa_hash_operation_t op = psa_hash_operation_init();
+    psa_status_t status = PSA_SUCCESS;
+
+    if (!PSA_ALG_IS_ECDSA(key->alg))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    hash_alg = PSA_ALG_SIGN_GET_HASH(key->alg);
+    if (hash_alg == PSA_ALG_SHA_256)
+    {
+        sha256_sw_ctx_t sw;
+
+        sha256_sw_init(&sw);
+        for (size_t i = 0; i < iov_cnt; i++)
+        {
+            sha256_sw_update(&sw, (const uint8_t *)iov[i].base, iov[i].len);
+        }
+        sha256_sw_finish(&sw, hash);
+        *hash_len = SHA256_SW_DIGEST_SIZE;
+        return PSA_SUCCESS;
+    }
+
+    status = psa_hash_setup(&op, hash_alg);
+    for (size_t i = 0; (status == PSA_SUCCESS) && (i < iov_cnt); i++)
+    {
+        status = psa_hash_update(&op, (const uint8_t *)iov[i].base, iov[i].len);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_hash_finish(&op, hash, PSA_HASH_MAX_SIZE, hash_len);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        (void)psa_hash_abort(&op);
+    }
+    return status;
+}
+
+psa_status_t signing_sign_iov(signing_key_t *key, const signing_iovec_t *iov, size_t iov_cnt,
+                              uint8_t *signature, size_t signature_size, size_t *signature_len)
+{
+    uint8_t hash[PSA_HASH_MAX_SIZE];
+    size_t hash_len;
+    uint32_t start = cycle_counter_read();
+    uint32_t cycles;
+    psa_status_t status;
+
+    status = signing_hash_iov(key, iov, iov_cnt, hash, &hash_len);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_sign_hash(key->key_id, key->alg, hash, hash_len,
+                               signature, signature_size, signature_len);
+    }
+    cycles = cycle_counter_read() - start;
+
+    if (status == PSA_SUCCESS)
+    {
+        signing_latency_add(&key->sign_latency, cycles);
+    }
+    return status;
+}
+
+psa_status_t signing_verify_iov(signing_key_t *key, const signing_iovec_t *iov, size_t iov_cnt,
+                                const uint8_t *signature, size_t signature_len)
+{
+    uint8_t hash[PSA_HASH_MAX_SIZE];
+    size_t hash_len;
+    uint32_t start = cycle_counter_read();
+    uint32_t cycles;
+    psa_status_t status;
+
+    status = signing_hash_iov(key, iov, iov_cnt, hash, &hash_len);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_verify_hash(key->key_id, key->alg, hash, hash_len, signature, signature_len);
+    }
+    cycles = cycle_counter_read() - start;
+
+    if (status == PSA_SUCCESS)
+    {
+        signing_latency_add(&key->verify_latency, cycles);
+    }
+    return status;
+}
+
+psa_status_t signing_prefix_init(signing_prefix_t *ctx, signing_key_t *key,
+                                 const uint8_t *prefix, size_t prefix_len)
+{
+    psa_status_t status = PSA_SUCCESS;
+
+    ctx->key = key;
+    ctx->psa = psa_hash_operation_init();
+    if (!PSA_ALG_IS_ECDSA(key->alg))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    ctx->hash_alg = PSA_ALG_SIGN_GET_HASH(key->alg);
+    if (ctx->hash_alg == PSA_ALG_SHA_256)
+    {
+        sha256_sw_init(&ctx->sw);
+        sha256_sw_update(&ctx->sw, prefix, prefix_len);
+    }
+    else
+    {
+        status = psa_hash_setup(&ctx->psa, ctx->hash_alg);
+        if (status == PSA_SUCCESS)
+        {
+            status = psa_hash_update(&ctx->psa, prefix, prefix_len);
+        }
+        if (status != PSA_SUCCESS)
+        {
+            (void)psa_hash_abort(&ctx->psa);
+        }
+    }
+    return status;
+}
+
+psa_status_t signing_prefix_sign(signing_prefix_t *ctx, const uint8_t *tail, size_t tail_len,
+                                 uint8_t *signature, size_t signature_size, size_t *signature_len)
+{
+    uint8_t hash[PSA_HASH_MAX_SIZE];
+    size_t hash_len;
+    uint32_t start = cycle_counter_read();
+    uint32_t cycles;
+    psa_status_t status;
+
+    if (ctx->hash_alg == PSA_ALG_SHA_256)
+    {
+        /* The midstate is a plain struct: copying it is the clone */
+        sha256_sw_ctx_t sw = ctx->sw;
+
+        sha256_sw_update(&sw, tail, tail_len);
+        sha256_sw_finish(&sw, hash);
+        hash_len = SHA256_SW_DIGEST_SIZE;
+        status = PSA_SUCCESS;
+    }
+    else
+    {
+        psa_hash_operation_t op = psa_hash_operation_init();
+
+        status = psa_hash_clone(&ctx->psa, &op);
+        if (status == PSA_SUCCESS)
+        {
+            status = psa_hash_update(&op, tail, tail_len);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            status = psa_hash_finish(&op, hash, sizeof(hash), &hash_len);
+        }
+        if (status != PSA_SUCCESS)
+        {
+            (void)psa_hash_abort(&op);
+        }
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_sign_hash(ctx->key->key_id, ctx->key->alg, hash, hash_len,
+                               signature, signature_size, signature_len);
+    }
+    cycles = cycle_counter_read() - start;
+
+    if (status == PSA_SUCCESS)
+    {
+        signing_latency_add(&ctx->key->sign_latency, cycles);
+    }
+    return status;
+}
+
+void signing_prefix_free(signing_prefix_t *ctx)
+{
+    (void)psa_hash_abort(&ctx->psa);
+    memset(&ctx->sw, 0, sizeof(ctx->sw));
+}
+
+/** @brief Integer square root (floor) */
+static uint32_t signing_isqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0U)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+void signing_latency_summary(const signing_latency_t *latency, uint32_t *mean, uint32_t *stddev)
+{
+    signing_latency_t copy;
+    uint64_t avg;
+    uint32_t irq_state = SIGNING_LOCK();
+
+    copy = *latency;
+    SIGNING_UNLOCK(irq_state);
+
+    if (copy.count == 0U)
+    {
+        *mean = 0;
+        *stddev = 0;
+        return;
+    }
+    avg = copy.sum / copy.count;
+    *mean = (uint32_t)avg;
+    /* E[x^2] - E[x]^2; cycles fit in 32 bits so the squares do not overflow */
+    *stddev = signing_isqrt((copy.sum_sq / copy.count) - (avg * avg));
+}
+
+void signing_latency_reset(signing_key_t *key)
+{
+    uint32_t irq_state = SIGNING_LOCK();
+
+    memset(&key->sign_latency, 0, sizeof(key->sign_latency));
+    memset(&key->verify_latency, 0, sizeof(key->verify_latency));
+    SIGNING_UNLOCK(irq_state);
+}
+
+size_t signing_signature_size(const signing_key_t *key)
+{
+    const signing_scheme_info_t *info = &signing_schemes[key->scheme];
+
+    if (key->scheme == SIGNING_SCHEME_HSS_SHA256)
+    {
+        return 0U;
+    }
+    return PSA_SIGN_OUTPUT_SIZE(info->key_type, info->key_bits, key->alg);
+}
+
+const char *signing_scheme_name(signing_scheme_t scheme)
+{
+    return (scheme < SIGNING_SCHEME_COUNT) ? signing_schemes[scheme].name : "?";
+}
+
+psa_status_t signing_self_test(void)
+{
+    const signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    signing_key_t key;
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    size_t signature_len;
+    psa_status_t status;
+
+    status = signing_key_import(&config, signing_kat_key, sizeof(signing_kat_key), &key);
+    for (uint32_t i = 0; (status == PSA_SUCCESS) && (i < (sizeof(signing_kats) / sizeof(signing_kats[0]))); i++)
+    {
+        const signing_kat_t *kat = &signing_kats[i];
+
+        status = signing_sign(&key, (const uint8_t *)kat->message, strlen(kat->message),
+                              signature, sizeof(signature), &signature_len);
+        if ((status == PSA_SUCCESS) &&
+            ((signature_len != sizeof(kat->signature)) ||
+             (memcmp(signature, kat->signature, signature_len) != 0)))
+        {
+            status = PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    signing_key_destroy(&key);
+
+    return status;
+}
+
+/* [] END OF FILE */
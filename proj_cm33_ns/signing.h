@@ -0,0 +1,267 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Signing keys
+ * Purpose : Key generation, sign and verify over the PSA Crypto API with a
+ *           per-key configuration and per-key latency statistics.
+ * Design  : A scheme table maps each supported signature scheme (ECDSA on
+ *           P-256 or P-384, Ed25519) to its PSA key type, size and
+ *           algorithm. HSS/LMS (RFC 8554) keys are verify only: the
+ *           public key is kept in the key and signing_verify() runs
+ *           lms_verify.c on this core. Callers size signature buffers with
+ *           signing_signature_size() or SIGNING_SIGNATURE_MAX_SIZE.
+ *           Messages that share a fixed prefix can be signed through a
+ *           signing_prefix_t, which hashes the prefix once and keeps the
+ *           hash midstate. Messages held in several buffers are signed
+ *           from a segment list without copying them together.
+ ********************************************************************************
+ * @file    signing.h
+ * @brief   Multi-scheme signing with per-key latency statistics
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SIGNING_H
+#define SIGNING_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lms_verify.h"
+#include "psa/crypto.h"
+#include "sha256_sw.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Largest signature produced by this module (P-384 r || s) */
+#define SIGNING_SIGNATURE_MAX_SIZE    PSA_SIGN_OUTPUT_SIZE(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 384U, \
+                                                           PSA_ALG_ECDSA(PSA_ALG_SHA_384))
+
+/** @brief Default key configuration: randomized ECDSA P-256, volatile key */
+#define SIGNING_KEY_CONFIG_DEFAULT    { SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_RANDOM, \
+                                        PSA_KEY_LIFETIME_VOLATILE }
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Signature schemes */
+typedef enum
+{
+    SIGNING_SCHEME_ECDSA_P256 = 0,  /**< ECDSA, secp256r1, SHA-256        */
+    SIGNING_SCHEME_ECDSA_P384,      /**< ECDSA, secp384r1, SHA-384        */
+    SIGNING_SCHEME_ED25519,         /**< PureEdDSA, edwards25519          */
+    SIGNING_SCHEME_HSS_SHA256,      /**< HSS/LMS, SHA-256; verify only    */
+    SIGNING_SCHEME_COUNT
+} signing_scheme_t;
+
+/** @brief How the ECDSA per-signature nonce is obtained; Ed25519 is always
+ *         deterministic and ignores it */
+typedef enum
+{
+    /** Fresh random nonce from the TF-M DRBG for every signature */
+    SIGNING_NONCE_RANDOM = 0,
+    /** Nonce derived from key and message hash (RFC 6979), no RNG access.
+     *  Latency then depends only on the message. */
+    SIGNING_NONCE_DETERMINISTIC
+} signing_nonce_t;
+
+/** @brief Per-key configuration */
+typedef struct
+{
+    signing_scheme_t   scheme;      /**< Signature scheme                */
+    signing_nonce_t    nonce;       /**< Nonce generation mode (ECDSA)   */
+    psa_key_lifetime_t lifetime;    /**< PSA key lifetime                */
+} signing_key_config_t;
+
+/** @brief Signing latency accumulator, in CPU cycles */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint64_t sum_sq;
+} signing_latency_t;
+
+/** @brief A key pair and its statistics */
+typedef struct
+{
+    psa_key_id_t      key_id;
+    signing_scheme_t  scheme;
+    psa_algorithm_t   alg;          /**< Algorithm used by sign/verify   */
+    uint32_t          keygen_cycles;    /**< Cost of generate or import  */
+    signing_latency_t sign_latency;
+    signing_latency_t verify_latency;
+    uint8_t           hss_public_key[HSS_PUBLIC_KEY_SIZE];  /**< SIGNING_SCHEME_HSS_SHA256 */
+} signing_key_t;
+
+/** @brief One message segment; same shape as mtb_srf_invec_ns_t */
+typedef struct
+{
+    const void *base;
+    size_t      len;
+} signing_iovec_t;
+
+/**
+ * @brief Signer for messages that start with a fixed prefix
+ *
+ * For SHA-256 the midstate is kept in a software context on this core and
+ * copied per message, so only the signature itself is a secure call. Other
+ * hashes keep a PSA hash operation and use psa_hash_clone().
+ */
+typedef struct
+{
+    signing_key_t        *key;
+    psa_algorithm_t       hash_alg;
+    sha256_sw_ctx_t       sw;       /**< Midstate when hash_alg is SHA-256 */
+    psa_hash_operation_t  psa;      /**< Midstate otherwise                */
+} signing_prefix_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Initialise PSA Crypto and the cycle counter */
+psa_status_t signing_init(void);
+
+/**
+ * @brief Generate a key pair
+ *
+ * @return PSA_ERROR_NOT_SUPPORTED if the secure image was built without
+ *         the requested scheme or nonce mode, and for HSS/LMS, which is
+ *         stateful and signed off the device
+ */
+psa_status_t signing_key_generate(const signing_key_config_t *config, signing_key_t *key);
+
+/**
+ * @brief Import a private key
+ *
+ * ECDSA keys are the big-endian scalar (32 or 48 bytes), Ed25519 keys the
+ * 32-byte seed. For HSS/LMS this takes the HSS public key instead
+ * (HSS_PUBLIC_KEY_SIZE bytes, RFC 8554 format), which is copied into @p key;
+ * no PSA key is created.
+ */
+psa_status_t signing_key_import(const signing_key_config_t *config, const uint8_t *private_key,
+                                size_t private_key_len, signing_key_t *key);
+
+/** @brief Destroy the key and clear the handle */
+void signing_key_destroy(signing_key_t *key);
+
+/**
+ * @brief Sign a message (hashed internally) and record the latency
+ *
+ * @return PSA_ERROR_NOT_SUPPORTED for HSS/LMS keys
+ */
+psa_status_t signing_sign(signing_key_t *key, const uint8_t *message, size_t message_len,
+                          uint8_t *signature, size_t signature_size, size_t *signature_len);
+
+/**
+ * @brief Verify a signature made by @p key and record the latency
+ *
+ * ECDSA and Ed25519 go to TF-M; HSS/LMS is verified on this core.
+ */
+psa_status_t signing_verify(signing_key_t *key, const uint8_t *message, size_t message_len,
+                            const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Sign the concatenation of @p iov_cnt segments without copying them
+ *
+ * The segments are hashed in order and the digest signed with
+ * psa_sign_hash(); the signature equals signing_sign() over the joined
+ * message. The latency is recorded in the key.
+ *
+ * @return PSA_ERROR_NOT_SUPPORTED for schemes that hash internally (Ed25519)
+ */
+psa_status_t signing_sign_iov(signing_key_t *key, const signing_iovec_t *iov, size_t iov_cnt,
+                              uint8_t *signature, size_t signature_size, size_t *signature_len);
+
+/** @brief Verify a signature over the concatenation of @p iov_cnt segments */
+psa_status_t signing_verify_iov(signing_key_t *key, const signing_iovec_t *iov, size_t iov_cnt,
+                                const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Hash a fixed message prefix once for repeated signing
+ *
+ * @param[out] ctx         Prefix signer
+ * @param[in]  key         Key to sign with; must stay valid while @p ctx is used
+ * @param[in]  prefix      Bytes every message starts with
+ * @param[in]  prefix_len  Length of @p prefix
+ *
+ * @return PSA_ERROR_NOT_SUPPORTED for schemes that hash internally (Ed25519)
+ */
+psa_status_t signing_prefix_init(signing_prefix_t *ctx, signing_key_t *key,
+                                 const uint8_t *prefix, size_t prefix_len);
+
+/**
+ * @brief Sign prefix || tail, hashing only the tail
+ *
+ * The signature is the same as signing_sign() over the whole message and
+ * verifies with signing_verify(). The latency is recorded in the key.
+ */
+psa_status_t signing_prefix_sign(signing_prefix_t *ctx, const uint8_t *tail, size_t tail_len,
+                                 uint8_t *signature, size_t signature_size, size_t *signature_len);
+
+/** @brief Release the prefix midstate */
+void signing_prefix_free(signing_prefix_t *ctx);
+
+/**
+ * @brief Mean and standard deviation of recorded latencies
+ *
+ * Reads a consistent snapshot while other threads keep signing with the key.
+ *
+ * @param[in]  latency  Accumulator
+ * @param[out] mean     Mean in cycles
+ * @param[out] stddev   Standard deviation in cycles
+ */
+void signing_latency_summary(const signing_latency_t *latency, uint32_t *mean, uint32_t *stddev);
+
+/** @brief Clear the sign and verify latency accumulators of a key */
+void signing_latency_reset(signing_key_t *key);
+
+/** @brief Signature length of a key's scheme in bytes; 0 for HSS/LMS,
+ *         whose length depends on the parameter sets */
+size_t signing_signature_size(const signing_key_t *key);
+
+/** @brief Short display name of a scheme, e.g. "ECDSA P-256" */
+const char *signing_scheme_name(signing_scheme_t scheme);
+
+/**
+ * @brief Known-answer test of deterministic ECDSA
+ *
+ * Signs the RFC 6979 (A.2.5) P-256 / SHA-256 vectors and compares the
+ * signatures byte for byte.
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_NOT_SUPPORTED if deterministic ECDSA is
+ *         not available, or PSA_ERROR_CORRUPTION_DETECTED on a mismatch
+ */
+psa_status_t signing_self_test(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGNING_H */
+/* [] END OF FILE */
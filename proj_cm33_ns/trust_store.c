@@ -0,0 +1,448 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Trust store
+ * Purpose : Key-ID index, manifest and bank handling, lazy key import.
+ ********************************************************************************
+ * @file    trust_store.c
+ * @brief   Key-ID indexed trust store with lazy loading from PS
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "crypto_arena.h"
+#include "sha256_sw.h"
+#include "trust_store.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Manifest magic, "TSMF" as a little-endian word */
+#define TRUST_STORE_MAGIC             (0x464D5354UL)
+
+/** @brief Manifest field offsets */
+#define TRUST_STORE_HDR_VERSION       (4U)
+#define TRUST_STORE_HDR_BANK          (8U)
+#define TRUST_STORE_HDR_COUNT         (12U)
+#define TRUST_STORE_HDR_SIZE          (16U)
+
+/** @brief Update buffer: the larger of a chunk and a full manifest */
+#define TRUST_STORE_CHUNK_SIZE        (TRUST_STORE_CHUNK_KEYS * TRUST_STORE_PUBLIC_KEY_SIZE)
+#define TRUST_STORE_STAGE_SIZE        ((TRUST_STORE_CHUNK_SIZE > TRUST_STORE_MANIFEST_SIZE(TRUST_STORE_MAX_KEYS)) ? \
+                                       TRUST_STORE_CHUNK_SIZE : TRUST_STORE_MANIFEST_SIZE(TRUST_STORE_MAX_KEYS))
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void trust_store_put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t trust_store_get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t trust_store_key_id(const uint8_t *public_key, size_t public_key_len)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint64_t kid = 0;
+
+    sha256_sw(public_key, public_key_len, digest);
+    for (uint32_t i = 0; i < 8U; i++)
+    {
+        kid = (kid << 8) | digest[i];
+    }
+    return kid;
+}
+
+void trust_index_init(trust_index_t *index, uint16_t *slots, uint32_t slot_count, const uint64_t *kids)
+{
+    memset(slots, 0, slot_count * sizeof(slots[0]));
+    index->slots = slots;
+    index->mask = slot_count - 1U;
+    index->kids = kids;
+}
+
+bool trust_index_insert(trust_index_t *index, uint16_t record)
+{
+    uint64_t kid = index->kids[record];
+    uint32_t i = (uint32_t)kid & index->mask;
+
+    /* The identifier is a hash already: its low bits pick the first slot */
+    for (uint32_t probes = 0; probes <= index->mask; probes++)
+    {
+        if (index->slots[i] == 0U)
+        {
+            index->slots[i] = (uint16_t)(record + 1U);
+            return true;
+        }
+        if (index->kids[index->slots[i] - 1U] == kid)
+        {
+            return false;
+        }
+        i = (i + 1U) & index->mask;
+    }
+    return false;
+}
+
+int32_t trust_index_find(const trust_index_t *index, uint64_t kid)
+{
+    uint32_t i = (uint32_t)kid & index->mask;
+
+    /* Bounded by the slot count: a full table has no empty slot to stop at */
+    for (uint32_t probes = 0; (probes <= index->mask) && (index->slots[i] != 0U); probes++)
+    {
+        uint32_t record = index->slots[i] - 1U;
+
+        if (index->kids[record] == kid)
+        {
+            return (int32_t)record;
+        }
+        i = (i + 1U) & index->mask;
+    }
+    return -1;
+}
+
+static psa_storage_uid_t trust_store_chunk_uid(const trust_store_t *store, uint32_t bank, uint32_t record)
+{
+    return store->uid_base + 1U + (bank * TRUST_STORE_CHUNKS) + (record / TRUST_STORE_CHUNK_KEYS);
+}
+
+/** @brief Verify-only P-256 key attributes */
+static void trust_store_key_attributes(psa_key_attributes_t *attributes)
+{
+    psa_set_key_usage_flags(attributes, PSA_KEY_USAGE_VERIFY_MESSAGE | PSA_KEY_USAGE_VERIFY_HASH);
+    psa_set_key_algorithm(attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+    psa_set_key_type(attributes, PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1));
+    psa_set_key_bits(attributes, 256U);
+}
+
+/** @brief Empty the RAM state (handles must be destroyed already) */
+static void trust_store_clear(trust_store_t *store)
+{
+    store->version = 0;
+    store->bank = 0;
+    store->count = 0;
+    store->loaded = 0;
+    for (uint32_t i = 0; i < TRUST_STORE_MAX_KEYS; i++)
+    {
+        store->handle[i] = PSA_KEY_ID_NULL;
+    }
+    trust_index_init(&store->index, store->slots, TRUST_STORE_SLOTS, store->kid);
+}
+
+/** @brief Take over a manifest: version, bank and the index */
+static psa_status_t trust_store_parse(trust_store_t *store, const uint8_t *manifest, size_t len)
+{
+    uint32_t count = trust_store_get_le32(&manifest[TRUST_STORE_HDR_COUNT]);
+    uint32_t bank = trust_store_get_le32(&manifest[TRUST_STORE_HDR_BANK]);
+
+    if ((trust_store_get_le32(manifest) != TRUST_STORE_MAGIC) || (count > TRUST_STORE_MAX_KEYS) ||
+        (bank > 1U) || (len != TRUST_STORE_MANIFEST_SIZE(count)))
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+
+    trust_store_clear(store);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint8_t *e = &manifest[TRUST_STORE_MANIFEST_SIZE(i)];
+
+        store->kid[i] = ((uint64_t)trust_store_get_le32(&e[4]) << 32) | trust_store_get_le32(e);
+        store->permissions[i] = trust_store_get_le32(&e[8]);
+        if (!trust_index_insert(&store->index, (uint16_t)i))
+        {
+            trust_store_clear(store);
+            return PSA_ERROR_CORRUPTION_DETECTED;
+        }
+    }
+    store->version = trust_store_get_le32(&manifest[TRUST_STORE_HDR_VERSION]);
+    store->bank = bank;
+    store->count = count;
+    return PSA_SUCCESS;
+}
+
+psa_status_t trust_store_open(trust_store_t *store, psa_storage_uid_t uid_base)
+{
+    uint8_t *manifest;
+    size_t len = 0;
+    psa_status_t status;
+
+    memset(&store->stats, 0, sizeof(store->stats));
+    store->uid_base = uid_base;
+    store->clock = 0;
+    trust_store_clear(store);
+
+    manifest = crypto_arena_calloc(1U, TRUST_STORE_MANIFEST_SIZE(TRUST_STORE_MAX_KEYS));
+    if (manifest == NULL)
+    {
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    status = psa_ps_get(uid_base, 0U, TRUST_STORE_MANIFEST_SIZE(TRUST_STORE_MAX_KEYS), manifest, &len);
+    if (status == PSA_SUCCESS)
+    {
+        status = (len < TRUST_STORE_HDR_SIZE) ? PSA_ERROR_CORRUPTION_DETECTED :
+                 trust_store_parse(store, manifest, len);
+    }
+    else if (status == PSA_ERROR_DOES_NOT_EXIST)
+    {
+        status = PSA_SUCCESS;
+    }
+    crypto_arena_free(manifest);
+    return status;
+}
+
+/**
+ * @brief Write chunks to the idle bank, then the manifest; @p stage has
+ *        TRUST_STORE_STAGE_SIZE bytes, @p kids the identifier of each entry
+ */
+static psa_status_t trust_store_write(trust_store_t *store, uint32_t version, uint32_t bank,
+                                      const trust_store_entry_t *entries, const uint64_t *kids,
+                                      size_t count, uint8_t *stage)
+{
+    psa_status_t status = PSA_SUCCESS;
+
+    for (uint32_t first = 0; (status == PSA_SUCCESS) && (first < count); first += TRUST_STORE_CHUNK_KEYS)
+    {
+        uint32_t n = ((count - first) < TRUST_STORE_CHUNK_KEYS) ? (uint32_t)(count - first) : TRUST_STORE_CHUNK_KEYS;
+
+        for (uint32_t i = 0; i < n; i++)
+        {
+            memcpy(&stage[i * TRUST_STORE_PUBLIC_KEY_SIZE], entries[first + i].public_key,
+                   TRUST_STORE_PUBLIC_KEY_SIZE);
+        }
+        status = psa_ps_set(trust_store_chunk_uid(store, bank, first), n * TRUST_STORE_PUBLIC_KEY_SIZE,
+                            stage, PSA_STORAGE_FLAG_NONE);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    /* The manifest write is the switch-over */
+    trust_store_put_le32(stage, TRUST_STORE_MAGIC);
+    trust_store_put_le32(&stage[TRUST_STORE_HDR_VERSION], version);
+    trust_store_put_le32(&stage[TRUST_STORE_HDR_BANK], bank);
+    trust_store_put_le32(&stage[TRUST_STORE_HDR_COUNT], (uint32_t)count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t *e = &stage[TRUST_STORE_MANIFEST_SIZE(i)];
+
+        trust_store_put_le32(e, (uint32_t)kids[i]);
+        trust_store_put_le32(&e[4], (uint32_t)(kids[i] >> 32));
+        trust_store_put_le32(&e[8], entries[i].permissions);
+    }
+    status = psa_ps_set(store->uid_base, TRUST_STORE_MANIFEST_SIZE(count), stage, PSA_STORAGE_FLAG_NONE);
+    if (status == PSA_SUCCESS)
+    {
+        trust_store_close(store);
+        status = trust_store_parse(store, stage, TRUST_STORE_MANIFEST_SIZE(count));
+    }
+    return status;
+}
+
+psa_status_t trust_store_update(trust_store_t *store, uint32_t version,
+                                const trust_store_entry_t *entries, size_t count)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    uint64_t kids[TRUST_STORE_MAX_KEYS];
+    uint16_t slots[TRUST_STORE_SLOTS];
+    trust_index_t index;
+    uint8_t *stage;
+    psa_status_t status;
+
+    if (version <= store->version)
+    {
+        return PSA_ERROR_NOT_PERMITTED;
+    }
+    if (count > TRUST_STORE_MAX_KEYS)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /*
+     * Reject the whole set for one bad key or one repeated identifier
+     * (a repeated key, or two keys whose identifiers collide), which
+     * trust_store_parse() would refuse after the manifest is committed
+     */
+    trust_store_key_attributes(&attributes);
+    trust_index_init(&index, slots, TRUST_STORE_SLOTS, kids);
+    for (size_t i = 0; i < count; i++)
+    {
+        psa_key_id_t trial = PSA_KEY_ID_NULL;
+
+        if (psa_import_key(&attributes, entries[i].public_key, TRUST_STORE_PUBLIC_KEY_SIZE, &trial) != PSA_SUCCESS)
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        (void)psa_destroy_key(trial);
+        kids[i] = trust_store_key_id(entries[i].public_key, TRUST_STORE_PUBLIC_KEY_SIZE);
+        if (!trust_index_insert(&index, (uint16_t)i))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    /* One buffer stages each chunk and then the manifest */
+    stage = crypto_arena_calloc(1U, TRUST_STORE_STAGE_SIZE);
+    if (stage == NULL)
+    {
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    status = trust_store_write(store, version, (store->version == 0U) ? 0U : (store->bank ^ 1U),
+                               entries, kids, count, stage);
+    crypto_arena_free(stage);
+    return status;
+}
+
+/** @brief Read record @p record from PS and import it, evicting the LRU handle if full */
+static psa_status_t trust_store_load(trust_store_t *store, uint32_t record)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    uint8_t public_key[TRUST_STORE_PUBLIC_KEY_SIZE];
+    size_t len = 0;
+    psa_status_t status;
+
+    status = psa_ps_get(trust_store_chunk_uid(store, store->bank, record),
+                        (record % TRUST_STORE_CHUNK_KEYS) * TRUST_STORE_PUBLIC_KEY_SIZE,
+                        sizeof(public_key), public_key, &len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if ((len != sizeof(public_key)) || (trust_store_key_id(public_key, len) != store->kid[record]))
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+
+    if (store->loaded >= TRUST_STORE_LOADED_MAX)
+    {
+        uint32_t victim = TRUST_STORE_MAX_KEYS;
+
+        for (uint32_t i = 0; i < store->count; i++)
+        {
+            if ((store->handle[i] != PSA_KEY_ID_NULL) &&
+                ((victim == TRUST_STORE_MAX_KEYS) || (store->last_use[i] < store->last_use[victim])))
+            {
+                victim = i;
+            }
+        }
+        (void)psa_destroy_key(store->handle[victim]);
+        store->handle[victim] = PSA_KEY_ID_NULL;
+        store->loaded--;
+        store->stats.evictions++;
+    }
+
+    trust_store_key_attributes(&attributes);
+    status = psa_import_key(&attributes, public_key, sizeof(public_key), &store->handle[record]);
+    if (status == PSA_SUCCESS)
+    {
+        store->loaded++;
+        store->stats.loads++;
+    }
+    else
+    {
+        store->handle[record] = PSA_KEY_ID_NULL;
+    }
+    return status;
+}
+
+psa_status_t trust_store_find(trust_store_t *store, uint64_t kid, uint32_t required, psa_key_id_t *key)
+{
+    int32_t record = trust_index_find(&store->index, kid);
+    psa_status_t status = PSA_SUCCESS;
+
+    store->stats.lookups++;
+    if (record < 0)
+    {
+        store->stats.unknown++;
+        return PSA_ERROR_DOES_NOT_EXIST;
+    }
+    if ((store->permissions[record] & required) != required)
+    {
+        return PSA_ERROR_NOT_PERMITTED;
+    }
+    if (store->handle[record] == PSA_KEY_ID_NULL)
+    {
+        status = trust_store_load(store, (uint32_t)record);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        store->last_use[record] = ++store->clock;
+        *key = store->handle[record];
+    }
+    return status;
+}
+
+psa_status_t trust_store_verify(trust_store_t *store, uint64_t kid, uint32_t required,
+                                const uint8_t *message, size_t message_len,
+                                const uint8_t *signature, size_t signature_len)
+{
+    psa_key_id_t key = PSA_KEY_ID_NULL;
+    psa_status_t status;
+
+    status = trust_store_find(store, kid, required, &key);
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_verify_message(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), message, message_len,
+                                    signature, signature_len);
+    }
+    return status;
+}
+
+void trust_store_close(trust_store_t *store)
+{
+    for (uint32_t i = 0; i < store->count; i++)
+    {
+        if (store->handle[i] != PSA_KEY_ID_NULL)
+        {
+            (void)psa_destroy_key(store->handle[i]);
+            store->handle[i] = PSA_KEY_ID_NULL;
+        }
+    }
+    store->loaded = 0;
+}
+
+psa_status_t trust_store_erase(trust_store_t *store)
+{
+    psa_status_t result = PSA_SUCCESS;
+
+    trust_store_close(store);
+    for (uint32_t i = 0; i < TRUST_STORE_ASSETS; i++)
+    {
+        psa_status_t status = psa_ps_remove(store->uid_base + i);
+
+        if ((status != PSA_SUCCESS) && (status != PSA_ERROR_DOES_NOT_EXIST))
+        {
+            result = status;
+        }
+    }
+    trust_store_clear(store);
+    return result;
+}
+
+/* [] END OF FILE */
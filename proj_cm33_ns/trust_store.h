@@ -0,0 +1,222 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Trust store
+ * Purpose : Public keys of the backend services and operators allowed to
+ *           send signed commands, looked up by key identifier.
+ * Design  : A key identifier is the first 8 bytes of the SHA-256 of the
+ *           uncompressed public key. The RAM index is an open-addressing
+ *           table of TRUST_STORE_SLOTS 16-bit record numbers (twice the
+ *           key capacity, so at most half full), probed linearly from the
+ *           low identifier bits; a lookup touches one or two slots whatever
+ *           the number of keys. Identifiers and permission bits of all keys
+ *           are in RAM; the public keys stay in Protected Storage and are
+ *           imported into PSA on first use. At most TRUST_STORE_LOADED_MAX
+ *           handles are held, the least recently used is destroyed first.
+ *
+ *           Assets from uid_base on: the manifest (version, bank, count,
+ *           then identifier and permissions per key), then two banks of
+ *           TRUST_STORE_CHUNKS assets with TRUST_STORE_CHUNK_KEYS 65-byte
+ *           keys each. trust_store_update() writes a new key set into the
+ *           bank not in use and switches with the manifest write, so a
+ *           power failure leaves the old or the new set. The version must
+ *           increase; the caller authenticates the update.
+ ********************************************************************************
+ * @file    trust_store.h
+ * @brief   Key-ID indexed trust store with lazy loading from PS
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef TRUST_STORE_H
+#define TRUST_STORE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+#include "psa/protected_storage.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Keys in the store; a power of two */
+#ifndef TRUST_STORE_MAX_KEYS
+#define TRUST_STORE_MAX_KEYS          (32U)
+#endif
+
+/** @brief Imported PSA keys held at once */
+#ifndef TRUST_STORE_LOADED_MAX
+#define TRUST_STORE_LOADED_MAX        (8U)
+#endif
+
+#if ((TRUST_STORE_MAX_KEYS & (TRUST_STORE_MAX_KEYS - 1U)) != 0U)
+#error "TRUST_STORE_MAX_KEYS must be a power of two"
+#endif
+
+/** @brief Index slots: load factor at most 1/2 */
+#define TRUST_STORE_SLOTS             (2U * TRUST_STORE_MAX_KEYS)
+
+/** @brief Uncompressed P-256 public key */
+#define TRUST_STORE_PUBLIC_KEY_SIZE   (65U)
+
+/** @brief Keys per PS asset and assets per bank */
+#define TRUST_STORE_CHUNK_KEYS        (16U)
+#define TRUST_STORE_CHUNKS            ((TRUST_STORE_MAX_KEYS + TRUST_STORE_CHUNK_KEYS - 1U) / TRUST_STORE_CHUNK_KEYS)
+
+/** @brief Manifest size for @p count keys */
+#define TRUST_STORE_MANIFEST_SIZE(count) (16U + (12U * (count)))
+
+/** @brief PS assets used from uid_base on */
+#define TRUST_STORE_ASSETS            (1U + (2U * TRUST_STORE_CHUNKS))
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Open-addressing index of record numbers by key identifier */
+typedef struct
+{
+    uint16_t       *slots;      /**< 0: empty, else record + 1      */
+    uint32_t        mask;       /**< Slot count - 1                 */
+    const uint64_t *kids;       /**< Key identifier per record      */
+} trust_index_t;
+
+/** @brief One key of a bulk update */
+typedef struct
+{
+    uint8_t  public_key[TRUST_STORE_PUBLIC_KEY_SIZE];   /**< 0x04 || x || y            */
+    uint32_t permissions;       /**< Application-defined, e.g. one bit per command class */
+} trust_store_entry_t;
+
+/** @brief Lookup counters */
+typedef struct
+{
+    uint32_t lookups;
+    uint32_t unknown;           /**< Identifier not in the store     */
+    uint32_t loads;             /**< Keys read from PS and imported  */
+    uint32_t evictions;         /**< Handles destroyed to make room  */
+} trust_store_stats_t;
+
+/** @brief Trust store */
+typedef struct
+{
+    psa_storage_uid_t   uid_base;
+    uint32_t            version;        /**< 0: nothing stored yet  */
+    uint32_t            bank;           /**< Bank the manifest uses */
+    uint32_t            count;
+    uint32_t            loaded;
+    uint32_t            clock;          /**< Lookup counter for LRU */
+    trust_store_stats_t stats;
+    trust_index_t       index;
+    uint64_t            kid[TRUST_STORE_MAX_KEYS];
+    uint32_t            permissions[TRUST_STORE_MAX_KEYS];
+    psa_key_id_t        handle[TRUST_STORE_MAX_KEYS];       /**< PSA_KEY_ID_NULL until loaded */
+    uint32_t            last_use[TRUST_STORE_MAX_KEYS];
+    uint16_t            slots[TRUST_STORE_SLOTS];
+} trust_store_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Key identifier: first 8 bytes of SHA-256(@p public_key), big-endian */
+uint64_t trust_store_key_id(const uint8_t *public_key, size_t public_key_len);
+
+/**
+ * @brief Empty index over caller storage
+ *
+ * @param[out] index       Index
+ * @param[in]  slots       Slot array, @p slot_count entries
+ * @param[in]  slot_count  Power of two, more than the records to insert; a
+ *                         lookup probes at most this many slots
+ * @param[in]  kids        Key identifier of each record
+ */
+void trust_index_init(trust_index_t *index, uint16_t *slots, uint32_t slot_count, const uint64_t *kids);
+
+/** @brief Add record @p record (below 0xFFFF); false if its identifier is already indexed or no slot is free */
+bool trust_index_insert(trust_index_t *index, uint16_t record);
+
+/** @brief Record with identifier @p kid, or -1 */
+int32_t trust_index_find(const trust_index_t *index, uint64_t kid);
+
+/**
+ * @brief Load the manifest at @p uid_base; no key is imported yet
+ *
+ * @return PSA_SUCCESS (also for an empty store),
+ *         PSA_ERROR_CORRUPTION_DETECTED for a malformed manifest,
+ *         PSA_ERROR_INSUFFICIENT_MEMORY, or a Protected Storage error
+ */
+psa_status_t trust_store_open(trust_store_t *store, psa_storage_uid_t uid_base);
+
+/**
+ * @brief Replace all keys with a new, higher version
+ *
+ * Every key is checked by a trial import before anything is written.
+ *
+ * @param[in] version  Must be above the stored version
+ * @param[in] entries  New key set
+ * @param[in] count    At most TRUST_STORE_MAX_KEYS
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_NOT_PERMITTED for a version that is not
+ *         newer, PSA_ERROR_INVALID_ARGUMENT for too many or invalid keys,
+ *         or for two keys with the same identifier (a duplicate key or a
+ *         64-bit collision), PSA_ERROR_INSUFFICIENT_MEMORY, or a Protected
+ *         Storage error (the old set then stays in use)
+ */
+psa_status_t trust_store_update(trust_store_t *store, uint32_t version,
+                                const trust_store_entry_t *entries, size_t count);
+
+/**
+ * @brief PSA handle of a trusted key, importing it on first use
+ *
+ * @param[in]  kid       Key identifier from the command
+ * @param[in]  required  Permission bits the key must all have
+ * @param[out] key       Verify-only ECDSA P-256 key; valid until the next
+ *                       lookup may evict it
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_DOES_NOT_EXIST for an unknown key,
+ *         PSA_ERROR_NOT_PERMITTED, PSA_ERROR_CORRUPTION_DETECTED if the
+ *         stored key does not match its identifier, or a PS or import error
+ */
+psa_status_t trust_store_find(trust_store_t *store, uint64_t kid, uint32_t required, psa_key_id_t *key);
+
+/** @brief trust_store_find(), then an ECDSA P-256 / SHA-256 check of @p message */
+psa_status_t trust_store_verify(trust_store_t *store, uint64_t kid, uint32_t required,
+                                const uint8_t *message, size_t message_len,
+                                const uint8_t *signature, size_t signature_len);
+
+/** @brief Destroy the imported handles */
+void trust_store_close(trust_store_t *store);
+
+/** @brief Remove the store's assets; the store is empty afterwards */
+psa_status_t trust_store_erase(trust_store_t *store);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TRUST_STORE_H */
+/* [] END OF FILE */
@@ -0,0 +1,374 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Verification result cache
+ * Purpose : Key digests, tag computation, probing, expiry and invalidation.
+ ********************************************************************************
+ * @file    verify_cache.c
+ * @brief   Cache of positive signature verification results
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <string.h>
+
+#include "sha256_sw.h"
+#include "verify_cache.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Protects the table; override to run off target
+ */
+#ifndef VERIFY_CACHE_LOCK
+#include "cy_syslib.h"
+#define VERIFY_CACHE_LOCK()           Cy_SysLib_EnterCriticalSection()
+#define VERIFY_CACHE_UNLOCK(state)    Cy_SysLib_ExitCriticalSection(state)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct
+{
+    uint8_t  tag[SHA256_SW_DIGEST_SIZE];
+    uint32_t key_fp;            /**< Key digest fingerprint              */
+    uint32_t expires;           /**< Time at which the entry lapses      */
+    bool     valid;
+} verify_cache_entry_t;
+
+/** @brief A registered key id and the SHA-256 of its public key */
+typedef struct
+{
+    psa_key_id_t key_id;        /**< PSA_KEY_ID_NULL when free           */
+    uint8_t      digest[SHA256_SW_DIGEST_SIZE];
+} verify_cache_key_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static verify_cache_entry_t verify_cache_table[VERIFY_CACHE_ENTRIES];
+static verify_cache_key_t   verify_cache_keys[VERIFY_CACHE_KEYS];
+static uint32_t             verify_cache_key_next;      /**< Next registration to replace */
+static verify_cache_stats_t verify_cache_stats;
+static uint32_t             verify_cache_ttl;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief Fingerprint of a key digest, enough to find its entries again */
+static uint32_t verify_cache_fingerprint(const uint8_t *digest)
+{
+    return (uint32_t)digest[0] | ((uint32_t)digest[1] << 8) |
+           ((uint32_t)digest[2] << 16) | ((uint32_t)digest[3] << 24);
+}
+
+/** @brief True while @p entry has not reached its expiry time (wrap safe) */
+static bool verify_cache_live(const verify_cache_entry_t *entry, uint32_t now)
+{
+    return entry->valid && ((int32_t)(entry->expires - now) > 0);
+}
+
+void verify_cache_init(uint32_t ttl)
+{
+    uint32_t irq_state = VERIFY_CACHE_LOCK();
+
+    memset(verify_cache_table, 0, sizeof(verify_cache_table));
+    memset(verify_cache_keys, 0, sizeof(verify_cache_keys));
+    verify_cache_key_next = 0;
+    memset(&verify_cache_stats, 0, sizeof(verify_cache_stats));
+    verify_cache_ttl = ttl;
+    VERIFY_CACHE_UNLOCK(irq_state);
+}
+
+/** @brief Append a length or algorithm to the tag input, 32 bits big endian */
+static void verify_cache_hash_u32(sha256_sw_ctx_t *ctx, uint32_t value)
+{
+    const uint8_t bytes[4] =
+    {
+        (uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value
+    };
+
+    sha256_sw_update(ctx, bytes, sizeof(bytes));
+}
+
+/** @brief Registration of @p key_id; call locked */
+static verify_cache_key_t *verify_cache_key_find(psa_key_id_t key_id)
+{
+    for (uint32_t i = 0; i < VERIFY_CACHE_KEYS; i++)
+    {
+        if ((verify_cache_keys[i].key_id != PSA_KEY_ID_NULL) && (verify_cache_keys[i].key_id == key_id))
+        {
+            return &verify_cache_keys[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Digest of the public key of @p key_id, exported on first use
+ *
+ * Only an unknown key id calls into TF-M; the export runs unlocked.
+ */
+static psa_status_t verify_cache_key_digest(psa_key_id_t key_id, uint8_t *digest)
+{
+    uint8_t public_key[PSA_EXPORT_PUBLIC_KEY_MAX_SIZE];
+    size_t public_key_len;
+    verify_cache_key_t *key;
+    uint32_t irq_state;
+    psa_status_t status;
+
+    irq_state = VERIFY_CACHE_LOCK();
+    key = verify_cache_key_find(key_id);
+    if (key != NULL)
+    {
+        memcpy(digest, key->digest, SHA256_SW_DIGEST_SIZE);
+    }
+    VERIFY_CACHE_UNLOCK(irq_state);
+    if (key != NULL)
+    {
+        return PSA_SUCCESS;
+    }
+
+    status = psa_export_public_key(key_id, public_key, sizeof(public_key), &public_key_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    sha256_sw(public_key, public_key_len, digest);
+
+    irq_state = VERIFY_CACHE_LOCK();
+    verify_cache_stats.key_exports++;
+    /* Another caller may have registered the key meanwhile */
+    key = verify_cache_key_find(key_id);
+    for (uint32_t i = 0; (key == NULL) && (i < VERIFY_CACHE_KEYS); i++)
+    {
+        if (verify_cache_keys[i].key_id == PSA_KEY_ID_NULL)
+        {
+            key = &verify_cache_keys[i];
+        }
+    }
+    if (key == NULL)
+    {
+        key = &verify_cache_keys[verify_cache_key_next];
+        verify_cache_key_next = (verify_cache_key_next + 1U) % VERIFY_CACHE_KEYS;
+    }
+    key->key_id = key_id;
+    memcpy(key->digest, digest, SHA256_SW_DIGEST_SIZE);
+    VERIFY_CACHE_UNLOCK(irq_state);
+    return PSA_SUCCESS;
+}
+
+psa_status_t verify_cache_add_key(psa_key_id_t key_id)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+
+    return verify_cache_key_digest(key_id, digest);
+}
+
+void verify_cache_forget_key(psa_key_id_t key_id)
+{
+    uint32_t irq_state = VERIFY_CACHE_LOCK();
+    verify_cache_key_t *key = verify_cache_key_find(key_id);
+
+    if (key != NULL)
+    {
+        memset(key, 0, sizeof(*key));
+    }
+    VERIFY_CACHE_UNLOCK(irq_state);
+}
+
+psa_status_t verify_cache_verify_hash(psa_key_id_t key_id, psa_algorithm_t alg,
+                                      const uint8_t *hash, size_t hash_len,
+                                      const uint8_t *signature, size_t signature_len,
+                                      uint32_t now)
+{
+    sha256_sw_ctx_t ctx;
+    uint8_t key_digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t tag[SHA256_SW_DIGEST_SIZE];
+    uint32_t home;
+    uint32_t victim;
+    uint32_t key_fp;
+    uint32_t irq_state;
+    bool hit = false;
+    psa_status_t status;
+
+    status = verify_cache_key_digest(key_id, key_digest);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    /* The lengths are hashed too so no two inputs can share a byte stream */
+    sha256_sw_init(&ctx);
+    verify_cache_hash_u32(&ctx, (uint32_t)alg);
+    verify_cache_hash_u32(&ctx, (uint32_t)hash_len);
+    verify_cache_hash_u32(&ctx, (uint32_t)signature_len);
+    sha256_sw_update(&ctx, key_digest, sizeof(key_digest));
+    sha256_sw_update(&ctx, hash, hash_len);
+    sha256_sw_update(&ctx, signature, signature_len);
+    sha256_sw_finish(&ctx, tag);
+
+    home = ((uint32_t)tag[0] | ((uint32_t)tag[1] << 8)) % VERIFY_CACHE_ENTRIES;
+
+    irq_state = VERIFY_CACHE_LOCK();
+    for (uint32_t i = 0; i < VERIFY_CACHE_PROBE; i++)
+    {
+        verify_cache_entry_t *entry = &verify_cache_table[(home + i) % VERIFY_CACHE_ENTRIES];
+
+        if (entry->valid && (memcmp(entry->tag, tag, sizeof(tag)) == 0))
+        {
+            if (verify_cache_live(entry, now))
+            {
+                hit = true;
+            }
+            else
+            {
+                entry->valid = false;
+                verify_cache_stats.expired++;
+            }
+            break;
+        }
+    }
+    if (hit)
+    {
+        verify_cache_stats.hits++;
+    }
+    else
+    {
+        verify_cache_stats.misses++;
+    }
+    VERIFY_CACHE_UNLOCK(irq_state);
+    if (hit)
+    {
+        return PSA_SUCCESS;
+    }
+
+    status = psa_verify_hash(key_id, alg, hash, hash_len, signature, signature_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    key_fp = verify_cache_fingerprint(key_digest);
+
+    irq_state = VERIFY_CACHE_LOCK();
+    /* Another caller may have stored the tag meanwhile: renew it */
+    victim = VERIFY_CACHE_ENTRIES;
+    for (uint32_t i = 0; i < VERIFY_CACHE_PROBE; i++)
+    {
+        uint32_t slot = (home + i) % VERIFY_CACHE_ENTRIES;
+
+        if (verify_cache_table[slot].valid && (memcmp(verify_cache_table[slot].tag, tag, sizeof(tag)) == 0))
+        {
+            victim = slot;
+            break;
+        }
+    }
+    if (victim == VERIFY_CACHE_ENTRIES)
+    {
+        /* First free or lapsed slot in the probe window, else the one closest to expiry */
+        victim = home;
+        for (uint32_t i = 0; i < VERIFY_CACHE_PROBE; i++)
+        {
+            uint32_t slot = (home + i) % VERIFY_CACHE_ENTRIES;
+
+            if (!verify_cache_live(&verify_cache_table[slot], now))
+            {
+                victim = slot;
+                break;
+            }
+            if ((int32_t)(verify_cache_table[slot].expires - verify_cache_table[victim].expires) < 0)
+            {
+                victim = slot;
+            }
+        }
+        if (verify_cache_live(&verify_cache_table[victim], now))
+        {
+            verify_cache_stats.evictions++;
+        }
+        verify_cache_stats.inserts++;
+    }
+    memcpy(verify_cache_table[victim].tag, tag, sizeof(tag));
+    verify_cache_table[victim].key_fp = key_fp;
+    verify_cache_table[victim].expires = now + verify_cache_ttl;
+    verify_cache_table[victim].valid = true;
+    VERIFY_CACHE_UNLOCK(irq_state);
+    return PSA_SUCCESS;
+}
+
+uint32_t verify_cache_invalidate_key(const uint8_t *public_key, size_t public_key_len)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint32_t fp;
+    uint32_t removed = 0;
+    uint32_t irq_state;
+
+    sha256_sw(public_key, public_key_len, digest);
+    fp = verify_cache_fingerprint(digest);
+
+    irq_state = VERIFY_CACHE_LOCK();
+    for (uint32_t i = 0; i < VERIFY_CACHE_KEYS; i++)
+    {
+        if (memcmp(verify_cache_keys[i].digest, digest, sizeof(digest)) == 0)
+        {
+            memset(&verify_cache_keys[i], 0, sizeof(verify_cache_keys[i]));
+        }
+    }
+    /* A fingerprint collision only drops extra entries, which is safe */
+    for (uint32_t i = 0; i < VERIFY_CACHE_ENTRIES; i++)
+    {
+        if (verify_cache_table[i].valid && (verify_cache_table[i].key_fp == fp))
+        {
+            verify_cache_table[i].valid = false;
+            removed++;
+        }
+    }
+    verify_cache_stats.invalidated += removed;
+    VERIFY_CACHE_UNLOCK(irq_state);
+
+    return removed;
+}
+
+void verify_cache_clear(void)
+{
+    uint32_t irq_state = VERIFY_CACHE_LOCK();
+
+    for (uint32_t i = 0; i < VERIFY_CACHE_ENTRIES; i++)
+    {
+        verify_cache_table[i].valid = false;
+    }
+    VERIFY_CACHE_UNLOCK(irq_state);
+}
+
+void verify_cache_get_stats(verify_cache_stats_t *stats)
+{
+    uint32_t irq_state = VERIFY_CACHE_LOCK();
+
+    *stats = verify_cache_stats;
+    VERIFY_CACHE_UNLOCK(irq_state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,164 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Verification result cache
+ * Purpose : Skip the signature check for commands that were already
+ *           verified, e.g. configuration pushes that are sent again.
+ * Design  : Fixed table of VERIFY_CACHE_ENTRIES tags. A tag is the SHA-256
+ *           of algorithm, key digest, digest and signature, computed on
+ *           this core. The key digest is the SHA-256 of the public key,
+ *           exported once per key id and kept in a table of
+ *           VERIFY_CACHE_KEYS keys, so an entry is bound to the key that
+ *           verified it and not to bytes supplied by the caller. A repeat
+ *           costs one SHA-256 and a short probe and never calls TF-M.
+ *           Key ids can be reused once a key is destroyed, so
+ *           verify_cache_forget_key() must run before psa_destroy_key().
+ *           Only successful verifications are stored, each with an expiry
+ *           time. Time is supplied by the caller in any monotonic unit
+ *           (ticks, seconds) and the TTL is in the same unit. Entries carry
+ *           a fingerprint of the key digest so a revoked key can be removed.
+ ********************************************************************************
+ * @file    verify_cache.h
+ * @brief   Cache of positive signature verification results
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef VERIFY_CACHE_H
+#define VERIFY_CACHE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Number of cached results */
+#ifndef VERIFY_CACHE_ENTRIES
+#define VERIFY_CACHE_ENTRIES          (32U)
+#endif
+
+/** @brief Slots examined per lookup or insert, starting at the tag's home slot */
+#ifndef VERIFY_CACHE_PROBE
+#define VERIFY_CACHE_PROBE            (4U)
+#endif
+
+/** @brief Number of key ids whose key digest is kept */
+#ifndef VERIFY_CACHE_KEYS
+#define VERIFY_CACHE_KEYS             (4U)
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Cache counters since verify_cache_init() */
+typedef struct
+{
+    uint32_t hits;              /**< Answered from the cache              */
+    uint32_t misses;            /**< Verified through PSA                 */
+    uint32_t expired;           /**< Misses that found an expired entry   */
+    uint32_t inserts;           /**< Successful verifications stored      */
+    uint32_t evictions;         /**< Live entries replaced by an insert   */
+    uint32_t invalidated;       /**< Entries removed by invalidation      */
+    uint32_t key_exports;       /**< Public key exports (TF-M calls)      */
+} verify_cache_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Empty the cache and reset the counters
+ *
+ * @param[in] ttl  Lifetime of an entry, in the unit of the @p now arguments
+ */
+void verify_cache_init(uint32_t ttl);
+
+/**
+ * @brief Verify a hash signature, answering repeats from the cache
+ *
+ * On a miss the signature is checked with psa_verify_hash() and stored if
+ * it is valid; a tag that is already stored only has its expiry renewed.
+ * Failed verifications are never cached. The first call with a key id
+ * also registers it as verify_cache_add_key() does.
+ *
+ * @param[in] key_id          Verification key; must allow export
+ * @param[in] alg             Signature algorithm
+ * @param[in] hash            Message digest
+ * @param[in] hash_len        Length of @p hash
+ * @param[in] signature       Signature
+ * @param[in] signature_len   Length of @p signature
+ * @param[in] now             Current time
+ *
+ * @return Result of psa_export_public_key() if registering the key fails,
+ *         else of psa_verify_hash(), or PSA_SUCCESS on a hit
+ */
+psa_status_t verify_cache_verify_hash(psa_key_id_t key_id, psa_algorithm_t alg,
+                                      const uint8_t *hash, size_t hash_len,
+                                      const uint8_t *signature, size_t signature_len,
+                                      uint32_t now);
+
+/**
+ * @brief Export a key's public key once and keep its digest
+ *
+ * Optional: verify_cache_verify_hash() registers unknown keys itself. When
+ * the key table is full the oldest registration is replaced.
+ *
+ * @param[in] key_id  Verification key; must allow export
+ *
+ * @return Result of psa_export_public_key()
+ */
+psa_status_t verify_cache_add_key(psa_key_id_t key_id);
+
+/**
+ * @brief Drop the digest kept for a key id
+ *
+ * Call before psa_destroy_key(): a later key may get the same id.
+ */
+void verify_cache_forget_key(psa_key_id_t key_id);
+
+/**
+ * @brief Remove every entry made with a public key, e.g. on revocation
+ *
+ * Registrations of the key are dropped too.
+ *
+ * @return Number of entries removed
+ */
+uint32_t verify_cache_invalidate_key(const uint8_t *public_key, size_t public_key_len);
+
+/** @brief Remove all entries; counters are kept */
+void verify_cache_clear(void);
+
+/** @brief Copy the counters */
+void verify_cache_get_stats(verify_cache_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* VERIFY_CACHE_H */
+/* [] END OF FILE */
@@ -0,0 +1,921 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : X.509 chain verification
+ * Purpose : DER certificate parsing, path checks, signature verification
+ *           through PSA and the intermediate CA cache.
+ ********************************************************************************
+ * @file    x509_chain.c
+ * @brief   X.509 chain verification with a verified-intermediate cache
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "crypto_dispatch.h"
+#include "ecdsa_der.h"
+#include "sha256_sw.h"
+#include "x509_chain.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief ASN.1 tags */
+#define X509_TAG_BOOLEAN              (0x01U)
+#define X509_TAG_INTEGER              (0x02U)
+#define X509_TAG_BIT_STRING           (0x03U)
+#define X509_TAG_OCTET_STRING         (0x04U)
+#define X509_TAG_OID                  (0x06U)
+#define X509_TAG_UTC_TIME             (0x17U)
+#define X509_TAG_GENERALIZED_TIME     (0x18U)
+#define X509_TAG_SEQUENCE             (0x30U)
+#define X509_TAG_VERSION              (0xA0U)     /* [0] EXPLICIT            */
+#define X509_TAG_ISSUER_UID           (0x81U)     /* [1] IMPLICIT            */
+#define X509_TAG_SUBJECT_UID          (0x82U)     /* [2] IMPLICIT            */
+#define X509_TAG_EXTENSIONS           (0xA3U)     /* [3] EXPLICIT            */
+#define X509_TAG_AKI_KEY_ID           (0x80U)     /* [0] IMPLICIT in AKI     */
+
+/** @brief Last arc of the id-ce extension OIDs (2.5.29.x) */
+#define X509_EXT_SUBJECT_KEY_ID       (14U)
+#define X509_EXT_KEY_USAGE            (15U)
+#define X509_EXT_SUBJECT_ALT_NAME     (17U)
+#define X509_EXT_BASIC_CONSTRAINTS    (19U)
+#define X509_EXT_AUTHORITY_KEY_ID     (35U)
+#define X509_EXT_EXT_KEY_USAGE        (37U)
+
+/** @brief Longest serial number (RFC 5280, 4.1.2.2) */
+#define X509_SERIAL_MAX               (20U)
+
+/** @brief P-256 coordinate size */
+#define X509_COORD_SIZE               (32U)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief AlgorithmIdentifier contents: ecdsa-with-SHA256, no parameters */
+static const uint8_t x509_alg_ecdsa_sha256[] =
+{
+    0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02
+};
+
+/** @brief SPKI AlgorithmIdentifier contents: id-ecPublicKey, prime256v1 */
+static const uint8_t x509_alg_ec_p256[] =
+{
+    0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01,
+    0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07
+};
+
+/** @brief id-ce (2.5.29) */
+static const uint8_t x509_oid_id_ce[] = { 0x55, 0x1D };
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Read one TLV with tag @p tag at *@p p and step past it
+ *
+ * Only definite, minimally encoded lengths up to 0xFFFF are accepted.
+ */
+static bool x509_der_get(const uint8_t **p, const uint8_t *end, uint8_t tag,
+                         const uint8_t **value, size_t *len)
+{
+    const uint8_t *q = *p;
+    size_t n;
+
+    if (((end - q) < 2) || (q[0] != tag))
+    {
+        return false;
+    }
+    n = q[1];
+    q += 2;
+    if (n == 0x81U)
+    {
+        if (((end - q) < 1) || (q[0] < 0x80U))
+        {
+            return false;
+        }
+        n = q[0];
+        q += 1;
+    }
+    else if (n == 0x82U)
+    {
+        if (((end - q) < 2) || (q[0] == 0U))
+        {
+            return false;
+        }
+        n = ((size_t)q[0] << 8) | q[1];
+        q += 2;
+    }
+    else if (n > 0x7FU)
+    {
+        return false;
+    }
+    if ((size_t)(end - q) < n)
+    {
+        return false;
+    }
+    *value = q;
+    *len = n;
+    *p = q + n;
+    return true;
+}
+
+static bool x509_der_peek(const uint8_t *p, const uint8_t *end, uint8_t tag)
+{
+    return (p < end) && (p[0] == tag);
+}
+
+static bool x509_digits(const uint8_t *s, uint32_t count, uint32_t *value)
+{
+    *value = 0U;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((s[i] < '0') || (s[i] > '9'))
+        {
+            return false;
+        }
+        *value = (*value * 10U) + (uint32_t)(s[i] - '0');
+    }
+    return true;
+}
+
+uint64_t x509_time_from_date(uint32_t year, uint32_t month, uint32_t day,
+                             uint32_t hour, uint32_t minute, uint32_t second)
+{
+    /* Days since 1970-01-01 in the proleptic Gregorian calendar, with the
+     * year starting in March so the leap day is last */
+    uint32_t y = (month <= 2U) ? (year - 1U) : year;
+    uint32_t era = y / 400U;
+    uint32_t yoe = y - (era * 400U);
+    uint32_t doy = (((153U * ((month > 2U) ? (month - 3U) : (month + 9U))) + 2U) / 5U) + day - 1U;
+    uint32_t doe = (yoe * 365U) + (yoe / 4U) - (yoe / 100U) + doy;
+    uint64_t days = ((uint64_t)era * 146097U) + doe - 719468U;
+
+    return (days * 86400U) + ((uint64_t)hour * 3600U) + ((uint64_t)minute * 60U) + second;
+}
+
+/** @brief UTCTime (YYMMDDHHMMSSZ) or GeneralizedTime (YYYYMMDDHHMMSSZ) */
+static bool x509_parse_time(const uint8_t **p, const uint8_t *end, uint64_t *time)
+{
+    const uint8_t *s;
+    size_t len;
+    uint32_t year;
+    uint32_t f[5];
+
+    if (x509_der_get(p, end, X509_TAG_UTC_TIME, &s, &len) && (len == 13U))
+    {
+        if (!x509_digits(s, 2U, &year))
+        {
+            return false;
+        }
+        year += (year < 50U) ? 2000U : 1900U;
+        s += 2;
+    }
+    else if (x509_der_get(p, end, X509_TAG_GENERALIZED_TIME, &s, &len) && (len == 15U))
+    {
+        if (!x509_digits(s, 4U, &year) || (year < 1970U))
+        {
+            return false;
+        }
+        s += 4;
+    }
+    else
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < 5U; i++)
+    {
+        if (!x509_digits(&s[2U * i], 2U, &f[i]))
+        {
+            return false;
+        }
+    }
+    if ((s[10] != 'Z') || (f[0] < 1U) || (f[0] > 12U) || (f[1] < 1U) || (f[1] > 31U) ||
+        (f[2] > 23U) || (f[3] > 59U) || (f[4] > 59U))
+    {
+        return false;
+    }
+    *time = x509_time_from_date(year, f[0], f[1], f[2], f[3], f[4]);
+    return true;
+}
+
+/** @brief AlgorithmIdentifier whose contents must equal @p expected */
+static psa_status_t x509_parse_alg(const uint8_t **p, const uint8_t *end,
+                                   const uint8_t *expected, size_t expected_len)
+{
+    const uint8_t *v;
+    size_t len;
+
+    if (!x509_der_get(p, end, X509_TAG_SEQUENCE, &v, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if ((len != expected_len) || (memcmp(v, expected, len) != 0))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    return PSA_SUCCESS;
+}
+
+/** @brief SubjectPublicKeyInfo of an uncompressed P-256 key */
+static psa_status_t x509_parse_spki(const uint8_t **p, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *v;
+    const uint8_t *v_end;
+    const uint8_t *bits;
+    size_t len;
+    psa_status_t status;
+
+    if (!x509_der_get(p, end, X509_TAG_SEQUENCE, &v, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    v_end = v + len;
+    status = x509_parse_alg(&v, v_end, x509_alg_ec_p256, sizeof(x509_alg_ec_p256));
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (!x509_der_get(&v, v_end, X509_TAG_BIT_STRING, &bits, &len) || (v != v_end))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if ((len != (1U + X509_PUBLIC_KEY_SIZE)) || (bits[0] != 0U))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (bits[1] != 0x04U)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;         /* Compressed point */
+    }
+    cert->public_key = &bits[1];
+    return PSA_SUCCESS;
+}
+
+/** @brief basicConstraints: SEQUENCE { cA BOOLEAN DEFAULT FALSE, pathLen INTEGER OPTIONAL } */
+static bool x509_parse_basic_constraints(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *s;
+    const uint8_t *b;
+    size_t len;
+
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &s, &len) || (v != end))
+    {
+        return false;
+    }
+    end = s + len;
+    if (x509_der_peek(s, end, X509_TAG_BOOLEAN))
+    {
+        /* DER leaves a FALSE default out, so a present cA is TRUE */
+        if (!x509_der_get(&s, end, X509_TAG_BOOLEAN, &b, &len) || (len != 1U) || (b[0] != 0xFFU))
+        {
+            return false;
+        }
+        cert->ca = true;
+    }
+    if (x509_der_peek(s, end, X509_TAG_INTEGER))
+    {
+        if (!x509_der_get(&s, end, X509_TAG_INTEGER, &b, &len) || (len != 1U) || (b[0] > 0x7FU) ||
+            !cert->ca)
+        {
+            return false;
+        }
+        cert->path_len = b[0];
+    }
+    return s == end;
+}
+
+/** @brief keyUsage: BIT STRING, bit 0 is the most significant bit of the first byte */
+static bool x509_parse_key_usage(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *b;
+    size_t len;
+
+    if (!x509_der_get(&v, end, X509_TAG_BIT_STRING, &b, &len) || (v != end) ||
+        (len < 2U) || (len > 3U) || (b[0] > 7U))
+    {
+        return false;
+    }
+    cert->key_usage = 0U;
+    for (uint32_t i = 0; i < ((len - 1U) * 8U); i++)
+    {
+        if ((b[1U + (i / 8U)] & (0x80U >> (i % 8U))) != 0U)
+        {
+            cert->key_usage |= 1UL << i;
+        }
+    }
+    return true;
+}
+
+/** @brief subjectKeyIdentifier: OCTET STRING */
+static bool x509_parse_ski(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    return x509_der_get(&v, end, X509_TAG_OCTET_STRING, &cert->ski, &cert->ski_len) &&
+           (v == end) && (cert->ski_len > 0U);
+}
+
+/** @brief authorityKeyIdentifier: SEQUENCE { [0] keyIdentifier OPTIONAL, ... } */
+static bool x509_parse_aki(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *s;
+    size_t len;
+
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &s, &len) || (v != end))
+    {
+        return false;
+    }
+    if (x509_der_peek(s, s + len, X509_TAG_AKI_KEY_ID))
+    {
+        /* Issuer name and serial, if present, are not used */
+        return x509_der_get(&s, s + len, X509_TAG_AKI_KEY_ID, &cert->aki, &cert->aki_len) &&
+               (cert->aki_len > 0U);
+    }
+    return true;
+}
+
+/** @brief [3] Extensions */
+static psa_status_t x509_parse_extensions(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *list;
+    size_t len;
+
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &list, &len) || (v != end) || (len == 0U))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    end = list + len;
+
+    while (list < end)
+    {
+        const uint8_t *ext;
+        const uint8_t *ext_end;
+        const uint8_t *oid;
+        const uint8_t *value;
+        const uint8_t *b;
+        size_t oid_len;
+        size_t value_len;
+        bool critical = false;
+        bool known = false;
+        bool ok = true;
+
+        if (!x509_der_get(&list, end, X509_TAG_SEQUENCE, &ext, &len))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        ext_end = ext + len;
+        if (!x509_der_get(&ext, ext_end, X509_TAG_OID, &oid, &oid_len))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        if (x509_der_peek(ext, ext_end, X509_TAG_BOOLEAN))
+        {
+            if (!x509_der_get(&ext, ext_end, X509_TAG_BOOLEAN, &b, &len) || (len != 1U) || (b[0] != 0xFFU))
+            {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            critical = true;
+        }
+        if (!x509_der_get(&ext, ext_end, X509_TAG_OCTET_STRING, &value, &value_len) || (ext != ext_end))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+
+        if ((oid_len == 3U) && (memcmp(oid, x509_oid_id_ce, sizeof(x509_oid_id_ce)) == 0))
+        {
+            known = true;
+            switch (oid[2])
+            {
+                case X509_EXT_BASIC_CONSTRAINTS:
+                    ok = x509_parse_basic_constraints(value, value + value_len, cert);
+                    break;
+                case X509_EXT_KEY_USAGE:
+                    ok = x509_parse_key_usage(value, value + value_len, cert);
+                    break;
+                case X509_EXT_SUBJECT_KEY_ID:
+                    ok = x509_parse_ski(value, value + value_len, cert);
+                    break;
+                case X509_EXT_AUTHORITY_KEY_ID:
+                    ok = x509_parse_aki(value, value + value_len, cert);
+                    break;
+                case X509_EXT_SUBJECT_ALT_NAME:
+                case X509_EXT_EXT_KEY_USAGE:
+                    break;                      /* For the application to check on the leaf */
+                default:
+                    known = false;
+                    break;
+            }
+        }
+        if (!ok)
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        if (critical && !known)
+        {
+            return PSA_ERROR_NOT_SUPPORTED;
+        }
+    }
+    return PSA_SUCCESS;
+}
+
+/** @brief TBSCertificate contents */
+static psa_status_t x509_parse_tbs(const uint8_t *v, const uint8_t *end, x509_cert_t *cert)
+{
+    const uint8_t *s;
+    const uint8_t *validity;
+    size_t len;
+    psa_status_t status;
+
+    /* Version v3 only: [0] { INTEGER 2 } */
+    if (!x509_der_get(&v, end, X509_TAG_VERSION, &s, &len) || (len != 3U) ||
+        (s[0] != X509_TAG_INTEGER) || (s[1] != 1U) || (s[2] != 2U))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (!x509_der_get(&v, end, X509_TAG_INTEGER, &cert->serial, &cert->serial_len) ||
+        (cert->serial_len == 0U) || (cert->serial_len > (X509_SERIAL_MAX + 1U)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    status = x509_parse_alg(&v, end, x509_alg_ecdsa_sha256, sizeof(x509_alg_ecdsa_sha256));
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    cert->issuer = v;
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &s, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    cert->issuer_len = (size_t)(v - cert->issuer);
+
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &validity, &len) ||
+        !x509_parse_time(&validity, validity + len, &cert->not_before) ||
+        !x509_parse_time(&validity, v, &cert->not_after) || (validity != v))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    cert->subject = v;
+    if (!x509_der_get(&v, end, X509_TAG_SEQUENCE, &s, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    cert->subject_len = (size_t)(v - cert->subject);
+
+    status = x509_parse_spki(&v, end, cert);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    if (x509_der_peek(v, end, X509_TAG_ISSUER_UID) && !x509_der_get(&v, end, X509_TAG_ISSUER_UID, &s, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (x509_der_peek(v, end, X509_TAG_SUBJECT_UID) && !x509_der_get(&v, end, X509_TAG_SUBJECT_UID, &s, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (x509_der_peek(v, end, X509_TAG_EXTENSIONS))
+    {
+        if (!x509_der_get(&v, end, X509_TAG_EXTENSIONS, &s, &len))
+        {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        status = x509_parse_extensions(s, s + len, cert);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return (v == end) ? PSA_SUCCESS : PSA_ERROR_INVALID_ARGUMENT;
+}
+
+psa_status_t x509_parse(const uint8_t *der, size_t der_len, x509_cert_t *cert)
+{
+    const uint8_t *p = der;
+    const uint8_t *end = der + der_len;
+    const uint8_t *v;
+    const uint8_t *v_end;
+    const uint8_t *tbs;
+    const uint8_t *bits;
+    size_t len;
+    psa_status_t status;
+
+    if ((der == NULL) || (cert == NULL))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    memset(cert, 0, sizeof(*cert));
+    cert->path_len = X509_PATH_LEN_NONE;
+    cert->key_usage = X509_KU_ANY;
+
+    if (!x509_der_get(&p, end, X509_TAG_SEQUENCE, &v, &len) || (p != end))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    v_end = v + len;
+    cert->der = der;
+    cert->der_len = der_len;
+
+    cert->tbs = v;
+    if (!x509_der_get(&v, v_end, X509_TAG_SEQUENCE, &tbs, &len))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    cert->tbs_len = (size_t)(v - cert->tbs);
+    status = x509_parse_tbs(tbs, tbs + len, cert);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = x509_parse_alg(&v, v_end, x509_alg_ecdsa_sha256, sizeof(x509_alg_ecdsa_sha256));
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (!x509_der_get(&v, v_end, X509_TAG_BIT_STRING, &bits, &len) || (v != v_end) ||
+        (len < 2U) || (bits[0] != 0U))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    cert->signature = &bits[1];
+    cert->signature_len = len - 1U;
+    return PSA_SUCCESS;
+}
+
+/** @brief Verify-only P-256 key for certificate signatures */
+static psa_status_t x509_chain_import(const uint8_t *public_key, psa_key_id_t *key)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_VERIFY_HASH);
+    psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+    psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1));
+    psa_set_key_bits(&attributes, 256U);
+    return psa_import_key(&attributes, public_key, X509_PUBLIC_KEY_SIZE, key);
+}
+
+/** @brief Check the signature on @p cert with its issuer's @p key */
+static psa_status_t x509_chain_check_signature(x509_chain_t *chain, const x509_cert_t *cert, psa_key_id_t key)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t raw[2U * X509_COORD_SIZE];
+    psa_status_t status;
+
+    status = ecdsa_der_to_raw(cert->signature, cert->signature_len, X509_COORD_SIZE, raw, sizeof(raw));
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    status = crypto_dispatch_sha256(cert->tbs, cert->tbs_len, digest);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    chain->stats.signatures++;
+    return psa_verify_hash(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), digest, sizeof(digest), raw, sizeof(raw));
+}
+
+static bool x509_valid_at(const x509_cert_t *cert, uint64_t now)
+{
+    return (now == 0U) || ((now >= cert->not_before) && (now <= cert->not_after));
+}
+
+/** @brief Validity period and revocation hook */
+static psa_status_t x509_chain_check_cert(x509_chain_t *chain, const x509_cert_t *cert, uint64_t now)
+{
+    if (!x509_valid_at(cert, now))
+    {
+        return PSA_ERROR_NOT_PERMITTED;
+    }
+    if ((chain->config.revoked != NULL) && chain->config.revoked(chain->config.revoked_arg, cert))
+    {
+        chain->stats.revoked++;
+        return PSA_ERROR_NOT_PERMITTED;
+    }
+    return PSA_SUCCESS;
+}
+
+/** @brief Issuer name matches and, where both are present, key identifiers too */
+static bool x509_issued_by(const x509_cert_t *cert, const x509_cert_t *issuer)
+{
+    if ((cert->issuer_len != issuer->subject_len) ||
+        (memcmp(cert->issuer, issuer->subject, cert->issuer_len) != 0))
+    {
+        return false;
+    }
+    if ((cert->aki != NULL) && (issuer->ski != NULL))
+    {
+        return (cert->aki_len == issuer->ski_len) && (memcmp(cert->aki, issuer->ski, cert->aki_len) == 0);
+    }
+    return true;
+}
+
+/** @brief May @p issuer sign certificates with @p below intermediates under it? */
+static bool x509_may_issue(const x509_cert_t *issuer, uint32_t below)
+{
+    return issuer->ca && ((issuer->key_usage & X509_KU_KEY_CERT_SIGN) != 0U) &&
+           ((issuer->path_len == X509_PATH_LEN_NONE) || (below <= (uint32_t)issuer->path_len));
+}
+
+static void x509_chain_cache_drop(x509_chain_cache_entry_t *entry)
+{
+    (void)psa_destroy_key(entry->key);
+    memset(entry, 0, sizeof(*entry));
+}
+
+/** @brief Live entry for key identifier @p ski; expired entries are dropped */
+static x509_chain_cache_entry_t *x509_chain_cache_find(x509_chain_t *chain, const uint8_t *ski,
+                                                       size_t ski_len, uint64_t now)
+{
+    if ((ski == NULL) || (ski_len > X509_KEY_ID_MAX))
+    {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < X509_CHAIN_CACHE_ENTRIES; i++)
+    {
+        x509_chain_cache_entry_t *entry = &chain->cache[i];
+
+        if ((entry->key != PSA_KEY_ID_NULL) && (entry->ski_len == ski_len) &&
+            (memcmp(entry->ski, ski, ski_len) == 0))
+        {
+            if ((now != 0U) && (now > entry->expires))
+            {
+                chain->stats.cache_expired++;
+                x509_chain_cache_drop(entry);
+                return NULL;
+            }
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Cache a verified CA, taking over @p *key
+ *
+ * Replaces an entry with the same identifier, else uses a free slot, else
+ * the least recently used one. *@p key is PSA_KEY_ID_NULL afterwards if the
+ * entry now owns it. @p path_len is the number of intermediates still
+ * allowed below the CA, after the limits of every CA above it.
+ */
+static void x509_chain_cache_insert(x509_chain_t *chain, const x509_cert_t *cert, psa_key_id_t *key,
+                                    int32_t path_len, uint64_t expires)
+{
+    x509_chain_cache_entry_t *slot = NULL;
+
+    if ((cert->ski == NULL) || (cert->ski_len > X509_KEY_ID_MAX))
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < X509_CHAIN_CACHE_ENTRIES; i++)
+    {
+        x509_chain_cache_entry_t *entry = &chain->cache[i];
+
+        if ((entry->key != PSA_KEY_ID_NULL) && (entry->ski_len == cert->ski_len) &&
+            (memcmp(entry->ski, cert->ski, cert->ski_len) == 0))
+        {
+            slot = entry;
+            break;
+        }
+        /* First free slot, else the least recently used */
+        if ((slot == NULL) || ((slot->key != PSA_KEY_ID_NULL) &&
+                               ((entry->key == PSA_KEY_ID_NULL) || (entry->last_use < slot->last_use))))
+        {
+            slot = entry;
+        }
+    }
+
+    if (slot->key != PSA_KEY_ID_NULL)
+    {
+        x509_chain_cache_drop(slot);
+    }
+    slot->key = *key;
+    slot->ski_len = (uint8_t)cert->ski_len;
+    memcpy(slot->ski, cert->ski, cert->ski_len);
+    slot->path_len = path_len;
+    slot->expires = expires;
+    slot->last_use = chain->clock;
+    *key = PSA_KEY_ID_NULL;
+    chain->stats.cache_inserts++;
+}
+
+psa_status_t x509_chain_init(x509_chain_t *chain, const x509_chain_config_t *config)
+{
+    psa_status_t status;
+
+    if ((chain == NULL) || (config == NULL) || (config->root == NULL))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    memset(chain, 0, sizeof(*chain));
+    chain->config = *config;
+
+    status = x509_parse(config->root, config->root_len, &chain->root);
+    if (status == PSA_SUCCESS)
+    {
+        status = x509_chain_import(chain->root.public_key, &chain->root_key);
+    }
+    return status;
+}
+
+psa_status_t x509_chain_verify(x509_chain_t *chain, const uint8_t *const *certs, const size_t *lens,
+                               size_t count, uint64_t now, x509_cert_t *leaf)
+{
+    x509_cert_t cert[X509_CHAIN_DEPTH_MAX];
+    psa_key_id_t key[X509_CHAIN_DEPTH_MAX] = { PSA_KEY_ID_NULL };
+    x509_chain_cache_entry_t *entry = NULL;
+    uint64_t bound = UINT64_MAX;
+    int32_t allowed = X509_PATH_LEN_NONE;
+    uint32_t top = 0;
+    bool anchored = false;
+    psa_status_t status;
+
+    if ((chain == NULL) || (certs == NULL) || (lens == NULL) || (count == 0U) || (count > X509_CHAIN_DEPTH_MAX))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    chain->stats.chains++;
+    chain->clock++;
+
+    status = x509_parse(certs[0], lens[0], &cert[0]);
+
+    /* Walk up from the leaf: cert[top] is checked against a cached CA, the
+     * root, or the next certificate, whose key is imported into key[top + 1] */
+    while ((status == PSA_SUCCESS) && !anchored)
+    {
+        const x509_cert_t *c = &cert[top];
+
+        status = x509_chain_check_cert(chain, c, now);
+        if (status != PSA_SUCCESS)
+        {
+            break;
+        }
+
+        entry = x509_chain_cache_find(chain, c->aki, c->aki_len, now);
+        if (entry != NULL)
+        {
+            if ((entry->path_len != X509_PATH_LEN_NONE) && (top > (uint32_t)entry->path_len))
+            {
+                status = PSA_ERROR_NOT_PERMITTED;
+                break;
+            }
+            status = x509_chain_check_signature(chain, c, entry->key);
+            entry->last_use = chain->clock;
+            bound = entry->expires;
+            allowed = entry->path_len;
+            anchored = true;
+        }
+        else if (x509_issued_by(c, &chain->root))
+        {
+            if (!x509_may_issue(&chain->root, top) || !x509_valid_at(&chain->root, now))
+            {
+                status = PSA_ERROR_NOT_PERMITTED;
+                break;
+            }
+            status = x509_chain_check_signature(chain, c, chain->root_key);
+            bound = chain->root.not_after;
+            allowed = chain->root.path_len;
+            anchored = true;
+        }
+        else if ((top + 1U) < count)
+        {
+            x509_cert_t *issuer = &cert[top + 1U];
+
+            status = x509_parse(certs[top + 1U], lens[top + 1U], issuer);
+            if (status != PSA_SUCCESS)
+            {
+                break;
+            }
+            if (!x509_issued_by(c, issuer))
+            {
+                status = PSA_ERROR_INVALID_SIGNATURE;
+                break;
+            }
+            if (!x509_may_issue(issuer, top))
+            {
+                status = PSA_ERROR_NOT_PERMITTED;
+                break;
+            }
+            status = x509_chain_import(issuer->public_key, &key[top + 1U]);
+            if (status == PSA_SUCCESS)
+            {
+                status = x509_chain_check_signature(chain, c, key[top + 1U]);
+            }
+            top++;
+        }
+        else
+        {
+            status = PSA_ERROR_INVALID_SIGNATURE;   /* Does not reach the root */
+        }
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        chain->stats.accepted++;
+        if (entry != NULL)
+        {
+            chain->stats.cache_hits++;
+        }
+        /* Cache the new intermediates from the top down; each expires with
+         * the first certificate above it and keeps the tightest path length
+         * limit above it, so a later chain through it is held to the same
+         * limits as this one */
+        for (uint32_t i = top; i >= 1U; i--)
+        {
+            uint64_t expires;
+
+            if (cert[i].not_after < bound)
+            {
+                bound = cert[i].not_after;
+            }
+            if (allowed != X509_PATH_LEN_NONE)
+            {
+                allowed--;          /* cert[i] itself; the walk checked this stays >= 0 */
+            }
+            if ((cert[i].path_len != X509_PATH_LEN_NONE) &&
+                ((allowed == X509_PATH_LEN_NONE) || (cert[i].path_len < allowed)))
+            {
+                allowed = cert[i].path_len;
+            }
+            expires = bound;
+            if ((now != 0U) && ((now + chain->config.ttl) < expires))
+            {
+                expires = now + chain->config.ttl;
+            }
+            x509_chain_cache_insert(chain, &cert[i], &key[i], allowed, expires);
+        }
+        if (leaf != NULL)
+        {
+            *leaf = cert[0];
+        }
+    }
+
+    for (uint32_t i = 1U; i < X509_CHAIN_DEPTH_MAX; i++)
+    {
+        if (key[i] != PSA_KEY_ID_NULL)
+        {
+            (void)psa_destroy_key(key[i]);
+        }
+    }
+    return status;
+}
+
+bool x509_chain_revoke(x509_chain_t *chain, const uint8_t *ski, size_t ski_len)
+{
+    x509_chain_cache_entry_t *entry = x509_chain_cache_find(chain, ski, ski_len, 0U);
+
+    if (entry == NULL)
+    {
+        return false;
+    }
+    x509_chain_cache_drop(entry);
+    return true;
+}
+
+void x509_chain_flush(x509_chain_t *chain)
+{
+    for (uint32_t i = 0; i < X509_CHAIN_CACHE_ENTRIES; i++)
+    {
+        if (chain->cache[i].key != PSA_KEY_ID_NULL)
+        {
+            x509_chain_cache_drop(&chain->cache[i]);
+        }
+    }
+}
+
+void x509_chain_deinit(x509_chain_t *chain)
+{
+    x509_chain_flush(chain);
+    if (chain->root_key != PSA_KEY_ID_NULL)
+    {
+        (void)psa_destroy_key(chain->root_key);
+        chain->root_key = PSA_KEY_ID_NULL;
+    }
+}
+
+/* [] END OF FILE */
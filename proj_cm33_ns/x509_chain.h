@@ -0,0 +1,252 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : X.509 chain verification
+ * Purpose : Check peer certificate chains (leaf, intermediates) against a
+ *           trusted root, without verifying the same intermediate again
+ *           for every new leaf.
+ * Design  : Certificates are parsed in place (no copies, no allocation)
+ *           with strict DER rules; only ECDSA P-256 / SHA-256 certificates
+ *           are accepted. Each signature is checked with psa_verify_hash()
+ *           over the SHA-256 of the TBS bytes, computed on this core.
+ *           Issuer and subject names are compared byte for byte.
+ *
+ *           After a chain verifies, each intermediate CA is kept in a cache
+ *           of X509_CHAIN_CACHE_ENTRIES entries indexed by its subject key
+ *           identifier, together with its imported PSA key. A later leaf
+ *           whose authority key identifier matches a live entry is checked
+ *           with that key alone: one signature instead of one per level. An
+ *           entry expires at the earliest notAfter on its path to the root,
+ *           or ttl after it was verified, whichever comes first; the least
+ *           recently used entry is replaced when the cache is full. It also
+ *           keeps the tightest pathLenConstraint on that path, so a chain
+ *           that ends at a cached CA is no longer than the root allows.
+ *
+ *           Revocation: the application's revoked() hook sees every
+ *           certificate whose signature is checked, and
+ *           x509_chain_revoke() drops a cached CA at once (e.g. when a CRL
+ *           update lists it). The ttl bounds how long a cached CA escapes
+ *           the hook. Time is UTC seconds since 1970 supplied by the
+ *           caller; 0 means no trusted time yet, validity periods and cache
+ *           expiry are then not checked.
+ ********************************************************************************
+ * @file    x509_chain.h
+ * @brief   X.509 chain verification with a verified-intermediate cache
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef X509_CHAIN_H
+#define X509_CHAIN_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Cached intermediate CAs */
+#ifndef X509_CHAIN_CACHE_ENTRIES
+#define X509_CHAIN_CACHE_ENTRIES      (8U)
+#endif
+
+/** @brief Certificates in a chain passed to x509_chain_verify() */
+#ifndef X509_CHAIN_DEPTH_MAX
+#define X509_CHAIN_DEPTH_MAX          (4U)
+#endif
+
+/** @brief Longest key identifier kept in the cache */
+#define X509_KEY_ID_MAX               (20U)
+
+/** @brief Uncompressed P-256 public key */
+#define X509_PUBLIC_KEY_SIZE          (65U)
+
+/** @brief x509_cert_t::key_usage bits (RFC 5280 KeyUsage bit numbers) */
+#define X509_KU_DIGITAL_SIGNATURE     (1UL << 0)
+#define X509_KU_KEY_CERT_SIGN         (1UL << 5)
+#define X509_KU_CRL_SIGN              (1UL << 6)
+#define X509_KU_ANY                   (0xFFFFUL)  /**< No keyUsage extension */
+
+/** @brief x509_cert_t::path_len when basicConstraints sets no limit */
+#define X509_PATH_LEN_NONE            (-1)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Parsed certificate; all pointers point into the DER input */
+typedef struct
+{
+    const uint8_t *der;                 /**< Whole certificate              */
+    size_t         der_len;
+    const uint8_t *tbs;                 /**< Signed part, tag and length included */
+    size_t         tbs_len;
+    const uint8_t *serial;              /**< INTEGER contents               */
+    size_t         serial_len;
+    const uint8_t *issuer;              /**< Name, tag and length included  */
+    size_t         issuer_len;
+    const uint8_t *subject;
+    size_t         subject_len;
+    uint64_t       not_before;          /**< UTC seconds since 1970         */
+    uint64_t       not_after;
+    const uint8_t *public_key;          /**< X509_PUBLIC_KEY_SIZE bytes     */
+    const uint8_t *ski;                 /**< Subject key identifier, or NULL */
+    size_t         ski_len;
+    const uint8_t *aki;                 /**< Authority key identifier, or NULL */
+    size_t         aki_len;
+    const uint8_t *signature;           /**< DER ECDSA-Sig-Value            */
+    size_t         signature_len;
+    bool           ca;                  /**< basicConstraints cA            */
+    int32_t        path_len;            /**< pathLenConstraint or X509_PATH_LEN_NONE */
+    uint32_t       key_usage;           /**< X509_KU_* bits                 */
+} x509_cert_t;
+
+/**
+ * @brief Revocation hook
+ *
+ * @param[in] arg   Caller context
+ * @param[in] cert  Certificate about to be accepted
+ *
+ * @return true if @p cert is revoked
+ */
+typedef bool (*x509_revoked_fn_t)(void *arg, const x509_cert_t *cert);
+
+/** @brief Verifier configuration */
+typedef struct
+{
+    const uint8_t     *root;            /**< Trusted root certificate, DER; must stay valid */
+    size_t             root_len;
+    uint32_t           ttl;             /**< Seconds a cached CA is trusted without a re-check */
+    x509_revoked_fn_t  revoked;         /**< Revocation hook, or NULL       */
+    void              *revoked_arg;
+} x509_chain_config_t;
+
+/** @brief Cached intermediate CA */
+typedef struct
+{
+    psa_key_id_t key;                   /**< PSA_KEY_ID_NULL: free slot     */
+    uint8_t      ski_len;
+    uint8_t      ski[X509_KEY_ID_MAX];
+    int32_t      path_len;              /**< Intermediates still allowed below,
+                                             tightened by every CA above it, or
+                                             X509_PATH_LEN_NONE             */
+    uint64_t     expires;               /**< Last second the entry is used  */
+    uint32_t     last_use;
+} x509_chain_cache_entry_t;
+
+/** @brief Counters since x509_chain_init() */
+typedef struct
+{
+    uint32_t chains;                    /**< x509_chain_verify() calls      */
+    uint32_t accepted;
+    uint32_t signatures;                /**< psa_verify_hash() calls        */
+    uint32_t cache_hits;                /**< Chains ended at a cached CA    */
+    uint32_t cache_inserts;
+    uint32_t cache_expired;             /**< Live entries found past expiry */
+    uint32_t revoked;                   /**< Rejected by the hook           */
+} x509_chain_stats_t;
+
+/** @brief Verifier state */
+typedef struct
+{
+    x509_chain_config_t      config;
+    x509_cert_t              root;
+    psa_key_id_t             root_key;
+    uint32_t                 clock;     /**< Verification counter for LRU   */
+    x509_chain_stats_t       stats;
+    x509_chain_cache_entry_t cache[X509_CHAIN_CACHE_ENTRIES];
+} x509_chain_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Parse a DER certificate
+ *
+ * @param[in]  der      Certificate, exactly @p der_len bytes; must outlive @p cert
+ * @param[in]  der_len  Length of @p der
+ * @param[out] cert     Fields
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_ARGUMENT for malformed DER, or
+ *         PSA_ERROR_NOT_SUPPORTED for another algorithm or curve, or an
+ *         unknown critical extension
+ */
+psa_status_t x509_parse(const uint8_t *der, size_t der_len, x509_cert_t *cert);
+
+/**
+ * @brief Set up a verifier with an empty cache
+ *
+ * @return PSA_SUCCESS, an x509_parse() error for the root, or the import error
+ */
+psa_status_t x509_chain_init(x509_chain_t *chain, const x509_chain_config_t *config);
+
+/**
+ * @brief Verify a certificate chain up to the root
+ *
+ * The chain may stop at any CA that is cached; the remaining certificates
+ * are then not looked at. A root certificate at the end of @p certs is
+ * ignored. Intermediates are cached only once the whole chain verified.
+ *
+ * @param[in]  certs  DER certificates, leaf first, each signed by the next
+ * @param[in]  lens   Length of each certificate
+ * @param[in]  count  1..X509_CHAIN_DEPTH_MAX
+ * @param[in]  now    UTC seconds since 1970, or 0 without trusted time
+ * @param[out] leaf   Parsed leaf, or NULL
+ *
+ * @return PSA_SUCCESS, PSA_ERROR_INVALID_SIGNATURE for a bad signature or
+ *         a chain that does not reach the root, PSA_ERROR_NOT_PERMITTED for
+ *         an expired, not yet valid or revoked certificate, an issuer that
+ *         is not a CA or a path that is too long, an x509_parse() error, or
+ *         a PSA error
+ */
+psa_status_t x509_chain_verify(x509_chain_t *chain, const uint8_t *const *certs, const size_t *lens,
+                               size_t count, uint64_t now, x509_cert_t *leaf);
+
+/**
+ * @brief Drop a cached CA, e.g. after it was revoked
+ *
+ * @return true if an entry was removed
+ */
+bool x509_chain_revoke(x509_chain_t *chain, const uint8_t *ski, size_t ski_len);
+
+/** @brief Drop all cached CAs; counters are kept */
+void x509_chain_flush(x509_chain_t *chain);
+
+/** @brief Destroy the root and cached keys */
+void x509_chain_deinit(x509_chain_t *chain);
+
+/** @brief UTC seconds since 1970 of a calendar date and time */
+uint64_t x509_time_from_date(uint32_t year, uint32_t month, uint32_t day,
+                             uint32_t hour, uint32_t minute, uint32_t second);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* X509_CHAIN_H */
+/* [] END OF FILE */
@@ -0,0 +1,170 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Demo certificate chain
+ * Purpose : DER bytes of the demo chain.
+ ********************************************************************************
+ * @file    x509_demo_certs.c
+ * @brief   Demo root, intermediate and leaf certificates
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "x509_demo_certs.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/** @brief Root CA "TESA Demo Root CA", self-signed, pathLen unlimited */
+const uint8_t x509_demo_root[] =
+{
+    0x30, 0x82, 0x01, 0x87, 0x30, 0x82, 0x01, 0x2D, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01,
+    0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x30, 0x2B, 0x31, 0x0D,
+    0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x1A, 0x30,
+    0x18, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x11, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44, 0x65, 0x6D,
+    0x6F, 0x20, 0x52, 0x6F, 0x6F, 0x74, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36, 0x31,
+    0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x36, 0x5A, 0x17, 0x0D, 0x34, 0x36, 0x31, 0x30,
+    0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x36, 0x5A, 0x30, 0x2B, 0x31, 0x0D, 0x30, 0x0B, 0x06,
+    0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x1A, 0x30, 0x18, 0x06, 0x03,
+    0x55, 0x04, 0x03, 0x0C, 0x11, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x20, 0x52,
+    0x6F, 0x6F, 0x74, 0x20, 0x43, 0x41, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE,
+    0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00,
+    0x04, 0xA8, 0x72, 0x43, 0xF6, 0x92, 0x1F, 0xA3, 0x6D, 0x09, 0xDE, 0x3F, 0xFC, 0x0A, 0x78, 0x9E,
+    0x4B, 0x64, 0xB2, 0x4F, 0x1E, 0xBB, 0x47, 0x73, 0xAB, 0xF8, 0x3E, 0x4F, 0xA9, 0x89, 0xC6, 0x64,
+    0x66, 0x58, 0x16, 0x9B, 0xD8, 0x14, 0xAF, 0x5C, 0x25, 0x4B, 0x89, 0x4C, 0xA3, 0x13, 0xE7, 0x43,
+    0x21, 0x8D, 0x43, 0x86, 0x94, 0xBD, 0xA1, 0x21, 0x7C, 0x6B, 0xDF, 0x89, 0x69, 0x29, 0x56, 0x74,
+    0x32, 0xA3, 0x42, 0x30, 0x40, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04,
+    0x05, 0x30, 0x03, 0x01, 0x01, 0xFF, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF,
+    0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04,
+    0x14, 0x4F, 0xF4, 0x1F, 0x14, 0x16, 0xDD, 0xAF, 0x08, 0x9D, 0x54, 0x9A, 0xB8, 0x17, 0x15, 0xEF,
+    0x86, 0x14, 0x2C, 0x72, 0x14, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03,
+    0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x35, 0x12, 0x97, 0x8D, 0x40, 0x4E, 0xBA, 0x51,
+    0x97, 0x18, 0xB5, 0xB7, 0xC7, 0x81, 0x08, 0x62, 0x9C, 0x9A, 0x08, 0x77, 0xB5, 0xFC, 0xF9, 0x1E,
+    0xC1, 0x4C, 0x38, 0xD3, 0xCE, 0x8C, 0x29, 0x8B, 0x02, 0x21, 0x00, 0xC3, 0x06, 0x5E, 0x75, 0x71,
+    0xA5, 0x6E, 0x73, 0x02, 0xD1, 0x63, 0x46, 0x85, 0x81, 0x2C, 0x83, 0xFF, 0x5F, 0x00, 0xE3, 0x9A,
+    0x1A, 0x11, 0xA2, 0x06, 0xF0, 0x3A, 0xF6, 0x0A, 0x82, 0x34, 0x38
+};
+
+const size_t x509_demo_root_len = sizeof(x509_demo_root);
+
+/** @brief Intermediate "TESA Demo Device CA", pathLen 0, signed by the root */
+const uint8_t x509_demo_intermediate[] =
+{
+    0x30, 0x82, 0x01, 0xAE, 0x30, 0x82, 0x01, 0x54, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x10,
+    0x01, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x30, 0x2B, 0x31,
+    0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x1A,
+    0x30, 0x18, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x11, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44, 0x65,
+    0x6D, 0x6F, 0x20, 0x52, 0x6F, 0x6F, 0x74, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36,
+    0x31, 0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x17, 0x0D, 0x33, 0x36, 0x31,
+    0x30, 0x31, 0x38, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x30, 0x2D, 0x31, 0x0D, 0x30, 0x0B,
+    0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x1C, 0x30, 0x1A, 0x06,
+    0x03, 0x55, 0x04, 0x03, 0x0C, 0x13, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x20,
+    0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x43, 0x41, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A,
+    0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07,
+    0x03, 0x42, 0x00, 0x04, 0xFE, 0xFD, 0xB0, 0xE5, 0xB5, 0xEE, 0xFE, 0x77, 0xE3, 0x31, 0x42, 0xED,
+    0x14, 0xEF, 0x8F, 0xE3, 0x4B, 0x27, 0xA7, 0x71, 0xD0, 0x04, 0xDD, 0xEF, 0xAF, 0x07, 0xBB, 0xDA,
+    0xE8, 0x88, 0x05, 0x38, 0x9B, 0x54, 0xC1, 0x2B, 0x0B, 0x58, 0x0E, 0x42, 0x04, 0x7D, 0x57, 0xF3,
+    0x61, 0xB7, 0x34, 0x9A, 0x8B, 0xBF, 0xD3, 0x1B, 0x84, 0xE1, 0x66, 0xA6, 0x4A, 0xCB, 0x4D, 0xD6,
+    0xE9, 0x26, 0x06, 0x6D, 0xA3, 0x66, 0x30, 0x64, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01,
+    0x01, 0xFF, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x30, 0x0E, 0x06, 0x03,
+    0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x1D, 0x06, 0x03,
+    0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x86, 0xB0, 0xCD, 0x0D, 0xC0, 0x47, 0xB2, 0x95, 0x3A,
+    0x08, 0xB7, 0xA3, 0x11, 0xF9, 0x88, 0x89, 0x69, 0x58, 0x0D, 0xE7, 0x30, 0x1F, 0x06, 0x03, 0x55,
+    0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x4F, 0xF4, 0x1F, 0x14, 0x16, 0xDD, 0xAF, 0x08,
+    0x9D, 0x54, 0x9A, 0xB8, 0x17, 0x15, 0xEF, 0x86, 0x14, 0x2C, 0x72, 0x14, 0x30, 0x0A, 0x06, 0x08,
+    0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x21, 0x00,
+    0xEB, 0x9A, 0x2B, 0x5A, 0x1F, 0x03, 0x9B, 0x94, 0x75, 0x75, 0xB1, 0x77, 0xEE, 0x99, 0xB5, 0x77,
+    0x65, 0x30, 0xB3, 0x1D, 0xD5, 0x11, 0x86, 0x6C, 0xDE, 0x7A, 0xE5, 0xCF, 0x07, 0xA3, 0xB1, 0x63,
+    0x02, 0x20, 0x5F, 0x9A, 0x08, 0x7A, 0x9B, 0x56, 0x52, 0x88, 0xD5, 0xB0, 0x6C, 0x1F, 0x3E, 0xA9,
+    0x60, 0x69, 0x01, 0xA0, 0x75, 0xAE, 0x97, 0xF0, 0x6E, 0xBC, 0x7E, 0xAA, 0x8D, 0xCF, 0xC1, 0x9C,
+    0x72, 0xCF
+};
+
+const size_t x509_demo_intermediate_len = sizeof(x509_demo_intermediate);
+
+/** @brief Device "psoc-edge-0001", signed by the intermediate */
+const uint8_t x509_demo_leaf1[] =
+{
+    0x30, 0x82, 0x01, 0xBB, 0x30, 0x82, 0x01, 0x61, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x20,
+    0x00, 0x01, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x30, 0x2D,
+    0x31, 0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31,
+    0x1C, 0x30, 0x1A, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x13, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44,
+    0x65, 0x6D, 0x6F, 0x20, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17,
+    0x0D, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x17, 0x0D,
+    0x33, 0x31, 0x31, 0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x30, 0x28, 0x31,
+    0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x17,
+    0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x0E, 0x70, 0x73, 0x6F, 0x63, 0x2D, 0x65, 0x64,
+    0x67, 0x65, 0x2D, 0x30, 0x30, 0x30, 0x31, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48,
+    0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42,
+    0x00, 0x04, 0xA2, 0x07, 0x36, 0xA7, 0xB7, 0x41, 0x13, 0x12, 0x52, 0x59, 0x1E, 0xD3, 0x5F, 0x7A,
+    0x6C, 0x30, 0x47, 0x8E, 0x12, 0x12, 0x77, 0x9B, 0xC7, 0x67, 0x23, 0x99, 0x1D, 0x1D, 0xC0, 0x71,
+    0xA5, 0xF8, 0xB9, 0x4B, 0x64, 0x08, 0xE0, 0x2B, 0x6C, 0x91, 0x36, 0x5E, 0x3D, 0xBB, 0x60, 0xDC,
+    0x6F, 0xBC, 0xF8, 0xA6, 0x17, 0xB3, 0x92, 0xAF, 0x53, 0x6D, 0x9F, 0x6A, 0xD8, 0x4B, 0xA3, 0x39,
+    0x0C, 0x17, 0xA3, 0x75, 0x30, 0x73, 0x30, 0x0C, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF,
+    0x04, 0x02, 0x30, 0x00, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04,
+    0x03, 0x02, 0x07, 0x80, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30, 0x0A, 0x06,
+    0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x02, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E,
+    0x04, 0x16, 0x04, 0x14, 0x1E, 0x89, 0x7B, 0x07, 0xAA, 0xC0, 0x88, 0x39, 0x38, 0xB9, 0xEE, 0xE7,
+    0xFE, 0x06, 0xF1, 0xF8, 0xFC, 0x3E, 0x30, 0x41, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04,
+    0x18, 0x30, 0x16, 0x80, 0x14, 0x86, 0xB0, 0xCD, 0x0D, 0xC0, 0x47, 0xB2, 0x95, 0x3A, 0x08, 0xB7,
+    0xA3, 0x11, 0xF9, 0x88, 0x89, 0x69, 0x58, 0x0D, 0xE7, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48,
+    0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x21, 0x00, 0xEC, 0xF3, 0x47,
+    0x39, 0xEC, 0xD8, 0x1D, 0xDA, 0x70, 0x26, 0x53, 0xA6, 0x57, 0xDF, 0x58, 0x94, 0x14, 0x10, 0x8C,
+    0xDD, 0x29, 0x85, 0x74, 0x96, 0x27, 0x70, 0xFB, 0x76, 0x29, 0x62, 0x70, 0xEF, 0x02, 0x20, 0x53,
+    0xA2, 0x9A, 0x4D, 0x45, 0x8E, 0xF7, 0xBC, 0xD1, 0xA8, 0x64, 0xDD, 0x91, 0x9D, 0x93, 0xC8, 0x4A,
+    0x77, 0x2A, 0xA1, 0x0A, 0x7A, 0xBA, 0x47, 0xCE, 0x00, 0xBA, 0x4A, 0x12, 0xB7, 0xF0, 0xFD
+};
+
+const size_t x509_demo_leaf1_len = sizeof(x509_demo_leaf1);
+
+/** @brief Device "psoc-edge-0002", signed by the intermediate */
+const uint8_t x509_demo_leaf2[] =
+{
+    0x30, 0x82, 0x01, 0xBB, 0x30, 0x82, 0x01, 0x61, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x20,
+    0x00, 0x02, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x30, 0x2D,
+    0x31, 0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31,
+    0x1C, 0x30, 0x1A, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x13, 0x54, 0x45, 0x53, 0x41, 0x20, 0x44,
+    0x65, 0x6D, 0x6F, 0x20, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17,
+    0x0D, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x17, 0x0D,
+    0x33, 0x31, 0x31, 0x30, 0x31, 0x39, 0x31, 0x31, 0x33, 0x39, 0x30, 0x39, 0x5A, 0x30, 0x28, 0x31,
+    0x0D, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x0C, 0x04, 0x54, 0x45, 0x53, 0x41, 0x31, 0x17,
+    0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x0E, 0x70, 0x73, 0x6F, 0x63, 0x2D, 0x65, 0x64,
+    0x67, 0x65, 0x2D, 0x30, 0x30, 0x30, 0x32, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48,
+    0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42,
+    0x00, 0x04, 0x62, 0x9D, 0x56, 0xBC, 0x92, 0x2E, 0xE4, 0xC8, 0xFB, 0x5B, 0xA6, 0x41, 0xDF, 0xBA,
+    0xCB, 0x51, 0xAD, 0xDF, 0xD9, 0x53, 0x67, 0xD1, 0x8E, 0x76, 0xE3, 0x7F, 0xE0, 0x6B, 0xDF, 0x6B,
+    0xB9, 0xB8, 0x24, 0x1A, 0x0F, 0xDB, 0x4E, 0x6F, 0xD2, 0x76, 0xC5, 0xD5, 0x37, 0x4B, 0xD7, 0xA0,
+    0x0F, 0x77, 0x23, 0x77, 0xF2, 0xC8, 0xE7, 0x41, 0x26, 0xAC, 0x88, 0xAF, 0x52, 0xE4, 0xB0, 0xE4,
+    0xE2, 0xB3, 0xA3, 0x75, 0x30, 0x73, 0x30, 0x0C, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF,
+    0x04, 0x02, 0x30, 0x00, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04,
+    0x03, 0x02, 0x07, 0x80, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30, 0x0A, 0x06,
+    0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x02, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E,
+    0x04, 0x16, 0x04, 0x14, 0xCD, 0xBD, 0x56, 0x3C, 0xB7, 0x70, 0x72, 0x41, 0x33, 0x00, 0x89, 0x0D,
+    0xB0, 0xC7, 0xF4, 0xED, 0xAF, 0x1B, 0x6A, 0x7D, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04,
+    0x18, 0x30, 0x16, 0x80, 0x14, 0x86, 0xB0, 0xCD, 0x0D, 0xC0, 0x47, 0xB2, 0x95, 0x3A, 0x08, 0xB7,
+    0xA3, 0x11, 0xF9, 0x88, 0x89, 0x69, 0x58, 0x0D, 0xE7, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48,
+    0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x6A, 0xB9, 0x46, 0xB6,
+    0x9B, 0xE1, 0xE3, 0x4B, 0xE7, 0xB5, 0x0A, 0x3B, 0x02, 0x00, 0xB3, 0x81, 0x07, 0x60, 0x25, 0xEF,
+    0x86, 0xDD, 0xC7, 0x79, 0x4C, 0xEC, 0x50, 0x04, 0x70, 0xCE, 0x2A, 0x1A, 0x02, 0x21, 0x00, 0xF8,
+    0xD7, 0x6F, 0xE7, 0x9D, 0xCC, 0x31, 0x9D, 0x17, 0xB6, 0x61, 0x09, 0xAE, 0x2F, 0x04, 0x0B, 0x1E,
+    0x4E, 0x14, 0x27, 0xC0, 0x3F, 0x79, 0x5C, 0xC5, 0xA3, 0xC1, 0x7B, 0xA8, 0xB8, 0x18, 0xFF
+};
+
+const size_t x509_demo_leaf2_len = sizeof(x509_demo_leaf2);
+
+/* [] END OF FILE */
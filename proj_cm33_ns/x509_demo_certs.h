@@ -0,0 +1,62 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Demo certificate chain
+ * Purpose : A three-level ECDSA P-256 chain (root, intermediate, two
+ *           device leaves) for the X.509 chain verification demo.
+ * Design  : Generated with OpenSSL (prime256v1, ecdsa-with-SHA256), DER.
+ *           Root valid 2026-10-19 to 2046-10-19, intermediate to
+ *           2036-10-18 with pathLen 0, leaves to 2031-10-19. All carry
+ *           subject and authority key identifiers; the keys are not in
+ *           the firmware. Demo material only, never a production trust
+ *           anchor.
+ ********************************************************************************
+ * @file    x509_demo_certs.h
+ * @brief   Demo root, intermediate and leaf certificates
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef X509_DEMO_CERTS_H
+#define X509_DEMO_CERTS_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+extern const uint8_t x509_demo_root[];
+extern const size_t  x509_demo_root_len;
+extern const uint8_t x509_demo_intermediate[];
+extern const size_t  x509_demo_intermediate_len;
+extern const uint8_t x509_demo_leaf1[];
+extern const size_t  x509_demo_leaf1_len;
+extern const uint8_t x509_demo_leaf2[];
+extern const size_t  x509_demo_leaf2_len;
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* X509_DEMO_CERTS_H */
+/* [] END OF FILE */
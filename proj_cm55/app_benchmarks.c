@@ -0,0 +1,136 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CM55 boot benchmarks
+ * Purpose : Measure shared_cache maintenance by range against whole-cache
+ *           maintenance for buffers of 1 KB to 32 KB.
+ * Design  : Each measurement first writes the whole buffer, so all its
+ *           lines are dirty, as they are when a request buffer is handed
+ *           over. The whole-cache operation then also walks every set and
+ *           way, which is its real cost. Each figure is the mean of
+ *           APP_CACHE_BENCH_ROUNDS runs, timed with the DWT cycle counter.
+ ********************************************************************************
+ * @file    app_benchmarks.c
+ * @brief   Boot-time benchmarks of the CM55 application modules
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "app_benchmarks.h"
+
+#if (APP_BENCHMARKS)
+
+#include <string.h>
+
+#include "cycle_counter.h"
+#include "shared_cache.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define APP_CACHE_BENCH_ROUNDS        (8U)
+#define APP_CACHE_BENCH_MAX_BYTES     ((1024UL) << (APP_CACHE_BENCH_SIZES - 1U))
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef enum
+{
+    BENCH_RANGE_CLEAN,
+    BENCH_ALL_CLEAN,
+    BENCH_RANGE_CLEAN_INVALIDATE,
+    BENCH_ALL_CLEAN_INVALIDATE
+} bench_op_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/* Results for the debugger */
+static volatile app_cache_benchmark_t cm55_cache_benchmark;
+
+static SHARED_CACHE_BUFFER(uint8_t, bench_buffer, APP_CACHE_BENCH_MAX_BYTES);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Mean cycles of one maintenance operation on a freshly dirtied buffer
+ */
+static uint32_t bench_cache_op(bench_op_t op, size_t len)
+{
+    uint64_t total = 0;
+    uint32_t start;
+
+    for (uint32_t round = 0; round < APP_CACHE_BENCH_ROUNDS; round++)
+    {
+        memset(bench_buffer, (int)round, len);
+        __DSB();
+
+        start = cycle_counter_read();
+        switch (op)
+        {
+            case BENCH_RANGE_CLEAN:
+                shared_cache_clean(bench_buffer, len);
+                break;
+            case BENCH_ALL_CLEAN:
+                shared_cache_clean_all();
+                break;
+            case BENCH_RANGE_CLEAN_INVALIDATE:
+                shared_cache_clean_invalidate(bench_buffer, len);
+                break;
+            default:
+                shared_cache_clean_invalidate_all();
+                break;
+        }
+        total += cycle_counter_read() - start;
+    }
+    return (uint32_t)(total / APP_CACHE_BENCH_ROUNDS);
+}
+
+void app_benchmarks_run(void)
+{
+    cycle_counter_init();
+    cm55_cache_benchmark.crossover_kb = 0;
+
+    for (uint32_t i = 0; i < APP_CACHE_BENCH_SIZES; i++)
+    {
+        size_t len = (size_t)1024U << i;
+        volatile app_cache_bench_t *result = &cm55_cache_benchmark.sizes[i];
+
+        result->size_kb = (uint32_t)(len / 1024U);
+        result->range_clean = bench_cache_op(BENCH_RANGE_CLEAN, len);
+        result->all_clean = bench_cache_op(BENCH_ALL_CLEAN, len);
+        result->range_clean_invalidate = bench_cache_op(BENCH_RANGE_CLEAN_INVALIDATE, len);
+        result->all_clean_invalidate = bench_cache_op(BENCH_ALL_CLEAN_INVALIDATE, len);
+
+        if ((cm55_cache_benchmark.crossover_kb == 0U) && (result->range_clean > result->all_clean))
+        {
+            cm55_cache_benchmark.crossover_kb = result->size_kb;
+        }
+    }
+}
+
+#endif /* (APP_BENCHMARKS) */
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CM55 boot benchmarks
+ * Purpose : Cost of D-cache maintenance by address range against the
+ *           whole-cache operations, per buffer size, run once at boot in a
+ *           BENCHMARK_BUILD=1 image. The CM55 has no console: the figures
+ *           are kept in cm55_cache_benchmark for the debugger.
+ ********************************************************************************
+ * @file    app_benchmarks.h
+ * @brief   Boot-time benchmarks of the CM55 application modules
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef APP_BENCHMARKS_H
+#define APP_BENCHMARKS_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Run the cache maintenance benchmark at boot (BENCHMARK_BUILD=1) */
+#ifndef APP_BENCHMARKS
+#define APP_BENCHMARKS                (0)
+#endif
+
+/** @brief Buffer sizes measured: 1 KB doubling up to 2^(n-1) KB */
+#define APP_CACHE_BENCH_SIZES         (6U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Mean cycles to hand over one dirty buffer of size_kb KB */
+typedef struct
+{
+    uint32_t size_kb;
+    uint32_t range_clean;             /**< shared_cache_clean()                  */
+    uint32_t all_clean;               /**< shared_cache_clean_all()              */
+    uint32_t range_clean_invalidate;  /**< shared_cache_clean_invalidate()       */
+    uint32_t all_clean_invalidate;    /**< shared_cache_clean_invalidate_all()   */
+} app_cache_bench_t;
+
+/** @brief Benchmark results; divide the cycle counts by size_kb for cost per KB */
+typedef struct
+{
+    app_cache_bench_t sizes[APP_CACHE_BENCH_SIZES];
+    uint32_t          crossover_kb;   /**< Smallest size where a range clean costs
+                                           more than a whole-cache clean, 0 if none.
+                                           Compare with SHARED_CACHE_RANGE_MAX.   */
+} app_cache_benchmark_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Run the benchmarks and store the figures in cm55_cache_benchmark
+ *
+ * Call with interrupts still disabled, so handlers do not disturb the
+ * cache or the timing.
+ */
+void app_benchmarks_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* APP_BENCHMARKS_H */
+/* [] END OF FILE */
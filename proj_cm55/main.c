@@ -40,6 +40,17 @@
 *******************************************************************************/
 
 #include "cybsp.h"
+#include "app_benchmarks.h"
+#include "srf_async.h"
+#include "stack_usage.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Peak stack and heap use, refreshed before each deep sleep. The CM55 has no
+ * console, so read it with the debugger. */
+static volatile stack_usage_t cm55_memory_usage;
 
 /*******************************************************************************
 * Function Name: main
@@ -48,7 +59,8 @@
 * This is the main function for CM55 application. 
 * 
 * CM33 application enables the CM55 CPU and then the CM55 CPU enters 
-* deep sleep.
+* deep sleep. Secure requests queued through srf_async_submit() are
+* executed from the main loop before the CPU goes back to sleep.
 * 
 * Parameters:
 *  void
@@ -76,13 +88,34 @@ int main(void)
         while(true);
     }
 
+    /* Initialize the asynchronous secure request queue. */
+    srf_async_init();
+
+#if (APP_BENCHMARKS)
+    /* D-cache maintenance cost per KB, kept in cm55_cache_benchmark */
+    app_benchmarks_run();
+#endif
+
     /* Enable global interrupts. */
     __enable_irq();
 
-    /* Put the CPU to Deep Sleep. */
     for (;;)
     {
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        /* Drain queued secure requests, then put the CPU to Deep Sleep. */
+        while (srf_async_process())
+        {
+        }
+        stack_usage_get((stack_usage_t *)&cm55_memory_usage);
+
+        /* A request queued by an interrupt after the drain would otherwise
+         * wait for the next wakeup: check again with interrupts masked. WFI
+         * still wakes on a pending interrupt, which runs once unmasked. */
+        __disable_irq();
+        if (srf_async_pending() == 0U)
+        {
+            Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        }
+        __enable_irq();
     }
 }
 
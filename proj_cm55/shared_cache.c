@@ -0,0 +1,107 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Range-based D-cache maintenance for buffers shared with the CM33
+ * Purpose : Clean / invalidate only the cache lines covering a buffer.
+ ********************************************************************************
+ * @file    shared_cache.c
+ * @brief   Clean / invalidate by address range, aligned to D-cache lines
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include "shared_cache.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Widen [addr, addr + len) to whole cache lines
+ *
+ * @param[in,out] start  In: buffer start. Out: first line address.
+ * @param[in]     len    Buffer length
+ *
+ * @return Length of the widened range in bytes
+ */
+static int32_t shared_cache_line_range(uintptr_t *start, size_t len)
+{
+    uintptr_t first = *start & ~(uintptr_t)(SHARED_CACHE_LINE_SIZE - 1U);
+    uintptr_t end = SHARED_CACHE_ROUND_UP(*start + len);
+
+    *start = first;
+    return (int32_t)(end - first);
+}
+
+void shared_cache_clean(const void *addr, size_t len)
+{
+    uintptr_t start = (uintptr_t)addr;
+    int32_t size;
+
+    if (len == 0U)
+    {
+        return;
+    }
+    if (len > SHARED_CACHE_RANGE_MAX)
+    {
+        shared_cache_clean_all();
+        return;
+    }
+    size = shared_cache_line_range(&start, len);
+    SCB_CleanDCache_by_Addr((volatile void *)start, size);
+}
+
+void shared_cache_invalidate(void *addr, size_t len)
+{
+    SHARED_CACHE_ASSERT_ALIGNED(addr, len);
+
+    if (len == 0U)
+    {
+        return;
+    }
+    /* No whole-cache shortcut here: a global invalidate would also drop
+     * unrelated dirty lines. */
+    SCB_InvalidateDCache_by_Addr(addr, (int32_t)len);
+}
+
+void shared_cache_clean_invalidate(void *addr, size_t len)
+{
+    SHARED_CACHE_ASSERT_ALIGNED(addr, len);
+
+    if (len == 0U)
+    {
+        return;
+    }
+    if (len > SHARED_CACHE_RANGE_MAX)
+    {
+        shared_cache_clean_invalidate_all();
+        return;
+    }
+    SCB_CleanInvalidateDCache_by_Addr(addr, (int32_t)len);
+}
+
+void shared_cache_clean_all(void)
+{
+    SCB_CleanDCache();
+}
+
+void shared_cache_clean_invalidate_all(void)
+{
+    SCB_CleanInvalidateDCache();
+}
+
+/* [] END OF FILE */
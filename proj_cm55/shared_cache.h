@@ -0,0 +1,140 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Range-based D-cache maintenance for buffers shared with the CM33
+ * Purpose : Replace whole-cache clean/invalidate (cy_cache_update) on buffer
+ *           hand-over with maintenance limited to the lines actually used.
+ *           Every CM55 path that hands a buffer to the CM33 goes through
+ *           here; the whole-cache calls are for large or scattered data.
+ ********************************************************************************
+ * @file    shared_cache.h
+ * @brief   Clean / invalidate by address range, aligned to D-cache lines
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SHARED_CACHE_H
+#define SHARED_CACHE_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_utils.h"
+#include "cy_device_headers.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief D-cache line size of the CM55 in bytes */
+#if defined(__SCB_DCACHE_LINE_SIZE)
+#define SHARED_CACHE_LINE_SIZE        (__SCB_DCACHE_LINE_SIZE)
+#else
+#define SHARED_CACHE_LINE_SIZE        (32U)
+#endif
+
+/**
+ * @brief Range size above which a whole-cache operation is used instead
+ *
+ * By-address maintenance costs one register write per line, whole-cache
+ * maintenance one per set/way. Past roughly the D-cache size the
+ * whole-cache operation is cheaper.
+ */
+#ifndef SHARED_CACHE_RANGE_MAX
+#define SHARED_CACHE_RANGE_MAX        (32U * 1024U)
+#endif
+
+/** @brief Round a size up to a whole number of cache lines */
+#define SHARED_CACHE_ROUND_UP(size) \
+    (((size) + SHARED_CACHE_LINE_SIZE - 1U) & ~(size_t)(SHARED_CACHE_LINE_SIZE - 1U))
+
+/**
+ * @brief Declare a buffer that another core reads or writes
+ *
+ * Aligned to a cache line and padded to whole lines, so invalidating it can
+ * never discard neighbouring data.
+ */
+#define SHARED_CACHE_BUFFER(type, name, count) \
+    CY_ALIGN(SHARED_CACHE_LINE_SIZE) type name[SHARED_CACHE_ROUND_UP(sizeof(type) * (count)) / sizeof(type)]
+
+/** @brief Debug check that a range starts and ends on cache-line boundaries */
+#define SHARED_CACHE_ASSERT_ALIGNED(addr, len) \
+    CY_ASSERT(((((uintptr_t)(addr)) | ((uintptr_t)(len))) & (SHARED_CACHE_LINE_SIZE - 1U)) == 0U)
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/**
+ * @brief Write back a buffer before another core reads it
+ *
+ * The range is widened to whole cache lines; cleaning never loses data, so
+ * no alignment is required.
+ *
+ * @param[in] addr  Start of the buffer
+ * @param[in] len   Length in bytes
+ */
+void shared_cache_clean(const void *addr, size_t len);
+
+/**
+ * @brief Discard cached copies of a buffer another core has written
+ *
+ * The buffer must be cache-line aligned and a whole number of lines
+ * (see SHARED_CACHE_BUFFER); this is checked by CY_ASSERT in debug builds.
+ *
+ * @param[in] addr  Start of the buffer
+ * @param[in] len   Length in bytes
+ */
+void shared_cache_invalidate(void *addr, size_t len);
+
+/**
+ * @brief Write back and discard a buffer that is handed to another core for
+ *        writing, so no dirty line can later overwrite the other core's data
+ *
+ * Same alignment rules as shared_cache_invalidate().
+ *
+ * @param[in] addr  Start of the buffer
+ * @param[in] len   Length in bytes
+ */
+void shared_cache_clean_invalidate(void *addr, size_t len);
+
+/**
+ * @brief Write back the whole D-cache
+ *
+ * For data spread over many buffers, or larger than SHARED_CACHE_RANGE_MAX.
+ */
+void shared_cache_clean_all(void);
+
+/**
+ * @brief Write back and discard the whole D-cache
+ *
+ * There is no whole-cache invalidate: it would drop dirty lines of
+ * unrelated data.
+ */
+void shared_cache_clean_invalidate_all(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SHARED_CACHE_H */
+/* [] END OF FILE */
@@ -0,0 +1,321 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CM55 asynchronous secure request client
+ * Purpose : Decouple request submission from the blocking CM33/TF-M round-trip.
+ * Design  : Fixed slot table + FIFO of queued slot indices. Each slot carries a
+ *           generation counter that is folded into the ticket, so a stale
+ *           ticket can never collect the completion of a later request.
+ ********************************************************************************
+ * @file    srf_async.c
+ * @brief   Ticket-based non-blocking submit API on top of mtb_srf_request_submit
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <string.h>
+
+#include "cy_syslib.h"
+#include "shared_cache.h"
+#include "srf_async.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Ticket layout: generation in the upper 24 bits, slot in the lower 8 */
+#define SRF_ASYNC_SLOT_BITS           (8U)
+#define SRF_ASYNC_SLOT_MASK           ((1UL << SRF_ASYNC_SLOT_BITS) - 1UL)
+#define SRF_ASYNC_GEN_MASK            (0x00FFFFFFUL)
+
+#if (SRF_ASYNC_QUEUE_DEPTH > SRF_ASYNC_SLOT_MASK)
+#error "SRF_ASYNC_QUEUE_DEPTH does not fit in the ticket slot field"
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef enum
+{
+    SRF_ASYNC_SLOT_FREE = 0,
+    SRF_ASYNC_SLOT_QUEUED,
+    SRF_ASYNC_SLOT_RUNNING,
+    SRF_ASYNC_SLOT_DONE
+} srf_async_slot_state_t;
+
+typedef struct
+{
+    volatile srf_async_slot_state_t state;
+    uint32_t             generation;
+    cy_rslt_t            result;
+    srf_async_callback_t callback;
+    void                *arg;
+    uint8_t              in_cnt;
+    uint8_t              out_cnt;
+    mtb_srf_invec_ns_t   in_vec[SRF_ASYNC_MAX_IN_VEC];
+    mtb_srf_outvec_ns_t  out_vec[SRF_ASYNC_MAX_OUT_VEC];
+} srf_async_slot_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static srf_async_slot_t  srf_async_slots[SRF_ASYNC_QUEUE_DEPTH];
+
+/** @brief FIFO of QUEUED slot indices, preserves submission order */
+static uint8_t           srf_async_fifo[SRF_ASYNC_QUEUE_DEPTH];
+static uint32_t          srf_async_fifo_head;
+static uint32_t          srf_async_fifo_count;
+
+static uint32_t          srf_async_in_use;
+static srf_async_stats_t srf_async_stats;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static srf_async_ticket_t srf_async_make_ticket(uint32_t slot)
+{
+    return (srf_async_ticket_t)((srf_async_slots[slot].generation << SRF_ASYNC_SLOT_BITS) | slot);
+}
+
+/**
+ * @brief Resolve a ticket to its slot, or NULL if stale or malformed
+ */
+static srf_async_slot_t *srf_async_lookup(srf_async_ticket_t ticket)
+{
+    uint32_t slot = ticket & SRF_ASYNC_SLOT_MASK;
+    uint32_t generation = ticket >> SRF_ASYNC_SLOT_BITS;
+
+    if ((ticket == SRF_ASYNC_INVALID_TICKET) || (slot >= SRF_ASYNC_QUEUE_DEPTH))
+    {
+        return NULL;
+    }
+    if ((srf_async_slots[slot].state == SRF_ASYNC_SLOT_FREE) ||
+        (srf_async_slots[slot].generation != generation))
+    {
+        return NULL;
+    }
+    return &srf_async_slots[slot];
+}
+
+/**
+ * @brief Return a slot to the free pool and advance its generation
+ *
+ * Must be called with interrupts masked.
+ */
+static void srf_async_retire(srf_async_slot_t *entry)
+{
+    entry->generation = (entry->generation + 1UL) & SRF_ASYNC_GEN_MASK;
+    if (entry->generation == 0UL)
+    {
+        /* Generation 0 with slot 0 would alias SRF_ASYNC_INVALID_TICKET */
+        entry->generation = 1UL;
+    }
+    entry->state = SRF_ASYNC_SLOT_FREE;
+    srf_async_in_use--;
+    srf_async_stats.delivered++;
+}
+
+void srf_async_init(void)
+{
+    memset(srf_async_slots, 0, sizeof(srf_async_slots));
+    for (uint32_t i = 0; i < SRF_ASYNC_QUEUE_DEPTH; i++)
+    {
+        srf_async_slots[i].generation = 1UL;
+    }
+    srf_async_fifo_head = 0;
+    srf_async_fifo_count = 0;
+    srf_async_in_use = 0;
+    memset(&srf_async_stats, 0, sizeof(srf_async_stats));
+}
+
+cy_rslt_t srf_async_submit(const mtb_srf_invec_ns_t *in_vec, uint8_t in_cnt,
+                           const mtb_srf_outvec_ns_t *out_vec, uint8_t out_cnt,
+                           srf_async_callback_t callback, void *arg,
+                           srf_async_ticket_t *ticket)
+{
+    uint32_t irq_state;
+    uint32_t slot;
+
+    if ((ticket == NULL) || (in_cnt > SRF_ASYNC_MAX_IN_VEC) ||
+        (out_cnt > SRF_ASYNC_MAX_OUT_VEC) ||
+        ((in_cnt > 0U) && (in_vec == NULL)) ||
+        ((out_cnt > 0U) && (out_vec == NULL)))
+    {
+        return SRF_ASYNC_RSLT_ERR_BAD_PARAM;
+    }
+
+    irq_state = Cy_SysLib_EnterCriticalSection();
+
+    for (slot = 0; slot < SRF_ASYNC_QUEUE_DEPTH; slot++)
+    {
+        if (srf_async_slots[slot].state == SRF_ASYNC_SLOT_FREE)
+        {
+            break;
+        }
+    }
+    if (slot == SRF_ASYNC_QUEUE_DEPTH)
+    {
+        srf_async_stats.rejected++;
+        Cy_SysLib_ExitCriticalSection(irq_state);
+        *ticket = SRF_ASYNC_INVALID_TICKET;
+        return SRF_ASYNC_RSLT_ERR_QUEUE_FULL;
+    }
+
+    srf_async_slot_t *entry = &srf_async_slots[slot];
+    entry->callback = callback;
+    entry->arg = arg;
+    entry->in_cnt = in_cnt;
+    entry->out_cnt = out_cnt;
+    if (in_cnt > 0U)
+    {
+        memcpy(entry->in_vec, in_vec, in_cnt * sizeof(mtb_srf_invec_ns_t));
+    }
+    if (out_cnt > 0U)
+    {
+        memcpy(entry->out_vec, out_vec, out_cnt * sizeof(mtb_srf_outvec_ns_t));
+    }
+    for (uint32_t i = 0; i < out_cnt; i++)
+    {
+        /* Output buffers are invalidated on completion: must own whole lines */
+        SHARED_CACHE_ASSERT_ALIGNED(out_vec[i].base, out_vec[i].len);
+    }
+    entry->result = CY_RSLT_SUCCESS;
+    entry->state = SRF_ASYNC_SLOT_QUEUED;
+
+    srf_async_fifo[(srf_async_fifo_head + srf_async_fifo_count) % SRF_ASYNC_QUEUE_DEPTH] = (uint8_t)slot;
+    srf_async_fifo_count++;
+    srf_async_in_use++;
+    srf_async_stats.submitted++;
+    if (srf_async_in_use > srf_async_stats.max_depth)
+    {
+        srf_async_stats.max_depth = srf_async_in_use;
+    }
+
+    *ticket = srf_async_make_ticket(slot);
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+
+    return CY_RSLT_SUCCESS;
+}
+
+bool srf_async_poll(srf_async_ticket_t ticket, cy_rslt_t *result)
+{
+    bool done = false;
+    uint32_t irq_state = Cy_SysLib_EnterCriticalSection();
+    srf_async_slot_t *entry = srf_async_lookup(ticket);
+
+    /* Callback-driven requests are never handed out through polling */
+    if ((entry != NULL) && (entry->callback == NULL) &&
+        (entry->state == SRF_ASYNC_SLOT_DONE))
+    {
+        if (result != NULL)
+        {
+            *result = entry->result;
+        }
+        srf_async_retire(entry);
+        done = true;
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq_state);
+    return done;
+}
+
+bool srf_async_process(void)
+{
+    uint32_t irq_state;
+    uint32_t slot;
+    srf_async_slot_t *entry;
+    srf_async_ticket_t ticket;
+    srf_async_callback_t callback;
+    void *arg;
+    cy_rslt_t result;
+
+    irq_state = Cy_SysLib_EnterCriticalSection();
+    if (srf_async_fifo_count == 0U)
+    {
+        Cy_SysLib_ExitCriticalSection(irq_state);
+        return false;
+    }
+    slot = srf_async_fifo[srf_async_fifo_head];
+    srf_async_fifo_head = (srf_async_fifo_head + 1U) % SRF_ASYNC_QUEUE_DEPTH;
+    srf_async_fifo_count--;
+    entry = &srf_async_slots[slot];
+    entry->state = SRF_ASYNC_SLOT_RUNNING;
+    Cy_SysLib_ExitCriticalSection(irq_state);
+
+    /* Only this function touches a RUNNING slot, so no lock is held here.
+     * Hand the buffers over to the CM33: inputs written back, outputs free
+     * of dirty lines before and re-read from memory after the request. */
+    for (uint32_t i = 0; i < entry->in_cnt; i++)
+    {
+        shared_cache_clean(entry->in_vec[i].base, entry->in_vec[i].len);
+    }
+    for (uint32_t i = 0; i < entry->out_cnt; i++)
+    {
+        shared_cache_clean_invalidate(entry->out_vec[i].base, entry->out_vec[i].len);
+    }
+
+    result = mtb_srf_request_submit(entry->in_vec, entry->in_cnt,
+                                    entry->out_vec, entry->out_cnt);
+
+    for (uint32_t i = 0; i < entry->out_cnt; i++)
+    {
+        shared_cache_invalidate(entry->out_vec[i].base, entry->out_vec[i].len);
+    }
+
+    irq_state = Cy_SysLib_EnterCriticalSection();
+    srf_async_stats.completed++;
+    entry->result = result;
+    callback = entry->callback;
+    arg = entry->arg;
+    ticket = srf_async_make_ticket(slot);
+    if (callback != NULL)
+    {
+        srf_async_retire(entry);
+    }
+    else
+    {
+        entry->state = SRF_ASYNC_SLOT_DONE;
+    }
+    Cy_SysLib_ExitCriticalSection(irq_state);
+
+    if (callback != NULL)
+    {
+        callback(ticket, result, arg);
+    }
+
+    return true;
+}
+
+uint32_t srf_async_pending(void)
+{
+    return srf_async_fifo_count;
+}
+
+void srf_async_get_stats(srf_async_stats_t *stats)
+{
+    uint32_t irq_state = Cy_SysLib_EnterCriticalSection();
+    *stats = srf_async_stats;
+    Cy_SysLib_ExitCriticalSection(irq_state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,168 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : CM55 asynchronous secure request client
+ * Purpose : Let the CM55 queue Secure Request Framework (SRF) requests without
+ *           waiting for the CM33/TF-M round-trip at the call site. Completion
+ *           is reported through a callback or a pollable ticket.
+ ********************************************************************************
+ * @file    srf_async.h
+ * @brief   Ticket-based non-blocking submit API on top of mtb_srf_request_submit
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#ifndef SRF_ASYNC_H
+#define SRF_ASYNC_H
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "mtb_srf.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+/** @brief Number of requests that may be queued or completed-but-unread */
+#ifndef SRF_ASYNC_QUEUE_DEPTH
+#define SRF_ASYNC_QUEUE_DEPTH         (8U)
+#endif
+
+/** @brief Maximum input vectors per queued request */
+#ifndef SRF_ASYNC_MAX_IN_VEC
+#define SRF_ASYNC_MAX_IN_VEC          (4U)
+#endif
+
+/** @brief Maximum output vectors per queued request */
+#ifndef SRF_ASYNC_MAX_OUT_VEC
+#define SRF_ASYNC_MAX_OUT_VEC         (4U)
+#endif
+
+/** @brief Ticket value that never identifies a request */
+#define SRF_ASYNC_INVALID_TICKET      (0UL)
+
+/** @brief Result codes reported by this module */
+#define SRF_ASYNC_RSLT_ERR_QUEUE_FULL \
+    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 0x26U)
+#define SRF_ASYNC_RSLT_ERR_BAD_PARAM \
+    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 0x27U)
+#define SRF_ASYNC_RSLT_ERR_UNKNOWN_TICKET \
+    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 0x28U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Handle returned by srf_async_submit(); slot index plus generation */
+typedef uint32_t srf_async_ticket_t;
+
+/**
+ * @brief Completion callback, called exactly once per submitted request
+ *
+ * Runs in the context of srf_async_process(). The ticket is retired before
+ * the callback runs, so srf_async_poll() on it returns an error afterwards.
+ */
+typedef void (*srf_async_callback_t)(srf_async_ticket_t ticket,
+                                     cy_rslt_t result, void *arg);
+
+/** @brief Counters for checking that no completion is lost or duplicated */
+typedef struct
+{
+    uint32_t submitted;     /**< Requests accepted by srf_async_submit()   */
+    uint32_t rejected;      /**< Requests refused because the queue was full */
+    uint32_t completed;     /**< Requests executed by srf_async_process()  */
+    uint32_t delivered;     /**< Completions handed out (callback or poll) */
+    uint32_t max_depth;     /**< Peak number of occupied slots             */
+} srf_async_stats_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+
+/** @brief Reset the request table. Call once after cybsp_init(). */
+void srf_async_init(void);
+
+/**
+ * @brief Queue a secure request and return immediately
+ *
+ * Safe to call from an interrupt handler: it only takes a critical
+ * section. The handler keeps running while the main loop is blocked in
+ * srf_async_process() on an earlier request.
+ *
+ * The vector arrays are copied, but the buffers they point to must stay
+ * valid until the request completes. Inputs are cleaned from the D-cache
+ * by address range (shared_cache) before the CM33 reads them. Output
+ * buffers must be declared with SHARED_CACHE_BUFFER() (cache-line aligned,
+ * whole lines) because they are invalidated when the request completes;
+ * CY_ASSERT checks this.
+ *
+ * @param[in]  in_vec    Input vectors (same layout as mtb_srf_request_submit)
+ * @param[in]  in_cnt    Number of input vectors
+ * @param[in]  out_vec   Output vectors
+ * @param[in]  out_cnt   Number of output vectors
+ * @param[in]  callback  Completion callback, or NULL to use srf_async_poll()
+ * @param[in]  arg       User argument passed to @p callback
+ * @param[out] ticket    Ticket identifying the request
+ *
+ * @return CY_RSLT_SUCCESS, or SRF_ASYNC_RSLT_ERR_* on failure
+ */
+cy_rslt_t srf_async_submit(const mtb_srf_invec_ns_t *in_vec, uint8_t in_cnt,
+                           const mtb_srf_outvec_ns_t *out_vec, uint8_t out_cnt,
+                           srf_async_callback_t callback, void *arg,
+                           srf_async_ticket_t *ticket);
+
+/**
+ * @brief Check whether a callback-less request has completed
+ *
+ * @param[in]  ticket  Ticket from srf_async_submit()
+ * @param[out] result  Request result, valid when true is returned
+ *
+ * @return true once, when the result is collected; false while pending
+ *         or for an unknown ticket
+ */
+bool srf_async_poll(srf_async_ticket_t ticket, cy_rslt_t *result);
+
+/**
+ * @brief Execute the oldest queued request and deliver its completion
+ *
+ * Call from the main loop. Each call performs at most one CM33/TF-M
+ * round-trip so the caller keeps control between requests.
+ *
+ * @return true if a request was executed, false if the queue was empty
+ */
+bool srf_async_process(void);
+
+/** @brief Number of requests waiting to be executed */
+uint32_t srf_async_pending(void);
+
+/** @brief Snapshot of the module counters */
+void srf_async_get_stats(srf_async_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SRF_ASYNC_H */
+/* [] END OF FILE */
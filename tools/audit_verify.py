@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Check a security audit log exported by proj_cm33_ns.
+
+audit_log_export() (see proj_cm33_ns/audit_log.h) hands over the checkpoint
+public key, the stored segments oldest first and the signed checkpoint; the
+demo prints them on the console as
+
+    AUDIT <K|S|C> <offset> <hex, up to 32 bytes>
+
+one record per run of lines starting at offset 0. This script collects those
+lines from a captured console log (run log_detokenize.py first on a
+tokenized build), recomputes the hash chain and checks the checkpoint's
+ECDSA P-256 signature:
+
+    entry       seq | time | event (2) | len (1) | 0 | data (20) | prev hash (32)
+    segment     "ALSG" | batch | first seq | count | entries
+    checkpoint  "ALCP" | entries | batch | 0 | head hash (32) | r | s
+
+Entries up to the checkpoint are authenticated; later ones are linked but
+not yet signed. Pin the device key with --pubkey; otherwise the key in the
+dump is used, which only shows the log is consistent with itself.
+
+Usage:
+    audit_verify.py console.txt
+    audit_verify.py console.txt --pubkey 04ab...  --list
+"""
+
+import argparse
+import hashlib
+import re
+import struct
+import sys
+
+ENTRY_SIZE = 64
+SEGMENT_HEADER = 16
+CHECKPOINT_SIGNED = 48
+SEGMENT_MAGIC = b"ALSG"
+CHECKPOINT_MAGIC = b"ALCP"
+DATA_MAX = 20
+
+LINE_RE = re.compile(r"AUDIT ([KSC]) (\d+) ([0-9a-fA-F]+)")
+
+# secp256r1
+P = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+A = P - 3
+B = 0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B
+N = 0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+G = (0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+
+
+def point_add(p1, p2):
+    """Affine point addition; None is the point at infinity."""
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    if p1[0] == p2[0]:
+        if (p1[1] + p2[1]) % P == 0:
+            return None
+        lam = (3 * p1[0] * p1[0] + A) * pow(2 * p1[1], -1, P) % P
+    else:
+        lam = (p2[1] - p1[1]) * pow(p2[0] - p1[0], -1, P) % P
+    x = (lam * lam - p1[0] - p2[0]) % P
+    return x, (lam * (p1[0] - x) - p1[1]) % P
+
+
+def point_mul(k, point):
+    result = None
+    while k:
+        if k & 1:
+            result = point_add(result, point)
+        point = point_add(point, point)
+        k >>= 1
+    return result
+
+
+def parse_public_key(raw):
+    """Uncompressed SEC1 point -> (x, y), checked to be on the curve."""
+    if len(raw) != 65 or raw[0] != 4:
+        raise ValueError("public key is not an uncompressed P-256 point")
+    x = int.from_bytes(raw[1:33], "big")
+    y = int.from_bytes(raw[33:], "big")
+    if x >= P or y >= P or (y * y - (x * x * x + A * x + B)) % P:
+        raise ValueError("public key is not on P-256")
+    return x, y
+
+
+def ecdsa_verify(public, message, signature):
+    """ECDSA P-256 / SHA-256 over message, signature is raw r || s."""
+    r = int.from_bytes(signature[:32], "big")
+    s = int.from_bytes(signature[32:64], "big")
+    if len(signature) != 64 or not (0 < r < N and 0 < s < N):
+        return False
+    e = int.from_bytes(hashlib.sha256(message).digest(), "big")
+    w = pow(s, -1, N)
+    point = point_add(point_mul(e * w % N, G), point_mul(r * w % N, public))
+    return point is not None and point[0] % N == r
+
+
+def read_records(text):
+    """[(type, bytes)] from the AUDIT lines of a console capture."""
+    records = []
+    for line in text.splitlines():
+        m = LINE_RE.search(line)
+        if not m:
+            continue
+        kind, offset, data = m.group(1), int(m.group(2)), bytes.fromhex(m.group(3))
+        if offset == 0:
+            records.append([kind, bytearray()])
+        elif not records or records[-1][0] != kind or len(records[-1][1]) != offset:
+            raise ValueError("AUDIT %s line at offset %d out of sequence" % (kind, offset))
+        records[-1][1] += data
+    return [(kind, bytes(data)) for kind, data in records]
+
+
+def check(records, public, listing):
+    """Walk the chain; return a list of problems (empty if the log is intact)."""
+    problems = []
+    segments = [data for kind, data in records if kind == "S"]
+    checkpoints = [data for kind, data in records if kind == "C"]
+    checkpoint = checkpoints[-1] if checkpoints else None
+
+    cp_entries = cp_head = None
+    if checkpoint is not None:
+        if len(checkpoint) != CHECKPOINT_SIGNED + 64 or checkpoint[:4] != CHECKPOINT_MAGIC:
+            problems.append("malformed checkpoint")
+            checkpoint = None
+        else:
+            cp_entries, = struct.unpack_from("<I", checkpoint, 4)
+            cp_head = checkpoint[16:48]
+
+    head = bytes(32)
+    first_seq = seq = None
+    batch = None
+    cp_matched = False
+    for segment in segments:
+        if len(segment) < SEGMENT_HEADER or segment[:4] != SEGMENT_MAGIC:
+            problems.append("malformed segment")
+            return problems
+        seg_batch, seg_seq, count = struct.unpack_from("<III", segment, 4)
+        if len(segment) != SEGMENT_HEADER + count * ENTRY_SIZE or count == 0:
+            problems.append("segment %d: bad length" % seg_batch)
+            return problems
+        if batch is not None and seg_batch != batch + 1:
+            problems.append("segments %d..%d missing" % (batch + 1, seg_batch - 1))
+        batch = seg_batch
+        if first_seq is None:
+            first_seq = seq = seg_seq
+
+        for i in range(count):
+            entry = segment[SEGMENT_HEADER + i * ENTRY_SIZE:SEGMENT_HEADER + (i + 1) * ENTRY_SIZE]
+            e_seq, e_time, e_event, e_len = struct.unpack_from("<IIHB", entry)
+            # The oldest stored entry links to data no longer stored, unless it is the first ever
+            anchored = seq != first_seq or first_seq == 0
+            if e_seq != seq:
+                problems.append("entry %d: sequence %d, expected %d" % (e_seq, e_seq, seq))
+            elif e_len > DATA_MAX:
+                problems.append("entry %d: bad data length" % e_seq)
+            elif anchored and entry[32:] != head:
+                problems.append("entry %d: does not link to its predecessor" % e_seq)
+            if problems:
+                return problems
+            head = hashlib.sha256(entry).digest()
+            seq += 1
+            if listing:
+                print("%6d  t=%-10d event %-5d %s" % (e_seq, e_time, e_event, entry[12:12 + e_len].hex()))
+            if checkpoint is not None and seq == cp_entries and head == cp_head:
+                cp_matched = True
+
+    if first_seq is None:
+        first_seq = seq = 0
+    signed = 0
+    if checkpoint is not None:
+        if cp_entries > seq:
+            problems.append("checkpoint covers %d entries, only %d stored: log truncated"
+                            % (cp_entries, seq))
+        elif cp_entries > first_seq and not cp_matched:
+            problems.append("checkpoint does not match the chain at entry %d" % (cp_entries - 1))
+        elif cp_matched:
+            if not ecdsa_verify(public, checkpoint[:CHECKPOINT_SIGNED], checkpoint[CHECKPOINT_SIGNED:]):
+                problems.append("checkpoint signature does not verify")
+            else:
+                signed = cp_entries - first_seq
+
+    if not problems:
+        print("%d entries (%d..%d) chain-linked, %d signed by the checkpoint, %d not yet signed"
+              % (seq - first_seq, first_seq, seq - 1, signed, seq - first_seq - signed))
+    return problems
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="console log with AUDIT lines ('-' for stdin)")
+    parser.add_argument("--pubkey", help="expected checkpoint key, uncompressed point in hex")
+    parser.add_argument("--list", action="store_true", help="print every entry")
+    opts = parser.parse_args()
+
+    if opts.capture == "-":
+        text = sys.stdin.read()
+    else:
+        with open(opts.capture, "r", errors="replace") as f:
+            text = f.read()
+
+    try:
+        records = read_records(text)
+        keys = [data for kind, data in records if kind == "K"]
+        if opts.pubkey:
+            pinned = bytes.fromhex(opts.pubkey)
+            if keys and keys[-1] != pinned:
+                sys.exit("the dump was exported with a different key")
+            public = parse_public_key(pinned)
+        elif keys:
+            print("warning: using the key from the dump; pin it with --pubkey", file=sys.stderr)
+            public = parse_public_key(keys[-1])
+        else:
+            sys.exit("no public key in the dump, pass --pubkey")
+    except ValueError as err:
+        sys.exit(str(err))
+
+    problems = check(records, public, opts.list)
+    for problem in problems:
+        print("FAIL: " + problem)
+    sys.exit(1 if problems else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,224 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : audit_log host check
+ * Purpose : Run proj_cm33_ns/audit_log.c on the host and check its
+ *           retention: a full ring is never overwritten before an export or
+ *           the checkpoint covers it, a segment replaced under the
+ *           checkpoint alone is counted, and the stored log still verifies,
+ *           resumes and rejects a flipped byte.
+ * Design  : host_ps.c keeps the assets in RAM and signing.c signs on
+ *           host_psa.c. Every append is URGENT in the retention cases, so
+ *           each entry takes a whole segment, the worst case of the ring.
+ *           The last export is written in the console format of
+ *           app_benchmarks.c to the file given on the command line, for
+ *           tools/audit_verify.py to check independently.
+ ********************************************************************************
+ * @file    audit_log_sim.c
+ * @brief   Ring retention, recovery and tamper check of the audit log
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "audit_log.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_UID_BASE                  (0x41554400ULL)
+#define SIM_ROUNDS                    (40U)        /**< Urgent appends of the rotating case */
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static unsigned int sim_failures;
+static uint32_t     sim_segments;       /**< Segment records of the last export */
+static FILE        *sim_dump;           /**< Console dump of the export, or NULL */
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Export callback: counts segments, dumps as audit_log_print() does */
+static void sim_export(void *arg, audit_log_record_t type, const uint8_t *data, size_t len)
+{
+    (void)arg;
+    if (type == AUDIT_LOG_RECORD_SEGMENT)
+    {
+        sim_segments++;
+    }
+    for (size_t off = 0; (sim_dump != NULL) && (off < len); off += 32U)
+    {
+        size_t n = ((len - off) < 32U) ? (len - off) : 32U;
+
+        fprintf(sim_dump, "AUDIT %c %lu ", (char)type, (unsigned long)off);
+        for (size_t i = 0; i < n; i++)
+        {
+            fprintf(sim_dump, "%02x", data[off + i]);
+        }
+        fprintf(sim_dump, "\n");
+    }
+}
+
+static psa_status_t sim_append(audit_log_t *log, uint32_t seq)
+{
+    uint8_t data[4] = { (uint8_t)seq, (uint8_t)(seq >> 8), 0xA5U, 0x5AU };
+
+    return audit_log_append(log, seq, (uint16_t)(seq % 8U), data, sizeof(data), AUDIT_LOG_URGENT);
+}
+
+/** @brief No checkpoint: a full ring refuses new segments until it is exported */
+static void sim_refuse_until_export(audit_log_config_t *config)
+{
+    static audit_log_t log;
+    audit_log_verify_info_t info;
+    uint32_t seq = 0;
+    psa_status_t status;
+
+    config->checkpoint_batches = 0U;
+    SIM_CHECK((audit_log_open(&log, config) == PSA_SUCCESS) && (audit_log_erase(&log) == PSA_SUCCESS), "open");
+    for (; seq < AUDIT_LOG_SEGMENTS; seq++)
+    {
+        SIM_CHECK(sim_append(&log, seq) == PSA_SUCCESS, "ring fills");
+    }
+    status = sim_append(&log, seq);
+    SIM_CHECK(status == PSA_ERROR_INSUFFICIENT_STORAGE, "full ring refuses an urgent entry");
+    SIM_CHECK((log.stats.refused == 1U) && (log.stats.entries == AUDIT_LOG_SEGMENTS) && (log.pending == 0U),
+              "refused entry counted, not buffered");
+    SIM_CHECK((audit_log_verify(&log, &info) == PSA_SUCCESS) && (info.first_seq == 0U) &&
+              (info.entries == AUDIT_LOG_SEGMENTS), "nothing overwritten");
+
+    /* Reopened after a reset, the ring is still full */
+    SIM_CHECK((audit_log_open(&log, config) == PSA_SUCCESS) && (sim_append(&log, seq) == PSA_ERROR_INSUFFICIENT_STORAGE),
+              "refusal survives a reset");
+
+    /* An export frees the whole ring */
+    sim_segments = 0;
+    SIM_CHECK(audit_log_export(&log, sim_export, NULL) == PSA_SUCCESS, "export");
+    SIM_CHECK(sim_segments == AUDIT_LOG_SEGMENTS, "every stored segment exported");
+    for (uint32_t i = 0; i < AUDIT_LOG_SEGMENTS; i++, seq++)
+    {
+        SIM_CHECK(sim_append(&log, seq) == PSA_SUCCESS, "exported slots reused");
+    }
+    SIM_CHECK(sim_append(&log, seq) == PSA_ERROR_INSUFFICIENT_STORAGE, "full again after one ring");
+    SIM_CHECK((log.stats.segments_dropped == 0U) && (audit_log_verify(&log, &info) == PSA_SUCCESS) &&
+              (info.first_seq == AUDIT_LOG_SEGMENTS), "exported entries replaced, none dropped");
+
+    /* A checkpoint covers the ring too, and the replacement is reported */
+    SIM_CHECK(audit_log_checkpoint(&log) == PSA_SUCCESS, "checkpoint");
+    SIM_CHECK(sim_append(&log, seq) == PSA_SUCCESS, "slot reused under the checkpoint");
+    SIM_CHECK(log.stats.segments_dropped == 1U, "unexported replacement counted");
+    printf("No checkpoint: %u-segment ring full after %lu urgent entries, %lu refused, %lu dropped\n",
+           AUDIT_LOG_SEGMENTS, (unsigned long)AUDIT_LOG_SEGMENTS, (unsigned long)log.stats.refused,
+           (unsigned long)log.stats.segments_dropped);
+}
+
+/** @brief Checkpoint every few commits: the ring turns and every loss is counted */
+static void sim_rotate_under_checkpoint(audit_log_config_t *config)
+{
+    static audit_log_t log;
+    static audit_log_t resumed;
+    static uint8_t segment[AUDIT_LOG_SEGMENT_SIZE(AUDIT_LOG_BATCH_MAX)];
+    audit_log_verify_info_t info;
+    psa_storage_uid_t uid;
+    size_t len = 0;
+    bool ok = true;
+
+    config->checkpoint_batches = 2U;
+    SIM_CHECK((audit_log_open(&log, config) == PSA_SUCCESS) && (audit_log_erase(&log) == PSA_SUCCESS), "open");
+    for (uint32_t seq = 0; seq < SIM_ROUNDS; seq++)
+    {
+        ok = ok && (sim_append(&log, seq) == PSA_SUCCESS);
+    }
+    SIM_CHECK(ok && (log.stats.refused == 0U), "ring turns under the checkpoint");
+    SIM_CHECK(log.stats.segments_dropped == (SIM_ROUNDS - AUDIT_LOG_SEGMENTS), "every replaced segment counted");
+    SIM_CHECK((audit_log_verify(&log, &info) == PSA_SUCCESS) && (info.first_seq == (SIM_ROUNDS - AUDIT_LOG_SEGMENTS)) &&
+              (info.entries == AUDIT_LOG_SEGMENTS) && (info.signed_entries == AUDIT_LOG_SEGMENTS),
+              "stored log starts after the dropped entries, all signed");
+    printf("Checkpoint every 2: %u urgent entries, %lu segments dropped, entries %lu..%lu stored\n",
+           SIM_ROUNDS, (unsigned long)log.stats.segments_dropped, (unsigned long)info.first_seq,
+           (unsigned long)(info.first_seq + info.entries - 1U));
+
+    /* As after a reset */
+    SIM_CHECK((audit_log_open(&resumed, config) == PSA_SUCCESS) && (resumed.next_seq == log.next_seq) &&
+              (memcmp(resumed.head, log.head, sizeof(log.head)) == 0), "chain resumes from storage");
+
+    sim_segments = 0;
+    SIM_CHECK(audit_log_export(&log, sim_export, NULL) == PSA_SUCCESS, "export");
+
+    /* One data byte of the oldest stored entry flipped behind the log's back */
+    uid = SIM_UID_BASE + (log.next_batch % AUDIT_LOG_SEGMENTS);
+    SIM_CHECK(psa_ps_get(uid, 0U, sizeof(segment), segment, &len) == PSA_SUCCESS, "read stored segment");
+    segment[AUDIT_LOG_SEGMENT_HEADER_SIZE + 12U] ^= 0x01U;
+    (void)psa_ps_set(uid, len, segment, PSA_STORAGE_FLAG_NONE);
+    SIM_CHECK(audit_log_verify(&log, NULL) == PSA_ERROR_INVALID_SIGNATURE, "flipped byte rejected");
+    (void)audit_log_erase(&log);
+}
+
+int main(int argc, char **argv)
+{
+    signing_key_config_t key_config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_RANDOM, PSA_KEY_LIFETIME_VOLATILE
+    };
+    audit_log_config_t config =
+    {
+        SIM_UID_BASE, NULL, 4U, 0U, 0U
+    };
+    signing_key_t key;
+    bool ok;
+
+    SIM_CHECK((signing_init() == PSA_SUCCESS) && (signing_key_generate(&key_config, &key) == PSA_SUCCESS),
+              "checkpoint key");
+    config.key = &key;
+
+    sim_refuse_until_export(&config);
+
+    /* The dump holds the export of the rotated log */
+    sim_dump = (argc > 1) ? fopen(argv[1], "w") : NULL;
+    SIM_CHECK((argc <= 1) || (sim_dump != NULL), "export dump file");
+    sim_rotate_under_checkpoint(&config);
+    if (sim_dump != NULL)
+    {
+        (void)fclose(sim_dump);
+    }
+    signing_key_destroy(&key);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
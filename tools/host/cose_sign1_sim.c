@@ -0,0 +1,343 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : COSE_Sign1 host check
+ * Purpose : Run proj_cm33_ns/cbor_write.c and cose_sign1.c on the host:
+ *           RFC 8949 Appendix A encodings, the COSE interoperability vector
+ *           of cose_sign1_self_test(), and single-pass against buffered
+ *           signing, with the payload bytes per microsecond of both.
+ * Design  : signing.c runs on host_psa.c, whose deterministic ECDSA makes
+ *           the signatures reproducible: the self test compares the whole
+ *           message, and the single-pass message must equal, byte for
+ *           byte, the one built the buffered way (payload buffer,
+ *           Sig_structure buffer, signing_sign()). The telemetry payload is
+ *           the one of cose_sign1_benchmark() in app_benchmarks.c.
+ ********************************************************************************
+ * @file    cose_sign1_sim.c
+ * @brief   CBOR and COSE_Sign1 vectors and throughput on the host
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "cbor_write.h"
+#include "cose_sign1.h"
+#include "signing.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_RUNS                      (200U)
+#define SIM_PAYLOAD_MAX               (1200U)
+#define SIM_MESSAGE_MAX               (1400U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief One RFC 8949 Appendix A item and its encoding */
+typedef struct
+{
+    uint8_t     kind;               /**< SIM_ITEM_* */
+    uint64_t    value;
+    const char *text;
+    const char *hex;
+} sim_cbor_kat_t;
+
+enum
+{
+    SIM_ITEM_UINT,
+    SIM_ITEM_NINT,                  /**< value is -1 - n, as in the head */
+    SIM_ITEM_FLOAT,                 /**< value is the binary32 pattern    */
+    SIM_ITEM_BOOL,
+    SIM_ITEM_TSTR,
+    SIM_ITEM_BSTR,                  /**< text holds the bytes             */
+    SIM_ITEM_ARRAY,
+    SIM_ITEM_MAP,
+    SIM_ITEM_TAG_UINT               /**< tag 1 around an unsigned value   */
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+static const sim_cbor_kat_t sim_cbor_kats[] =
+{
+    { SIM_ITEM_UINT,  0U,                     NULL,   "00" },
+    { SIM_ITEM_UINT,  10U,                    NULL,   "0a" },
+    { SIM_ITEM_UINT,  23U,                    NULL,   "17" },
+    { SIM_ITEM_UINT,  24U,                    NULL,   "1818" },
+    { SIM_ITEM_UINT,  100U,                   NULL,   "1864" },
+    { SIM_ITEM_UINT,  1000U,                  NULL,   "1903e8" },
+    { SIM_ITEM_UINT,  1000000U,               NULL,   "1a000f4240" },
+    { SIM_ITEM_UINT,  1000000000000ULL,       NULL,   "1b000000e8d4a51000" },
+    { SIM_ITEM_UINT,  18446744073709551615ULL, NULL,  "1bffffffffffffffff" },
+    { SIM_ITEM_NINT,  0U,                     NULL,   "20" },
+    { SIM_ITEM_NINT,  9U,                     NULL,   "29" },
+    { SIM_ITEM_NINT,  99U,                    NULL,   "3863" },
+    { SIM_ITEM_NINT,  999U,                   NULL,   "3903e7" },
+    { SIM_ITEM_FLOAT, 0x47C35000U,            NULL,   "fa47c35000" },   /* 100000.0 */
+    { SIM_ITEM_FLOAT, 0x7F7FFFFFU,            NULL,   "fa7f7fffff" },   /* 3.4028234663852886e+38 */
+    { SIM_ITEM_BOOL,  0U,                     NULL,   "f4" },
+    { SIM_ITEM_BOOL,  1U,                     NULL,   "f5" },
+    { SIM_ITEM_BSTR,  0U,                     "",     "40" },
+    { SIM_ITEM_BSTR,  4U,                     "\x01\x02\x03\x04", "4401020304" },
+    { SIM_ITEM_TSTR,  0U,                     "",     "60" },
+    { SIM_ITEM_TSTR,  0U,                     "a",    "6161" },
+    { SIM_ITEM_TSTR,  0U,                     "IETF", "6449455446" },
+    { SIM_ITEM_TSTR,  0U,                     "\"\\", "62225c" },
+    { SIM_ITEM_TSTR,  0U,                     "\xc3\xbc", "62c3bc" },
+    { SIM_ITEM_ARRAY, 0U,                     NULL,   "80" },
+    { SIM_ITEM_MAP,   0U,                     NULL,   "a0" },
+    { SIM_ITEM_TAG_UINT, 1363896240U,         NULL,   "c11a514b67b0" },
+};
+
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+static uint64_t sim_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static void sim_cbor_put(cbor_writer_t *w, const sim_cbor_kat_t *kat)
+{
+    float f;
+    uint32_t bits = (uint32_t)kat->value;
+
+    switch (kat->kind)
+    {
+        case SIM_ITEM_UINT:
+            cbor_put_uint(w, kat->value);
+            break;
+        case SIM_ITEM_NINT:
+            cbor_put_int(w, -1 - (int64_t)kat->value);
+            break;
+        case SIM_ITEM_FLOAT:
+            memcpy(&f, &bits, sizeof(f));
+            cbor_put_float(w, f);
+            break;
+        case SIM_ITEM_BOOL:
+            cbor_put_bool(w, kat->value != 0U);
+            break;
+        case SIM_ITEM_TSTR:
+            cbor_put_tstr(w, kat->text);
+            break;
+        case SIM_ITEM_BSTR:
+            cbor_put_bstr(w, (const uint8_t *)kat->text, (size_t)kat->value);
+            break;
+        case SIM_ITEM_ARRAY:
+            cbor_put_array(w, 0U);
+            break;
+        case SIM_ITEM_MAP:
+            cbor_put_map(w, 0U);
+            break;
+        default:
+            cbor_put_tag(w, 1U);
+            cbor_put_uint(w, kat->value);
+            break;
+    }
+}
+
+/** @brief Every Appendix A item encodes as listed, counting gives the same size */
+static void sim_cbor_vectors(void)
+{
+    uint32_t passed = 0;
+    uint32_t count = sizeof(sim_cbor_kats) / sizeof(sim_cbor_kats[0]);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const sim_cbor_kat_t *kat = &sim_cbor_kats[i];
+        uint8_t buf[16];
+        char hex[33];
+        cbor_writer_t w;
+        cbor_writer_t counter;
+
+        cbor_writer_init(&w, buf, sizeof(buf));
+        cbor_writer_init(&counter, NULL, 0U);
+        sim_cbor_put(&w, kat);
+        sim_cbor_put(&counter, kat);
+        for (size_t b = 0; (b < w.len) && (b < 16U); b++)
+        {
+            (void)snprintf(&hex[2U * b], 3U, "%02x", buf[b]);
+        }
+        hex[2U * w.len] = '\0';
+        if (cbor_writer_ok(&w) && (counter.len == w.len) && (strcmp(hex, kat->hex) == 0))
+        {
+            passed++;
+        }
+        else
+        {
+            printf("  CBOR item %lu: %s, expected %s\n", (unsigned long)i, hex, kat->hex);
+        }
+    }
+
+    /* A write that does not fit is flagged, not truncated silently */
+    {
+        uint8_t small[2];
+        cbor_writer_t w;
+
+        cbor_writer_init(&w, small, sizeof(small));
+        cbor_put_uint(&w, 1000U);
+        SIM_CHECK(!cbor_writer_ok(&w), "overflow flagged");
+    }
+
+    printf("RFC 8949 Appendix A: %lu/%lu items\n", (unsigned long)passed, (unsigned long)count);
+    SIM_CHECK(passed == count, "CBOR encodings match RFC 8949 Appendix A");
+}
+
+/** @brief { "dev": bstr, "seq": uint, "t": [ float... ] }, as on the device */
+static void sim_telemetry(cbor_writer_t *w, uint32_t seq, uint32_t readings)
+{
+    static const uint8_t device_id[8] = { 0x45, 0x84, 0x00, 0x01, 0x00, 0x00, 0x2A, 0x17 };
+
+    cbor_put_map(w, 3U);
+    cbor_put_tstr(w, "dev");
+    cbor_put_bstr(w, device_id, sizeof(device_id));
+    cbor_put_tstr(w, "seq");
+    cbor_put_uint(w, seq);
+    cbor_put_tstr(w, "t");
+    cbor_put_array(w, readings);
+    for (uint32_t i = 0; i < readings; i++)
+    {
+        cbor_put_float(w, 20.0f + ((float)(i % 50U) * 0.1f));
+    }
+}
+
+/** @brief Single pass equals buffered signing; payload bytes per microsecond of each */
+static void sim_cose_throughput(signing_key_t *key)
+{
+    static const uint16_t readings[] = { 8U, 48U, 210U };
+    static const uint8_t protected_header[] = { 0xA1, 0x01, 0x26 };    /* {1: -7} */
+    static uint8_t payload[SIM_PAYLOAD_MAX];
+    static uint8_t tbs[SIM_PAYLOAD_MAX + 32U];
+    static uint8_t buffered[SIM_MESSAGE_MAX];
+    static uint8_t single[SIM_MESSAGE_MAX];
+
+    printf("COSE_Sign1 ES256 telemetry (payload B per us: buffered / single pass):\n");
+    for (uint32_t p = 0; p < (sizeof(readings) / sizeof(readings[0])); p++)
+    {
+        uint64_t buffered_ns = 0;
+        uint64_t single_ns = 0;
+        size_t payload_len = 0;
+        size_t buffered_len = 0;
+        size_t single_len = 0;
+        bool same = true;
+
+        for (uint32_t r = 0; r < SIM_RUNS; r++)
+        {
+            uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+            size_t signature_len = 0;
+            cbor_writer_t w;
+            cose_sign1_t cose;
+            uint64_t start = sim_now_ns();
+            bool ok;
+
+            cbor_writer_init(&w, payload, sizeof(payload));
+            sim_telemetry(&w, r, readings[p]);
+            payload_len = w.len;
+            cbor_writer_init(&w, tbs, sizeof(tbs));
+            cbor_put_array(&w, 4U);
+            cbor_put_tstr(&w, "Signature1");
+            cbor_put_bstr(&w, protected_header, sizeof(protected_header));
+            cbor_put_bstr(&w, NULL, 0U);
+            cbor_put_bstr(&w, payload, payload_len);
+            ok = (signing_sign(key, tbs, w.len, signature, sizeof(signature), &signature_len) == PSA_SUCCESS);
+            cbor_writer_init(&w, buffered, sizeof(buffered));
+            cbor_put_tag(&w, COSE_SIGN1_TAG);
+            cbor_put_array(&w, 4U);
+            cbor_put_bstr(&w, protected_header, sizeof(protected_header));
+            cbor_put_map(&w, 0U);
+            cbor_put_bstr(&w, payload, payload_len);
+            cbor_put_bstr(&w, signature, signature_len);
+            buffered_len = w.len;
+            buffered_ns += sim_now_ns() - start;
+
+            start = sim_now_ns();
+            cbor_writer_init(&w, NULL, 0U);
+            sim_telemetry(&w, r, readings[p]);
+            ok = ok && (cose_sign1_begin(&cose, key, NULL, 0U, NULL, 0U, w.len, single, sizeof(single)) == PSA_SUCCESS);
+            if (ok)
+            {
+                sim_telemetry(cose_sign1_payload(&cose), r, readings[p]);
+                ok = (cose_sign1_finish(&cose, &single_len) == PSA_SUCCESS);
+            }
+            single_ns += sim_now_ns() - start;
+
+            same = same && ok && (single_len == buffered_len) && (memcmp(single, buffered, single_len) == 0);
+        }
+        printf("  payload %4lu B: %5.1f / %5.1f\n", (unsigned long)payload_len,
+               (double)(payload_len * SIM_RUNS * 1000U) / (double)(buffered_ns + 1U),
+               (double)(payload_len * SIM_RUNS * 1000U) / (double)(single_ns + 1U));
+        SIM_CHECK(same, "single-pass message equals the buffered one");
+    }
+}
+
+int main(void)
+{
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    signing_key_t key;
+    psa_status_t status;
+    bool ok;
+
+    sim_cbor_vectors();
+
+    SIM_CHECK(signing_init() == PSA_SUCCESS, "signing_init");
+    /* With RFC 6979 nonces the self test compares the signature bytes too */
+    SIM_CHECK(signing_self_test() == PSA_SUCCESS, "deterministic ECDSA known-answer test");
+    status = cose_sign1_self_test();
+    printf("COSE_Sign1 interoperability vector: %s\n", (status == PSA_SUCCESS) ? "pass" : "FAIL");
+    SIM_CHECK(status == PSA_SUCCESS, "cose_sign1_self_test");
+
+    SIM_CHECK(signing_key_generate(&config, &key) == PSA_SUCCESS, "deterministic P-256 key");
+    sim_cose_throughput(&key);
+    signing_key_destroy(&key);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,265 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : crypto_arena host soak
+ * Purpose : Run proj_cm33_ns/crypto_arena.c through a million sign and
+ *           verify cycles and check that memory stays flat: every cycle
+ *           returns the arena to empty, the high-water marks are reached
+ *           in the first window and never move after it, no request fails,
+ *           and the time per cycle does not drift.
+ * Design  : A cycle replays the allocation pattern of an ECDSA P-256
+ *           operation in Mbed TLS with 32-bit limbs: long-lived operands
+ *           (big numbers, points, a comb table in the bump region), then
+ *           temporaries that come and go in random order around them,
+ *           then the operands freed in random order and crypto_arena_reset().
+ *           Every SOAK_LEAK_EVERY-th cycle also allocates a bump block and
+ *           never frees it, which crypto_arena_reset() must reclaim.
+ *
+ *           The run is split into SOAK_WINDOWS windows. Per window it
+ *           prints the mean and worst cycle time and the arena peaks.
+ ********************************************************************************
+ * @file    crypto_arena_soak.c
+ * @brief   One-million-cycle memory and latency soak of the crypto arena
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "crypto_arena.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SOAK_CYCLES                   (1000000U)
+#define SOAK_WINDOWS                  (10U)
+#define SOAK_LEAK_EVERY               (1000U)
+#define SOAK_LEAK_SIZE                (700U)
+#define SOAK_MAX_LIVE                 (16U)
+#define SOAK_DRIFT_LIMIT              (3U)     /**< Worst window mean / best window mean */
+
+#define SOAK_CHECK(cond, what) soak_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief Allocation pattern of one operation */
+typedef struct
+{
+    const uint16_t *operands;       /**< Held for the whole operation */
+    uint32_t        operand_count;
+    const uint16_t *temporaries;    /**< Allocated and freed around them */
+    uint32_t        temporary_count;
+} soak_trace_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/* Sign: k, r, s, the hash and the key as 8-limb numbers, R as a point and
+ * an 8-point comb table */
+static const uint16_t soak_sign_operands[] = { 32U, 32U, 32U, 32U, 32U, 96U, 36U, 1056U };
+static const uint16_t soak_sign_temporaries[] = { 68U, 68U, 32U, 136U, 64U, 96U, 272U, 32U, 68U, 600U };
+
+/* Verify: r, s, the hash, u1, u2, the public key and the sum point, and a
+ * comb table for each of the two multiplications */
+static const uint16_t soak_verify_operands[] = { 32U, 32U, 32U, 32U, 32U, 96U, 96U, 1056U, 1056U };
+static const uint16_t soak_verify_temporaries[] = { 68U, 136U, 68U, 32U, 480U, 64U, 68U, 256U };
+
+static const soak_trace_t soak_traces[] =
+{
+    { soak_sign_operands,   sizeof(soak_sign_operands) / sizeof(uint16_t),
+      soak_sign_temporaries,   sizeof(soak_sign_temporaries) / sizeof(uint16_t) },
+    { soak_verify_operands, sizeof(soak_verify_operands) / sizeof(uint16_t),
+      soak_verify_temporaries, sizeof(soak_verify_temporaries) / sizeof(uint16_t) },
+};
+
+static uint32_t     soak_seed = 0x2545F491U;
+static unsigned int soak_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void soak_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        soak_failures++;
+    }
+}
+
+static uint32_t soak_random(uint32_t bound)
+{
+    soak_seed ^= soak_seed << 13;
+    soak_seed ^= soak_seed >> 17;
+    soak_seed ^= soak_seed << 5;
+    return soak_seed % bound;
+}
+
+static uint64_t soak_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Free @p count blocks in random order */
+static void soak_free_shuffled(void **blocks, uint32_t count)
+{
+    while (count > 0U)
+    {
+        uint32_t pick = soak_random(count);
+
+        crypto_arena_free(blocks[pick]);
+        blocks[pick] = blocks[--count];
+    }
+}
+
+/** @brief One operation; with @p leak it forgets a bump block */
+static bool soak_cycle(const soak_trace_t *trace, bool leak)
+{
+    void *operands[SOAK_MAX_LIVE];
+    void *temporaries[SOAK_MAX_LIVE];
+    uint32_t live = 0;
+    bool ok = true;
+
+    for (uint32_t i = 0; i < trace->operand_count; i++)
+    {
+        operands[i] = crypto_arena_calloc(1U, trace->operands[i]);
+        ok = ok && (operands[i] != NULL);
+    }
+
+    /* Temporaries: allocate two, free one at random, so a few stay live */
+    for (uint32_t i = 0; i < trace->temporary_count; i++)
+    {
+        temporaries[live] = crypto_arena_calloc(1U, trace->temporaries[i]);
+        ok = ok && (temporaries[live] != NULL);
+        live++;
+        if ((i % 2U) == 1U)
+        {
+            uint32_t pick = soak_random(live);
+
+            crypto_arena_free(temporaries[pick]);
+            temporaries[pick] = temporaries[--live];
+        }
+    }
+    if (leak)
+    {
+        /* A bump block the operation never frees */
+        ok = ok && (crypto_arena_calloc(1U, SOAK_LEAK_SIZE) != NULL);
+    }
+
+    soak_free_shuffled(temporaries, live);
+    soak_free_shuffled(operands, trace->operand_count);
+    crypto_arena_reset();
+    return ok;
+}
+
+int main(void)
+{
+    crypto_arena_stats_t first;
+    crypto_arena_stats_t stats;
+    uint64_t window_mean[SOAK_WINDOWS];
+    uint32_t window_cycles = SOAK_CYCLES / SOAK_WINDOWS;
+    uint32_t leaks = 0;
+    uint64_t best = UINT64_MAX;
+    uint64_t worst_mean = 0;
+    bool ok;
+
+    crypto_arena_init();
+    memset(&first, 0, sizeof(first));
+
+    printf("Crypto arena soak: %u sign/verify cycles in %u windows\n", SOAK_CYCLES, SOAK_WINDOWS);
+    for (uint32_t w = 0; w < SOAK_WINDOWS; w++)
+    {
+        uint64_t worst = 0;
+        uint64_t start = soak_now_ns();
+
+        for (uint32_t n = 0; n < window_cycles; n++)
+        {
+            uint32_t cycle = (w * window_cycles) + n;
+            bool leak = ((cycle % SOAK_LEAK_EVERY) == (SOAK_LEAK_EVERY - 1U));
+            uint64_t t0 = soak_now_ns();
+            bool served = soak_cycle(&soak_traces[cycle % 2U], leak);
+            uint64_t elapsed = soak_now_ns() - t0;
+
+            leaks += leak ? 1U : 0U;
+            worst = (elapsed > worst) ? elapsed : worst;
+            if (!served)
+            {
+                SOAK_CHECK(false, "every allocation served");
+                break;
+            }
+        }
+        window_mean[w] = (soak_now_ns() - start) / window_cycles;
+
+        crypto_arena_get_stats(&stats);
+        printf("  window %2lu: %4lu ns/cycle mean, %7lu ns worst, peak %lu bytes, bump peak %lu\n",
+               (unsigned long)w, (unsigned long)window_mean[w], (unsigned long)worst,
+               (unsigned long)stats.bytes_peak, (unsigned long)stats.bump_peak);
+
+        SOAK_CHECK((stats.bytes_in_use == 0U) && (stats.slack_bytes == 0U) && (stats.bump_used == 0U),
+                   "arena empty after the window");
+        if (w == 0U)
+        {
+            first = stats;
+            continue;
+        }
+        SOAK_CHECK((stats.bytes_peak == first.bytes_peak) && (stats.bump_peak == first.bump_peak),
+                   "byte and bump high-water marks flat after the first window");
+        for (uint32_t c = 0; c < CRYPTO_ARENA_CLASSES; c++)
+        {
+            SOAK_CHECK(stats.classes[c].peak == first.classes[c].peak, "class high-water mark flat");
+            SOAK_CHECK(stats.classes[c].in_use == 0U, "class empty after the window");
+        }
+    }
+
+    for (uint32_t w = 0; w < SOAK_WINDOWS; w++)
+    {
+        best = (window_mean[w] < best) ? window_mean[w] : best;
+        worst_mean = (window_mean[w] > worst_mean) ? window_mean[w] : worst_mean;
+    }
+    printf("Classes 32..512 peak:");
+    for (uint32_t c = 0; c < CRYPTO_ARENA_CLASSES; c++)
+    {
+        printf(" %u/%u", stats.classes[c].peak, stats.classes[c].blocks);
+    }
+    printf(", %lu allocations, %lu fallbacks, %lu failed, %lu reclaimed by reset\n",
+           (unsigned long)stats.allocs, (unsigned long)stats.fallbacks,
+           (unsigned long)stats.failures, (unsigned long)stats.bump_reclaimed);
+
+    SOAK_CHECK(stats.failures == 0U, "no failed allocation");
+    SOAK_CHECK(stats.bump_reclaimed == leaks, "reset reclaims every forgotten bump block");
+    SOAK_CHECK(worst_mean <= (best * SOAK_DRIFT_LIMIT), "time per cycle does not drift");
+
+    ok = (soak_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
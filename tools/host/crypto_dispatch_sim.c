@@ -0,0 +1,276 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : crypto_dispatch host check
+ * Purpose : Calibrate proj_cm33_ns/crypto_dispatch.c against two mock
+ *           backends with known costs and check the selected table, the
+ *           routing of calls and the handling of failing backends.
+ * Design  : Time is simulated: the DWT cycle counter reads sim_now, and
+ *           each backend advances it by its cost model before it returns.
+ *           The PSA backend is the built-in one over a psa_hash_compute()
+ *           defined here, with a fixed secure call overhead plus a small
+ *           cost per byte. The software backend is registered as a mock
+ *           with no overhead and a higher cost per byte. Both compute the
+ *           real digest with sha256_sw, so the results are checked too.
+ ********************************************************************************
+ * @file    crypto_dispatch_sim.c
+ * @brief   Mock two-backend check of the crypto dispatcher
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto_dispatch.h"
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_PSA_OVERHEAD              (3000U)   /**< Ticks per secure call */
+#define SIM_PSA_PER_BYTE              (2U)
+#define SIM_SW_OVERHEAD               (100U)
+#define SIM_SW_PER_BYTE               (12U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static const size_t sim_sizes[CRYPTO_DISPATCH_BUCKETS] = CRYPTO_DISPATCH_CAL_SIZES;
+
+static uint32_t     sim_now;
+static bool         sim_psa_fails;
+static uint32_t     sim_flaky_calls;
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Simulated DWT cycle counter (HOST_DWT_CLOCK) */
+uint32_t sim_clock(void)
+{
+    return sim_now;
+}
+
+static psa_status_t sim_digest(const uint8_t *input, size_t input_len,
+                               uint8_t *output, size_t output_size, size_t *output_len)
+{
+    if (output_size < SHA256_SW_DIGEST_SIZE)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    sha256_sw(input, input_len, output);
+    *output_len = SHA256_SW_DIGEST_SIZE;
+    return PSA_SUCCESS;
+}
+
+/** @brief TF-M model behind the built-in PSA backend */
+psa_status_t psa_hash_compute(psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                              uint8_t *hash, size_t hash_size, size_t *hash_length)
+{
+    sim_now += SIM_PSA_OVERHEAD;
+    if (sim_psa_fails || (alg != PSA_ALG_SHA_256))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    sim_now += SIM_PSA_PER_BYTE * (uint32_t)input_length;
+    return sim_digest(input, input_length, hash, hash_size, hash_length);
+}
+
+static psa_status_t sim_sw(const uint8_t *input, size_t input_len,
+                           uint8_t *output, size_t output_size, size_t *output_len)
+{
+    sim_now += SIM_SW_OVERHEAD + (SIM_SW_PER_BYTE * (uint32_t)input_len);
+    return sim_digest(input, input_len, output, output_size, output_len);
+}
+
+/** @brief Passes the untimed first call at each size, then fails at once */
+static psa_status_t sim_sw_flaky(const uint8_t *input, size_t input_len,
+                                 uint8_t *output, size_t output_size, size_t *output_len)
+{
+    if (((sim_flaky_calls++) % (CRYPTO_DISPATCH_CAL_RUNS + 1U)) == 0U)
+    {
+        return sim_sw(input, input_len, output, output_size, output_len);
+    }
+    sim_now += 1U;
+    return PSA_ERROR_CORRUPTION_DETECTED;
+}
+
+static uint32_t sim_psa_cost(size_t len)
+{
+    return SIM_PSA_OVERHEAD + (SIM_PSA_PER_BYTE * (uint32_t)len);
+}
+
+static uint32_t sim_sw_cost(size_t len)
+{
+    return SIM_SW_OVERHEAD + (SIM_SW_PER_BYTE * (uint32_t)len);
+}
+
+/** @brief Calibrate both mocks: the cheaper one wins each bucket, timings are exact */
+static void sim_calibration(void)
+{
+    crypto_dispatch_table_t table;
+    crypto_dispatch_stats_t stats;
+
+    crypto_dispatch_init();
+    crypto_dispatch_register(CRYPTO_OP_SHA256, CRYPTO_BACKEND_SW, sim_sw);
+    SIM_CHECK(crypto_dispatch_calibrate() == PSA_SUCCESS, "calibration with two backends");
+
+    crypto_dispatch_get_table(&table);
+    crypto_dispatch_get_stats(CRYPTO_OP_SHA256, &stats);
+    printf("Calibration (ticks per call PSA / SW):\n");
+    for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+    {
+        uint8_t expected = (sim_sw_cost(sim_sizes[b]) < sim_psa_cost(sim_sizes[b])) ?
+                           CRYPTO_BACKEND_SW : CRYPTO_BACKEND_PSA;
+
+        printf("  <= %4lu B: %6lu / %6lu -> %s\n", (unsigned long)sim_sizes[b],
+               (unsigned long)stats.ticks[b][CRYPTO_BACKEND_PSA],
+               (unsigned long)stats.ticks[b][CRYPTO_BACKEND_SW],
+               (table.backend[CRYPTO_OP_SHA256][b] == CRYPTO_BACKEND_SW) ? "SW" : "PSA");
+        SIM_CHECK(stats.ticks[b][CRYPTO_BACKEND_PSA] == sim_psa_cost(sim_sizes[b]), "PSA timing");
+        SIM_CHECK(stats.ticks[b][CRYPTO_BACKEND_SW] == sim_sw_cost(sim_sizes[b]), "SW timing");
+        SIM_CHECK(table.backend[CRYPTO_OP_SHA256][b] == expected, "cheaper backend selected");
+    }
+}
+
+/** @brief Calls go to the backend of their size bucket and return the right digest */
+static void sim_routing(void)
+{
+    static const size_t lengths[] = { 0U, 10U, 64U, 65U, 256U, 300U, 5000U };
+    static uint8_t input[5000];
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t expected[SHA256_SW_DIGEST_SIZE];
+    crypto_dispatch_stats_t stats;
+    uint32_t sw_calls = 0;
+
+    for (uint32_t i = 0; i < sizeof(input); i++)
+    {
+        input[i] = (uint8_t)(i * 7U);
+    }
+
+    for (uint32_t i = 0; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+    {
+        /* Bucket of the length: the first calibration size that holds it */
+        uint32_t b = 0;
+
+        while ((b < (CRYPTO_DISPATCH_BUCKETS - 1U)) && (lengths[i] > sim_sizes[b]))
+        {
+            b++;
+        }
+        sw_calls += (sim_sw_cost(sim_sizes[b]) < sim_psa_cost(sim_sizes[b])) ? 1U : 0U;
+
+        sha256_sw(input, lengths[i], expected);
+        SIM_CHECK(crypto_dispatch_sha256(input, lengths[i], digest) == PSA_SUCCESS, "dispatched digest");
+        SIM_CHECK(memcmp(digest, expected, sizeof(digest)) == 0, "digest matches");
+    }
+
+    crypto_dispatch_get_stats(CRYPTO_OP_SHA256, &stats);
+    printf("Routing: %lu calls to SW, %lu to PSA\n",
+           (unsigned long)stats.calls[CRYPTO_BACKEND_SW], (unsigned long)stats.calls[CRYPTO_BACKEND_PSA]);
+    SIM_CHECK(stats.calls[CRYPTO_BACKEND_SW] == sw_calls, "calls routed to SW by size");
+    SIM_CHECK(stats.calls[CRYPTO_BACKEND_PSA] == ((sizeof(lengths) / sizeof(lengths[0])) - sw_calls),
+              "calls routed to PSA by size");
+}
+
+/** @brief Backends that return errors never win a bucket */
+static void sim_failing_backends(void)
+{
+    crypto_dispatch_table_t table;
+    crypto_dispatch_stats_t stats;
+
+    /* Fast but failing in the timed runs: PSA everywhere */
+    crypto_dispatch_init();
+    crypto_dispatch_register(CRYPTO_OP_SHA256, CRYPTO_BACKEND_SW, sim_sw_flaky);
+    SIM_CHECK(crypto_dispatch_calibrate() == PSA_SUCCESS, "calibration with one working backend");
+    crypto_dispatch_get_table(&table);
+    crypto_dispatch_get_stats(CRYPTO_OP_SHA256, &stats);
+    for (uint32_t b = 0; b < CRYPTO_DISPATCH_BUCKETS; b++)
+    {
+        SIM_CHECK(table.backend[CRYPTO_OP_SHA256][b] == CRYPTO_BACKEND_PSA, "failing backend rejected");
+        SIM_CHECK(stats.ticks[b][CRYPTO_BACKEND_SW] == UINT32_MAX, "failing backend marked");
+    }
+
+    /* Missing backend */
+    crypto_dispatch_init();
+    crypto_dispatch_register(CRYPTO_OP_SHA256, CRYPTO_BACKEND_SW, NULL);
+    SIM_CHECK(crypto_dispatch_calibrate() == PSA_SUCCESS, "calibration without SW");
+    crypto_dispatch_get_table(&table);
+    SIM_CHECK(table.backend[CRYPTO_OP_SHA256][0] == CRYPTO_BACKEND_PSA, "missing backend not selected");
+
+    /* Nothing works */
+    sim_psa_fails = true;
+    crypto_dispatch_register(CRYPTO_OP_SHA256, CRYPTO_BACKEND_SW, sim_sw_flaky);
+    SIM_CHECK(crypto_dispatch_calibrate() == PSA_ERROR_NOT_SUPPORTED, "no working backend reported");
+    sim_psa_fails = false;
+
+    printf("Failing backends: rejected in every bucket\n");
+}
+
+/** @brief A stored table is applied only if every entry names a backend */
+static void sim_stored_table(void)
+{
+    crypto_dispatch_table_t stored;
+    crypto_dispatch_table_t table;
+
+    crypto_dispatch_init();
+    crypto_dispatch_register(CRYPTO_OP_SHA256, CRYPTO_BACKEND_SW, sim_sw);
+    memset(&stored, CRYPTO_BACKEND_PSA, sizeof(stored));
+    stored.backend[CRYPTO_OP_SHA256][0] = CRYPTO_BACKEND_SW;
+    SIM_CHECK(crypto_dispatch_set_table(&stored) == PSA_SUCCESS, "stored table accepted");
+    crypto_dispatch_get_table(&table);
+    SIM_CHECK(memcmp(&table, &stored, sizeof(table)) == 0, "stored table round trip");
+
+    stored.backend[CRYPTO_OP_SHA256][1] = CRYPTO_BACKEND_COUNT;
+    SIM_CHECK(crypto_dispatch_set_table(&stored) == PSA_ERROR_INVALID_ARGUMENT, "bad entry rejected");
+    crypto_dispatch_get_table(&table);
+    SIM_CHECK(table.backend[CRYPTO_OP_SHA256][1] == CRYPTO_BACKEND_PSA, "table kept on a bad entry");
+
+    printf("Stored table: applied without calibration, bad entries rejected\n");
+}
+
+int main(void)
+{
+    bool ok;
+
+    sim_calibration();
+    sim_routing();
+    sim_failing_backends();
+    sim_stored_table();
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,323 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : csr_write host check
+ * Purpose : Run proj_cm33_ns/csr_write.c and der_write.c on the host: the
+ *           known-answer test, a DER and a PEM request written through a
+ *           file sink for "openssl req -verify" (run by make check), and
+ *           the peak stack of one csr_write() call.
+ * Design  : signing.c runs on host_psa.c with deterministic ECDSA, so the
+ *           DER and the PEM request carry the same signature and the
+ *           Makefile can compare them byte for byte after OpenSSL has
+ *           decoded the PEM. csr_write() runs on a thread whose stack is
+ *           painted; the Makefile links with --wrap for
+ *           psa_export_public_key() and psa_sign_hash(), and the wrappers
+ *           hand the call to a second thread that runs OpenSSL, as TF-M
+ *           runs on the secure stack, so the window holds the non-secure
+ *           frames and a spinning handoff in place of the veneer. The
+ *           peak of a thread that returns at once is subtracted.
+ ********************************************************************************
+ * @file    csr_write_sim.c
+ * @brief   CSR files for OpenSSL and peak stack of csr_write() on the host
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "csr_write.h"
+#include "stack_usage.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_STACK_BYTES               (64U * 1024U)
+
+/** @brief Stack budget of csr_write() with a counting sink, on the host ABI */
+#define SIM_STACK_MAX                 (2048U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief One csr_write() call on the painted thread */
+typedef struct
+{
+    signing_key_t       *key;
+    const csr_subject_t *subject;
+    csr_format_t         format;
+    der_sink_fn_t        sink;
+    void                *arg;
+    size_t               len;
+    psa_status_t         status;
+} sim_call_t;
+
+/** @brief One PSA call on the secure-side thread */
+typedef struct
+{
+    bool            sign;       /**< psa_sign_hash(), else psa_export_public_key() */
+    psa_key_id_t    key;
+    psa_algorithm_t alg;
+    const uint8_t  *in;
+    size_t          in_len;
+    uint8_t        *out;
+    size_t          out_size;
+    size_t         *out_len;
+    psa_status_t    status;
+} sim_secure_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint64_t     sim_stack[SIM_STACK_BYTES / sizeof(uint64_t)];
+static sim_secure_t *sim_secure_call;   /**< Posted call, NULL once it has run */
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+psa_status_t __real_psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                          size_t *data_length);
+psa_status_t __real_psa_sign_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                                  size_t hash_length, uint8_t *signature, size_t signature_size,
+                                  size_t *signature_length);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Secure-side thread: runs each posted call on its own stack */
+static void *sim_secure_thread(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        while (__atomic_load_n(&sim_secure_call, __ATOMIC_ACQUIRE) == NULL)
+        {
+            (void)sched_yield();
+        }
+        if (sim_secure_call->sign)
+        {
+            sim_secure_call->status = __real_psa_sign_hash(sim_secure_call->key, sim_secure_call->alg,
+                                                           sim_secure_call->in, sim_secure_call->in_len,
+                                                           sim_secure_call->out, sim_secure_call->out_size,
+                                                           sim_secure_call->out_len);
+        }
+        else
+        {
+            sim_secure_call->status = __real_psa_export_public_key(sim_secure_call->key, sim_secure_call->out,
+                                                                   sim_secure_call->out_size,
+                                                                   sim_secure_call->out_len);
+        }
+        __atomic_store_n(&sim_secure_call, NULL, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Hand @p call to the secure-side thread and wait, as a veneer call
+ *        would; a flag and sched_yield(), so the handoff takes the same few
+ *        bytes of stack however the threads interleave
+ */
+static psa_status_t sim_secure(sim_secure_t *call)
+{
+    __atomic_store_n(&sim_secure_call, call, __ATOMIC_RELEASE);
+    while (__atomic_load_n(&sim_secure_call, __ATOMIC_ACQUIRE) != NULL)
+    {
+        (void)sched_yield();
+    }
+    return call->status;
+}
+
+psa_status_t __wrap_psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                          size_t *data_length)
+{
+    sim_secure_t call = { false, key, 0U, NULL, 0U, data, data_size, data_length, PSA_SUCCESS };
+
+    return sim_secure(&call);
+}
+
+psa_status_t __wrap_psa_sign_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                                  size_t hash_length, uint8_t *signature, size_t signature_size,
+                                  size_t *signature_length)
+{
+    sim_secure_t call = { true, key, alg, hash, hash_length, signature, signature_size, signature_length, PSA_SUCCESS };
+
+    return sim_secure(&call);
+}
+
+/** @brief der_sink_fn_t writing to a FILE */
+static void sim_file_sink(void *arg, const uint8_t *data, size_t len)
+{
+    (void)fwrite(data, 1U, len, (FILE *)arg);
+}
+
+/** @brief der_sink_fn_t that only counts, so the stack figure is the encoder's */
+static void sim_null_sink(void *arg, const uint8_t *data, size_t len)
+{
+    (void)data;
+    *(size_t *)arg += len;
+}
+
+static void *sim_call_thread(void *arg)
+{
+    sim_call_t *call = arg;
+
+    if (call->key != NULL)
+    {
+        call->status = csr_write(call->key, call->subject, call->format, call->sink, call->arg, &call->len);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Peak stack of one call on the painted thread
+ *
+ * @return Bytes written below the thread's entry, or 0 if the thread failed
+ */
+static uint32_t sim_stack_peak(sim_call_t *call)
+{
+    uint32_t *limit = (uint32_t *)sim_stack;
+    uint32_t *top = (uint32_t *)&sim_stack[sizeof(sim_stack) / sizeof(sim_stack[0])];
+    pthread_attr_t attr;
+    pthread_t thread;
+    bool ran;
+
+    stack_usage_paint(limit, top);
+    ran = (pthread_attr_init(&attr) == 0) &&
+          (pthread_attr_setstack(&attr, sim_stack, sizeof(sim_stack)) == 0) &&
+          (pthread_create(&thread, &attr, sim_call_thread, call) == 0);
+    if (ran)
+    {
+        (void)pthread_join(thread, NULL);
+    }
+    (void)pthread_attr_destroy(&attr);
+    return ran ? stack_usage_measure(limit, top) : 0U;
+}
+
+/** @brief Write @p format to @p path through the file sink */
+static bool sim_write_file(signing_key_t *key, const csr_subject_t *subject, csr_format_t format,
+                           const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "wb");
+    psa_status_t status;
+
+    if (f == NULL)
+    {
+        return false;
+    }
+    status = csr_write(key, subject, format, sim_file_sink, f, len);
+    return (fclose(f) == 0) && (status == PSA_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+    static const char long_value[] = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    const csr_subject_t subject = { "psoc-edge-demo", "TESA", "TH", "0001" };
+    const csr_subject_t long_subject = { long_value, long_value, "TH", long_value };
+    size_t der_len = 0;
+    size_t pem_len = 0;
+    size_t long_len = 0;
+    size_t counted = 0;
+    sim_call_t call;
+    signing_key_t key;
+    uint32_t baseline;
+    uint32_t short_peak;
+    uint32_t long_peak;
+    uint32_t file_peak;
+    psa_status_t status;
+    FILE *pem = NULL;
+    pthread_t secure;
+    bool ok;
+
+    if (argc != 3)
+    {
+        printf("usage: %s <csr.der> <csr.pem>\n", argv[0]);
+        return 1;
+    }
+
+    SIM_CHECK(pthread_create(&secure, NULL, sim_secure_thread, NULL) == 0, "secure-side thread");
+    SIM_CHECK(signing_init() == PSA_SUCCESS, "signing_init");
+    status = csr_self_test();
+    printf("CSR known-answer test: %s\n", (status == PSA_SUCCESS) ? "pass" : "FAIL");
+    SIM_CHECK(status == PSA_SUCCESS, "csr_self_test");
+
+    SIM_CHECK(signing_key_generate(&config, &key) == PSA_SUCCESS, "deterministic P-256 key");
+    SIM_CHECK(sim_write_file(&key, &subject, CSR_FORMAT_DER, argv[1], &der_len), "DER request written");
+    SIM_CHECK(sim_write_file(&key, &subject, CSR_FORMAT_PEM, argv[2], &pem_len), "PEM request written");
+    printf("Request: %lu B DER in %s, %lu B PEM in %s\n", (unsigned long)der_len, argv[1],
+           (unsigned long)pem_len, argv[2]);
+
+    /* Stack: thread start alone, then the request with a counting and with the file sink */
+    memset(&call, 0, sizeof(call));
+    baseline = sim_stack_peak(&call);
+
+    call = (sim_call_t){ &key, &subject, CSR_FORMAT_PEM, sim_null_sink, &counted, 0U, PSA_ERROR_BAD_STATE };
+    short_peak = sim_stack_peak(&call) - baseline;
+    SIM_CHECK((call.status == PSA_SUCCESS) && (call.len == pem_len) && (counted == pem_len), "counted request");
+
+    counted = 0;
+    call = (sim_call_t){ &key, &long_subject, CSR_FORMAT_PEM, sim_null_sink, &counted, 0U, PSA_ERROR_BAD_STATE };
+    long_peak = sim_stack_peak(&call) - baseline;
+    long_len = call.len;
+    SIM_CHECK((call.status == PSA_SUCCESS) && (long_len > pem_len), "longer request");
+
+    pem = fopen(argv[2], "wb");
+    call = (sim_call_t){ (pem != NULL) ? &key : NULL, &subject, CSR_FORMAT_PEM, sim_file_sink, pem, 0U, PSA_ERROR_BAD_STATE };
+    file_peak = sim_stack_peak(&call) - baseline;
+    SIM_CHECK((pem != NULL) && (fclose(pem) == 0) && (call.status == PSA_SUCCESS), "PEM rewritten from the painted thread");
+
+    printf("csr_write() peak stack, secure calls excluded (bytes):\n");
+    printf("  %4lu B PEM, counting sink  %5lu\n", (unsigned long)pem_len, (unsigned long)short_peak);
+    printf("  %4lu B PEM, counting sink  %5lu\n", (unsigned long)long_len, (unsigned long)long_peak);
+    printf("  %4lu B PEM, file sink      %5lu  (stdio included)\n", (unsigned long)pem_len, (unsigned long)file_peak);
+    printf("  DER writer state %lu bytes, no request buffer\n", (unsigned long)sizeof(der_writer_t));
+    SIM_CHECK(short_peak <= SIM_STACK_MAX, "stack within budget");
+    /* Painting only sees written words, so the two paths may differ by a few; more would mean a buffer that grows */
+    SIM_CHECK(long_peak <= short_peak, "a longer request needs no more stack");
+    signing_key_destroy(&key);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,323 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : ecdsa_der host fuzz
+ * Purpose : Fuzz proj_cm33_ns/ecdsa_der.c against OpenSSL on the host, under
+ *           AddressSanitizer and UBSan: the decoder must accept exactly the
+ *           strict DER signatures that OpenSSL parses and re-encodes to the
+ *           same bytes, and the encoder must match OpenSSL for any r || s.
+ * Design  : LLVMFuzzerTestOneInput() checks one input. The first byte picks
+ *           P-256 or P-384, the rest is the DER record. Accepted records must
+ *           give OpenSSL's r and s and re-encode to themselves, also when
+ *           converted in place; rejected ones must fail OpenSSL's parse,
+ *           re-encode differently, or hold a negative or oversized integer.
+ *
+ *           Without libFuzzer, main() feeds it FUZZ_ITERATIONS inputs: one
+ *           to three byte flips, cuts and appends on valid records, as the
+ *           device benchmark does, and random bytes. Raw signatures with
+ *           leading zero bytes and set top bits are round-tripped through
+ *           both directions and the batch calls. With clang, build with
+ *           -fsanitize=fuzzer -DECDSA_DER_LIBFUZZER to run under libFuzzer.
+ ********************************************************************************
+ * @file    ecdsa_der_fuzz.c
+ * @brief   Differential fuzz and round-trip check of the DER signature codec
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/ecdsa.h>
+
+#include "ecdsa_der.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define FUZZ_ITERATIONS               (200000U)
+#define FUZZ_BATCH                    (64U)
+#define FUZZ_RECORD_MAX               (ECDSA_DER_MAX_SIZE(ECDSA_DER_COORD_MAX) + 8U)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint32_t fuzz_accepted;
+#if !defined(ECDSA_DER_LIBFUZZER)
+static uint32_t fuzz_seed = 0x2545F491U;
+#endif
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief Report a property violation with the input and stop */
+static void fuzz_fail(const char *what, const uint8_t *data, size_t size)
+{
+    printf("  FAIL: %s, input:", what);
+    for (size_t i = 0; i < size; i++)
+    {
+        printf(" %02x", data[i]);
+    }
+    printf("\nFAIL\n");
+    (void)fflush(stdout);
+    abort();
+}
+
+/** @brief OpenSSL's strict-DER verdict; r || s in @p raw when it accepts */
+static bool fuzz_openssl_decode(const uint8_t *der, size_t len, size_t n, uint8_t *raw)
+{
+    const unsigned char *p = der;
+    ECDSA_SIG *sig = d2i_ECDSA_SIG(NULL, &p, (long)len);
+    unsigned char *again = NULL;
+    const BIGNUM *r;
+    const BIGNUM *s;
+    bool ok;
+    int again_len;
+
+    if (sig == NULL)
+    {
+        return false;
+    }
+    ECDSA_SIG_get0(sig, &r, &s);
+    again_len = i2d_ECDSA_SIG(sig, &again);
+    ok = (p == (der + len)) && (again_len == (int)len) && (memcmp(again, der, len) == 0) &&
+         !BN_is_negative(r) && !BN_is_negative(s) &&
+         ((size_t)BN_num_bytes(r) <= n) && ((size_t)BN_num_bytes(s) <= n);
+    if (ok)
+    {
+        (void)BN_bn2binpad(r, raw, (int)n);
+        (void)BN_bn2binpad(s, &raw[n], (int)n);
+    }
+    OPENSSL_free(again);
+    ECDSA_SIG_free(sig);
+    return ok;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    uint8_t raw[2U * ECDSA_DER_COORD_MAX];
+    uint8_t expected[2U * ECDSA_DER_COORD_MAX];
+    uint8_t der[FUZZ_RECORD_MAX];
+    uint8_t in_place[FUZZ_RECORD_MAX];
+    size_t n;
+    size_t der_len = 0;
+    bool ours;
+
+    if ((size < 1U) || ((size - 1U) > FUZZ_RECORD_MAX))
+    {
+        return 0;
+    }
+    n = ((data[0] & 1U) != 0U) ? 48U : 32U;
+
+    ours = (ecdsa_der_to_raw(&data[1], size - 1U, n, raw, sizeof(raw)) == PSA_SUCCESS);
+    if (ours != fuzz_openssl_decode(&data[1], size - 1U, n, expected))
+    {
+        fuzz_fail(ours ? "accepted a record OpenSSL rejects" : "rejected a strict DER record", data, size);
+    }
+    if (!ours)
+    {
+        return 0;
+    }
+    fuzz_accepted++;
+
+    if (memcmp(raw, expected, 2U * n) != 0)
+    {
+        fuzz_fail("r || s differs from OpenSSL", data, size);
+    }
+    if ((ecdsa_raw_to_der(raw, 2U * n, der, sizeof(der), &der_len) != PSA_SUCCESS) ||
+        (der_len != (size - 1U)) || (memcmp(der, &data[1], der_len) != 0))
+    {
+        fuzz_fail("accepted record does not re-encode to itself", data, size);
+    }
+
+    /* In place: DER to raw in the same buffer, then back */
+    memcpy(in_place, &data[1], size - 1U);
+    if ((ecdsa_der_to_raw(in_place, size - 1U, n, in_place, sizeof(in_place)) != PSA_SUCCESS) ||
+        (memcmp(in_place, raw, 2U * n) != 0) ||
+        (ecdsa_raw_to_der(in_place, 2U * n, in_place, sizeof(in_place), &der_len) != PSA_SUCCESS) ||
+        (memcmp(in_place, &data[1], der_len) != 0))
+    {
+        fuzz_fail("in-place conversion differs", data, size);
+    }
+    return 0;
+}
+
+#if !defined(ECDSA_DER_LIBFUZZER)
+static uint32_t fuzz_random(uint32_t bound)
+{
+    fuzz_seed ^= fuzz_seed << 13;
+    fuzz_seed ^= fuzz_seed >> 17;
+    fuzz_seed ^= fuzz_seed << 5;
+    return fuzz_seed % bound;
+}
+
+/** @brief Random r || s with the byte patterns the encoder branches on */
+static void fuzz_raw(uint8_t *raw, size_t n)
+{
+    for (size_t i = 0; i < (2U * n); i++)
+    {
+        raw[i] = (uint8_t)fuzz_random(256U);
+    }
+    for (size_t half = 0; half < 2U; half++)
+    {
+        switch (fuzz_random(5U))
+        {
+            case 0U:
+                memset(&raw[half * n], 0, fuzz_random((uint32_t)n + 1U));     /* leading zeros, or zero */
+                break;
+            case 1U:
+                raw[half * n] |= 0x80U;                                         /* needs a 0x00 pad */
+                break;
+            case 2U:
+                memset(&raw[half * n], 0, n - 1U);                              /* one byte left */
+                raw[(half * n) + n - 1U] |= (uint8_t)(fuzz_random(2U) << 7);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/** @brief Encoder against OpenSSL's i2d for one raw signature; DER in @p der */
+static size_t fuzz_encode(const uint8_t *raw, size_t n, uint8_t *der)
+{
+    ECDSA_SIG *sig = ECDSA_SIG_new();
+    unsigned char *expected = NULL;
+    size_t der_len = 0;
+    int expected_len;
+
+    (void)ECDSA_SIG_set0(sig, BN_bin2bn(raw, (int)n, NULL), BN_bin2bn(&raw[n], (int)n, NULL));
+    expected_len = i2d_ECDSA_SIG(sig, &expected);
+    if ((ecdsa_raw_to_der(raw, 2U * n, der, ECDSA_DER_MAX_SIZE(n), &der_len) != PSA_SUCCESS) ||
+        (der_len != (size_t)expected_len) || (memcmp(der, expected, der_len) != 0))
+    {
+        fuzz_fail("encoding differs from OpenSSL", raw, 2U * n);
+    }
+    OPENSSL_free(expected);
+    ECDSA_SIG_free(sig);
+    return der_len;
+}
+
+/** @brief A batch of FUZZ_BATCH signatures through both batch calls */
+static void fuzz_batch(size_t n)
+{
+    static uint8_t raw[FUZZ_BATCH][2U * ECDSA_DER_COORD_MAX];
+    static uint8_t back[FUZZ_BATCH][2U * ECDSA_DER_COORD_MAX];
+    static uint8_t der[FUZZ_BATCH * ECDSA_DER_MAX_SIZE(ECDSA_DER_COORD_MAX)];
+    uint8_t packed[FUZZ_BATCH * 2U * ECDSA_DER_COORD_MAX];
+    size_t der_len = 0;
+    size_t done = 0;
+
+    for (uint32_t i = 0; i < FUZZ_BATCH; i++)
+    {
+        fuzz_raw(raw[i], n);
+        memcpy(&packed[i * 2U * n], raw[i], 2U * n);
+    }
+    if ((ecdsa_raw_to_der_batch(packed, n, FUZZ_BATCH, der, sizeof(der), &der_len, &done) != PSA_SUCCESS) ||
+        (done != FUZZ_BATCH) ||
+        (ecdsa_der_to_raw_batch(der, der_len, n, &back[0][0], FUZZ_BATCH, &done) != PSA_SUCCESS) ||
+        (done != FUZZ_BATCH))
+    {
+        fuzz_fail("batch conversion", packed, 2U * n);
+    }
+    for (uint32_t i = 0; i < FUZZ_BATCH; i++)
+    {
+        if (memcmp(&back[0][0] + (i * 2U * n), raw[i], 2U * n) != 0)
+        {
+            fuzz_fail("batch round trip", raw[i], 2U * n);
+        }
+    }
+}
+
+int main(void)
+{
+    uint8_t input[1U + FUZZ_RECORD_MAX];
+    uint8_t raw[2U * ECDSA_DER_COORD_MAX];
+    uint32_t mutated = 0;
+
+    if (ecdsa_der_self_test() != PSA_SUCCESS)
+    {
+        printf("ecdsa_der_self_test failed\nFAIL\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        size_t n = (fuzz_random(4U) == 0U) ? 48U : 32U;
+        size_t len;
+
+        input[0] = (n == 48U) ? 1U : 0U;
+        if (fuzz_random(8U) == 0U)
+        {
+            /* Random bytes, often starting like a signature */
+            len = fuzz_random(FUZZ_RECORD_MAX + 1U);
+            for (size_t b = 0; b < len; b++)
+            {
+                input[1U + b] = (uint8_t)fuzz_random(256U);
+            }
+            if ((len > 0U) && (fuzz_random(2U) == 0U))
+            {
+                input[1] = 0x30U;
+            }
+        }
+        else
+        {
+            uint32_t edits = fuzz_random(4U);
+
+            fuzz_raw(raw, n);
+            len = fuzz_encode(raw, n, &input[1]);
+            for (uint32_t e = 0; e < edits; e++)
+            {
+                switch (fuzz_random(3U))
+                {
+                    case 0U:
+                        input[1U + fuzz_random((uint32_t)len)] ^= (uint8_t)(1U << fuzz_random(8U));
+                        break;
+                    case 1U:
+                        len -= (len > 1U) ? 1U : 0U;
+                        break;
+                    default:
+                        if (len < FUZZ_RECORD_MAX)
+                        {
+                            input[1U + len++] = (uint8_t)fuzz_random(256U);
+                        }
+                        break;
+                }
+            }
+            mutated += (edits > 0U) ? 1U : 0U;
+        }
+        (void)LLVMFuzzerTestOneInput(input, 1U + len);
+    }
+
+    fuzz_batch(32U);
+    fuzz_batch(48U);
+
+    printf("ecdsa_der fuzz: %u inputs (%lu mutated records), %lu accepted, all match OpenSSL\n",
+           FUZZ_ITERATIONS, (unsigned long)mutated, (unsigned long)fuzz_accepted);
+    printf("PASS\n");
+    return 0;
+}
+#endif /* !ECDSA_DER_LIBFUZZER */
+
+/* [] END OF FILE */
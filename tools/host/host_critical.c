@@ -0,0 +1,27 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Host critical section
+ * Purpose : The lock behind the host Cy_SysLib_EnterCriticalSection().
+ ********************************************************************************
+ * @file    host_critical.c
+ * @brief   Interrupt masking stand-in for host builds
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+#include "cy_syslib.h"
+
+pthread_mutex_t host_critical = PTHREAD_MUTEX_INITIALIZER;
+
+/* [] END OF FILE */
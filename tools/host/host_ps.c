@@ -0,0 +1,149 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Host Protected Storage
+ * Purpose : psa_ps_set(), psa_ps_get() and psa_ps_remove() in RAM, so that
+ *           host programs can run the modules that store through TF-M.
+ * Design  : A fixed table of assets, each a heap copy of the last
+ *           psa_ps_set() data. As in TF-M, a set replaces the whole asset
+ *           at once and a get reads up to data_size bytes from an offset.
+ ********************************************************************************
+ * @file    host_ps.c
+ * @brief   PSA Protected Storage for host builds, in RAM
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdlib.h>
+#include <string.h>
+
+#include "psa/protected_storage.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define HOST_PS_ASSETS                (64U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct
+{
+    psa_storage_uid_t  uid;
+    uint8_t           *data;            /**< NULL: slot unused */
+    size_t             len;
+} host_ps_asset_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static host_ps_asset_t host_ps_assets[HOST_PS_ASSETS];
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static host_ps_asset_t *host_ps_find(psa_storage_uid_t uid)
+{
+    for (uint32_t i = 0; i < HOST_PS_ASSETS; i++)
+    {
+        if ((host_ps_assets[i].data != NULL) && (host_ps_assets[i].uid == uid))
+        {
+            return &host_ps_assets[i];
+        }
+    }
+    return NULL;
+}
+
+psa_status_t psa_ps_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+                        psa_storage_create_flags_t create_flags)
+{
+    host_ps_asset_t *asset = host_ps_find(uid);
+    uint8_t *copy;
+
+    (void)create_flags;
+    if (uid == 0U)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; (asset == NULL) && (i < HOST_PS_ASSETS); i++)
+    {
+        if (host_ps_assets[i].data == NULL)
+        {
+            asset = &host_ps_assets[i];
+        }
+    }
+    copy = malloc(data_length + 1U);
+    if ((asset == NULL) || (copy == NULL))
+    {
+        free(copy);
+        return PSA_ERROR_INSUFFICIENT_STORAGE;
+    }
+    if (data_length != 0U)
+    {
+        memcpy(copy, p_data, data_length);
+    }
+
+    /* The old contents stay until the new ones are complete */
+    free(asset->data);
+    asset->uid = uid;
+    asset->data = copy;
+    asset->len = data_length;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+                        size_t *p_data_length)
+{
+    const host_ps_asset_t *asset = host_ps_find(uid);
+    size_t n;
+
+    if (asset == NULL)
+    {
+        return PSA_ERROR_DOES_NOT_EXIST;
+    }
+    if (data_offset > asset->len)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    n = asset->len - data_offset;
+    n = (n < data_size) ? n : data_size;
+    memcpy(p_data, &asset->data[data_offset], n);
+    *p_data_length = n;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_remove(psa_storage_uid_t uid)
+{
+    host_ps_asset_t *asset = host_ps_find(uid);
+
+    if (asset == NULL)
+    {
+        return PSA_ERROR_DOES_NOT_EXIST;
+    }
+    free(asset->data);
+    asset->data = NULL;
+    asset->len = 0;
+    return PSA_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,684 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Host PSA Crypto
+ * Purpose : The PSA Crypto calls of the application (keys, SHA-2, ECDSA and
+ *           Ed25519 sign and verify) on OpenSSL, so that host programs can
+ *           run the modules that sign through TF-M on the target.
+ * Design  : Keys live in a small table and key ids are table index + 1.
+ *           ECDSA signatures are in the raw r || s format of PSA. Random
+ *           nonces come from OpenSSL; deterministic ECDSA derives the
+ *           nonce as RFC 6979 section 3.2 does, for digests as long as the
+ *           curve order, so the known-answer vectors compare byte for byte.
+ *           Independent of the target code: a host check that compares
+ *           against this model compares against OpenSSL.
+ ********************************************************************************
+ * @file    host_psa.c
+ * @brief   PSA Crypto subset for host builds, on OpenSSL
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include <stdbool.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/obj_mac.h>
+
+#include "psa/crypto.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define HOST_PSA_KEYS                 (16U)
+#define HOST_PSA_COORD_MAX            (48U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef struct
+{
+    EVP_PKEY            *pkey;      /**< NULL when the slot is free */
+    psa_key_attributes_t attributes;
+} host_psa_key_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static host_psa_key_t host_psa_keys[HOST_PSA_KEYS];
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static const EVP_MD *host_psa_md(psa_algorithm_t alg)
+{
+    switch (alg)
+    {
+        case PSA_ALG_SHA_256:
+            return EVP_sha256();
+        case PSA_ALG_SHA_384:
+            return EVP_sha384();
+        default:
+            return NULL;
+    }
+}
+
+static host_psa_key_t *host_psa_key(psa_key_id_t key)
+{
+    if ((key == PSA_KEY_ID_NULL) || (key > HOST_PSA_KEYS) || (host_psa_keys[key - 1U].pkey == NULL))
+    {
+        return NULL;
+    }
+    return &host_psa_keys[key - 1U];
+}
+
+static bool host_psa_is_edwards(psa_key_type_t type)
+{
+    return (type & 0xFFU) == PSA_ECC_FAMILY_TWISTED_EDWARDS;
+}
+
+static bool host_psa_is_key_pair(psa_key_type_t type)
+{
+    return (type & 0xFF00U) == 0x7100U;
+}
+
+static int host_psa_curve(size_t bits)
+{
+    return (bits == 256U) ? NID_X9_62_prime256v1 : ((bits == 384U) ? NID_secp384r1 : NID_undef);
+}
+
+static psa_status_t host_psa_store(const psa_key_attributes_t *attributes, EVP_PKEY *pkey,
+                                   psa_key_id_t *key)
+{
+    for (uint32_t i = 0; i < HOST_PSA_KEYS; i++)
+    {
+        if (host_psa_keys[i].pkey == NULL)
+        {
+            host_psa_keys[i].pkey = pkey;
+            host_psa_keys[i].attributes = *attributes;
+            *key = (psa_key_id_t)(i + 1U);
+            return PSA_SUCCESS;
+        }
+    }
+    EVP_PKEY_free(pkey);
+    return PSA_ERROR_INSUFFICIENT_MEMORY;
+}
+
+psa_status_t psa_crypto_init(void)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_generate_key(const psa_key_attributes_t *attributes, psa_key_id_t *key)
+{
+    EVP_PKEY *pkey;
+
+    if (!host_psa_is_key_pair(attributes->type))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (host_psa_is_edwards(attributes->type))
+    {
+        pkey = EVP_PKEY_Q_keygen(NULL, NULL, "ED25519");
+    }
+    else
+    {
+        pkey = (attributes->bits == 256U) ? EVP_PKEY_Q_keygen(NULL, NULL, "EC", "P-256") :
+               ((attributes->bits == 384U) ? EVP_PKEY_Q_keygen(NULL, NULL, "EC", "P-384") : NULL);
+    }
+    if (pkey == NULL)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    return host_psa_store(attributes, pkey, key);
+}
+
+/** @brief EC key from a private scalar or an uncompressed public point */
+static EVP_PKEY *host_psa_ec_import(const psa_key_attributes_t *attributes,
+                                    const uint8_t *data, size_t data_length)
+{
+    EC_KEY *ec = EC_KEY_new_by_curve_name(host_psa_curve(attributes->bits));
+    const EC_GROUP *group = (ec != NULL) ? EC_KEY_get0_group(ec) : NULL;
+    EC_POINT *point = (group != NULL) ? EC_POINT_new(group) : NULL;
+    BIGNUM *priv = NULL;
+    EVP_PKEY *pkey = NULL;
+    bool ok = (point != NULL);
+
+    if (ok && host_psa_is_key_pair(attributes->type))
+    {
+        priv = BN_bin2bn(data, (int)data_length, NULL);
+        ok = (data_length == PSA_BITS_TO_BYTES(attributes->bits)) && (priv != NULL) &&
+             (EC_KEY_set_private_key(ec, priv) == 1) &&
+             (EC_POINT_mul(group, point, priv, NULL, NULL, NULL) == 1);
+    }
+    else if (ok)
+    {
+        ok = (EC_POINT_oct2point(group, point, data, data_length, NULL) == 1);
+    }
+    ok = ok && (EC_KEY_set_public_key(ec, point) == 1) && (EC_KEY_check_key(ec) == 1);
+    if (ok)
+    {
+        pkey = EVP_PKEY_new();
+        if ((pkey != NULL) && (EVP_PKEY_assign_EC_KEY(pkey, ec) == 1))
+        {
+            ec = NULL;
+        }
+        else
+        {
+            EVP_PKEY_free(pkey);
+            pkey = NULL;
+        }
+    }
+    BN_clear_free(priv);
+    EC_POINT_free(point);
+    EC_KEY_free(ec);
+    return pkey;
+}
+
+psa_status_t psa_import_key(const psa_key_attributes_t *attributes, const uint8_t *data,
+                            size_t data_length, psa_key_id_t *key)
+{
+    EVP_PKEY *pkey;
+
+    if (host_psa_is_edwards(attributes->type))
+    {
+        pkey = host_psa_is_key_pair(attributes->type) ?
+               EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, NULL, data, data_length) :
+               EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519, NULL, data, data_length);
+    }
+    else if ((attributes->type & 0xFFU) == PSA_ECC_FAMILY_SECP_R1)
+    {
+        pkey = host_psa_ec_import(attributes, data, data_length);
+    }
+    else
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (pkey == NULL)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    return host_psa_store(attributes, pkey, key);
+}
+
+psa_status_t psa_destroy_key(psa_key_id_t key)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+
+    if (slot == NULL)
+    {
+        return PSA_ERROR_INVALID_HANDLE;
+    }
+    EVP_PKEY_free(slot->pkey);
+    memset(slot, 0, sizeof(*slot));
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                   size_t *data_length)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+    size_t len = data_size;
+
+    if (slot == NULL)
+    {
+        return PSA_ERROR_INVALID_HANDLE;
+    }
+    if (host_psa_is_edwards(slot->attributes.type))
+    {
+        if (EVP_PKEY_get_raw_public_key(slot->pkey, data, &len) != 1)
+        {
+            return PSA_ERROR_BUFFER_TOO_SMALL;
+        }
+    }
+    else
+    {
+        const EC_KEY *ec = EVP_PKEY_get0_EC_KEY(slot->pkey);
+
+        len = EC_POINT_point2oct(EC_KEY_get0_group(ec), EC_KEY_get0_public_key(ec),
+                                 POINT_CONVERSION_UNCOMPRESSED, NULL, 0, NULL);
+        if (len > data_size)
+        {
+            return PSA_ERROR_BUFFER_TOO_SMALL;
+        }
+        (void)EC_POINT_point2oct(EC_KEY_get0_group(ec), EC_KEY_get0_public_key(ec),
+                                 POINT_CONVERSION_UNCOMPRESSED, data, len, NULL);
+    }
+    *data_length = len;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_setup(psa_hash_operation_t *operation, psa_algorithm_t alg)
+{
+    const EVP_MD *md = host_psa_md(alg);
+
+    if (operation->ctx != NULL)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    if (md == NULL)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    operation->ctx = EVP_MD_CTX_new();
+    operation->alg = alg;
+    if ((operation->ctx == NULL) || (EVP_DigestInit_ex(operation->ctx, md, NULL) != 1))
+    {
+        (void)psa_hash_abort(operation);
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_update(psa_hash_operation_t *operation, const uint8_t *input,
+                             size_t input_length)
+{
+    if (operation->ctx == NULL)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    return (EVP_DigestUpdate(operation->ctx, input, input_length) == 1) ?
+           PSA_SUCCESS : PSA_ERROR_CORRUPTION_DETECTED;
+}
+
+psa_status_t psa_hash_finish(psa_hash_operation_t *operation, uint8_t *hash, size_t hash_size,
+                             size_t *hash_length)
+{
+    unsigned int len = 0;
+    psa_status_t status;
+
+    if (operation->ctx == NULL)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    if (hash_size < PSA_HASH_LENGTH(operation->alg))
+    {
+        status = PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    else
+    {
+        status = (EVP_DigestFinal_ex(operation->ctx, hash, &len) == 1) ?
+                 PSA_SUCCESS : PSA_ERROR_CORRUPTION_DETECTED;
+        *hash_length = len;
+    }
+    (void)psa_hash_abort(operation);
+    return status;
+}
+
+psa_status_t psa_hash_clone(const psa_hash_operation_t *source_operation,
+                            psa_hash_operation_t *target_operation)
+{
+    if ((source_operation->ctx == NULL) || (target_operation->ctx != NULL))
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    target_operation->ctx = EVP_MD_CTX_new();
+    target_operation->alg = source_operation->alg;
+    if ((target_operation->ctx == NULL) ||
+        (EVP_MD_CTX_copy_ex(target_operation->ctx, source_operation->ctx) != 1))
+    {
+        (void)psa_hash_abort(target_operation);
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_abort(psa_hash_operation_t *operation)
+{
+    EVP_MD_CTX_free(operation->ctx);
+    operation->ctx = NULL;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_compute(psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                              uint8_t *hash, size_t hash_size, size_t *hash_length)
+{
+    psa_hash_operation_t op = PSA_HASH_OPERATION_INIT;
+    psa_status_t status = psa_hash_setup(&op, alg);
+
+    if (status == PSA_SUCCESS)
+    {
+        status = psa_hash_update(&op, input, input_length);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        return psa_hash_finish(&op, hash, hash_size, hash_length);
+    }
+    (void)psa_hash_abort(&op);
+    return status;
+}
+
+/** @brief Check that @p key may run @p alg with @p usage */
+static psa_status_t host_psa_check(const host_psa_key_t *slot, psa_algorithm_t alg,
+                                   psa_key_usage_t usage)
+{
+    if (slot == NULL)
+    {
+        return PSA_ERROR_INVALID_HANDLE;
+    }
+    if (((slot->attributes.usage & usage) == 0U) || (slot->attributes.alg != alg))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    return PSA_SUCCESS;
+}
+
+/** @brief HMAC_K(V || sep || x || h) of RFC 6979 3.2 d and f; @p sep < 0 omits the tail */
+static void host_psa_hmac(const EVP_MD *md, const uint8_t *k, uint8_t *v, size_t n, int sep,
+                          const uint8_t *x, const uint8_t *h, uint8_t *out)
+{
+    uint8_t msg[(3U * HOST_PSA_COORD_MAX) + 1U];
+    size_t len = n;
+    unsigned int out_len = 0;
+
+    memcpy(msg, v, n);
+    if (sep >= 0)
+    {
+        msg[len++] = (uint8_t)sep;
+        if (x != NULL)
+        {
+            memcpy(&msg[len], x, n);
+            memcpy(&msg[len + n], h, n);
+            len += 2U * n;
+        }
+    }
+    (void)HMAC(md, k, (int)n, msg, len, out, &out_len);
+}
+
+/**
+ * @brief Nonce of RFC 6979 3.2 for a digest as long as the order
+ *
+ * @p attempt selects the attempt-th candidate, for the rare retry when
+ * r or s comes out zero.
+ */
+static bool host_psa_rfc6979_k(const EC_GROUP *group, const BIGNUM *d, const EVP_MD *md,
+                               const uint8_t *hash, size_t n, uint32_t attempt, BIGNUM *k_out,
+                               BN_CTX *bn)
+{
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    uint8_t x[HOST_PSA_COORD_MAX];
+    uint8_t h[HOST_PSA_COORD_MAX];
+    uint8_t v[HOST_PSA_COORD_MAX];
+    uint8_t k[HOST_PSA_COORD_MAX];
+    BIGNUM *e = BN_CTX_get(bn);
+
+    /* bits2octets(h1): the digest reduced mod q */
+    if ((e == NULL) || (BN_bin2bn(hash, (int)n, e) == NULL) || (BN_nnmod(e, e, order, bn) != 1))
+    {
+        return false;
+    }
+    (void)BN_bn2binpad(d, x, (int)n);
+    (void)BN_bn2binpad(e, h, (int)n);
+    memset(v, 0x01, n);
+    memset(k, 0x00, n);
+
+    host_psa_hmac(md, k, v, n, 0x00, x, h, k);
+    host_psa_hmac(md, k, v, n, -1, NULL, NULL, v);
+    host_psa_hmac(md, k, v, n, 0x01, x, h, k);
+    host_psa_hmac(md, k, v, n, -1, NULL, NULL, v);
+    for (;;)
+    {
+        host_psa_hmac(md, k, v, n, -1, NULL, NULL, v);
+        if ((BN_bin2bn(v, (int)n, k_out) != NULL) && !BN_is_zero(k_out) &&
+            (BN_cmp(k_out, order) < 0) && (attempt-- == 0U))
+        {
+            return true;
+        }
+        host_psa_hmac(md, k, v, n, 0x00, NULL, NULL, k);
+        host_psa_hmac(md, k, v, n, -1, NULL, NULL, v);
+    }
+}
+
+/** @brief ECDSA with the RFC 6979 nonce: s = k^-1 (e + r d) mod q */
+static ECDSA_SIG *host_psa_ecdsa_deterministic(const EC_KEY *ec, const EVP_MD *md,
+                                               const uint8_t *hash, size_t n)
+{
+    const EC_GROUP *group = EC_KEY_get0_group(ec);
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    BN_CTX *bn = BN_CTX_new();
+    EC_POINT *point = EC_POINT_new(group);
+    ECDSA_SIG *sig = NULL;
+    BIGNUM *k;
+    BIGNUM *r;
+    BIGNUM *s;
+    BIGNUM *e;
+
+    BN_CTX_start(bn);
+    k = BN_CTX_get(bn);
+    e = BN_CTX_get(bn);
+    r = BN_new();
+    s = BN_new();
+    for (uint32_t attempt = 0; (point != NULL) && (s != NULL) && (attempt < 4U); attempt++)
+    {
+        if (!host_psa_rfc6979_k(group, EC_KEY_get0_private_key(ec), md, hash, n, attempt, k, bn) ||
+            (EC_POINT_mul(group, point, k, NULL, NULL, bn) != 1) ||
+            (EC_POINT_get_affine_coordinates(group, point, r, NULL, bn) != 1) ||
+            (BN_nnmod(r, r, order, bn) != 1) || (BN_bin2bn(hash, (int)n, e) == NULL) ||
+            (BN_mod_mul(s, r, EC_KEY_get0_private_key(ec), order, bn) != 1) ||
+            (BN_mod_add(s, s, e, order, bn) != 1) || (BN_mod_inverse(k, k, order, bn) == NULL) ||
+            (BN_mod_mul(s, s, k, order, bn) != 1))
+        {
+            break;
+        }
+        if (!BN_is_zero(r) && !BN_is_zero(s))
+        {
+            sig = ECDSA_SIG_new();
+            if ((sig != NULL) && (ECDSA_SIG_set0(sig, r, s) == 1))
+            {
+                r = NULL;
+                s = NULL;
+            }
+            break;
+        }
+    }
+    BN_free(r);
+    BN_free(s);
+    EC_POINT_free(point);
+    BN_CTX_end(bn);
+    BN_CTX_free(bn);
+    return sig;
+}
+
+/** @brief ECDSA over @p hash with raw r || s output; the key is checked */
+static psa_status_t host_psa_ecdsa_sign(const host_psa_key_t *slot, psa_algorithm_t alg,
+                                        const uint8_t *hash, size_t hash_length, uint8_t *signature,
+                                        size_t signature_size, size_t *signature_length)
+{
+    size_t n = PSA_BITS_TO_BYTES(slot->attributes.bits);
+    EC_KEY *ec;
+    ECDSA_SIG *sig;
+
+    if (!host_psa_is_key_pair(slot->attributes.type))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (signature_size < (2U * n))
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (PSA_ALG_IS_DETERMINISTIC_ECDSA(alg) && (hash_length != n))
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    ec = EVP_PKEY_get1_EC_KEY(slot->pkey);
+    if (ec == NULL)
+    {
+        sig = NULL;
+    }
+    else if (PSA_ALG_IS_DETERMINISTIC_ECDSA(alg))
+    {
+        sig = host_psa_ecdsa_deterministic(ec, host_psa_md(PSA_ALG_SIGN_GET_HASH(alg)), hash, n);
+    }
+    else
+    {
+        sig = ECDSA_do_sign(hash, (int)hash_length, ec);
+    }
+    EC_KEY_free(ec);
+    if (sig == NULL)
+    {
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    (void)BN_bn2binpad(ECDSA_SIG_get0_r(sig), signature, (int)n);
+    (void)BN_bn2binpad(ECDSA_SIG_get0_s(sig), &signature[n], (int)n);
+    ECDSA_SIG_free(sig);
+    *signature_length = 2U * n;
+    return PSA_SUCCESS;
+}
+
+/** @brief ECDSA check of raw r || s over @p hash; the key is checked */
+static psa_status_t host_psa_ecdsa_verify(const host_psa_key_t *slot, const uint8_t *hash,
+                                          size_t hash_length, const uint8_t *signature,
+                                          size_t signature_length)
+{
+    size_t n = PSA_BITS_TO_BYTES(slot->attributes.bits);
+    EC_KEY *ec;
+    ECDSA_SIG *sig;
+    int result;
+
+    if (signature_length != (2U * n))
+    {
+        return PSA_ERROR_INVALID_SIGNATURE;
+    }
+
+    sig = ECDSA_SIG_new();
+    if ((sig == NULL) ||
+        (ECDSA_SIG_set0(sig, BN_bin2bn(signature, (int)n, NULL), BN_bin2bn(&signature[n], (int)n, NULL)) != 1))
+    {
+        ECDSA_SIG_free(sig);
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    ec = EVP_PKEY_get1_EC_KEY(slot->pkey);
+    result = (ec != NULL) ? ECDSA_do_verify(hash, (int)hash_length, sig, ec) : -1;
+    EC_KEY_free(ec);
+    ECDSA_SIG_free(sig);
+    return (result == 1) ? PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+}
+
+psa_status_t psa_sign_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                           size_t hash_length, uint8_t *signature, size_t signature_size,
+                           size_t *signature_length)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+    psa_status_t status = host_psa_check(slot, alg, PSA_KEY_USAGE_SIGN_HASH);
+
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (!PSA_ALG_IS_ECDSA(alg))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    return host_psa_ecdsa_sign(slot, alg, hash, hash_length, signature, signature_size, signature_length);
+}
+
+psa_status_t psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                             size_t hash_length, const uint8_t *signature, size_t signature_length)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+    psa_status_t status = host_psa_check(slot, alg, PSA_KEY_USAGE_VERIFY_HASH);
+
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (!PSA_ALG_IS_ECDSA(alg))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    return host_psa_ecdsa_verify(slot, hash, hash_length, signature, signature_length);
+}
+
+psa_status_t psa_sign_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                              size_t input_length, uint8_t *signature, size_t signature_size,
+                              size_t *signature_length)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+    psa_status_t status = host_psa_check(slot, alg, PSA_KEY_USAGE_SIGN_MESSAGE);
+    uint8_t hash[PSA_HASH_MAX_SIZE];
+    size_t hash_len;
+
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (alg == PSA_ALG_PURE_EDDSA)
+    {
+        EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+        size_t len = signature_size;
+
+        status = ((ctx != NULL) && (EVP_DigestSignInit(ctx, NULL, NULL, NULL, slot->pkey) == 1) &&
+                  (EVP_DigestSign(ctx, signature, &len, input, input_length) == 1)) ?
+                 PSA_SUCCESS : PSA_ERROR_BUFFER_TOO_SMALL;
+        EVP_MD_CTX_free(ctx);
+        *signature_length = len;
+        return status;
+    }
+
+    status = psa_hash_compute(PSA_ALG_SIGN_GET_HASH(alg), input, input_length, hash, sizeof(hash), &hash_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    return host_psa_ecdsa_sign(slot, alg, hash, hash_len, signature, signature_size, signature_length);
+}
+
+psa_status_t psa_verify_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                                size_t input_length, const uint8_t *signature,
+                                size_t signature_length)
+{
+    host_psa_key_t *slot = host_psa_key(key);
+    psa_status_t status = host_psa_check(slot, alg, PSA_KEY_USAGE_VERIFY_MESSAGE);
+    uint8_t hash[PSA_HASH_MAX_SIZE];
+    size_t hash_len;
+
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (alg == PSA_ALG_PURE_EDDSA)
+    {
+        EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+
+        status = ((ctx != NULL) && (EVP_DigestVerifyInit(ctx, NULL, NULL, NULL, slot->pkey) == 1) &&
+                  (EVP_DigestVerify(ctx, signature, signature_length, input, input_length) == 1)) ?
+                 PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+        EVP_MD_CTX_free(ctx);
+        return status;
+    }
+
+    status = psa_hash_compute(PSA_ALG_SIGN_GET_HASH(alg), input, input_length, hash, sizeof(hash), &hash_len);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    return host_psa_ecdsa_verify(slot, hash, hash_len, signature, signature_length);
+}
+
+/* [] END OF FILE */
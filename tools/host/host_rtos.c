@@ -0,0 +1,357 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Host RTOS
+ * Purpose : The abstraction-rtos calls used by the RTOS_BUILD=1 modules, on
+ *           POSIX threads, and task_stats_report() for the threads they
+ *           create.
+ * Design  : Each thread runs on the stack its creator passes, painted with
+ *           HOST_RTOS_STACK_PAINT first. The free stack reported is the
+ *           painted run at the low end, as FreeRTOS measures it. CPU share
+ *           is the thread's CPU clock (pthread_getcpuclockid) over the wall
+ *           time since the previous report, so on a multicore host the
+ *           shares need not add up to 100 %.
+ ********************************************************************************
+ * @file    host_rtos.c
+ * @brief   abstraction-rtos and task statistics on POSIX threads
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cyabs_rtos.h"
+#include "task_stats.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define HOST_RTOS_STACK_PAINT         (0xA5U)
+#define HOST_RTOS_THREADS_MAX         (TASK_STATS_MAX_TASKS)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+struct host_rtos_thread
+{
+    pthread_t             id;
+    cy_thread_entry_fn_t  entry;
+    cy_thread_arg_t       arg;
+    const char           *name;
+    uint8_t              *stack;
+    uint32_t              stack_size;
+    uint64_t              prev_cpu_ns;
+};
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static struct host_rtos_thread host_rtos_threads[HOST_RTOS_THREADS_MAX];
+static uint32_t                host_rtos_thread_count;
+static pthread_mutex_t         host_rtos_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t                host_rtos_prev_wall_ns;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static uint64_t host_rtos_clock_ns(clockid_t clock)
+{
+    struct timespec now;
+
+    (void)clock_gettime(clock, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Absolute CLOCK_REALTIME deadline @p timeout_ms from now, for pthread_cond_timedwait() */
+static struct timespec host_rtos_deadline(cy_time_t timeout_ms)
+{
+    struct timespec deadline;
+
+    (void)clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(timeout_ms / 1000U);
+    deadline.tv_nsec += (long)(timeout_ms % 1000U) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+/** @brief Wait on @p cond; false once @p deadline has passed */
+static int host_rtos_wait(pthread_cond_t *cond, pthread_mutex_t *lock, cy_time_t timeout_ms,
+                          const struct timespec *deadline)
+{
+    if (timeout_ms == CY_RTOS_NEVER_TIMEOUT)
+    {
+        return pthread_cond_wait(cond, lock) == 0;
+    }
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+/** @brief Painted bytes left at the low end of a thread stack */
+static uint32_t host_rtos_stack_free(const struct host_rtos_thread *t)
+{
+    uint32_t free_bytes = 0;
+
+    while ((free_bytes < t->stack_size) && (t->stack[free_bytes] == HOST_RTOS_STACK_PAINT))
+    {
+        free_bytes++;
+    }
+    return free_bytes;
+}
+
+static void *host_rtos_thread_main(void *arg)
+{
+    struct host_rtos_thread *thread = (struct host_rtos_thread *)arg;
+
+    thread->entry(thread->arg);
+    return NULL;
+}
+
+cy_rslt_t cy_rtos_thread_create(cy_thread_t *thread, cy_thread_entry_fn_t entry_function,
+                                const char *name, void *stack, uint32_t stack_size,
+                                cy_thread_priority_t priority, cy_thread_arg_t arg)
+{
+    struct host_rtos_thread *t;
+    pthread_attr_t attr;
+    int err;
+
+    (void)priority;
+    if ((thread == NULL) || (entry_function == NULL) || (stack == NULL) || (stack_size < PTHREAD_STACK_MIN))
+    {
+        return CY_RTOS_BAD_PARAM;
+    }
+
+    (void)pthread_mutex_lock(&host_rtos_lock);
+    if (host_rtos_thread_count == HOST_RTOS_THREADS_MAX)
+    {
+        (void)pthread_mutex_unlock(&host_rtos_lock);
+        return CY_RTOS_NO_MEMORY;
+    }
+    t = &host_rtos_threads[host_rtos_thread_count++];
+    (void)pthread_mutex_unlock(&host_rtos_lock);
+
+    t->entry = entry_function;
+    t->arg = arg;
+    t->name = name;
+    t->stack = (uint8_t *)stack;
+    t->stack_size = stack_size;
+    memset(stack, HOST_RTOS_STACK_PAINT, stack_size);
+
+    (void)pthread_attr_init(&attr);
+    err = pthread_attr_setstack(&attr, stack, stack_size);
+    if (err == 0)
+    {
+        err = pthread_create(&t->id, &attr, host_rtos_thread_main, t);
+    }
+    (void)pthread_attr_destroy(&attr);
+    if (err != 0)
+    {
+        return CY_RTOS_GENERAL_ERROR;
+    }
+    *thread = t;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_queue_init(cy_queue_t *queue, size_t length, size_t itemsize)
+{
+    memset(queue, 0, sizeof(*queue));
+    queue->items = calloc(length, itemsize);
+    if (queue->items == NULL)
+    {
+        return CY_RTOS_NO_MEMORY;
+    }
+    queue->length = length;
+    queue->item_size = itemsize;
+    (void)pthread_mutex_init(&queue->lock, NULL);
+    (void)pthread_cond_init(&queue->changed, NULL);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_queue_put(cy_queue_t *queue, const void *item_ptr, cy_time_t timeout_ms)
+{
+    struct timespec deadline = host_rtos_deadline(timeout_ms);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    (void)pthread_mutex_lock(&queue->lock);
+    while ((queue->count == queue->length) && (result == CY_RSLT_SUCCESS))
+    {
+        if ((timeout_ms == 0U) || !host_rtos_wait(&queue->changed, &queue->lock, timeout_ms, &deadline))
+        {
+            result = CY_RTOS_TIMEOUT;
+        }
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        size_t tail = (queue->head + queue->count) % queue->length;
+
+        memcpy(&queue->items[tail * queue->item_size], item_ptr, queue->item_size);
+        queue->count++;
+        (void)pthread_cond_broadcast(&queue->changed);
+    }
+    (void)pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+
+cy_rslt_t cy_rtos_queue_get(cy_queue_t *queue, void *item_ptr, cy_time_t timeout_ms)
+{
+    struct timespec deadline = host_rtos_deadline(timeout_ms);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    (void)pthread_mutex_lock(&queue->lock);
+    while ((queue->count == 0U) && (result == CY_RSLT_SUCCESS))
+    {
+        if ((timeout_ms == 0U) || !host_rtos_wait(&queue->changed, &queue->lock, timeout_ms, &deadline))
+        {
+            result = CY_RTOS_TIMEOUT;
+        }
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        memcpy(item_ptr, &queue->items[queue->head * queue->item_size], queue->item_size);
+        queue->head = (queue->head + 1U) % queue->length;
+        queue->count--;
+        (void)pthread_cond_broadcast(&queue->changed);
+    }
+    (void)pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+
+cy_rslt_t cy_rtos_semaphore_init(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount)
+{
+    if (initcount > maxcount)
+    {
+        return CY_RTOS_BAD_PARAM;
+    }
+    (void)pthread_mutex_init(&semaphore->lock, NULL);
+    (void)pthread_cond_init(&semaphore->changed, NULL);
+    semaphore->count = initcount;
+    semaphore->max_count = maxcount;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_semaphore_get(cy_semaphore_t *semaphore, cy_time_t timeout_ms)
+{
+    struct timespec deadline = host_rtos_deadline(timeout_ms);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    (void)pthread_mutex_lock(&semaphore->lock);
+    while ((semaphore->count == 0U) && (result == CY_RSLT_SUCCESS))
+    {
+        if ((timeout_ms == 0U) || !host_rtos_wait(&semaphore->changed, &semaphore->lock, timeout_ms, &deadline))
+        {
+            result = CY_RTOS_TIMEOUT;
+        }
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        semaphore->count--;
+    }
+    (void)pthread_mutex_unlock(&semaphore->lock);
+    return result;
+}
+
+cy_rslt_t cy_rtos_semaphore_set(cy_semaphore_t *semaphore)
+{
+    (void)pthread_mutex_lock(&semaphore->lock);
+    if (semaphore->count < semaphore->max_count)
+    {
+        semaphore->count++;
+        (void)pthread_cond_signal(&semaphore->changed);
+    }
+    (void)pthread_mutex_unlock(&semaphore->lock);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_delay_milliseconds(cy_time_t num_ms)
+{
+    struct timespec delay = { (time_t)(num_ms / 1000U), (long)(num_ms % 1000U) * 1000000L };
+
+    while (nanosleep(&delay, &delay) != 0)
+    {
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+void task_stats_timer_init(void)
+{
+    host_rtos_prev_wall_ns = host_rtos_clock_ns(CLOCK_MONOTONIC);
+}
+
+uint32_t task_stats_timer_read(void)
+{
+    return (uint32_t)host_rtos_clock_ns(CLOCK_MONOTONIC);
+}
+
+void task_stats_report(void)
+{
+    uint64_t wall = host_rtos_clock_ns(CLOCK_MONOTONIC);
+    uint64_t wall_delta = wall - host_rtos_prev_wall_ns;
+
+    host_rtos_prev_wall_ns = wall;
+    printf("Task             CPU%%  Stack free\n");
+    for (uint32_t i = 0; i < host_rtos_thread_count; i++)
+    {
+        struct host_rtos_thread *t = &host_rtos_threads[i];
+        clockid_t clock;
+        uint64_t cpu = 0;
+        uint32_t permille = 0;
+
+        if (pthread_getcpuclockid(t->id, &clock) == 0)
+        {
+            cpu = host_rtos_clock_ns(clock);
+        }
+        if (wall_delta > 0U)
+        {
+            permille = (uint32_t)(((cpu - t->prev_cpu_ns) * 1000U) / wall_delta);
+        }
+        t->prev_cpu_ns = cpu;
+        printf("%-16s %3lu.%lu %8lu B\n", t->name,
+               (unsigned long)(permille / 10U), (unsigned long)(permille % 10U),
+               (unsigned long)host_rtos_stack_free(t));
+    }
+}
+
+uint32_t host_rtos_min_stack_free(void)
+{
+    uint32_t lowest = UINT32_MAX;
+
+    for (uint32_t i = 0; i < host_rtos_thread_count; i++)
+    {
+        uint32_t free_bytes = host_rtos_stack_free(&host_rtos_threads[i]);
+
+        if (free_bytes < lowest)
+        {
+            lowest = free_bytes;
+        }
+    }
+    return lowest;
+}
+
+/* [] END OF FILE */
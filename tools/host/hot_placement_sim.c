@@ -0,0 +1,203 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : hot_placement host check
+ * Purpose : Run tools/hot_placement.py end to end on a host build: profile
+ *           a workload, generate the fragment, relink with it and check
+ *           that the samples have moved into .app_code_hot.
+ * Design  : The workload is the non-secure verify path without TF-M:
+ *           sha256_sw over a signed payload and an ECDSA raw/DER round
+ *           trip, built with -ffunction-sections like the target images.
+ *           The program samples its own PC with ITIMER_PROF and writes
+ *           one hex address per line, the format the tool reads.
+ *
+ *           hot_placement.ld inserts .app_code_hot in front of .text of
+ *           the default host script and INCLUDEs app_code_hot.ld from the
+ *           -L path, as the GCC_ARM scripts do. The Makefile links twice:
+ *           with the empty fragment of proj_cm33_ns, then with the one
+ *           generated from the first profile. Given a budget, the program
+ *           checks that the section fits it and holds at least the given
+ *           share of the samples.
+ ********************************************************************************
+ * @file    hot_placement_sim.c
+ * @brief   Profile, place and re-profile check of the hot code placement
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+#include "ecdsa_der.h"
+#include "sha256_sw.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_SAMPLES                   (2000U)
+#define SIM_SAMPLE_PERIOD_US          (200)
+#define SIM_MAX_JOBS                  (4000000U)
+#define SIM_PAYLOAD_BYTES             (512U)
+#define SIM_COORD_SIZE                (32U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+
+/* Bounds of .app_code_hot, from hot_placement.ld */
+extern const char __app_code_hot_start[];
+extern const char __app_code_hot_end[];
+
+static volatile uintptr_t    sim_pcs[SIM_SAMPLES];
+static volatile sig_atomic_t sim_sample_count;
+static unsigned int          sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+static void sim_on_sample(int sig, siginfo_t *info, void *context)
+{
+    const ucontext_t *uc = (const ucontext_t *)context;
+
+    (void)sig;
+    (void)info;
+    if (sim_sample_count < (sig_atomic_t)SIM_SAMPLES)
+    {
+#if defined(__x86_64__)
+        sim_pcs[sim_sample_count++] = (uintptr_t)uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__aarch64__)
+        sim_pcs[sim_sample_count++] = (uintptr_t)uc->uc_mcontext.pc;
+#else
+#error "PC sampling: unsupported host architecture"
+#endif
+    }
+}
+
+/** @brief One verify job: hash the payload, round-trip the signature */
+static bool sim_job(uint8_t *payload, uint32_t n)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    uint8_t raw[2U * SIM_COORD_SIZE];
+    uint8_t back[2U * SIM_COORD_SIZE];
+    uint8_t der[ECDSA_DER_MAX_SIZE(SIM_COORD_SIZE)];
+    size_t der_len;
+
+    payload[n % SIM_PAYLOAD_BYTES] ^= (uint8_t)n;
+    sha256_sw(payload, SIM_PAYLOAD_BYTES, digest);
+    memcpy(raw, digest, SIM_COORD_SIZE);
+    memcpy(&raw[SIM_COORD_SIZE], digest, SIM_COORD_SIZE);
+    raw[0] &= 0x7FU;
+
+    return (ecdsa_raw_to_der(raw, sizeof(raw), der, sizeof(der), &der_len) == PSA_SUCCESS) &&
+           (ecdsa_der_to_raw(der, der_len, SIM_COORD_SIZE, back, sizeof(back)) == PSA_SUCCESS) &&
+           (memcmp(raw, back, sizeof(raw)) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t payload[SIM_PAYLOAD_BYTES];
+    struct sigaction action;
+    struct itimerval timer;
+    uintptr_t hot_start = (uintptr_t)__app_code_hot_start;
+    uintptr_t hot_end = (uintptr_t)__app_code_hot_end;
+    uint32_t jobs = 0;
+    uint32_t in_hot = 0;
+    uint32_t share;
+    bool served = true;
+    FILE *out;
+    bool ok;
+
+    if ((argc != 2) && (argc != 4))
+    {
+        fprintf(stderr, "usage: %s <pc samples out> [<budget bytes> <min hot share %%>]\n", argv[0]);
+        return 2;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = sim_on_sample;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    (void)sigaction(SIGPROF, &action, NULL);
+
+    memset(&timer, 0, sizeof(timer));
+    timer.it_interval.tv_usec = SIM_SAMPLE_PERIOD_US;
+    timer.it_value.tv_usec = SIM_SAMPLE_PERIOD_US;
+    (void)setitimer(ITIMER_PROF, &timer, NULL);
+
+    while (served && (sim_sample_count < (sig_atomic_t)SIM_SAMPLES) && (jobs < SIM_MAX_JOBS))
+    {
+        served = sim_job(payload, jobs++);
+    }
+
+    memset(&timer, 0, sizeof(timer));
+    (void)setitimer(ITIMER_PROF, &timer, NULL);
+
+    out = fopen(argv[1], "w");
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+    fprintf(out, "# %u PC samples of %u verify jobs\n", (unsigned)sim_sample_count, jobs);
+    for (sig_atomic_t i = 0; i < sim_sample_count; i++)
+    {
+        fprintf(out, "%lx\n", (unsigned long)sim_pcs[i]);
+        in_hot += ((sim_pcs[i] >= hot_start) && (sim_pcs[i] < hot_end)) ? 1U : 0U;
+    }
+    (void)fclose(out);
+
+    share = (sim_sample_count > 0) ? ((in_hot * 100U) / (uint32_t)sim_sample_count) : 0U;
+    printf("Hot placement: %u jobs, %u samples, .app_code_hot %lu bytes holds %u%% of them\n",
+           jobs, (unsigned)sim_sample_count, (unsigned long)(hot_end - hot_start), share);
+
+    SIM_CHECK(served, "every verify job round-trips");
+    SIM_CHECK(sim_sample_count == (sig_atomic_t)SIM_SAMPLES, "profile complete");
+    if (argc == 4)
+    {
+        SIM_CHECK((hot_end > hot_start) && ((hot_end - hot_start) <= strtoul(argv[2], NULL, 0)),
+                  ".app_code_hot filled within the budget");
+        SIM_CHECK(share >= strtoul(argv[3], NULL, 0), "samples moved into .app_code_hot");
+        SIM_CHECK(((uintptr_t)sim_check < hot_start) || ((uintptr_t)sim_check >= hot_end),
+                  "cold code left out");
+    }
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
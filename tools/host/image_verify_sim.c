@@ -0,0 +1,524 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : image_verify host test
+ * Purpose : Run proj_cm33_ns/image_verify.c against MCUboot images in a
+ *           file, through a synchronous and an asynchronous backend.
+ * Design  : The synchronous backend reads with pread(). The asynchronous
+ *           one hands each read to a helper thread (the "DMA") and waits
+ *           for it in wait(), so the next chunk is being read while the
+ *           current one is hashed and the two buffers really alternate.
+ *           Either backend can be told to fail at a given offset.
+ *
+ *           Test images are written to a temporary file with image sizes
+ *           around the chunk size. Each must verify with the key and with
+ *           the hash only, report its version and a progress call per
+ *           chunk, and fail once a byte is flipped. Malformed layouts and
+ *           read errors must fail with a cleared info. psa_verify_hash()
+ *           is stubbed: the "signature" of a digest is the digest followed
+ *           by its complement, DER-encoded with proj_cm33_ns/ecdsa_der.c.
+ *
+ *           With a file argument, that image (e.g. a signed CM55 build)
+ *           is checked against its SHA-256 TLV instead.
+ ********************************************************************************
+ * @file    image_verify_sim.c
+ * @brief   File-backed MCUboot image verification test
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#define _GNU_SOURCE                 /* pread() */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ecdsa_der.h"
+#include "image_verify.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_HEADER_SIZE               (0x400U)     /**< MCUBOOT_HEADER_SIZE       */
+#define SIM_KEY                       ((psa_key_id_t)1)
+#define SIM_NO_FAULT                  (0xFFFFFFFFUL)
+#define SIM_READ_ERROR                ((psa_status_t)-146)  /**< PSA_ERROR_STORAGE_FAILURE */
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief File backend; one read in flight at most */
+typedef struct
+{
+    int             fd;
+    bool            async;
+    uint32_t        fault;          /**< Reads covering this offset fail */
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    bool            pending;        /**< Read requested, not yet done    */
+    bool            stop;
+    uint32_t        offset;
+    uint8_t        *buf;
+    size_t          len;
+    psa_status_t    status;
+    uint32_t        reads;
+    uint32_t        overlapped;     /**< Reads started before a wait     */
+} sim_file_t;
+
+/** @brief Progress callback record */
+typedef struct
+{
+    uint32_t calls;
+    uint32_t done;
+    uint32_t total;
+} sim_progress_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Stub signature of a digest: the digest, then its complement */
+static void sim_sign(const uint8_t *digest, uint8_t signature[64])
+{
+    for (uint32_t i = 0; i < SHA256_SW_DIGEST_SIZE; i++)
+    {
+        signature[i] = digest[i];
+        signature[SHA256_SW_DIGEST_SIZE + i] = (uint8_t)~digest[i];
+    }
+}
+
+psa_status_t psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                             size_t hash_length, const uint8_t *signature, size_t signature_length)
+{
+    uint8_t expected[64];
+
+    if ((key != SIM_KEY) || (alg != PSA_ALG_ECDSA(PSA_ALG_SHA_256)) ||
+        (hash_length != SHA256_SW_DIGEST_SIZE) || (signature_length != sizeof(expected)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    sim_sign(hash, expected);
+    return (memcmp(signature, expected, sizeof(expected)) == 0) ? PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+}
+
+static psa_status_t sim_pread(sim_file_t *file, uint32_t offset, uint8_t *buf, size_t len)
+{
+    if ((file->fault >= offset) && (file->fault < (offset + len)))
+    {
+        return SIM_READ_ERROR;
+    }
+    return (pread(file->fd, buf, len, (off_t)offset) == (ssize_t)len) ? PSA_SUCCESS : SIM_READ_ERROR;
+}
+
+/** @brief The "DMA": serve one read request at a time */
+static void *sim_dma_thread(void *arg)
+{
+    sim_file_t *file = arg;
+
+    (void)pthread_mutex_lock(&file->mutex);
+    for (;;)
+    {
+        while (!file->pending && !file->stop)
+        {
+            (void)pthread_cond_wait(&file->cond, &file->mutex);
+        }
+        if (file->stop)
+        {
+            break;
+        }
+        (void)pthread_mutex_unlock(&file->mutex);
+        /* Slow enough that hashing the other buffer really overlaps */
+        (void)usleep(50U);
+        file->status = sim_pread(file, file->offset, file->buf, file->len);
+        (void)pthread_mutex_lock(&file->mutex);
+        file->pending = false;
+        (void)pthread_cond_broadcast(&file->cond);
+    }
+    (void)pthread_mutex_unlock(&file->mutex);
+    return NULL;
+}
+
+static psa_status_t sim_file_read(void *ctx, uint32_t offset, uint8_t *buf, size_t len)
+{
+    sim_file_t *file = ctx;
+
+    file->reads++;
+    if (!file->async)
+    {
+        return sim_pread(file, offset, buf, len);
+    }
+    (void)pthread_mutex_lock(&file->mutex);
+    if (file->pending)
+    {
+        /* The verifier must wait before it starts another read */
+        (void)pthread_mutex_unlock(&file->mutex);
+        return PSA_ERROR_CORRUPTION_DETECTED;
+    }
+    file->offset = offset;
+    file->buf = buf;
+    file->len = len;
+    file->pending = true;
+    (void)pthread_cond_broadcast(&file->cond);
+    (void)pthread_mutex_unlock(&file->mutex);
+    return PSA_SUCCESS;
+}
+
+static psa_status_t sim_file_wait(void *ctx)
+{
+    sim_file_t *file = ctx;
+
+    (void)pthread_mutex_lock(&file->mutex);
+    if (file->pending)
+    {
+        file->overlapped++;
+    }
+    while (file->pending)
+    {
+        (void)pthread_cond_wait(&file->cond, &file->mutex);
+    }
+    (void)pthread_mutex_unlock(&file->mutex);
+    return file->status;
+}
+
+/** @brief Open @p path as a flash backend */
+static bool sim_file_open(sim_file_t *file, image_flash_t *flash, const char *path, bool async)
+{
+    struct stat st;
+
+    memset(file, 0, sizeof(*file));
+    file->fd = open(path, O_RDONLY);
+    if ((file->fd < 0) || (fstat(file->fd, &st) != 0))
+    {
+        perror(path);
+        return false;
+    }
+    file->async = async;
+    file->fault = SIM_NO_FAULT;
+    (void)pthread_mutex_init(&file->mutex, NULL);
+    (void)pthread_cond_init(&file->cond, NULL);
+    if (async && (pthread_create(&file->thread, NULL, sim_dma_thread, file) != 0))
+    {
+        return false;
+    }
+
+    flash->read = sim_file_read;
+    flash->wait = async ? sim_file_wait : NULL;
+    flash->ctx = file;
+    flash->size = (uint32_t)st.st_size;
+    return true;
+}
+
+static void sim_file_close(sim_file_t *file)
+{
+    if (file->async)
+    {
+        (void)sim_file_wait(file);
+        (void)pthread_mutex_lock(&file->mutex);
+        file->stop = true;
+        (void)pthread_cond_broadcast(&file->cond);
+        (void)pthread_mutex_unlock(&file->mutex);
+        (void)pthread_join(file->thread, NULL);
+    }
+    (void)close(file->fd);
+}
+
+static void sim_progress(void *arg, uint32_t done, uint32_t total)
+{
+    sim_progress_t *p = arg;
+
+    p->calls++;
+    p->done = done;
+    p->total = total;
+}
+
+static void sim_put_le16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+/**
+ * @brief Build a MCUboot image: header, @p image_len bytes, TLV area
+ *
+ * @param[out] out          Image
+ * @param[in]  image_len    Image size without header and TLVs
+ * @param[in]  signature    Add the ECDSA signature TLV
+ * @param[out] digest       SHA-256 of header and image
+ *
+ * @return Total size
+ */
+static size_t sim_build(uint8_t *out, uint32_t image_len, bool signature,
+                        uint8_t digest[SHA256_SW_DIGEST_SIZE])
+{
+    uint8_t raw[64];
+    size_t der_len = 0;
+    uint32_t pos = SIM_HEADER_SIZE + image_len;
+    uint32_t lcg = image_len;
+
+    memset(out, 0, SIM_HEADER_SIZE);
+    out[0] = 0x3D;
+    out[1] = 0xB8;
+    out[2] = 0xF3;
+    out[3] = 0x96;
+    sim_put_le16(&out[8], SIM_HEADER_SIZE);
+    out[12] = (uint8_t)image_len;
+    out[13] = (uint8_t)(image_len >> 8);
+    out[14] = (uint8_t)(image_len >> 16);
+    out[20] = 1U;
+    out[21] = 2U;
+    out[22] = 3U;
+    out[24] = 4U;
+    for (uint32_t i = SIM_HEADER_SIZE; i < pos; i++)
+    {
+        lcg = (lcg * 1103515245UL) + 12345UL;
+        out[i] = (uint8_t)(lcg >> 16);
+    }
+    sha256_sw(out, pos, digest);
+
+    sim_put_le16(&out[pos + 4U], 0x10U);
+    sim_put_le16(&out[pos + 6U], SHA256_SW_DIGEST_SIZE);
+    memcpy(&out[pos + 8U], digest, SHA256_SW_DIGEST_SIZE);
+    if (signature)
+    {
+        sim_sign(digest, raw);
+        (void)ecdsa_raw_to_der(raw, sizeof(raw), &out[pos + 44U], ECDSA_DER_MAX_SIZE(32U), &der_len);
+        sim_put_le16(&out[pos + 40U], 0x22U);
+        sim_put_le16(&out[pos + 42U], (uint32_t)der_len);
+    }
+    sim_put_le16(&out[pos], 0x6907U);
+    sim_put_le16(&out[pos + 2U], (uint32_t)(signature ? (44U + der_len) : 40U));
+    return pos + (signature ? (44U + der_len) : 40U);
+}
+
+static bool sim_write_file(const char *path, const uint8_t *data, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    bool ok = (f != NULL) && (fwrite(data, 1, len, f) == len);
+
+    if (f != NULL)
+    {
+        ok = (fclose(f) == 0) && ok;
+    }
+    return ok;
+}
+
+/** @brief Verify @p image from a file through one backend */
+static psa_status_t sim_verify(const char *path, const uint8_t *image, size_t len, bool async,
+                               uint32_t fault, psa_key_id_t key, image_verify_info_t *info,
+                               sim_progress_t *progress, sim_file_t *stats)
+{
+    static image_verify_t verifier;
+    image_flash_t flash;
+    sim_file_t file;
+    psa_status_t status;
+
+    if (!sim_write_file(path, image, len) || !sim_file_open(&file, &flash, path, async))
+    {
+        return SIM_READ_ERROR;
+    }
+    file.fault = fault;
+    memset(progress, 0, sizeof(*progress));
+    memset(info, 0xA5, sizeof(*info));
+    image_verify_init(&verifier, &flash, sim_progress, progress);
+    status = image_verify_mcuboot(&verifier, key, info);
+    sim_file_close(&file);
+    if (stats != NULL)
+    {
+        *stats = file;
+    }
+    return status;
+}
+
+/** @brief Image sizes around the chunk size, through both backends */
+static void sim_sizes(const char *path, uint8_t *image)
+{
+    static const uint32_t sizes[] =
+    {
+        0U, 1U, IMAGE_VERIFY_CHUNK_SIZE - 1U, IMAGE_VERIFY_CHUNK_SIZE,
+        IMAGE_VERIFY_CHUNK_SIZE + 1U, (5U * IMAGE_VERIFY_CHUNK_SIZE) + 7U, 64U * 1024U
+    };
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    image_verify_info_t info;
+    sim_progress_t progress;
+    sim_file_t file;
+    uint32_t overlapped = 0;
+
+    for (uint32_t async = 0; async < 2U; async++)
+    {
+        for (uint32_t i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+        {
+            size_t len = sim_build(image, sizes[i], true, digest);
+            uint32_t hashed = SIM_HEADER_SIZE + sizes[i];
+            psa_status_t status;
+
+            status = sim_verify(path, image, len, async != 0U, SIM_NO_FAULT, SIM_KEY,
+                                &info, &progress, &file);
+            SIM_CHECK(status == PSA_SUCCESS, "image verifies with the key");
+            SIM_CHECK(info.signature_checked && (info.hashed_len == hashed) &&
+                      (info.version_major == 1U) && (info.version_minor == 2U) &&
+                      (info.version_revision == 3U) && (info.version_build == 4U),
+                      "image details reported");
+            SIM_CHECK((progress.calls == ((hashed + IMAGE_VERIFY_CHUNK_SIZE - 1U) / IMAGE_VERIFY_CHUNK_SIZE)) &&
+                      (progress.done == hashed) && (progress.total == hashed),
+                      "one progress call per chunk");
+            overlapped += file.overlapped;
+
+            status = sim_verify(path, image, len, async != 0U, SIM_NO_FAULT, PSA_KEY_ID_NULL,
+                                &info, &progress, NULL);
+            SIM_CHECK((status == PSA_SUCCESS) && !info.signature_checked, "hash-only check passes");
+
+            image[SIM_HEADER_SIZE + (sizes[i] / 2U) - ((sizes[i] == 0U) ? 1U : 0U)] ^= 0x01U;
+            status = sim_verify(path, image, len, async != 0U, SIM_NO_FAULT, SIM_KEY,
+                                &info, &progress, NULL);
+            SIM_CHECK(status == PSA_ERROR_INVALID_SIGNATURE, "flipped byte rejected");
+        }
+    }
+    printf("image_verify: %lu image sizes, sync and async backends, %lu reads overlapped with hashing\n",
+           (unsigned long)(sizeof(sizes) / sizeof(sizes[0])), (unsigned long)overlapped);
+    SIM_CHECK(overlapped > 0U, "asynchronous reads overlap the hashing");
+}
+
+/** @brief Malformed layouts and read errors */
+static void sim_errors(const char *path, uint8_t *image)
+{
+    uint8_t digest[SHA256_SW_DIGEST_SIZE];
+    image_verify_info_t info;
+    sim_progress_t progress;
+    size_t len;
+    psa_status_t status;
+
+    len = sim_build(image, 3000U, true, digest);
+    image[0] ^= 0x01U;
+    status = sim_verify(path, image, len, true, SIM_NO_FAULT, SIM_KEY, &info, &progress, NULL);
+    SIM_CHECK((status == PSA_ERROR_INVALID_ARGUMENT) && (info.hashed_len == 0U) &&
+              !info.signature_checked, "bad magic rejected, info cleared");
+
+    len = sim_build(image, 3000U, true, digest);
+    image[14] = 0x01U;
+    status = sim_verify(path, image, len, true, SIM_NO_FAULT, SIM_KEY, &info, &progress, NULL);
+    SIM_CHECK(status == PSA_ERROR_INVALID_ARGUMENT, "image size beyond the file rejected");
+
+    len = sim_build(image, 3000U, true, digest);
+    status = sim_verify(path, image, len - 1U, true, SIM_NO_FAULT, SIM_KEY, &info, &progress, NULL);
+    SIM_CHECK(status == PSA_ERROR_INVALID_ARGUMENT, "truncated TLV area rejected");
+
+    len = sim_build(image, 3000U, false, digest);
+    status = sim_verify(path, image, len, true, SIM_NO_FAULT, SIM_KEY, &info, &progress, NULL);
+    SIM_CHECK(status == PSA_ERROR_INVALID_SIGNATURE, "missing signature TLV rejected");
+    status = sim_verify(path, image, len, true, SIM_NO_FAULT, PSA_KEY_ID_NULL, &info, &progress, NULL);
+    SIM_CHECK(status == PSA_SUCCESS, "hash TLV alone is enough without a key");
+
+    for (uint32_t async = 0; async < 2U; async++)
+    {
+        status = sim_verify(path, image, len, async != 0U, 4U, SIM_KEY, &info, &progress, NULL);
+        SIM_CHECK((status == SIM_READ_ERROR) && (info.hashed_len == 0U), "header read error reported");
+        status = sim_verify(path, image, len, async != 0U, SIM_HEADER_SIZE + 2500U, SIM_KEY,
+                            &info, &progress, NULL);
+        SIM_CHECK((status == SIM_READ_ERROR) && !info.signature_checked, "image read error reported");
+    }
+}
+
+/** @brief Check the hash TLV of an image file */
+static int sim_image_file(const char *path)
+{
+    static image_verify_t verifier;
+    image_verify_info_t info;
+    sim_progress_t progress = { 0 };
+    image_flash_t flash;
+    sim_file_t file;
+    psa_status_t status;
+
+    if (!sim_file_open(&file, &flash, path, true))
+    {
+        return 1;
+    }
+    image_verify_init(&verifier, &flash, sim_progress, &progress);
+    status = image_verify_mcuboot(&verifier, PSA_KEY_ID_NULL, &info);
+    sim_file_close(&file);
+
+    if ((status == PSA_SUCCESS) || (status == PSA_ERROR_INVALID_SIGNATURE))
+    {
+        printf("%s: MCUboot image %u.%u.%u+%lu, %lu B hashed in %lu chunks: hash %s\n", path,
+               (unsigned int)info.version_major, (unsigned int)info.version_minor,
+               (unsigned int)info.version_revision, (unsigned long)info.version_build,
+               (unsigned long)info.hashed_len, (unsigned long)progress.calls,
+               (status == PSA_SUCCESS) ? "matches" : "MISMATCH");
+    }
+    else
+    {
+        printf("%s: not a MCUboot image (%ld)\n", path, (long)status);
+    }
+    return (status == PSA_SUCCESS) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t image[SIM_HEADER_SIZE + (64U * 1024U) + 256U];
+    char path[] = "/tmp/image_verify_simXXXXXX";
+    int fd;
+    bool ok;
+
+    if (argc > 1)
+    {
+        return sim_image_file(argv[1]);
+    }
+
+    fd = mkstemp(path);
+    if (fd < 0)
+    {
+        perror("mkstemp");
+        return 1;
+    }
+    (void)close(fd);
+
+    sim_sizes(path, image);
+    sim_errors(path, image);
+    (void)unlink(path);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
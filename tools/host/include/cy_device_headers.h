@@ -0,0 +1,18 @@
+/*
+ * Host stand-in for the CM55 device header: the CMSIS D-cache maintenance
+ * calls used by shared_cache.c, which the host program defines
+ */
+#ifndef CY_DEVICE_HEADERS_H
+#define CY_DEVICE_HEADERS_H
+
+#include <stdint.h>
+
+#define __SCB_DCACHE_LINE_SIZE        (32U)
+
+void SCB_CleanDCache(void);
+void SCB_CleanInvalidateDCache(void);
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t size);
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t size);
+void SCB_CleanInvalidateDCache_by_Addr(volatile void *addr, int32_t size);
+
+#endif /* CY_DEVICE_HEADERS_H */
@@ -0,0 +1,75 @@
+/*
+ * Host stand-in for the PDL cy_pdl.h: the critical section, utility macros
+ * and the DWT cycle counter that cycle_counter.h reads. The host counter
+ * runs at 1 GHz off CLOCK_MONOTONIC, so a "cycle" is a nanosecond. A
+ * program with simulated time builds with -DHOST_DWT_CLOCK=<function>
+ * and returns its own nanosecond count from that function instead.
+ *
+ * The NVIC and SysInt calls are declared only; a host program that uses
+ * them defines them to model the interrupt.
+ */
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <time.h>
+
+#include "cy_result.h"
+#include "cy_syslib.h"
+#include "cy_utils.h"
+
+#define SystemCoreClock               (1000000000UL)
+
+#define DWT_CTRL_CYCCNTENA_Msk        (1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk    (1UL << 24)
+
+#define CY_IPC_INTR_MUX(intr)         ((intr) + 16U)
+
+typedef int32_t IRQn_Type;
+typedef void  (*cy_israddress)(void);
+
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} host_dwt_t;
+
+typedef struct
+{
+    uint32_t DEMCR;
+} host_core_debug_t;
+
+#if defined(HOST_DWT_CLOCK)
+uint32_t HOST_DWT_CLOCK(void);
+#endif
+
+/** @brief DWT registers, with CYCCNT refreshed from the monotonic clock */
+static inline host_dwt_t *host_dwt(void)
+{
+    static host_dwt_t regs = { DWT_CTRL_CYCCNTENA_Msk, 0U };
+#if defined(HOST_DWT_CLOCK)
+    regs.CYCCNT = HOST_DWT_CLOCK();
+#else
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    regs.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+#endif
+    return &regs;
+}
+
+static inline host_core_debug_t *host_core_debug(void)
+{
+    static host_core_debug_t regs;
+
+    return &regs;
+}
+
+#define DWT                           (host_dwt())
+#define CoreDebug                     (host_core_debug())
+
+void          NVIC_EnableIRQ(IRQn_Type IRQn);
+void          NVIC_DisableIRQ(IRQn_Type IRQn);
+cy_israddress Cy_SysInt_SetVector(IRQn_Type IRQn, cy_israddress userIsr);
+
+#endif /* CY_PDL_H */
@@ -0,0 +1,15 @@
+/* Host stand-in for the PDL cy_result.h: result type and codes only */
+#ifndef CY_RESULT_H
+#define CY_RESULT_H
+
+#include <stdint.h>
+
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS               ((cy_rslt_t)0U)
+#define CY_RSLT_TYPE_ERROR            (2U)
+#define CY_RSLT_MODULE_APP_START      (0x0100U)
+#define CY_RSLT_CREATE(type, module, code) \
+    ((cy_rslt_t)((((type) & 0x3U) << 16) | (((module) & 0xFFFU) << 18) | ((code) & 0xFFFFU)))
+
+#endif /* CY_RESULT_H */
@@ -0,0 +1,30 @@
+/*
+ * Host stand-in for the PDL cy_syslib.h
+ *
+ * A critical section masks interrupts on the target. On the host,
+ * "interrupts" are threads, so it takes host_critical, which
+ * host_critical.c defines.
+ */
+#ifndef CY_SYSLIB_H
+#define CY_SYSLIB_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "cy_utils.h"
+
+extern pthread_mutex_t host_critical;
+
+static inline uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    (void)pthread_mutex_lock(&host_critical);
+    return 0U;
+}
+
+static inline void Cy_SysLib_ExitCriticalSection(uint32_t state)
+{
+    (void)state;
+    (void)pthread_mutex_unlock(&host_critical);
+}
+
+#endif /* CY_SYSLIB_H */
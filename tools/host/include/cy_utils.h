@@ -0,0 +1,13 @@
+/* Host stand-in for the PDL cy_utils.h */
+#ifndef CY_UTILS_H
+#define CY_UTILS_H
+
+#include <assert.h>
+
+#define CY_ASSERT(x)                  assert(x)
+#define CY_UNUSED_PARAMETER(x)        ((void)(x))
+#define CY_ALIGN(align)               __attribute__((aligned(align)))
+#define CY_SECTION(name)              __attribute__((section(name)))
+#define CY_STATIC_ASSERT(cond, msg)   _Static_assert((cond), msg)
+
+#endif /* CY_UTILS_H */
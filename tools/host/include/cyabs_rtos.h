@@ -0,0 +1,83 @@
+/*
+ * Host stand-in for the abstraction-rtos cyabs_rtos.h: threads, queues,
+ * semaphores and delays on POSIX threads, which host_rtos.c implements.
+ *
+ * Threads run on the stack the caller passes, as they do under FreeRTOS;
+ * host_rtos.c paints it first so task_stats_report() can report the
+ * high-water mark. glibc keeps its thread control block at the top of a
+ * caller-supplied stack, so on the host the stack size must leave room
+ * for it and be at least PTHREAD_STACK_MIN.
+ */
+#ifndef CYABS_RTOS_H
+#define CYABS_RTOS_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+#define CY_RTOS_NEVER_TIMEOUT         (0xFFFFFFFFUL)
+
+#define CY_RSLT_MODULE_ABSTRACTION_OS (0x0100U)
+#define CY_RTOS_NO_MEMORY             CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_OS, 1U)
+#define CY_RTOS_GENERAL_ERROR         CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_OS, 2U)
+#define CY_RTOS_BAD_PARAM             CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_OS, 5U)
+#define CY_RTOS_TIMEOUT               CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_OS, 6U)
+
+typedef uint32_t cy_time_t;
+typedef void    *cy_thread_arg_t;
+typedef void   (*cy_thread_entry_fn_t)(cy_thread_arg_t arg);
+
+/* Priorities are accepted and ignored: Linux schedules the threads */
+typedef enum
+{
+    CY_RTOS_PRIORITY_MIN,
+    CY_RTOS_PRIORITY_LOW,
+    CY_RTOS_PRIORITY_BELOWNORMAL,
+    CY_RTOS_PRIORITY_NORMAL,
+    CY_RTOS_PRIORITY_ABOVENORMAL,
+    CY_RTOS_PRIORITY_HIGH,
+    CY_RTOS_PRIORITY_REALTIME,
+    CY_RTOS_PRIORITY_MAX
+} cy_thread_priority_t;
+
+typedef struct host_rtos_thread *cy_thread_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    uint8_t        *items;
+    size_t          item_size;
+    size_t          length;
+    size_t          head;
+    size_t          count;
+} cy_queue_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    uint32_t        count;
+    uint32_t        max_count;
+} cy_semaphore_t;
+
+cy_rslt_t cy_rtos_thread_create(cy_thread_t *thread, cy_thread_entry_fn_t entry_function,
+                                const char *name, void *stack, uint32_t stack_size,
+                                cy_thread_priority_t priority, cy_thread_arg_t arg);
+
+cy_rslt_t cy_rtos_queue_init(cy_queue_t *queue, size_t length, size_t itemsize);
+cy_rslt_t cy_rtos_queue_put(cy_queue_t *queue, const void *item_ptr, cy_time_t timeout_ms);
+cy_rslt_t cy_rtos_queue_get(cy_queue_t *queue, void *item_ptr, cy_time_t timeout_ms);
+
+cy_rslt_t cy_rtos_semaphore_init(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount);
+cy_rslt_t cy_rtos_semaphore_get(cy_semaphore_t *semaphore, cy_time_t timeout_ms);
+cy_rslt_t cy_rtos_semaphore_set(cy_semaphore_t *semaphore);
+
+cy_rslt_t cy_rtos_delay_milliseconds(cy_time_t num_ms);
+
+/* Host only: lowest free stack of the threads created so far, in bytes */
+uint32_t host_rtos_min_stack_free(void);
+
+#endif /* CYABS_RTOS_H */
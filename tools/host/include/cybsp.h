@@ -0,0 +1,26 @@
+/*
+ * Host stand-in for the BSP cybsp.h: the SRF relay context and the IPC
+ * receive/process calls of the CM33 relay loop, which the host program
+ * defines
+ */
+#ifndef CYBSP_H
+#define CYBSP_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+#define MTB_IPC_NEVER_TIMEOUT         (0xFFFFFFFFUL)
+#define MTB_IPC_IRQ_QUEUE_SRF_RELAY   (2U)
+
+typedef struct
+{
+    uint32_t unused;
+} mtb_srf_ipc_relay_context_t;
+
+extern mtb_srf_ipc_relay_context_t cybsp_mtb_srf_relay_context;
+
+cy_rslt_t mtb_srf_ipc_receive_request(mtb_srf_ipc_relay_context_t *context, uint32_t timeout_us);
+cy_rslt_t mtb_srf_ipc_process_pending_request(mtb_srf_ipc_relay_context_t *context);
+
+#endif /* CYBSP_H */
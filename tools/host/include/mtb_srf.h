@@ -0,0 +1,28 @@
+/*
+ * Host stand-in for the mtb-srf client header: the vector types and the
+ * blocking submit, which the host program under test implements
+ */
+#ifndef MTB_SRF_H
+#define MTB_SRF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+typedef struct
+{
+    const void *base;
+    size_t      len;
+} mtb_srf_invec_ns_t;
+
+typedef struct
+{
+    void  *base;
+    size_t len;
+} mtb_srf_outvec_ns_t;
+
+cy_rslt_t mtb_srf_request_submit(mtb_srf_invec_ns_t *inVec_ns, uint8_t inVec_cnt_ns,
+                                 mtb_srf_outvec_ns_t *outVec_ns, uint8_t outVec_cnt_ns);
+
+#endif /* MTB_SRF_H */
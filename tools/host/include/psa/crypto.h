@@ -0,0 +1,157 @@
+/*
+ * Host stand-in for the PSA Crypto API header: status codes, key types,
+ * algorithms and size macros of the subset the application uses. The
+ * values and sizes follow the real header. A host program either defines
+ * the calls its module makes as mocks or links host_psa.c, which
+ * implements them on OpenSSL.
+ */
+#ifndef PSA_CRYPTO_H
+#define PSA_CRYPTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int32_t  psa_status_t;
+typedef uint32_t psa_key_id_t;
+typedef uint32_t psa_algorithm_t;
+typedef uint16_t psa_key_type_t;
+typedef uint32_t psa_key_lifetime_t;
+typedef uint8_t  psa_ecc_family_t;
+typedef uint32_t psa_key_usage_t;
+
+typedef struct
+{
+    void            *ctx;           /* OpenSSL digest context in host_psa.c */
+    psa_algorithm_t  alg;
+} psa_hash_operation_t;
+
+typedef struct
+{
+    psa_key_type_t     type;
+    size_t             bits;
+    psa_algorithm_t    alg;
+    psa_key_usage_t    usage;
+    psa_key_lifetime_t lifetime;
+} psa_key_attributes_t;
+
+#define PSA_HASH_OPERATION_INIT       { NULL, 0U }
+#define PSA_KEY_ATTRIBUTES_INIT       { 0U, 0U, 0U, 0U, 0U }
+
+#define PSA_SUCCESS                   ((psa_status_t)0)
+#define PSA_ERROR_NOT_PERMITTED       ((psa_status_t)-133)
+#define PSA_ERROR_NOT_SUPPORTED       ((psa_status_t)-134)
+#define PSA_ERROR_INVALID_ARGUMENT    ((psa_status_t)-135)
+#define PSA_ERROR_INVALID_HANDLE      ((psa_status_t)-136)
+#define PSA_ERROR_BAD_STATE           ((psa_status_t)-137)
+#define PSA_ERROR_BUFFER_TOO_SMALL    ((psa_status_t)-138)
+#define PSA_ERROR_DOES_NOT_EXIST      ((psa_status_t)-140)
+#define PSA_ERROR_INSUFFICIENT_MEMORY ((psa_status_t)-141)
+#define PSA_ERROR_INSUFFICIENT_STORAGE ((psa_status_t)-142)
+#define PSA_ERROR_INVALID_SIGNATURE   ((psa_status_t)-149)
+#define PSA_ERROR_CORRUPTION_DETECTED ((psa_status_t)-151)
+#define PSA_OPERATION_INCOMPLETE      ((psa_status_t)-248)
+
+#define PSA_KEY_ID_NULL               ((psa_key_id_t)0)
+#define PSA_KEY_LIFETIME_VOLATILE     ((psa_key_lifetime_t)0x00000000)
+
+#define PSA_ECC_FAMILY_SECP_R1        ((psa_ecc_family_t)0x12)
+#define PSA_ECC_FAMILY_TWISTED_EDWARDS ((psa_ecc_family_t)0x42)
+#define PSA_KEY_TYPE_ECC_KEY_PAIR(curve) \
+    ((psa_key_type_t)(0x7100U | (curve)))
+#define PSA_KEY_TYPE_ECC_PUBLIC_KEY(curve) \
+    ((psa_key_type_t)(0x4100U | (curve)))
+
+#define PSA_KEY_USAGE_EXPORT          ((psa_key_usage_t)0x00000001)
+#define PSA_KEY_USAGE_SIGN_MESSAGE    ((psa_key_usage_t)0x00000400)
+#define PSA_KEY_USAGE_VERIFY_MESSAGE  ((psa_key_usage_t)0x00000800)
+#define PSA_KEY_USAGE_SIGN_HASH       ((psa_key_usage_t)0x00001000)
+#define PSA_KEY_USAGE_VERIFY_HASH     ((psa_key_usage_t)0x00002000)
+
+#define PSA_ALG_NONE                  ((psa_algorithm_t)0)
+#define PSA_ALG_SHA_256               ((psa_algorithm_t)0x02000009)
+#define PSA_ALG_SHA_384               ((psa_algorithm_t)0x0200000a)
+#define PSA_ALG_ECDSA(hash_alg)       ((psa_algorithm_t)(0x06000600U | ((hash_alg) & 0xffU)))
+#define PSA_ALG_DETERMINISTIC_ECDSA(hash_alg) \
+    ((psa_algorithm_t)(0x06000700U | ((hash_alg) & 0xffU)))
+#define PSA_ALG_PURE_EDDSA            ((psa_algorithm_t)0x06000800)
+#define PSA_ALG_IS_ECDSA(alg)         (((alg) & ~0x000001ffU) == 0x06000600U)
+#define PSA_ALG_IS_DETERMINISTIC_ECDSA(alg) (((alg) & ~0x000000ffU) == 0x06000700U)
+#define PSA_ALG_SIGN_GET_HASH(alg)    (((alg) & 0x000000ffU) | 0x02000000U)
+
+#define PSA_BITS_TO_BYTES(bits)       (((bits) + 7U) / 8U)
+
+#define PSA_HASH_LENGTH(alg)          (((alg) == PSA_ALG_SHA_384) ? 48U : 32U)
+#define PSA_HASH_MAX_SIZE             (64U)
+
+/* ECDSA and EdDSA: r || s */
+#define PSA_SIGN_OUTPUT_SIZE(key_type, key_bits, alg) \
+    (2U * PSA_BITS_TO_BYTES(key_bits))
+#define PSA_SIGNATURE_MAX_SIZE        (2U * PSA_BITS_TO_BYTES(384U))
+
+/* Uncompressed point 04 || x || y, up to P-384 */
+#define PSA_KEY_EXPORT_ECC_PUBLIC_KEY_MAX_SIZE(key_bits) \
+    (2U * PSA_BITS_TO_BYTES(key_bits) + 1U)
+#define PSA_EXPORT_PUBLIC_KEY_MAX_SIZE PSA_KEY_EXPORT_ECC_PUBLIC_KEY_MAX_SIZE(384U)
+
+static inline psa_hash_operation_t psa_hash_operation_init(void)
+{
+    const psa_hash_operation_t op = PSA_HASH_OPERATION_INIT;
+    return op;
+}
+
+static inline void psa_set_key_type(psa_key_attributes_t *attributes, psa_key_type_t type)
+{
+    attributes->type = type;
+}
+
+static inline void psa_set_key_bits(psa_key_attributes_t *attributes, size_t bits)
+{
+    attributes->bits = bits;
+}
+
+static inline void psa_set_key_algorithm(psa_key_attributes_t *attributes, psa_algorithm_t alg)
+{
+    attributes->alg = alg;
+}
+
+static inline void psa_set_key_usage_flags(psa_key_attributes_t *attributes, psa_key_usage_t usage)
+{
+    attributes->usage = usage;
+}
+
+static inline void psa_set_key_lifetime(psa_key_attributes_t *attributes, psa_key_lifetime_t lifetime)
+{
+    attributes->lifetime = lifetime;
+}
+
+psa_status_t psa_crypto_init(void);
+psa_status_t psa_generate_key(const psa_key_attributes_t *attributes, psa_key_id_t *key);
+psa_status_t psa_import_key(const psa_key_attributes_t *attributes, const uint8_t *data,
+                            size_t data_length, psa_key_id_t *key);
+psa_status_t psa_destroy_key(psa_key_id_t key);
+psa_status_t psa_hash_setup(psa_hash_operation_t *operation, psa_algorithm_t alg);
+psa_status_t psa_hash_update(psa_hash_operation_t *operation, const uint8_t *input,
+                             size_t input_length);
+psa_status_t psa_hash_finish(psa_hash_operation_t *operation, uint8_t *hash, size_t hash_size,
+                             size_t *hash_length);
+psa_status_t psa_hash_clone(const psa_hash_operation_t *source_operation,
+                            psa_hash_operation_t *target_operation);
+psa_status_t psa_hash_abort(psa_hash_operation_t *operation);
+psa_status_t psa_sign_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                           size_t hash_length, uint8_t *signature, size_t signature_size,
+                           size_t *signature_length);
+psa_status_t psa_verify_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                                size_t input_length, const uint8_t *signature,
+                                size_t signature_length);
+
+psa_status_t psa_hash_compute(psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                              uint8_t *hash, size_t hash_size, size_t *hash_length);
+psa_status_t psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                   size_t *data_length);
+psa_status_t psa_sign_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                              size_t input_length, uint8_t *signature, size_t signature_size,
+                              size_t *signature_length);
+psa_status_t psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                             size_t hash_length, const uint8_t *signature, size_t signature_length);
+
+#endif /* PSA_CRYPTO_H */
@@ -0,0 +1,26 @@
+/*
+ * Host stand-in for the PSA Protected Storage API header. host_ps.c keeps
+ * the assets in RAM, so a host program starts with empty storage and can
+ * read or alter an asset behind the module's back as an attacker with
+ * flash access would.
+ */
+#ifndef PSA_PROTECTED_STORAGE_H
+#define PSA_PROTECTED_STORAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+typedef uint64_t psa_storage_uid_t;
+typedef uint32_t psa_storage_create_flags_t;
+
+#define PSA_STORAGE_FLAG_NONE         ((psa_storage_create_flags_t)0U)
+
+psa_status_t psa_ps_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+                        psa_storage_create_flags_t create_flags);
+psa_status_t psa_ps_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+                        size_t *p_data_length);
+psa_status_t psa_ps_remove(psa_storage_uid_t uid);
+
+#endif /* PSA_PROTECTED_STORAGE_H */
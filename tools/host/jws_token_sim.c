@@ -0,0 +1,230 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : JWS token host check
+ * Purpose : Run proj_cm33_ns/jws_token.c on the host: the RFC 4648 and
+ *           RFC 7515 vectors of jws_self_test(), base64url against
+ *           OpenSSL, cached-header minting against direct minting, and
+ *           tokens per second of both.
+ * Design  : signing.c runs on host_psa.c, whose deterministic ECDSA makes
+ *           the RFC 7515 A.3 token and the two minting paths reproducible,
+ *           so tokens are compared whole. OpenSSL's EVP_EncodeBlock() is the
+ *           independent base64 encoder; its output is mapped to the URL
+ *           alphabet and stripped of padding. The claims are the ones of
+ *           jws_token_benchmark() in app_benchmarks.c.
+ ********************************************************************************
+ * @file    jws_token_sim.c
+ * @brief   JWS vectors, base64url cross-check and minting rate on the host
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openssl/evp.h>
+
+#include "jws_token.h"
+#include "signing.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_RUNS                      (2000U)
+#define SIM_B64_MAX                   (200U)       /**< Longest input of the cross-check */
+#define SIM_CLAIMS_MAX                (160U)
+#define SIM_TOKEN_MAX                 (JWS_TOKEN_SIZE(JWS_HEADER_MAX, SIM_CLAIMS_MAX))
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint32_t     sim_seed = 0x9E3779B9U;
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+static uint32_t sim_random(void)
+{
+    sim_seed ^= sim_seed << 13;
+    sim_seed ^= sim_seed >> 17;
+    sim_seed ^= sim_seed << 5;
+    return sim_seed;
+}
+
+static uint64_t sim_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Every length up to SIM_B64_MAX encodes as OpenSSL does and decodes back */
+static void sim_base64url(void)
+{
+    uint8_t in[SIM_B64_MAX];
+    uint8_t back[SIM_B64_MAX];
+    char ours[JWS_BASE64URL_SIZE(SIM_B64_MAX) + 1U];
+    char ref[((SIM_B64_MAX + 2U) / 3U * 4U) + 1U];
+    uint32_t passed = 0;
+
+    for (uint32_t len = 0; len <= SIM_B64_MAX; len++)
+    {
+        size_t n;
+        int ref_len;
+
+        for (uint32_t i = 0; i < len; i++)
+        {
+            in[i] = (uint8_t)sim_random();
+        }
+        n = jws_base64url_encode(in, len, ours);
+        ref_len = EVP_EncodeBlock((unsigned char *)ref, in, (int)len);
+        while ((ref_len > 0) && (ref[ref_len - 1] == '='))
+        {
+            ref_len--;
+        }
+        for (int i = 0; i < ref_len; i++)
+        {
+            ref[i] = (ref[i] == '+') ? '-' : ((ref[i] == '/') ? '_' : ref[i]);
+        }
+
+        if ((n == JWS_BASE64URL_SIZE(len)) && (n == (size_t)ref_len) && (memcmp(ours, ref, n) == 0) &&
+            (jws_base64url_decode(ours, n, back, sizeof(back)) == len) && (memcmp(back, in, len) == 0))
+        {
+            passed++;
+        }
+    }
+    printf("base64url against OpenSSL: %lu/%u lengths\n", (unsigned long)passed, SIM_B64_MAX + 1U);
+    SIM_CHECK(passed == (SIM_B64_MAX + 1U), "base64url matches EVP_EncodeBlock and decodes back");
+
+    /* Characters outside the alphabet and a lone final character are rejected */
+    SIM_CHECK(jws_base64url_decode("Zm9v+g", 6U, back, sizeof(back)) == SIZE_MAX, "'+' rejected");
+    SIM_CHECK(jws_base64url_decode("Zm9vY", 5U, back, sizeof(back)) == SIZE_MAX, "length 4n+1 rejected");
+}
+
+/** @brief Claims of a five-minute device token, as on the device */
+static size_t sim_claims(char *claims, size_t size, uint32_t seq)
+{
+    uint32_t iat = 1791158400UL + (seq * 60U);
+
+    return (size_t)snprintf(claims, size,
+                            "{\"sub\":\"psoc-edge-0017\",\"aud\":\"telemetry\","
+                            "\"iat\":%lu,\"exp\":%lu,\"jti\":\"%08lx\"}",
+                            (unsigned long)iat, (unsigned long)(iat + 300U), (unsigned long)seq);
+}
+
+/** @brief Cached-header tokens equal direct ones; tokens per second of each */
+static void sim_minting(signing_key_t *key)
+{
+    static const char header[] = JWS_HEADER_ES256_JWT;
+    char claims[SIM_CLAIMS_MAX];
+    char direct[SIM_TOKEN_MAX];
+    char cached[SIM_TOKEN_MAX];
+    uint8_t signature[SIGNING_SIGNATURE_MAX_SIZE];
+    uint64_t direct_ns = 0;
+    uint64_t cached_ns = 0;
+    size_t direct_len = 0;
+    size_t cached_len = 0;
+    jws_minter_t minter;
+    bool same = true;
+    bool ok;
+
+    ok = (jws_minter_init(&minter, key, header, sizeof(header) - 1U) == PSA_SUCCESS);
+    for (uint32_t r = 0; ok && (r < SIM_RUNS); r++)
+    {
+        size_t signature_len = 0;
+        size_t claims_len;
+        uint64_t start = sim_now_ns();
+
+        claims_len = sim_claims(claims, sizeof(claims), r);
+        direct_len = jws_base64url_encode((const uint8_t *)header, sizeof(header) - 1U, direct);
+        direct[direct_len++] = '.';
+        direct_len += jws_base64url_encode((const uint8_t *)claims, claims_len, &direct[direct_len]);
+        ok = (signing_sign(key, (const uint8_t *)direct, direct_len, signature, sizeof(signature), &signature_len) == PSA_SUCCESS);
+        direct[direct_len++] = '.';
+        direct_len += jws_base64url_encode(signature, signature_len, &direct[direct_len]);
+        direct[direct_len] = '\0';
+        direct_ns += sim_now_ns() - start;
+
+        start = sim_now_ns();
+        claims_len = sim_claims(claims, sizeof(claims), r);
+        ok = ok && (jws_mint(&minter, claims, claims_len, cached, sizeof(cached), &cached_len) == PSA_SUCCESS);
+        cached_ns += sim_now_ns() - start;
+
+        same = same && ok && (cached_len == direct_len) && (strcmp(cached, direct) == 0);
+    }
+    jws_minter_free(&minter);
+
+    SIM_CHECK(ok, "every token minted");
+    SIM_CHECK(same, "cached-header token equals the direct one");
+    if (ok)
+    {
+        printf("JWS ES256 minting, %lu B tokens (mean ns, tokens/s):\n", (unsigned long)cached_len);
+        printf("  direct         %9lu  %lu\n", (unsigned long)(direct_ns / SIM_RUNS),
+               (unsigned long)((1000000000ULL * SIM_RUNS) / (direct_ns + 1U)));
+        printf("  cached header  %9lu  %lu\n", (unsigned long)(cached_ns / SIM_RUNS),
+               (unsigned long)((1000000000ULL * SIM_RUNS) / (cached_ns + 1U)));
+    }
+}
+
+int main(void)
+{
+    signing_key_config_t config =
+    {
+        SIGNING_SCHEME_ECDSA_P256, SIGNING_NONCE_DETERMINISTIC, PSA_KEY_LIFETIME_VOLATILE
+    };
+    signing_key_t key;
+    psa_status_t status;
+    bool ok;
+
+    sim_base64url();
+
+    SIM_CHECK(signing_init() == PSA_SUCCESS, "signing_init");
+    /* With RFC 6979 nonces the self test compares the whole token */
+    SIM_CHECK(signing_self_test() == PSA_SUCCESS, "deterministic ECDSA known-answer test");
+    status = jws_self_test();
+    printf("JWS known-answer test: %s\n", (status == PSA_SUCCESS) ? "pass" : "FAIL");
+    SIM_CHECK(status == PSA_SUCCESS, "jws_self_test");
+
+    SIM_CHECK(signing_key_generate(&config, &key) == PSA_SUCCESS, "deterministic P-256 key");
+    sim_minting(&key);
+    signing_key_destroy(&key);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
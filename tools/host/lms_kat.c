@@ -0,0 +1,292 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : LMS / HSS known-answer tests
+ * Purpose : Run proj_cm33_ns/lms_verify.c against the RFC 8554 Appendix F
+ *           test cases and against the built-in vector, directly and
+ *           through signing_verify() with a SIGNING_SCHEME_HSS_SHA256 key.
+ * Design  : The vectors are rfc8554_vectors.txt, which rfc8554_vectors.py
+ *           extracts from the RFC text (one "case", "pub", "msg", "sig" line
+ *           group per test case). Each case must verify as given, with
+ *           hss_verify() and with signing_verify(). It must then fail when a
+ *           bit is flipped in the public key, the message or the signature,
+ *           and when the signature is truncated. A missing file, or fewer
+ *           than the KAT_RFC_CASES cases of Appendix F, fails the run.
+ *
+ *           signing.c is linked with host_psa.c, so the same call is also
+ *           checked with an ECDSA P-256 key on OpenSSL: both schemes share
+ *           the verify path of the image check in main.c.
+ ********************************************************************************
+ * @file    lms_kat.c
+ * @brief   RFC 8554 Appendix F known-answer tests for the LMS verifier
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lms_verify.h"
+#include "signing.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define KAT_LINE_MAX                  (64U * 1024U)
+#define KAT_SIG_FLIP_STRIDE           (97U)        /**< Signature bytes between flips */
+#define KAT_RFC_CASES                 (2)          /**< Test cases in Appendix F */
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief One decoded test case */
+typedef struct
+{
+    uint8_t *data[3];               /**< Public key, message, signature */
+    size_t   len[3];
+} kat_case_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+/** @brief Decode a hex string into a new buffer; NULL if it is not hex */
+static uint8_t *kat_unhex(const char *hex, size_t *len)
+{
+    size_t n = strlen(hex);
+    uint8_t *out;
+
+    if ((n % 2U) != 0U)
+    {
+        return NULL;
+    }
+    out = malloc((n / 2U) + 1U);
+    for (size_t i = 0; (out != NULL) && (i < (n / 2U)); i++)
+    {
+        unsigned int byte;
+
+        if (sscanf(&hex[2U * i], "%2x", &byte) != 1)
+        {
+            free(out);
+            return NULL;
+        }
+        out[i] = (uint8_t)byte;
+    }
+    *len = n / 2U;
+    return out;
+}
+
+/** @brief signing_verify() with an HSS key imported from @p pub */
+static psa_status_t kat_signing_verify(const uint8_t *pub, size_t pub_len, const uint8_t *msg,
+                                       size_t msg_len, const uint8_t *sig, size_t sig_len)
+{
+    static const signing_key_config_t config = { SIGNING_SCHEME_HSS_SHA256, SIGNING_NONCE_RANDOM,
+                                                 PSA_KEY_LIFETIME_VOLATILE };
+    signing_key_t key;
+    psa_status_t status = signing_key_import(&config, pub, pub_len, &key);
+
+    if (status == PSA_SUCCESS)
+    {
+        status = signing_verify(&key, msg, msg_len, sig, sig_len);
+        signing_key_destroy(&key);
+    }
+    return status;
+}
+
+/** @brief Verify one case as given and with every kind of corruption */
+static bool kat_run(int number, kat_case_t *c)
+{
+    uint8_t *pub = c->data[0];
+    uint8_t *msg = c->data[1];
+    uint8_t *sig = c->data[2];
+    uint32_t rejected = 0;
+    uint32_t tampered = 0;
+    psa_status_t status;
+
+    status = hss_verify(pub, c->len[0], msg, c->len[1], sig, c->len[2]);
+    if (status == PSA_SUCCESS)
+    {
+        status = kat_signing_verify(pub, c->len[0], msg, c->len[1], sig, c->len[2]);
+    }
+    if (status != PSA_SUCCESS)
+    {
+        printf("RFC 8554 test case %d: does not verify (%ld)\n", number, (long)status);
+        return false;
+    }
+
+    for (uint32_t part = 0; part < 3U; part++)
+    {
+        size_t stride = (part == 2U) ? KAT_SIG_FLIP_STRIDE : 1U;
+
+        for (size_t i = 0; i < c->len[part]; i += stride)
+        {
+            c->data[part][i] ^= 0x01U;
+            if (hss_verify(pub, c->len[0], msg, c->len[1], sig, c->len[2]) != PSA_SUCCESS)
+            {
+                rejected++;
+            }
+            tampered++;
+            c->data[part][i] ^= 0x01U;
+        }
+    }
+    tampered++;
+    if (hss_verify(pub, c->len[0], msg, c->len[1], sig, c->len[2] - 1U) != PSA_SUCCESS)
+    {
+        rejected++;
+    }
+
+    printf("RFC 8554 test case %d: OK, %lu levels, %zu byte signature, %lu/%lu corruptions rejected\n",
+           number, (unsigned long)(((uint32_t)pub[2] << 8) | pub[3]), c->len[2],
+           (unsigned long)rejected, (unsigned long)tampered);
+    return rejected == tampered;
+}
+
+/** @brief Run every case in a rfc8554_vectors.py output file */
+static bool kat_file(const char *path)
+{
+    static const char *const tags[3] = { "pub ", "msg ", "sig " };
+    static char line[KAT_LINE_MAX];
+    kat_case_t c;
+    int number = -1;
+    int cases = 0;
+    bool ok = true;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL)
+    {
+        perror(path);
+        printf("RFC 8554 Appendix F: no vectors, run make -C tools/host rfc8554-vectors\n");
+        return false;
+    }
+    memset(&c, 0, sizeof(c));
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (sscanf(line, "case %d", &number) == 1)
+        {
+            continue;
+        }
+        for (uint32_t part = 0; part < 3U; part++)
+        {
+            if (strncmp(line, tags[part], 4U) == 0)
+            {
+                free(c.data[part]);
+                c.data[part] = kat_unhex(&line[4], &c.len[part]);
+                if (c.data[part] == NULL)
+                {
+                    printf("%s: bad hex in test case %d\n", path, number);
+                    ok = false;
+                }
+            }
+        }
+        if ((c.data[0] != NULL) && (c.data[1] != NULL) && (c.data[2] != NULL))
+        {
+            ok = kat_run(number, &c) && ok;
+            cases++;
+            for (uint32_t part = 0; part < 3U; part++)
+            {
+                free(c.data[part]);
+                c.data[part] = NULL;
+            }
+        }
+    }
+    fclose(f);
+
+    if (cases < KAT_RFC_CASES)
+    {
+        printf("%s: %d test cases, Appendix F has %d\n", path, cases, KAT_RFC_CASES);
+        ok = false;
+    }
+    return ok;
+}
+
+/** @brief HSS and ECDSA P-256 keys through the same signing_verify() call */
+static bool kat_signing(void)
+{
+    static const uint8_t message[] = "firmware image digest";
+    const lms_vector_t *v = &lms_test_vector;
+    signing_key_config_t config = SIGNING_KEY_CONFIG_DEFAULT;
+    signing_key_t key;
+    uint8_t signature[PSA_SIGNATURE_MAX_SIZE];
+    uint8_t *tampered = malloc(v->signature_len);
+    size_t signature_len = 0;
+    bool ok = (tampered != NULL) && (signing_init() == PSA_SUCCESS);
+
+    /* HSS: the built-in vector, a corrupted signature, no signing */
+    config.scheme = SIGNING_SCHEME_HSS_SHA256;
+    ok = ok && (signing_key_import(&config, v->public_key, v->public_key_len, &key) == PSA_SUCCESS);
+    if (ok)
+    {
+        memcpy(tampered, v->signature, v->signature_len);
+        tampered[v->signature_len / 2U] ^= 0x01U;
+        ok = (signing_verify(&key, v->message, v->message_len, v->signature, v->signature_len) == PSA_SUCCESS) &&
+             (signing_verify(&key, v->message, v->message_len, tampered, v->signature_len) == PSA_ERROR_INVALID_SIGNATURE) &&
+             (signing_sign(&key, message, sizeof(message), signature, sizeof(signature), &signature_len) == PSA_ERROR_NOT_SUPPORTED) &&
+             (key.verify_latency.count == 1U);
+        signing_key_destroy(&key);
+    }
+    ok = ok && (signing_key_import(&config, v->public_key, v->public_key_len - 1U, &key) == PSA_ERROR_INVALID_ARGUMENT);
+    printf("signing_verify() with SIGNING_SCHEME_HSS_SHA256: %s\n", ok ? "OK" : "FAIL");
+
+    /* ECDSA P-256 on OpenSSL through the same calls */
+    config.scheme = SIGNING_SCHEME_ECDSA_P256;
+    if (ok && (signing_key_generate(&config, &key) == PSA_SUCCESS))
+    {
+        ok = (signing_sign(&key, message, sizeof(message), signature, sizeof(signature), &signature_len) == PSA_SUCCESS) &&
+             (signing_verify(&key, message, sizeof(message), signature, signature_len) == PSA_SUCCESS);
+        signature[0] ^= 0x01U;
+        ok = ok && (signing_verify(&key, message, sizeof(message), signature, signature_len) == PSA_ERROR_INVALID_SIGNATURE);
+        signing_key_destroy(&key);
+    }
+    else
+    {
+        ok = false;
+    }
+    printf("signing_verify() with SIGNING_SCHEME_ECDSA_P256: %s\n", ok ? "OK" : "FAIL");
+
+    free(tampered);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    psa_status_t status;
+    bool ok;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <rfc8554_vectors.txt>\n", argv[0]);
+        return 2;
+    }
+
+    status = lms_self_test();
+    ok = (status == PSA_SUCCESS);
+    printf("Built-in vector: %s\n", ok ? "OK" : "FAIL");
+    ok = kat_signing() && ok;
+    ok = kat_file(argv[1]) && ok;
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,403 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : SRF relay host model
+ * Purpose : Compare the default CM33 relay loop (one blocking receive and
+ *           one process call per request) with proj_cm33_ns/relay_coalesce.c
+ *           under the same M55 traffic, and report interrupts per request
+ *           and arrival-to-reply latency percentiles for both.
+ * Design  : Discrete-event model in simulated time. The DWT cycle counter
+ *           reads the simulated clock (HOST_DWT_CLOCK, 1 cycle = 1 ns), so
+ *           relay_coalesce.c runs unchanged. Time advances only in the
+ *           IPC calls:
+ *           - an arrival raises the queue interrupt; if it is enabled the
+ *             ISR runs at once and costs SIM_ISR_NS, else it stays pending
+ *             and runs once when NVIC_EnableIRQ() unmasks it;
+ *           - a blocking receive on an empty queue sleeps until the next
+ *             arrival, a receive costs SIM_RECEIVE_NS, an empty poll
+ *             SIM_POLL_NS;
+ *           - processing a request (the TF-M call) costs SIM_SERVICE_NS.
+ *           Each traffic pattern uses the same arrival times for both
+ *           loops. True latency comes from the model; the coalescing
+ *           loop's own estimate (relay_coalesce_get_stats) is printed next
+ *           to it.
+ *
+ *           Exit status 0 means every request was served exactly once, in
+ *           order, by both loops, and coalescing never took more
+ *           interrupts than the default loop.
+ ********************************************************************************
+ * @file    relay_coalesce_sim.c
+ * @brief   Interrupts per request and latency of the default and coalescing relay
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "relay_coalesce.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_REQUESTS                  (20000U)
+#define SIM_ISR_NS                    (1500U)      /**< Interrupt entry, BSP handler, exit */
+#define SIM_RECEIVE_NS                (300U)       /**< Take one request off the IPC queue */
+#define SIM_POLL_NS                   (200U)       /**< Look at an empty IPC queue         */
+#define SIM_SERVICE_NS                (20000U)     /**< TF-M round trip of one request     */
+
+#define SIM_EMPTY                     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 1U)
+#define SIM_NOT_RECEIVED              CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 2U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+typedef enum
+{
+    SIM_TRAFFIC_LOW,        /**< Poisson, 1 ms mean gap                        */
+    SIM_TRAFFIC_BURSTS,     /**< 16 requests 5 us apart, 2 ms between bursts   */
+    SIM_TRAFFIC_SUSTAINED   /**< Poisson, 25 us mean gap (80 % of the service) */
+} sim_traffic_t;
+
+typedef struct
+{
+    uint32_t interrupts;
+    uint32_t p50_ns;
+    uint32_t p90_ns;
+    uint32_t p99_ns;
+    uint64_t elapsed_ns;
+} sim_result_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+mtb_srf_ipc_relay_context_t cybsp_mtb_srf_relay_context;
+
+static uint64_t      sim_arrival[SIM_REQUESTS];
+static uint32_t      sim_latency[SIM_REQUESTS];
+static uint32_t      sim_served_count[SIM_REQUESTS];
+static uint64_t      sim_now;
+static uint32_t      sim_arrived;       /**< Requests that reached the queue     */
+static uint32_t      sim_received;      /**< Requests taken off the queue        */
+static uint32_t      sim_served;        /**< Requests processed                  */
+static uint32_t      sim_irq_entries;
+static bool          sim_irq_enabled;
+static bool          sim_irq_pending;
+static cy_israddress sim_vector;
+static uint64_t      sim_seed;
+static unsigned int  sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Simulated DWT->CYCCNT (HOST_DWT_CLOCK) */
+uint32_t sim_clock(void)
+{
+    return (uint32_t)sim_now;
+}
+
+/** @brief Uniform in (0, 1], xorshift64 with a fixed seed */
+static double sim_uniform(void)
+{
+    sim_seed ^= sim_seed << 13;
+    sim_seed ^= sim_seed >> 7;
+    sim_seed ^= sim_seed << 17;
+    return ((double)(sim_seed >> 11) + 1.0) / 9007199254740992.0;
+}
+
+static void sim_traffic(sim_traffic_t traffic)
+{
+    uint64_t t = 0;
+
+    sim_seed = 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = 0; i < SIM_REQUESTS; i++)
+    {
+        switch (traffic)
+        {
+            case SIM_TRAFFIC_LOW:
+                t += (uint64_t)(-log(sim_uniform()) * 1000000.0);
+                break;
+            case SIM_TRAFFIC_BURSTS:
+                t += ((i % 16U) == 0U) ? 2000000U : 5000U;
+                break;
+            default:
+                t += (uint64_t)(-log(sim_uniform()) * 25000.0);
+                break;
+        }
+        sim_arrival[i] = t + 1U;
+    }
+}
+
+/** @brief The BSP queue handler: signals the blocking receive, nothing to model */
+void cybsp_srf_ipc_queue_interrupt_handler(void)
+{
+}
+
+static void sim_isr(void)
+{
+    sim_irq_entries++;
+    if (sim_vector != NULL)
+    {
+        sim_vector();
+    }
+    else
+    {
+        cybsp_srf_ipc_queue_interrupt_handler();
+    }
+}
+
+/**
+ * @brief Run the relay for @p ns; arrivals in that time raise the queue
+ *        interrupt, and an ISR that runs steals SIM_ISR_NS from the relay
+ */
+static void sim_advance(uint64_t ns)
+{
+    uint64_t until = sim_now + ns;
+
+    while ((sim_arrived < SIM_REQUESTS) && (sim_arrival[sim_arrived] <= until))
+    {
+        if (sim_arrival[sim_arrived] > sim_now)
+        {
+            sim_now = sim_arrival[sim_arrived];
+        }
+        sim_arrived++;
+        if (sim_irq_enabled)
+        {
+            sim_isr();
+            until += SIM_ISR_NS;
+        }
+        else
+        {
+            sim_irq_pending = true;
+        }
+    }
+    sim_now = until;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+    sim_irq_enabled = true;
+    if (sim_irq_pending)
+    {
+        sim_irq_pending = false;
+        sim_isr();
+        sim_advance(SIM_ISR_NS);
+    }
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+    sim_irq_enabled = false;
+}
+
+cy_israddress Cy_SysInt_SetVector(IRQn_Type IRQn, cy_israddress userIsr)
+{
+    cy_israddress previous = sim_vector;
+
+    (void)IRQn;
+    sim_vector = userIsr;
+    return previous;
+}
+
+cy_rslt_t mtb_srf_ipc_receive_request(mtb_srf_ipc_relay_context_t *context, uint32_t timeout_us)
+{
+    (void)context;
+    if (sim_arrived == sim_received)
+    {
+        if ((timeout_us != MTB_IPC_NEVER_TIMEOUT) || (sim_arrived == SIM_REQUESTS))
+        {
+            sim_advance(SIM_POLL_NS);
+            if (sim_arrived == sim_received)
+            {
+                return SIM_EMPTY;
+            }
+        }
+        else
+        {
+            /* Sleep until the interrupt of the next arrival */
+            sim_advance(sim_arrival[sim_arrived] - sim_now);
+        }
+    }
+    sim_received++;
+    sim_advance(SIM_RECEIVE_NS);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t mtb_srf_ipc_process_pending_request(mtb_srf_ipc_relay_context_t *context)
+{
+    uint32_t request = sim_served;
+
+    (void)context;
+    if (sim_served == sim_received)
+    {
+        return SIM_NOT_RECEIVED;
+    }
+    sim_advance(SIM_SERVICE_NS);
+    sim_served_count[request]++;
+    sim_latency[request] = (uint32_t)(sim_now - sim_arrival[request]);
+    sim_served++;
+    return CY_RSLT_SUCCESS;
+}
+
+/** @brief The default loop in proj_cm33_ns/main.c (relay_service without RELAY_COALESCE) */
+static cy_rslt_t sim_default_service(void)
+{
+    cy_rslt_t result;
+
+    result = mtb_srf_ipc_receive_request(&cybsp_mtb_srf_relay_context, MTB_IPC_NEVER_TIMEOUT);
+    if (result == CY_RSLT_SUCCESS)
+    {
+        result = mtb_srf_ipc_process_pending_request(&cybsp_mtb_srf_relay_context);
+    }
+    return result;
+}
+
+static int sim_compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t sim_percentile(const uint32_t *sorted, uint32_t percent)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)SIM_REQUESTS * percent + 99U) / 100U);
+
+    return sorted[rank - 1U];
+}
+
+/** @brief Serve the whole traffic pattern with one relay loop */
+static void sim_run(bool coalesce, sim_result_t *result)
+{
+    sim_now = 0;
+    sim_arrived = 0;
+    sim_received = 0;
+    sim_served = 0;
+    sim_irq_entries = 0;
+    sim_irq_enabled = true;
+    sim_irq_pending = false;
+    sim_vector = NULL;
+    memset(sim_served_count, 0, sizeof(sim_served_count));
+
+    if (coalesce)
+    {
+        relay_coalesce_init();
+    }
+    while (sim_served < SIM_REQUESTS)
+    {
+        cy_rslt_t rslt = coalesce ? relay_coalesce_service() : sim_default_service();
+
+        SIM_CHECK(rslt == CY_RSLT_SUCCESS, "relay service round");
+        if (rslt != CY_RSLT_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    for (uint32_t i = 0; i < SIM_REQUESTS; i++)
+    {
+        if (sim_served_count[i] != 1U)
+        {
+            SIM_CHECK(false, "request served exactly once");
+            break;
+        }
+    }
+    SIM_CHECK(sim_irq_enabled, "queue interrupt left enabled");
+
+    qsort(sim_latency, SIM_REQUESTS, sizeof(sim_latency[0]), sim_compare_u32);
+    result->interrupts = sim_irq_entries;
+    result->p50_ns = sim_percentile(sim_latency, 50U);
+    result->p90_ns = sim_percentile(sim_latency, 90U);
+    result->p99_ns = sim_percentile(sim_latency, 99U);
+    result->elapsed_ns = sim_now;
+}
+
+static void sim_print(const char *loop, const sim_result_t *result)
+{
+    printf("  %-9s %5.2f irq/request  p50/p90/p99 %6.1f / %6.1f / %6.1f us\n", loop,
+           (double)result->interrupts / SIM_REQUESTS, result->p50_ns / 1000.0,
+           result->p90_ns / 1000.0, result->p99_ns / 1000.0);
+}
+
+static void sim_compare(sim_traffic_t traffic, const char *name)
+{
+    sim_result_t plain;
+    sim_result_t coalesced;
+    relay_coalesce_stats_t stats;
+
+    sim_traffic(traffic);
+    printf("%s: %u requests over %.1f ms\n", name, SIM_REQUESTS,
+           sim_arrival[SIM_REQUESTS - 1U] / 1000000.0);
+
+    sim_run(false, &plain);
+    sim_print("default", &plain);
+    sim_run(true, &coalesced);
+    sim_print("coalesce", &coalesced);
+
+    relay_coalesce_get_stats(&stats);
+    printf("            module: %lu interrupts, %lu polled, burst limit %lu, "
+           "p50/p90/p99 <= %lu / %lu / %lu us\n",
+           (unsigned long)stats.interrupts, (unsigned long)stats.polled,
+           (unsigned long)stats.batch_limit, (unsigned long)stats.latency_p50_us,
+           (unsigned long)stats.latency_p90_us, (unsigned long)stats.latency_p99_us);
+
+    SIM_CHECK(stats.requests == SIM_REQUESTS, "module counted every request");
+    SIM_CHECK(stats.interrupts == coalesced.interrupts, "module counted every interrupt");
+    SIM_CHECK(coalesced.interrupts <= plain.interrupts, "coalescing takes no extra interrupts");
+}
+
+int main(void)
+{
+    bool ok;
+
+    printf("Relay model: %u ns ISR, %u ns receive, %u ns empty poll, %u ns TF-M call\n",
+           SIM_ISR_NS, SIM_RECEIVE_NS, SIM_POLL_NS, SIM_SERVICE_NS);
+    sim_compare(SIM_TRAFFIC_LOW, "Low rate");
+    sim_compare(SIM_TRAFFIC_BURSTS, "Bursts of 16");
+    sim_compare(SIM_TRAFFIC_SUSTAINED, "Sustained 80 %");
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
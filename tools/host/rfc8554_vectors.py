@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Extract the RFC 8554 Appendix F test cases for lms_kat.
+
+Appendix F prints each test case as annotated hex dumps:
+
+    Test Case 1 Public Key
+    --------------------------------------------
+    HSS public key
+    levels          00000002
+    ...
+    I               61a5d57d37f5e46bfb7520806b07a1b8
+    K               50650e3b31fe4a773ea29a07f09cf2ea
+                    30e579f0df58ef8e298da0434cb2b878
+
+The fields are listed in wire order, so concatenating the hex column of the
+"Public Key", "Message" and "Signature" blocks gives the encoded values.
+Field labels, "# ..." annotations and the "|ascii|" column of the message
+are dropped, and so are the page headers and footers of the text.
+"Private Key" blocks are skipped.
+
+Output, one test case per group of lines:
+
+    case <n>
+    pub <hex>
+    msg <hex>
+    sig <hex>
+
+Usage:
+    rfc8554_vectors.py rfc8554.txt > rfc8554_vectors.txt
+"""
+
+import re
+import sys
+
+HEX_RE = re.compile(r"^(?:[0-9a-f]{2})+$")
+TITLE_RE = re.compile(r"^\s*Test Case (\d+) (Public Key|Private Key|Message|Signature)\s*$")
+BLOCKS = {"Public Key": "pub", "Message": "msg", "Signature": "sig"}
+
+
+def page_furniture(line):
+    """Page header, footer or form feed of the plain-text RFC."""
+    return line.startswith("RFC 8554") or line.startswith("McGrew, et al.") or line.startswith("\f")
+
+
+def hex_field(line):
+    """Hex column of a dump line, or None if the line has none."""
+    words = line.split("|", 1)[0].split("#", 1)[0].split()
+    for word in words:
+        if HEX_RE.match(word):
+            return word
+        if any(c.isdigit() for c in word) and not word.endswith((":", "]")):
+            return None
+    return None
+
+
+def extract(lines):
+    cases = {}
+    block = None
+    in_appendix = False
+
+    for line in lines:
+        line = line.rstrip("\n")
+        if line.startswith("Appendix F."):
+            in_appendix = True
+            continue
+        if not in_appendix:
+            continue
+        if line.startswith("Acknowledgements") or line.startswith("Authors' Addresses"):
+            break
+        if page_furniture(line):
+            continue
+
+        match = TITLE_RE.match(line)
+        if match:
+            case = cases.setdefault(int(match.group(1)), {})
+            block = BLOCKS.get(match.group(2))
+            if block is not None:
+                case[block] = []
+            continue
+
+        if block is not None:
+            field = hex_field(line)
+            if field is not None:
+                case[block].append(field)
+
+    return cases
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().splitlines()[-1].strip())
+
+    with open(sys.argv[1]) as f:
+        cases = extract(f)
+    if not cases:
+        sys.exit("%s: no Appendix F test cases found" % sys.argv[1])
+
+    for number in sorted(cases):
+        case = cases[number]
+        missing = [b for b in ("pub", "msg", "sig") if not case.get(b)]
+        if missing:
+            sys.exit("test case %d: no %s block" % (number, ", ".join(missing)))
+        print("case %d" % number)
+        for block in ("pub", "msg", "sig"):
+            print("%s %s" % (block, "".join(case[block])))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,734 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : sign_service host simulation
+ * Purpose : Run proj_cm33_ns/sign_service.c behind a pseudo-terminal and
+ *           talk to it the way the gateway does.
+ * Design  : The master side of a pty is the service's UART. As in
+ *           sign_service_uart.c, a receive thread stands in for the RX
+ *           interrupt: it feeds every byte to sign_service_rx_byte() and
+ *           wakes the service thread when a frame completes, and the
+ *           service thread runs sign_service_process(). The main thread
+ *           is the gateway on the slave side (raw mode): it COBS-encodes
+ *           requests with proj_cm33_ns/cobs.c and decodes the responses.
+ *           Signing is stubbed: the "signature" is derived from the
+ *           message, so the gateway can check each response.
+ *
+ *           The second half offloads SIGN to a pool of worker threads
+ *           whose signing time depends on the message, so responses
+ *           complete out of order. The gateway streams requests keeping
+ *           exactly SIGN_SERVICE_RX_FRAMES outstanding (the credit window)
+ *           and must see no overrun. It then holds the workers, fills the
+ *           window and sends one request more, which must be the only
+ *           frame dropped.
+ *
+ *           Exit status 0 means every request got the expected response
+ *           and the service counters agree with what was sent.
+ ********************************************************************************
+ * @file    sign_service_sim.c
+ * @brief   Pseudo-terminal round trips through the signing service
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#define _GNU_SOURCE                 /* posix_openpt(), ptsname(), cfmakeraw() */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "cobs.h"
+#include "sign_service.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_SIGNATURE_LEN             (64U)
+#define SIM_PUBKEY_LEN                (65U)
+#define SIM_FRAME_MAX                 (2048U)      /**< Encoded, either way      */
+#define SIM_RESPONSE_MS               (2000)       /**< Expected response        */
+#define SIM_SILENCE_MS                (100)        /**< No response expected     */
+#define SIM_WORKERS                   (2U)
+#define SIM_WINDOW_REQUESTS           (200U)       /**< Streamed through the window */
+#define SIM_SIGN_US                   (700U)       /**< Worker signing time step */
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief A decoded response */
+typedef struct
+{
+    uint8_t      cmd;
+    uint8_t      seq;
+    psa_status_t status;
+    uint8_t      payload[SIM_FRAME_MAX];
+    size_t       len;
+} sim_response_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static int             sim_uart;        /**< pty master: the service side */
+static int             sim_gateway;     /**< pty slave: the gateway side  */
+static sem_t           sim_rx_sema;
+static pthread_mutex_t sim_tx_mutex = PTHREAD_MUTEX_INITIALIZER;
+static signing_key_t   sim_key;
+static sign_service_sign_t *sim_jobs[SIGN_SERVICE_RX_FRAMES];  /**< Worker queue */
+static uint32_t        sim_job_count;
+static bool            sim_hold;        /**< Workers wait while set */
+static pthread_mutex_t sim_job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  sim_job_cond = PTHREAD_COND_INITIALIZER;
+static uint8_t         sim_rx[SIM_FRAME_MAX];
+static size_t          sim_rx_len;
+static unsigned int    sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Stub signature: depends on every message byte and the length */
+static void sim_signature(const uint8_t *message, size_t message_len, uint8_t *signature)
+{
+    uint8_t acc = (uint8_t)message_len;
+
+    for (size_t i = 0; i < message_len; i++)
+    {
+        acc = (uint8_t)((acc * 31U) + message[i]);
+    }
+    for (size_t i = 0; i < SIM_SIGNATURE_LEN; i++)
+    {
+        signature[i] = (uint8_t)(acc + i);
+    }
+}
+
+psa_status_t signing_sign(signing_key_t *key, const uint8_t *message, size_t message_len,
+                          uint8_t *signature, size_t signature_size, size_t *signature_len)
+{
+    (void)key;
+    if (signature_size < SIM_SIGNATURE_LEN)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    sim_signature(message, message_len, signature);
+    *signature_len = SIM_SIGNATURE_LEN;
+    return PSA_SUCCESS;
+}
+
+psa_status_t signing_verify(signing_key_t *key, const uint8_t *message, size_t message_len,
+                            const uint8_t *signature, size_t signature_len)
+{
+    uint8_t expected[SIM_SIGNATURE_LEN];
+
+    (void)key;
+    sim_signature(message, message_len, expected);
+    return ((signature_len == SIM_SIGNATURE_LEN) &&
+            (memcmp(signature, expected, SIM_SIGNATURE_LEN) == 0)) ?
+           PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+}
+
+void signing_latency_summary(const signing_latency_t *latency, uint32_t *mean, uint32_t *stddev)
+{
+    (void)latency;
+    *mean = 0;
+    *stddev = 0;
+}
+
+psa_status_t psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                   size_t *data_length)
+{
+    (void)key;
+    if (data_size < SIM_PUBKEY_LEN)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    memset(data, 0x04, SIM_PUBKEY_LEN);
+    *data_length = SIM_PUBKEY_LEN;
+    return PSA_SUCCESS;
+}
+
+/** @brief CRC-16/CCITT-FALSE, as the gateway computes it */
+static uint16_t sim_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (uint32_t b = 0; b < 8U; b++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/** @brief sign_service transmit function: the UART TX line */
+static void sim_tx(const uint8_t *data, size_t len)
+{
+    (void)pthread_mutex_lock(&sim_tx_mutex);
+    while (len > 0U)
+    {
+        ssize_t n = write(sim_uart, data, len);
+
+        if (n <= 0)
+        {
+            break;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    (void)pthread_mutex_unlock(&sim_tx_mutex);
+}
+
+/** @brief The RX interrupt: drain the "FIFO" into the service */
+static void *sim_rx_thread(void *arg)
+{
+    uint8_t fifo[256];
+    ssize_t n;
+
+    while ((n = read(sim_uart, fifo, sizeof(fifo))) > 0)
+    {
+        bool complete = false;
+
+        for (ssize_t i = 0; i < n; i++)
+        {
+            complete |= sign_service_rx_byte(fifo[i]);
+        }
+        if (complete)
+        {
+            (void)sem_post(&sim_rx_sema);
+        }
+    }
+    return arg;
+}
+
+/** @brief The service thread of sign_service_uart.c */
+static void *sim_service_thread(void *arg)
+{
+    for (;;)
+    {
+        if (sem_wait(&sim_rx_sema) == 0)
+        {
+            (void)sign_service_process();
+        }
+    }
+    return arg;
+}
+
+/** @brief Offload function: queue the request for the workers */
+static bool sim_offload(sign_service_sign_t *req)
+{
+    bool taken = false;
+
+    (void)pthread_mutex_lock(&sim_job_mutex);
+    if (sim_job_count < SIGN_SERVICE_RX_FRAMES)
+    {
+        sim_jobs[sim_job_count++] = req;
+        (void)pthread_cond_broadcast(&sim_job_cond);
+        taken = true;
+    }
+    (void)pthread_mutex_unlock(&sim_job_mutex);
+    return taken;
+}
+
+/** @brief Signing worker: 0 to 3 time steps per request, chosen by the message */
+static void *sim_worker_thread(void *arg)
+{
+    sign_service_sign_t *req;
+    size_t signature_len = 0;
+    psa_status_t status;
+
+    for (;;)
+    {
+        (void)pthread_mutex_lock(&sim_job_mutex);
+        while ((sim_job_count == 0U) || sim_hold)
+        {
+            (void)pthread_cond_wait(&sim_job_cond, &sim_job_mutex);
+        }
+        req = sim_jobs[0];
+        sim_job_count--;
+        memmove(&sim_jobs[0], &sim_jobs[1], sim_job_count * sizeof(sim_jobs[0]));
+        (void)pthread_mutex_unlock(&sim_job_mutex);
+
+        (void)usleep((req->message[0] % 4U) * SIM_SIGN_US);
+        status = signing_sign(&sim_key, req->message, req->message_len,
+                              req->signature, SIGNING_SIGNATURE_MAX_SIZE, &signature_len);
+        sign_service_sign_done(req, status, signature_len);
+    }
+    return arg;
+}
+
+static void sim_set_hold(bool hold)
+{
+    (void)pthread_mutex_lock(&sim_job_mutex);
+    sim_hold = hold;
+    (void)pthread_cond_broadcast(&sim_job_cond);
+    (void)pthread_mutex_unlock(&sim_job_mutex);
+}
+
+/** @brief Write all of @p data to the gateway side, @p chunk bytes per write */
+static void sim_write(const uint8_t *data, size_t len, size_t chunk)
+{
+    while (len > 0U)
+    {
+        size_t part = (len < chunk) ? len : chunk;
+        ssize_t n = write(sim_gateway, data, part);
+
+        if (n <= 0)
+        {
+            break;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+}
+
+/** @brief Encode one request frame, delimiter included; flips a bit after the CRC if asked */
+static size_t sim_frame(uint8_t cmd, uint8_t seq, const uint8_t *payload, size_t len,
+                        bool corrupt, uint8_t *frame)
+{
+    static uint8_t raw[SIM_FRAME_MAX];
+    uint16_t crc;
+    size_t n;
+
+    raw[0] = cmd;
+    raw[1] = seq;
+    memcpy(&raw[2], payload, len);
+    crc = sim_crc16(raw, len + 2U);
+    raw[len + 2U] = (uint8_t)crc;
+    raw[len + 3U] = (uint8_t)(crc >> 8);
+    if (corrupt)
+    {
+        raw[1] ^= 0x01U;
+    }
+    n = cobs_encode(raw, len + 4U, frame, SIM_FRAME_MAX - 1U);
+    frame[n++] = 0;
+    return n;
+}
+
+static void sim_send(uint8_t cmd, uint8_t seq, const uint8_t *payload, size_t len)
+{
+    static uint8_t frame[SIM_FRAME_MAX];
+
+    sim_write(frame, sim_frame(cmd, seq, payload, len, false, frame), SIM_FRAME_MAX);
+}
+
+/**
+ * @brief Read the next response frame
+ *
+ * @return false on timeout, or if the frame does not decode or its CRC is wrong
+ */
+static bool sim_recv(sim_response_t *rsp, int timeout_ms)
+{
+    for (;;)
+    {
+        uint8_t *end = memchr(sim_rx, 0, sim_rx_len);
+        struct pollfd pfd = { sim_gateway, POLLIN, 0 };
+        ssize_t n;
+
+        if (end != NULL)
+        {
+            size_t frame_len = (size_t)(end - sim_rx);
+            size_t len = cobs_decode(sim_rx, frame_len);
+            bool ok = (len != SIZE_MAX) && (len >= 8U) &&
+                      (sim_crc16(sim_rx, len - 2U) ==
+                       ((uint16_t)sim_rx[len - 2U] | (uint16_t)((uint16_t)sim_rx[len - 1U] << 8)));
+
+            if (ok)
+            {
+                rsp->cmd = sim_rx[0];
+                rsp->seq = sim_rx[1];
+                rsp->status = (psa_status_t)((uint32_t)sim_rx[2] | ((uint32_t)sim_rx[3] << 8) |
+                                             ((uint32_t)sim_rx[4] << 16) | ((uint32_t)sim_rx[5] << 24));
+                rsp->len = len - 8U;
+                memcpy(rsp->payload, &sim_rx[6], rsp->len);
+            }
+            sim_rx_len -= frame_len + 1U;
+            memmove(sim_rx, end + 1, sim_rx_len);
+            return ok;
+        }
+        if ((sim_rx_len == sizeof(sim_rx)) || (poll(&pfd, 1, timeout_ms) <= 0))
+        {
+            return false;
+        }
+        n = read(sim_gateway, &sim_rx[sim_rx_len], sizeof(sim_rx) - sim_rx_len);
+        if (n <= 0)
+        {
+            return false;
+        }
+        sim_rx_len += (size_t)n;
+    }
+}
+
+/** @brief Send a request and read its response, which must carry the same seq */
+static bool sim_call(uint8_t cmd, uint8_t seq, const uint8_t *payload, size_t len,
+                     sim_response_t *rsp)
+{
+    sim_send(cmd, seq, payload, len);
+    return sim_recv(rsp, SIM_RESPONSE_MS) &&
+           (rsp->cmd == (cmd | SIGN_SERVICE_RESPONSE)) && (rsp->seq == seq);
+}
+
+static uint32_t sim_get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/** @brief STATS over the wire */
+static bool sim_stats(uint8_t seq, sign_service_stats_t *stats)
+{
+    sim_response_t rsp;
+
+    if (!sim_call(SIGN_SERVICE_CMD_STATS, seq, NULL, 0, &rsp) || (rsp.len != 32U))
+    {
+        return false;
+    }
+    stats->requests = sim_get_u32(&rsp.payload[0]);
+    stats->crc_errors = sim_get_u32(&rsp.payload[4]);
+    stats->overruns = sim_get_u32(&rsp.payload[8]);
+    stats->oversize = sim_get_u32(&rsp.payload[12]);
+    stats->failures = sim_get_u32(&rsp.payload[16]);
+    stats->sign_mean_cycles = sim_get_u32(&rsp.payload[20]);
+    stats->offloaded = sim_get_u32(&rsp.payload[24]);
+    stats->window = sim_get_u32(&rsp.payload[28]);
+    return true;
+}
+
+/** @brief Every command once, with messages full of COBS delimiters */
+static void sim_commands(void)
+{
+    static uint8_t message[SIGN_SERVICE_MESSAGE_MAX + 1U];
+    static uint8_t verify[1U + SIM_SIGNATURE_LEN + SIGN_SERVICE_MESSAGE_MAX];
+    static const size_t lengths[] = { 1U, 300U, SIGN_SERVICE_MESSAGE_MAX };
+    uint8_t signature[SIM_SIGNATURE_LEN];
+    sim_response_t rsp;
+
+    for (size_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = ((i % 3U) == 0U) ? 0U : (uint8_t)i;
+    }
+
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_PUBKEY, 1, NULL, 0, &rsp) &&
+              (rsp.status == PSA_SUCCESS) && (rsp.len == SIM_PUBKEY_LEN), "PUBKEY");
+
+    /* Short, longer than one COBS block, and the largest message */
+    for (uint32_t i = 0; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+    {
+        sim_signature(message, lengths[i], signature);
+        SIM_CHECK(sim_call(SIGN_SERVICE_CMD_SIGN, (uint8_t)(0x40U + i), message, lengths[i], &rsp) &&
+                  (rsp.status == PSA_SUCCESS) && (rsp.len == SIM_SIGNATURE_LEN) &&
+                  (memcmp(rsp.payload, signature, SIM_SIGNATURE_LEN) == 0), "SIGN");
+    }
+
+    verify[0] = SIM_SIGNATURE_LEN;
+    memcpy(&verify[1], signature, SIM_SIGNATURE_LEN);
+    memcpy(&verify[1U + SIM_SIGNATURE_LEN], message, SIGN_SERVICE_MESSAGE_MAX);
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_VERIFY, 2, verify, sizeof(verify), &rsp) &&
+              (rsp.status == PSA_SUCCESS) && (rsp.len == 0U), "VERIFY good signature");
+    verify[1] ^= 0x01U;
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_VERIFY, 3, verify, sizeof(verify), &rsp) &&
+              (rsp.status == PSA_ERROR_INVALID_SIGNATURE), "VERIFY bad signature");
+
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_SIGN, 4, message, SIGN_SERVICE_MESSAGE_MAX + 1U, &rsp) &&
+              (rsp.status == PSA_ERROR_INVALID_ARGUMENT), "SIGN message too long");
+    SIM_CHECK(sim_call(0x7FU, 5, NULL, 0, &rsp) &&
+              (rsp.status == PSA_ERROR_NOT_SUPPORTED), "unknown command");
+}
+
+/** @brief Frames split across writes, joined in one write, corrupted and oversized */
+static void sim_framing(void)
+{
+    static uint8_t frames[4U * SIM_FRAME_MAX];
+    static uint8_t noise[SIM_FRAME_MAX];
+    const uint8_t message[] = { 0x00, 0x11, 0x00, 0x00, 0x22 };
+    sim_response_t rsp;
+    size_t len;
+
+    /* One byte per write, as a slow link delivers it */
+    len = sim_frame(SIGN_SERVICE_CMD_SIGN, 10, message, sizeof(message), false, frames);
+    sim_write(frames, len, 1);
+    SIM_CHECK(sim_recv(&rsp, SIM_RESPONSE_MS) && (rsp.seq == 10U) && (rsp.status == PSA_SUCCESS),
+              "frame written a byte at a time");
+
+    /* Two frames in one write */
+    len = sim_frame(SIGN_SERVICE_CMD_PUBKEY, 11, NULL, 0, false, frames);
+    len += sim_frame(SIGN_SERVICE_CMD_PUBKEY, 12, NULL, 0, false, &frames[len]);
+    sim_write(frames, len, sizeof(frames));
+    SIM_CHECK(sim_recv(&rsp, SIM_RESPONSE_MS) && (rsp.seq == 11U), "first of two joined frames");
+    SIM_CHECK(sim_recv(&rsp, SIM_RESPONSE_MS) && (rsp.seq == 12U), "second of two joined frames");
+
+    /* Bad CRC, a lone delimiter and a truncated COBS frame: dropped silently */
+    len = sim_frame(SIGN_SERVICE_CMD_SIGN, 13, message, sizeof(message), true, frames);
+    frames[len++] = 0;
+    frames[len++] = 0x05;
+    frames[len++] = 0x01;
+    frames[len++] = 0;
+    sim_write(frames, len, sizeof(frames));
+    SIM_CHECK(!sim_recv(&rsp, SIM_SILENCE_MS), "no response to a corrupted frame");
+
+    /* A frame longer than a slot is dropped up to the next delimiter */
+    memset(noise, 0x5A, sizeof(noise) - 1U);
+    noise[sizeof(noise) - 1U] = 0;
+    sim_write(noise, sizeof(noise), sizeof(noise));
+    SIM_CHECK(!sim_recv(&rsp, SIM_SILENCE_MS), "no response to an oversized frame");
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_SIGN, 14, message, sizeof(message), &rsp) &&
+              (rsp.status == PSA_SUCCESS), "request after an oversized frame");
+}
+
+/** @brief Message of a window request; the first byte picks the signing time */
+static size_t sim_window_message(uint32_t n, uint8_t *message)
+{
+    size_t len = 16U + (n % 48U);
+
+    message[0] = (uint8_t)((n * 7U) % 13U);
+    for (size_t i = 1; i < len; i++)
+    {
+        message[i] = ((i % 5U) == 0U) ? 0U : (uint8_t)(n + i);
+    }
+    return len;
+}
+
+/**
+ * @brief Stream requests through the window, a new one per response
+ *
+ * Sequence numbers are request numbers, so each response can be matched
+ * to its message.
+ */
+static void sim_window(void)
+{
+    uint8_t message[64];
+    uint8_t signature[SIM_SIGNATURE_LEN];
+    bool outstanding[SIM_WINDOW_REQUESTS];
+    uint32_t sent = 0;
+    uint32_t done = 0;
+    uint32_t in_flight = 0;
+    uint32_t oldest = 0;
+    uint32_t out_of_order = 0;
+    uint32_t bad = 0;
+    sim_response_t rsp;
+    size_t len;
+
+    memset(outstanding, 0, sizeof(outstanding));
+    while (done < SIM_WINDOW_REQUESTS)
+    {
+        while ((sent < SIM_WINDOW_REQUESTS) && (in_flight < SIGN_SERVICE_RX_FRAMES))
+        {
+            len = sim_window_message(sent, message);
+            sim_send(SIGN_SERVICE_CMD_SIGN, (uint8_t)sent, message, len);
+            outstanding[sent++] = true;
+            in_flight++;
+        }
+        if (!sim_recv(&rsp, SIM_RESPONSE_MS))
+        {
+            break;
+        }
+        if ((rsp.seq >= sent) || !outstanding[rsp.seq])
+        {
+            bad++;
+            continue;
+        }
+        len = sim_window_message(rsp.seq, message);
+        sim_signature(message, len, signature);
+        if ((rsp.status != PSA_SUCCESS) || (rsp.len != SIM_SIGNATURE_LEN) ||
+            (memcmp(rsp.payload, signature, SIM_SIGNATURE_LEN) != 0))
+        {
+            bad++;
+        }
+        if (rsp.seq != oldest)
+        {
+            out_of_order++;
+        }
+        outstanding[rsp.seq] = false;
+        while ((oldest < sent) && !outstanding[oldest])
+        {
+            oldest++;
+        }
+        in_flight--;
+        done++;
+    }
+
+    printf("sign_service: %lu SIGN requests through a window of %lu, %lu answered out of order\n",
+           (unsigned long)done, (unsigned long)SIGN_SERVICE_RX_FRAMES, (unsigned long)out_of_order);
+    SIM_CHECK(done == SIM_WINDOW_REQUESTS, "every windowed request answered");
+    SIM_CHECK(bad == 0U, "windowed responses match their requests");
+    SIM_CHECK(out_of_order > 0U, "offloaded responses complete out of order");
+}
+
+/** @brief Wait until the service counter at @p offset reaches @p value */
+static bool sim_wait_counter(size_t offset, uint32_t value)
+{
+    sign_service_stats_t now;
+
+    for (uint32_t i = 0; i < (SIM_RESPONSE_MS * 10U); i++)
+    {
+        sign_service_get_stats(&now);
+        if (*(const uint32_t *)((const uint8_t *)&now + offset) >= value)
+        {
+            return true;
+        }
+        (void)usleep(100U);
+    }
+    return false;
+}
+
+/** @brief One frame more than the window while every slot is held */
+static void sim_overrun(void)
+{
+    const uint8_t message[] = { 0x01, 0x00, 0x02 };
+    sign_service_stats_t before;
+    uint32_t answered = 0;
+    uint32_t seen = 0;
+    sim_response_t rsp;
+
+    sign_service_get_stats(&before);
+    sim_set_hold(true);
+    for (uint32_t i = 0; i < SIGN_SERVICE_RX_FRAMES; i++)
+    {
+        sim_send(SIGN_SERVICE_CMD_SIGN, (uint8_t)(0xA0U + i), message, sizeof(message));
+    }
+    SIM_CHECK(sim_wait_counter(offsetof(sign_service_stats_t, offloaded), before.offloaded + SIGN_SERVICE_RX_FRAMES),
+              "window filled with held requests");
+    sim_send(SIGN_SERVICE_CMD_SIGN, 0xBFU, message, sizeof(message));
+    SIM_CHECK(sim_wait_counter(offsetof(sign_service_stats_t, overruns), before.overruns + 1U),
+              "frame beyond the window dropped");
+    sim_set_hold(false);
+
+    while (sim_recv(&rsp, SIM_SILENCE_MS * 5))
+    {
+        if ((rsp.seq >= 0xA0U) && (rsp.seq < (0xA0U + SIGN_SERVICE_RX_FRAMES)) &&
+            (rsp.status == PSA_SUCCESS))
+        {
+            seen |= (1UL << (rsp.seq - 0xA0U));
+        }
+        answered++;
+    }
+    SIM_CHECK((answered == SIGN_SERVICE_RX_FRAMES) &&
+              (seen == (uint32_t)((1ULL << SIGN_SERVICE_RX_FRAMES) - 1U)),
+              "the window is answered and the extra frame is not");
+    SIM_CHECK(sim_call(SIGN_SERVICE_CMD_SIGN, 0xC0U, message, sizeof(message), &rsp) &&
+              (rsp.status == PSA_SUCCESS), "credit returned after the overrun");
+}
+
+/** @brief Open the pty, start the service and its threads */
+static bool sim_start(void)
+{
+    struct termios tio;
+    pthread_t thread;
+
+    sim_uart = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((sim_uart < 0) || (grantpt(sim_uart) != 0) || (unlockpt(sim_uart) != 0))
+    {
+        perror("posix_openpt");
+        return false;
+    }
+    sim_gateway = open(ptsname(sim_uart), O_RDWR | O_NOCTTY);
+    if (sim_gateway < 0)
+    {
+        perror("pty slave");
+        return false;
+    }
+    /* Both ends raw: no echo, no line discipline between the two sides */
+    (void)tcgetattr(sim_gateway, &tio);
+    cfmakeraw(&tio);
+    (void)tcsetattr(sim_gateway, TCSANOW, &tio);
+    (void)tcgetattr(sim_uart, &tio);
+    cfmakeraw(&tio);
+    (void)tcsetattr(sim_uart, TCSANOW, &tio);
+
+    sign_service_init(&sim_key, sim_tx);
+    (void)sem_init(&sim_rx_sema, 0, 0);
+    for (uint32_t i = 0; i < SIM_WORKERS; i++)
+    {
+        if (pthread_create(&thread, NULL, sim_worker_thread, NULL) != 0)
+        {
+            return false;
+        }
+    }
+    return (pthread_create(&thread, NULL, sim_rx_thread, NULL) == 0) &&
+           (pthread_create(&thread, NULL, sim_service_thread, NULL) == 0);
+}
+
+int main(void)
+{
+    sign_service_stats_t stats;
+    sign_service_stats_t local;
+    bool ok;
+
+    if (!sim_start())
+    {
+        return 1;
+    }
+
+    sim_commands();
+    sim_framing();
+
+    SIM_CHECK(sim_stats(20, &stats), "STATS");
+    sign_service_get_stats(&local);
+    SIM_CHECK(stats.requests == 13U, "requests counted, STATS included");
+    SIM_CHECK(stats.crc_errors == 2U, "CRC and COBS errors counted");
+    SIM_CHECK(stats.oversize == 1U, "oversized frame counted");
+    SIM_CHECK(stats.failures == 3U, "error responses counted");
+    SIM_CHECK(stats.overruns == 0U, "no overruns");
+    SIM_CHECK(stats.window == SIGN_SERVICE_RX_FRAMES, "window reported");
+    SIM_CHECK(memcmp(&local, &stats, sizeof(stats)) == 0, "STATS matches sign_service_get_stats()");
+
+    printf("sign_service: %lu requests, %lu CRC/COBS errors, %lu oversize, %lu failures over a pty\n",
+           (unsigned long)local.requests, (unsigned long)local.crc_errors,
+           (unsigned long)local.oversize, (unsigned long)local.failures);
+
+    /* Offloaded signing: the credit window */
+    sign_service_set_offload(sim_offload);
+    sim_window();
+    SIM_CHECK(sim_stats(21, &stats), "STATS after the window");
+    SIM_CHECK(stats.overruns == 0U, "no overruns inside the window");
+    SIM_CHECK(stats.offloaded == SIM_WINDOW_REQUESTS, "every windowed SIGN offloaded");
+    sim_overrun();
+    SIM_CHECK(sim_stats(22, &stats), "STATS after the overrun");
+    SIM_CHECK(stats.overruns == 1U, "exactly one overrun");
+    SIM_CHECK(stats.offloaded == (SIM_WINDOW_REQUESTS + SIGN_SERVICE_RX_FRAMES + 1U),
+              "held requests offloaded");
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,243 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : Signing worker pool host benchmark
+ * Purpose : Run proj_cm33_ns/COMPONENT_RTOS_AWARE/sign_worker.c on Linux
+ *           through the host abstraction-rtos (host_rtos.c), check that
+ *           every job completes once, and report throughput, per-worker
+ *           counters and per-thread CPU share and free stack.
+ * Design  : psa_sign_message() is a model of a TF-M call: SIM_PREP_US of
+ *           non-secure work (spinning, so it is CPU time of the worker),
+ *           then SIM_SECURE_US waiting for the secure element, under one
+ *           lock as the NS interface serializes secure calls. A job for
+ *           PSA_KEY_ID_NULL fails. The "signature" is the key id and the
+ *           first message byte repeated, so results can be checked.
+ *
+ *           The Makefile builds it once per SIGN_WORKER_COUNT (1, 2, 4)
+ *           with SIGN_WORKER_STACK_SIZE set for glibc. One worker is bound
+ *           by prep + secure time per job; with more, the prep of one job
+ *           overlaps the secure wait of another and the secure time bounds
+ *           the rate, also on a single-core host.
+ ********************************************************************************
+ * @file    sign_worker_sim.c
+ * @brief   Host throughput and statistics run of the signing worker pool
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "sign_worker.h"
+#include "task_stats.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_JOBS                      (2000U)
+#define SIM_BATCH                     (16U)        /**< Jobs in flight, as WORKER_JOBS_PER_PERIOD */
+#define SIM_FAIL_EVERY                (50U)        /**< Every n-th job uses PSA_KEY_ID_NULL        */
+#define SIM_PREP_US                   (50U)
+#define SIM_SECURE_US                 (200U)
+#define SIM_SIGNATURE_SIZE            (64U)
+#define SIM_KEY                       ((psa_key_id_t)7)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static pthread_mutex_t sim_secure_lock = PTHREAD_MUTEX_INITIALIZER;
+static cy_semaphore_t  sim_done;
+static sign_job_t      sim_jobs[SIM_BATCH];
+static uint8_t         sim_messages[SIM_BATCH][16];
+static uint8_t         sim_signatures[SIM_BATCH][SIM_SIGNATURE_SIZE];
+static uint32_t        sim_completions[SIM_BATCH];
+static unsigned int    sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+static uint64_t sim_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Keep the CPU busy for @p us microseconds */
+static void sim_spin_us(uint32_t us)
+{
+    uint64_t end = sim_now_ns() + ((uint64_t)us * 1000U);
+
+    while (sim_now_ns() < end)
+    {
+    }
+}
+
+/** @brief Give the CPU away for @p us microseconds */
+static void sim_sleep_us(uint32_t us)
+{
+    struct timespec delay = { 0, (long)us * 1000L };
+
+    while (nanosleep(&delay, &delay) != 0)
+    {
+    }
+}
+
+/** @brief TF-M model: non-secure prep, then the serialized secure element round trip */
+psa_status_t psa_sign_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                              size_t input_length, uint8_t *signature, size_t signature_size,
+                              size_t *signature_length)
+{
+    (void)alg;
+    sim_spin_us(SIM_PREP_US);
+    if ((key == PSA_KEY_ID_NULL) || (input_length == 0U))
+    {
+        return PSA_ERROR_INVALID_HANDLE;
+    }
+    if (signature_size < SIM_SIGNATURE_SIZE)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    (void)pthread_mutex_lock(&sim_secure_lock);
+    sim_sleep_us(SIM_SECURE_US);
+    for (uint32_t i = 0; i < SIM_SIGNATURE_SIZE; i++)
+    {
+        signature[i] = (uint8_t)((i % 2U) ? input[0] : key);
+    }
+    *signature_length = SIM_SIGNATURE_SIZE;
+    (void)pthread_mutex_unlock(&sim_secure_lock);
+    return PSA_SUCCESS;
+}
+
+/** @brief Completion callback, on the worker thread */
+static void sim_job_done(sign_job_t *job)
+{
+    sim_completions[(uint32_t)(uintptr_t)job->user_arg]++;
+    (void)cy_rtos_semaphore_set(&sim_done);
+}
+
+/** @brief Check one completed job of number @p n */
+static void sim_job_check(uint32_t slot, uint32_t n)
+{
+    const sign_job_t *job = &sim_jobs[slot];
+    bool fails = ((n % SIM_FAIL_EVERY) == 0U);
+
+    SIM_CHECK(sim_completions[slot] == 1U, "job completed exactly once");
+    if (fails)
+    {
+        SIM_CHECK(job->status == PSA_ERROR_INVALID_HANDLE, "job without a key fails");
+        return;
+    }
+    SIM_CHECK(job->status == PSA_SUCCESS, "job signed");
+    SIM_CHECK(job->signature_len == SIM_SIGNATURE_SIZE, "signature length");
+    SIM_CHECK((job->signature[0] == (uint8_t)SIM_KEY) && (job->signature[1] == (uint8_t)n),
+              "signature belongs to this job");
+}
+
+int main(void)
+{
+    sign_worker_stats_t stats;
+    uint32_t jobs = 0;
+    uint32_t failed = 0;
+    uint32_t expected_failed = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    bool ok;
+
+    task_stats_timer_init();
+    SIM_CHECK(cy_rtos_semaphore_init(&sim_done, SIM_BATCH, 0U) == CY_RSLT_SUCCESS, "semaphore");
+    SIM_CHECK(sign_worker_init() == CY_RSLT_SUCCESS, "sign_worker_init");
+
+    start = sim_now_ns();
+    for (uint32_t n = 0; n < SIM_JOBS; n += SIM_BATCH)
+    {
+        for (uint32_t slot = 0; slot < SIM_BATCH; slot++)
+        {
+            uint32_t number = n + slot;
+
+            sim_messages[slot][0] = (uint8_t)number;
+            sim_completions[slot] = 0;
+            sim_jobs[slot] = (sign_job_t)
+            {
+                .key_id         = ((number % SIM_FAIL_EVERY) == 0U) ? PSA_KEY_ID_NULL : SIM_KEY,
+                .alg            = PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+                .input          = sim_messages[slot],
+                .input_len      = sizeof(sim_messages[slot]),
+                .signature      = sim_signatures[slot],
+                .signature_size = sizeof(sim_signatures[slot]),
+                .on_done        = sim_job_done,
+                .user_arg       = (void *)(uintptr_t)slot,
+            };
+            expected_failed += ((number % SIM_FAIL_EVERY) == 0U) ? 1U : 0U;
+            SIM_CHECK(sign_worker_submit(&sim_jobs[slot], CY_RTOS_NEVER_TIMEOUT) == CY_RSLT_SUCCESS,
+                      "sign_worker_submit");
+        }
+        for (uint32_t slot = 0; slot < SIM_BATCH; slot++)
+        {
+            SIM_CHECK(cy_rtos_semaphore_get(&sim_done, 5000U) == CY_RSLT_SUCCESS, "job completes");
+        }
+        for (uint32_t slot = 0; slot < SIM_BATCH; slot++)
+        {
+            sim_job_check(slot, n + slot);
+        }
+    }
+    elapsed = sim_now_ns() - start;
+
+    printf("Signing worker pool: %u workers, %u B stacks, %u jobs (%u us prep + %u us secure)\n",
+           (unsigned int)SIGN_WORKER_COUNT, (unsigned int)SIGN_WORKER_STACK_SIZE, SIM_JOBS,
+           SIM_PREP_US, SIM_SECURE_US);
+    for (uint32_t i = 0; i < SIGN_WORKER_COUNT; i++)
+    {
+        sign_worker_get_stats(i, &stats);
+        printf("Worker %lu: %lu jobs, %lu failed, %lu ns/job\n",
+               (unsigned long)i, (unsigned long)stats.jobs, (unsigned long)stats.failures,
+               (unsigned long)((stats.jobs > 0U) ? (stats.busy_cycles / stats.jobs) : 0U));
+        jobs += stats.jobs;
+        failed += stats.failures;
+    }
+    printf("Throughput: %lu jobs/s\n", (unsigned long)(((uint64_t)SIM_JOBS * 1000000000ULL) / elapsed));
+    task_stats_report();
+
+    SIM_CHECK(jobs == SIM_JOBS, "worker job counts add up");
+    SIM_CHECK(failed == expected_failed, "worker failure counts add up");
+    SIM_CHECK(host_rtos_min_stack_free() > 0U, "worker stacks did not overflow");
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,384 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : srf_async host simulation
+ * Purpose : Stress proj_cm55/srf_async.c and check that every request
+ *           completes exactly once, with its own result.
+ * Design  : Producer threads stand in for CM55 interrupt handlers. Half
+ *           of the requests use a callback, the other half are polled.
+ *           The main thread is the CM55 main loop. It drains the queue
+ *           and then "sleeps" the way proj_cm55/main.c does: it checks
+ *           the queue under the critical-section lock (interrupts
+ *           masked), then waits on a condition (WFI). A producer signals
+ *           that condition after each submit, like the interrupt that
+ *           wakes the core. The blocking mtb_srf_request_submit() runs
+ *           on the main thread with a random delay and fails for some
+ *           requests. The real shared_cache.c runs on top of recording SCB_*
+ *           stand-ins.
+ *
+ *           With --unmasked, the queue check is done outside the lock, as
+ *           the main loop did before. A request that arrives between the
+ *           check and the wait is then only run at the next wakeup, and
+ *           the run reports those missed wakeups.
+ *
+ *           Exit status 0 means no request was lost, duplicated or
+ *           mismatched, the counters agree, and (by default) no wakeup
+ *           was missed.
+ ********************************************************************************
+ * @file    srf_async_sim.c
+ * @brief   Lost/duplicate completion stress test for the CM55 SRF queue
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cy_syslib.h"
+#include "shared_cache.h"
+#include "srf_async.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_PRODUCERS                 (4U)
+#define SIM_REQUESTS                  (10000U)     /**< Per producer          */
+#define SIM_POLL_OUTSTANDING          (3U)         /**< Polled tickets held   */
+#define SIM_FAIL_EVERY                (17U)        /**< Request ids that fail */
+#define SIM_WAKE_TIMEOUT_MS           (20)         /**< A missed wakeup       */
+
+#define SIM_FAIL_RESULT \
+    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_APP_START, 0x99U)
+
+
+/* -------------------------------------------------------------------- */
+/* Types                                                                */
+/* -------------------------------------------------------------------- */
+
+/** @brief One request; its output is a whole cache line */
+typedef struct
+{
+    SHARED_CACHE_BUFFER(uint32_t, out, 1);
+    uint32_t           id;
+    srf_async_ticket_t ticket;
+} sim_request_t;
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static sim_request_t  *sim_requests;
+static atomic_uint    *sim_delivered;
+static atomic_uint     sim_mismatches;
+static atomic_uint     sim_retries;
+static atomic_uint     sim_producers_done;
+static atomic_ulong    sim_cache_lines;
+static pthread_cond_t  sim_wfi = PTHREAD_COND_INITIALIZER;
+static bool            sim_unmasked;
+static unsigned int    sim_missed_wakeups;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static uint32_t sim_expected(uint32_t id)
+{
+    return id * 2654435761U;
+}
+
+static void sim_cache_range(volatile void *addr, int32_t size)
+{
+    if ((((uintptr_t)addr | (uintptr_t)size) & (SHARED_CACHE_LINE_SIZE - 1U)) != 0U)
+    {
+        atomic_fetch_add(&sim_mismatches, 1U);
+    }
+    atomic_fetch_add(&sim_cache_lines, (unsigned long)size / SHARED_CACHE_LINE_SIZE);
+}
+
+void SCB_CleanDCache(void)
+{
+}
+
+void SCB_CleanInvalidateDCache(void)
+{
+}
+
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    sim_cache_range(addr, size);
+}
+
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    sim_cache_range(addr, size);
+}
+
+void SCB_CleanInvalidateDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    sim_cache_range(addr, size);
+}
+
+/** @brief The CM33/TF-M round-trip: blocks, answers from the input */
+cy_rslt_t mtb_srf_request_submit(mtb_srf_invec_ns_t *inVec_ns, uint8_t inVec_cnt_ns,
+                                 mtb_srf_outvec_ns_t *outVec_ns, uint8_t outVec_cnt_ns)
+{
+    uint32_t id;
+    struct timespec delay = { 0, (long)(rand() % 20) * 1000L };
+
+    if ((inVec_cnt_ns != 1U) || (outVec_cnt_ns != 1U) || (inVec_ns[0].len != sizeof(id)))
+    {
+        return SIM_FAIL_RESULT;
+    }
+    memcpy(&id, inVec_ns[0].base, sizeof(id));
+    (void)nanosleep(&delay, NULL);
+    if ((id % SIM_FAIL_EVERY) == 0U)
+    {
+        return SIM_FAIL_RESULT;
+    }
+    *(uint32_t *)outVec_ns[0].base = sim_expected(id);
+    return CY_RSLT_SUCCESS;
+}
+
+static void sim_check(const sim_request_t *req, cy_rslt_t result)
+{
+    bool fails = ((req->id % SIM_FAIL_EVERY) == 0U);
+
+    if ((fails && (result != SIM_FAIL_RESULT)) ||
+        (!fails && ((result != CY_RSLT_SUCCESS) || (req->out[0] != sim_expected(req->id)))))
+    {
+        atomic_fetch_add(&sim_mismatches, 1U);
+    }
+    atomic_fetch_add(&sim_delivered[req->id], 1U);
+}
+
+static void sim_callback(srf_async_ticket_t ticket, cy_rslt_t result, void *arg)
+{
+    const sim_request_t *req = (const sim_request_t *)arg;
+    cy_rslt_t again;
+
+    if ((ticket != req->ticket) || srf_async_poll(ticket, &again))
+    {
+        atomic_fetch_add(&sim_mismatches, 1U);
+    }
+    sim_check(req, result);
+}
+
+/** @brief Collect polled requests; returns how many are still outstanding */
+static uint32_t sim_poll(sim_request_t **held, uint32_t count)
+{
+    cy_rslt_t result;
+    uint32_t kept = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (srf_async_poll(held[i]->ticket, &result))
+        {
+            sim_check(held[i], result);
+            /* A collected ticket is stale from now on */
+            if (srf_async_poll(held[i]->ticket, &result))
+            {
+                atomic_fetch_add(&sim_mismatches, 1U);
+            }
+        }
+        else
+        {
+            held[kept++] = held[i];
+        }
+    }
+    return kept;
+}
+
+/**
+ * @brief Submit until accepted, then raise the "interrupt" that wakes the
+ *        main loop
+ *
+ * While the queue is full, keep collecting polled results: completed but
+ * uncollected requests hold their slots.
+ */
+static void sim_submit(sim_request_t *req, bool polled, sim_request_t **held, uint32_t *outstanding)
+{
+    mtb_srf_invec_ns_t in = { &req->id, sizeof(req->id) };
+    mtb_srf_outvec_ns_t out = { req->out, sizeof(req->out) };
+
+    while (srf_async_submit(&in, 1U, &out, 1U, polled ? NULL : sim_callback, req,
+                            &req->ticket) != CY_RSLT_SUCCESS)
+    {
+        atomic_fetch_add(&sim_retries, 1U);
+        *outstanding = sim_poll(held, *outstanding);
+        (void)sched_yield();
+    }
+    (void)pthread_mutex_lock(&host_critical);
+    (void)pthread_cond_signal(&sim_wfi);
+    (void)pthread_mutex_unlock(&host_critical);
+}
+
+static void *sim_producer(void *arg)
+{
+    uint32_t base = (uint32_t)(uintptr_t)arg * SIM_REQUESTS;
+    sim_request_t *held[SIM_POLL_OUTSTANDING];
+    uint32_t outstanding = 0;
+
+    for (uint32_t n = 0; n < SIM_REQUESTS; n++)
+    {
+        sim_request_t *req = &sim_requests[base + n];
+        bool polled = ((n & 1U) != 0U);
+
+        req->id = base + n;
+        if ((n % 4U) == 0U)
+        {
+            /* Let the queue run empty now and then, so the main loop sleeps */
+            struct timespec gap = { 0, (long)(rand() % 100) * 1000L };
+            (void)nanosleep(&gap, NULL);
+        }
+        while (polled && (outstanding == SIM_POLL_OUTSTANDING))
+        {
+            outstanding = sim_poll(held, outstanding);
+            (void)sched_yield();
+        }
+        sim_submit(req, polled, held, &outstanding);
+        if (polled)
+        {
+            held[outstanding++] = req;
+        }
+    }
+    while (outstanding != 0U)
+    {
+        outstanding = sim_poll(held, outstanding);
+        (void)sched_yield();
+    }
+
+    (void)pthread_mutex_lock(&host_critical);
+    atomic_fetch_add(&sim_producers_done, 1U);
+    (void)pthread_cond_signal(&sim_wfi);
+    (void)pthread_mutex_unlock(&host_critical);
+    return NULL;
+}
+
+/** @brief One main-loop sleep; true if a wakeup was missed */
+static bool sim_sleep(void)
+{
+    struct timespec until;
+    bool pending;
+    int rc = 0;
+
+    (void)clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_nsec += SIM_WAKE_TIMEOUT_MS * 1000000L;
+    if (until.tv_nsec >= 1000000000L)
+    {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+
+    if (sim_unmasked)
+    {
+        /* Checked with interrupts enabled: a submit can slip in here */
+        pending = (srf_async_pending() != 0U);
+        (void)sched_yield();
+        (void)pthread_mutex_lock(&host_critical);
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&host_critical);
+        pending = (srf_async_pending() != 0U);
+    }
+    if (!pending && (atomic_load(&sim_producers_done) < SIM_PRODUCERS))
+    {
+        rc = pthread_cond_timedwait(&sim_wfi, &host_critical, &until);
+    }
+    (void)pthread_mutex_unlock(&host_critical);
+
+    return (rc == ETIMEDOUT) && (srf_async_pending() != 0U);
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t producers[SIM_PRODUCERS];
+    srf_async_stats_t stats;
+    uint32_t total = SIM_PRODUCERS * SIM_REQUESTS;
+    uint32_t lost = 0;
+    uint32_t duplicated = 0;
+    bool ok;
+
+    sim_unmasked = ((argc > 1) && (strcmp(argv[1], "--unmasked") == 0));
+    sim_requests = aligned_alloc(SHARED_CACHE_LINE_SIZE, total * sizeof(*sim_requests));
+    sim_delivered = calloc(total, sizeof(*sim_delivered));
+    if ((sim_requests == NULL) || (sim_delivered == NULL))
+    {
+        return 2;
+    }
+    memset(sim_requests, 0, total * sizeof(*sim_requests));
+
+    srf_async_init();
+    for (uintptr_t p = 0; p < SIM_PRODUCERS; p++)
+    {
+        (void)pthread_create(&producers[p], NULL, sim_producer, (void *)p);
+    }
+
+    /* proj_cm55/main.c: drain, then sleep unless something was queued */
+    while ((atomic_load(&sim_producers_done) < SIM_PRODUCERS) || (srf_async_pending() != 0U))
+    {
+        while (srf_async_process())
+        {
+        }
+        if (sim_sleep())
+        {
+            sim_missed_wakeups++;
+        }
+    }
+    for (uint32_t p = 0; p < SIM_PRODUCERS; p++)
+    {
+        (void)pthread_join(producers[p], NULL);
+    }
+
+    for (uint32_t id = 0; id < total; id++)
+    {
+        unsigned int n = atomic_load(&sim_delivered[id]);
+
+        lost += (n == 0U) ? 1U : 0U;
+        duplicated += (n > 1U) ? 1U : 0U;
+    }
+    srf_async_get_stats(&stats);
+
+    printf("srf_async: %u requests from %u producers (%s check before sleep)\n",
+           (unsigned)total, (unsigned)SIM_PRODUCERS, sim_unmasked ? "unmasked" : "masked");
+    printf("  submitted %lu, rejected %lu, completed %lu, delivered %lu, max depth %lu/%u\n",
+           (unsigned long)stats.submitted, (unsigned long)stats.rejected,
+           (unsigned long)stats.completed, (unsigned long)stats.delivered,
+           (unsigned long)stats.max_depth, (unsigned)SRF_ASYNC_QUEUE_DEPTH);
+    printf("  lost %u, duplicated %u, mismatched %u, missed wakeups %u, cache lines %lu\n",
+           (unsigned)lost, (unsigned)duplicated, atomic_load(&sim_mismatches),
+           sim_missed_wakeups, atomic_load(&sim_cache_lines));
+
+    ok = (lost == 0U) && (duplicated == 0U) && (atomic_load(&sim_mismatches) == 0U) &&
+         (stats.submitted == total) && (stats.completed == total) && (stats.delivered == total) &&
+         (stats.rejected == atomic_load(&sim_retries)) && (sim_unmasked || (sim_missed_wakeups == 0U));
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    free(sim_delivered);
+    free(sim_requests);
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,179 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : stack_usage host check
+ * Purpose : Build common/stack_usage.c with STACK_USAGE_HOST and check the
+ *           high-water mark it reports for a painted stack.
+ * Design  : First on a simulated stack, an array that the program writes
+ *           down to known depths the way frames would: the reported peak
+ *           must be that depth exactly, also when only the deepest word
+ *           was written. Then on a real one: a thread runs on a painted
+ *           array of its own, calls down through frames with known
+ *           locals, and the reported peak must cover them, with no more
+ *           than SIM_OVERHEAD_BYTES on top for the glibc thread block.
+ ********************************************************************************
+ * @file    stack_usage_sim.c
+ * @brief   High-water mark check of the stack painting helpers
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "stack_usage.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_STACK_WORDS               (1024U)
+#define SIM_THREAD_STACK_BYTES        (256U * 1024U)
+#define SIM_FRAME_BYTES               (4096U)
+#define SIM_FRAME_DEPTH               (8U)
+#define SIM_OVERHEAD_BYTES            (16U * 1024U)  /**< glibc thread block at the top, frame headers */
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint32_t     sim_stack[SIM_STACK_WORDS];
+static uint64_t     sim_thread_stack[SIM_THREAD_STACK_BYTES / sizeof(uint64_t)];
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+/** @brief Peak of the simulated stack after writing every word down to @p words deep */
+static uint32_t sim_push(uint32_t words)
+{
+    uint32_t *top = &sim_stack[SIM_STACK_WORDS];
+
+    stack_usage_paint(sim_stack, top);
+    for (uint32_t i = 1; i <= words; i++)
+    {
+        top[-(int32_t)i] = i;
+    }
+    return stack_usage_measure(sim_stack, top);
+}
+
+/** @brief Peak after writing only the word @p words deep, as a frame that skips its locals */
+static uint32_t sim_touch(uint32_t words)
+{
+    uint32_t *top = &sim_stack[SIM_STACK_WORDS];
+
+    stack_usage_paint(sim_stack, top);
+    top[-(int32_t)words] = 0U;
+    return stack_usage_measure(sim_stack, top);
+}
+
+static void sim_simulated_stack(void)
+{
+    static const uint32_t depths[] = { 0U, 1U, 2U, 100U, SIM_STACK_WORDS - 1U, SIM_STACK_WORDS };
+
+    for (uint32_t i = 0; i < (sizeof(depths) / sizeof(depths[0])); i++)
+    {
+        SIM_CHECK(sim_push(depths[i]) == (depths[i] * 4U), "peak of a filled stack");
+    }
+    for (uint32_t i = 1; i < (sizeof(depths) / sizeof(depths[0])); i++)
+    {
+        SIM_CHECK(sim_touch(depths[i]) == (depths[i] * 4U), "peak set by the deepest word");
+    }
+
+    /* A written word that happens to equal the pattern is not seen */
+    stack_usage_paint(sim_stack, &sim_stack[SIM_STACK_WORDS]);
+    sim_stack[SIM_STACK_WORDS - 10U] = 0U;
+    sim_stack[SIM_STACK_WORDS - 20U] = CY_STACK_PAINT_PATTERN;
+    SIM_CHECK(stack_usage_measure(sim_stack, &sim_stack[SIM_STACK_WORDS]) == 40U,
+              "pattern-valued word is read as unused");
+
+    printf("Simulated stack: %u words, peaks exact at every depth\n", SIM_STACK_WORDS);
+}
+
+/** @brief Frames of SIM_FRAME_BYTES of written locals, @p depth deep */
+static uint32_t sim_frames(uint32_t depth)
+{
+    volatile uint8_t locals[SIM_FRAME_BYTES];
+    uint32_t sum;
+
+    memset((void *)locals, (int)depth, sizeof(locals));
+    sum = (depth > 1U) ? sim_frames(depth - 1U) : 0U;
+    return sum + locals[depth % SIM_FRAME_BYTES];
+}
+
+static void *sim_thread(void *arg)
+{
+    (void)arg;
+    return (void *)(uintptr_t)sim_frames(SIM_FRAME_DEPTH);
+}
+
+static void sim_thread_stack_check(void)
+{
+    uint32_t *limit = (uint32_t *)sim_thread_stack;
+    uint32_t *top = (uint32_t *)&sim_thread_stack[sizeof(sim_thread_stack) / sizeof(sim_thread_stack[0])];
+    uint32_t peak;
+    pthread_attr_t attr;
+    pthread_t thread;
+    void *result;
+
+    stack_usage_paint(limit, top);
+    SIM_CHECK(stack_usage_measure(limit, top) == 0U, "painted stack reads as unused");
+
+    SIM_CHECK(pthread_attr_init(&attr) == 0, "pthread_attr_init");
+    SIM_CHECK(pthread_attr_setstack(&attr, sim_thread_stack, sizeof(sim_thread_stack)) == 0,
+              "pthread_attr_setstack");
+    SIM_CHECK(pthread_create(&thread, &attr, sim_thread, NULL) == 0, "pthread_create");
+    SIM_CHECK(pthread_join(thread, &result) == 0, "pthread_join");
+    (void)pthread_attr_destroy(&attr);
+
+    peak = stack_usage_measure(limit, top);
+
+    printf("Thread stack: %u bytes, %u frames of %u bytes, peak %lu bytes\n",
+           SIM_THREAD_STACK_BYTES, SIM_FRAME_DEPTH, SIM_FRAME_BYTES, (unsigned long)peak);
+    SIM_CHECK(peak >= (SIM_FRAME_DEPTH * SIM_FRAME_BYTES), "peak covers the written frames");
+    SIM_CHECK(peak <= ((SIM_FRAME_DEPTH * SIM_FRAME_BYTES) + SIM_OVERHEAD_BYTES),
+              "peak is the frames plus the thread block and call overhead");
+}
+
+int main(void)
+{
+    bool ok;
+
+    sim_simulated_stack();
+    sim_thread_stack_check();
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,244 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : trust_index host check
+ * Purpose : Run the key-identifier index of proj_cm33_ns/trust_store.c with
+ *           up to 10000 keys, beyond the 2048 of the device benchmark, and
+ *           check that a lookup stays at one or two probes at every size,
+ *           and that a full table neither loops nor accepts a record.
+ * Design  : Identifiers are trust_store_key_id() of random uncompressed
+ *           points, as on the device. The slot count is the smallest power
+ *           of two of at least twice the keys, the rule of
+ *           TRUST_STORE_SLOTS. Probe counts are read off the slot array
+ *           that trust_index_insert() built: a hit costs its displacement
+ *           from the home slot plus one, a miss the run of occupied slots
+ *           from its home slot plus the empty one that ends it.
+ ********************************************************************************
+ * @file    trust_index_sim.c
+ * @brief   Probe counts and lookup time of the trust index up to 10000 keys
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "trust_store.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_KEYS_MAX                  (10000U)
+#define SIM_SLOTS_MAX                 (32768U)     /**< Power of two >= 2 * SIM_KEYS_MAX */
+#define SIM_LOOKUPS                   (1000000U)
+#define SIM_MISSES                    (100000U)
+
+/**
+ * @brief Limits on the probes per lookup. Linear probing at the highest
+ *        load of the index, 0.5, expects 1.5 per hit and 2.5 per miss; the
+ *        longest run grows with the log of the key count, and its limit
+ *        only catches identifiers that cluster.
+ */
+#define SIM_HIT_MEAN_MAX              (2.0)
+#define SIM_MISS_MEAN_MAX             (3.5)
+#define SIM_PROBES_MAX                (32U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint64_t     sim_kids[SIM_KEYS_MAX + 1U];
+static uint16_t     sim_slots[SIM_SLOTS_MAX];
+static uint32_t     sim_seed = 0x2545F491U;
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+static uint32_t sim_random(void)
+{
+    sim_seed ^= sim_seed << 13;
+    sim_seed ^= sim_seed >> 17;
+    sim_seed ^= sim_seed << 5;
+    return sim_seed;
+}
+
+static uint64_t sim_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Identifier of a random public key */
+static uint64_t sim_kid(void)
+{
+    uint8_t public_key[TRUST_STORE_PUBLIC_KEY_SIZE];
+
+    public_key[0] = 0x04U;
+    for (uint32_t i = 1; i < sizeof(public_key); i++)
+    {
+        public_key[i] = (uint8_t)sim_random();
+    }
+    return trust_store_key_id(public_key, sizeof(public_key));
+}
+
+/** @brief Slots a lookup of @p kid reads: up to and including its record or the first empty slot */
+static uint32_t sim_probes(const trust_index_t *index, uint64_t kid)
+{
+    uint32_t i = (uint32_t)kid & index->mask;
+    uint32_t probes = 1;
+
+    while ((index->slots[i] != 0U) && (index->kids[index->slots[i] - 1U] != kid) && (probes <= index->mask))
+    {
+        i = (i + 1U) & index->mask;
+        probes++;
+    }
+    return probes;
+}
+
+/** @brief Index @p n keys; check every lookup and its probe count, time the hits */
+static void sim_size(uint32_t n)
+{
+    trust_index_t index;
+    uint32_t slot_count = 1;
+    uint64_t hit_probes = 0;
+    uint64_t miss_probes = 0;
+    uint32_t max_probes = 0;
+    uint32_t inserted = 0;
+    uint32_t found = 0;
+    uint32_t missed = 0;
+    uint64_t start;
+    uint64_t ns;
+    double hit_mean;
+    double miss_mean;
+
+    while (slot_count < (2U * n))
+    {
+        slot_count <<= 1;
+    }
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sim_kids[i] = sim_kid();
+    }
+    trust_index_init(&index, sim_slots, slot_count, sim_kids);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        inserted += trust_index_insert(&index, (uint16_t)i) ? 1U : 0U;
+    }
+    SIM_CHECK(inserted == n, "every identifier indexed");
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint32_t probes = sim_probes(&index, sim_kids[i]);
+
+        found += (trust_index_find(&index, sim_kids[i]) == (int32_t)i) ? 1U : 0U;
+        hit_probes += probes;
+        max_probes = (probes > max_probes) ? probes : max_probes;
+    }
+    SIM_CHECK(found == n, "every identifier found at its record");
+
+    for (uint32_t m = 0; m < SIM_MISSES; m++)
+    {
+        uint64_t kid = ((uint64_t)sim_random() << 32) | sim_random();
+        uint32_t probes = sim_probes(&index, kid);
+
+        missed += (trust_index_find(&index, kid) < 0) ? 1U : 0U;
+        miss_probes += probes;
+        max_probes = (probes > max_probes) ? probes : max_probes;
+    }
+    SIM_CHECK(missed == SIM_MISSES, "unknown identifiers not found");
+
+    start = sim_now_ns();
+    found = 0;
+    for (uint32_t l = 0; l < SIM_LOOKUPS; l++)
+    {
+        found += (trust_index_find(&index, sim_kids[(l * 7919U) % n]) >= 0) ? 1U : 0U;
+    }
+    ns = sim_now_ns() - start;
+    SIM_CHECK(found == SIM_LOOKUPS, "timed lookups hit");
+
+    hit_mean = (double)hit_probes / n;
+    miss_mean = (double)miss_probes / SIM_MISSES;
+    printf("  %5lu keys %6lu slots  %5.2f  %5.2f  %3lu  %6.1f\n", (unsigned long)n, (unsigned long)slot_count,
+           hit_mean, miss_mean, (unsigned long)max_probes, (double)ns / SIM_LOOKUPS);
+    SIM_CHECK(hit_mean <= SIM_HIT_MEAN_MAX, "mean probes per hit");
+    SIM_CHECK(miss_mean <= SIM_MISS_MEAN_MAX, "mean probes per miss");
+    SIM_CHECK(max_probes <= SIM_PROBES_MAX, "longest probe run");
+}
+
+/** @brief A table with no empty slot: lookups end after slot_count probes, inserts fail */
+static void sim_full_table(void)
+{
+    trust_index_t index;
+    uint16_t slots[8];
+    int32_t absent;
+
+    for (uint32_t i = 0; i <= 8U; i++)
+    {
+        sim_kids[i] = sim_kid();
+    }
+    trust_index_init(&index, slots, 8U, sim_kids);
+    for (uint32_t i = 0; i < 8U; i++)
+    {
+        SIM_CHECK(trust_index_insert(&index, (uint16_t)i), "fills the table");
+    }
+    SIM_CHECK(!trust_index_insert(&index, 8U), "insert into a full table refused");
+    SIM_CHECK(!trust_index_insert(&index, 3U), "duplicate refused");
+
+    absent = trust_index_find(&index, sim_kids[8]);
+    SIM_CHECK(absent == -1, "lookup in a full table ends");
+    for (uint32_t i = 0; i < 8U; i++)
+    {
+        SIM_CHECK(trust_index_find(&index, sim_kids[i]) == (int32_t)i, "full table still finds its records");
+    }
+}
+
+int main(void)
+{
+    static const uint32_t sizes[] = { 16U, 256U, 2048U, SIM_KEYS_MAX };
+    bool ok;
+
+    printf("Trust index (mean probes per hit and miss, longest run, ns per hit):\n");
+    for (uint32_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        sim_size(sizes[s]);
+    }
+    sim_full_table();
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
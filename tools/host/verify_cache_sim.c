@@ -0,0 +1,190 @@
+/********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2024-2026 TESA
+ * All rights reserved.</center></h2>
+ *
+ * This source code and any compilation or derivative thereof is the
+ * proprietary information of TESA and is confidential in nature.
+ *
+ ********************************************************************************
+ * Project : OPTIGA Trust M Connectivity Tutorial Series
+ ********************************************************************************
+ * Module  : verify_cache host check
+ * Purpose : Run proj_cm33_ns/verify_cache.c on OpenSSL keys and check that
+ *           a repeat never calls into TF-M, that a tag is stored once, and
+ *           that a key id reused after verify_cache_forget_key() does not
+ *           inherit the entries of the destroyed key.
+ * Design  : host_psa.c stands in for TF-M. The Makefile links with
+ *           --wrap for psa_export_public_key() and psa_verify_hash(), so
+ *           the wrappers count every secure call. One wrapped verify runs
+ *           the same request again before it returns, as a second thread
+ *           would, to make the insert race deterministic.
+ ********************************************************************************
+ * @file    verify_cache_sim.c
+ * @brief   TF-M call count and dedupe check of the verification cache
+ * @author  TESA Workshop Team
+ * @date    October 19, 2026
+ * @version 1.0.0
+ *******************************************************************************/
+
+/* -------------------------------------------------------------------- */
+/* Includes                                                             */
+/* -------------------------------------------------------------------- */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "psa/crypto.h"
+#include "sha256_sw.h"
+#include "verify_cache.h"
+
+
+/* -------------------------------------------------------------------- */
+/* Macros                                                               */
+/* -------------------------------------------------------------------- */
+
+#define SIM_TTL                       (100U)
+#define SIM_REPEATS                   (1000U)
+#define SIM_COORD_SIZE                (32U)
+
+#define SIM_CHECK(cond, what) sim_check((cond), (what), __LINE__)
+
+
+/* -------------------------------------------------------------------- */
+/* Global Variables                                                     */
+/* -------------------------------------------------------------------- */
+static uint32_t     sim_exports;
+static uint32_t     sim_verifies;
+static bool         sim_race;           /**< Next verify repeats the request inside */
+static unsigned int sim_failures;
+
+
+/* -------------------------------------------------------------------- */
+/* Function Prototypes                                                  */
+/* -------------------------------------------------------------------- */
+psa_status_t __real_psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                          size_t *data_length);
+psa_status_t __real_psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                                    size_t hash_length, const uint8_t *signature,
+                                    size_t signature_length);
+
+
+/* -------------------------------------------------------------------- */
+/* Function Definitions                                                 */
+/* -------------------------------------------------------------------- */
+
+static void sim_check(bool cond, const char *what, int line)
+{
+    if (!cond)
+    {
+        printf("  FAIL line %d: %s\n", line, what);
+        sim_failures++;
+    }
+}
+
+psa_status_t __wrap_psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                          size_t *data_length)
+{
+    sim_exports++;
+    return __real_psa_export_public_key(key, data, data_size, data_length);
+}
+
+psa_status_t __wrap_psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                                    size_t hash_length, const uint8_t *signature,
+                                    size_t signature_length)
+{
+    sim_verifies++;
+    if (sim_race)
+    {
+        sim_race = false;
+        (void)verify_cache_verify_hash(key, alg, hash, hash_length, signature, signature_length, 0U);
+    }
+    return __real_psa_verify_hash(key, alg, hash, hash_length, signature, signature_length);
+}
+
+static psa_key_id_t sim_key(void)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_key_id_t key = PSA_KEY_ID_NULL;
+
+    psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+    psa_set_key_bits(&attributes, 256U);
+    psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH |
+                                         PSA_KEY_USAGE_EXPORT);
+    (void)psa_generate_key(&attributes, &key);
+    return key;
+}
+
+int main(void)
+{
+    const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+    static const uint8_t command[] = "set-config #0";
+    uint8_t hash[SHA256_SW_DIGEST_SIZE];
+    uint8_t signature[2U * SIM_COORD_SIZE];
+    uint8_t public_key[PSA_EXPORT_PUBLIC_KEY_MAX_SIZE];
+    size_t public_key_len = 0;
+    size_t signature_len = 0;
+    verify_cache_stats_t stats;
+    psa_key_id_t key;
+    psa_key_id_t reused;
+    bool served = true;
+    bool ok;
+
+    sha256_sw(command, sizeof(command), hash);
+    key = sim_key();
+    SIM_CHECK((key != PSA_KEY_ID_NULL) &&
+              (psa_sign_hash(key, alg, hash, sizeof(hash), signature, sizeof(signature), &signature_len) == PSA_SUCCESS),
+              "key and signature");
+
+    /* One export and one verify for the first arrival, none after */
+    verify_cache_init(SIM_TTL);
+    for (uint32_t i = 0; i < SIM_REPEATS; i++)
+    {
+        served = served && (verify_cache_verify_hash(key, alg, hash, sizeof(hash), signature, signature_len, 0U) == PSA_SUCCESS);
+    }
+    verify_cache_get_stats(&stats);
+    printf("Verify cache: %u repeats, %lu hits, %lu TF-M exports, %lu TF-M verifies\n",
+           SIM_REPEATS, (unsigned long)stats.hits, (unsigned long)sim_exports, (unsigned long)sim_verifies);
+    SIM_CHECK(served, "every repeat verifies");
+    SIM_CHECK((sim_exports == 1U) && (stats.key_exports == 1U), "public key exported once per key id");
+    SIM_CHECK(sim_verifies == 1U, "repeats answered without psa_verify_hash()");
+    SIM_CHECK(stats.hits == (SIM_REPEATS - 1U), "repeats are hits");
+
+    /* A corrupted signature is verified, rejected and never stored */
+    signature[5] ^= 0x01U;
+    SIM_CHECK(verify_cache_verify_hash(key, alg, hash, sizeof(hash), signature, signature_len, 1U) == PSA_ERROR_INVALID_SIGNATURE,
+              "corrupted signature rejected");
+    signature[5] ^= 0x01U;
+
+    /* Two callers missing on the same tag store it once */
+    verify_cache_clear();
+    sim_race = true;
+    SIM_CHECK(verify_cache_verify_hash(key, alg, hash, sizeof(hash), signature, signature_len, 0U) == PSA_SUCCESS,
+              "racing verify");
+    (void)psa_export_public_key(key, public_key, sizeof(public_key), &public_key_len);
+    SIM_CHECK(verify_cache_invalidate_key(public_key, public_key_len) == 1U, "tag stored once after a race");
+    verify_cache_get_stats(&stats);
+    SIM_CHECK(stats.inserts == 2U, "renewed tag not counted as an insert");
+
+    /* Invalidation dropped the registration: the next call exports again */
+    sim_exports = 0;
+    (void)verify_cache_verify_hash(key, alg, hash, sizeof(hash), signature, signature_len, 0U);
+    SIM_CHECK(sim_exports == 1U, "revoked key registered again");
+
+    /* A new key on the same id does not inherit the old key's entries */
+    verify_cache_forget_key(key);
+    (void)psa_destroy_key(key);
+    reused = sim_key();
+    SIM_CHECK(reused == key, "host PSA reuses the key id");
+    SIM_CHECK(verify_cache_verify_hash(reused, alg, hash, sizeof(hash), signature, signature_len, 0U) == PSA_ERROR_INVALID_SIGNATURE,
+              "old signature not accepted for the new key");
+    (void)psa_destroy_key(reused);
+
+    ok = (sim_failures == 0U);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
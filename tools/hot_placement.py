@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""Generate the hot-function placement fragment for the GCC_ARM linker scripts.
+
+Code runs XIP from external flash. .app_code_hot (CM33: SRAM, CM55: ITCM)
+is filled from proj_*/placement/app_code_hot.ld, which this script writes:
+
+  1. Read the GNU ld map of the current build (-Wl,-Map is on by default)
+     and collect every function section (.text.<name>, -ffunction-sections).
+  2. Attribute PC samples to those sections. A sample file has one sample
+     per line: "<hex pc>" or "<hex pc> <count>"; '#' starts a comment. Any
+     PC sampler works (debugger PC sampling, DWT/ITM trace dump, simulator).
+  3. Rank sections by samples per byte and take them greedily until the
+     byte budget is used up. Sections already in .app_code_ram or
+     .app_code_itcm are left where they are.
+
+Usage:
+    hot_placement.py --map proj_cm33_ns/build/APP_KIT_PSE84_EVAL_EPC2/Debug/proj_cm33_ns.map \\
+                     --profile pc_samples.txt --budget 8192 \\
+                     --out proj_cm33_ns/placement/app_code_hot.ld
+
+Rebuild after writing the fragment and take a new profile: addresses move,
+and the before/after figures come from the same sampler.
+"""
+
+import argparse
+import bisect
+import os
+import re
+import sys
+
+# Output sections that already execute from RAM
+RAM_SECTIONS = (".app_code_ram", ".app_code_itcm", ".app_code_hot")
+
+OUT_SECTION_RE = re.compile(r"^(\.\S+)\s")
+INPUT_RE = re.compile(r"^ (\.text\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$")
+CONT_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+
+
+class Section(object):
+    def __init__(self, name, addr, size, obj, out):
+        self.name = name
+        self.addr = addr
+        self.size = size
+        self.obj = obj
+        self.out = out
+        self.samples = 0
+
+    @property
+    def density(self):
+        return float(self.samples) / self.size if self.size else 0.0
+
+    def pattern(self):
+        """Linker script input section description for this section."""
+        obj = self.obj.strip()
+        match = re.match(r"^(.*)\((.*)\)$", obj)
+        if match:
+            # Archive member: libfoo.a(bar.o) -> *libfoo.a:bar.o
+            obj = "%s:%s" % (os.path.basename(match.group(1)), match.group(2))
+        else:
+            obj = os.path.basename(obj)
+        return "*%s(%s)" % (obj, self.name)
+
+
+def parse_map(path):
+    """Return the function sections of a GNU ld map, sorted by address."""
+    sections = []
+    out = None
+    in_layout = False
+    pending = None
+
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Linker script and memory map"):
+                in_layout = True
+                continue
+            if not in_layout:
+                continue
+
+            match = OUT_SECTION_RE.match(line)
+            if match:
+                out = match.group(1)
+                pending = None
+                continue
+
+            if pending is not None:
+                match = CONT_RE.match(line)
+                if match:
+                    sections.append(Section(pending, int(match.group(1), 16),
+                                            int(match.group(2), 16), match.group(3), out))
+                pending = None
+                continue
+
+            match = INPUT_RE.match(line)
+            if match:
+                if match.group(2) is None:
+                    pending = match.group(1)      # long name, values on next line
+                else:
+                    sections.append(Section(match.group(1), int(match.group(2), 16),
+                                            int(match.group(3), 16), match.group(4), out))
+
+    sections = [s for s in sections if s.size > 0 and s.addr != 0]
+    sections.sort(key=lambda s: s.addr)
+    return sections
+
+
+def load_profile(path, sections):
+    """Attribute samples to sections; return (total, attributed)."""
+    starts = [s.addr for s in sections]
+    total = attributed = 0
+
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if not line:
+                continue
+            pc = int(line[0], 16) & ~1        # drop the Thumb bit
+            count = int(line[1]) if len(line) > 1 else 1
+            total += count
+            i = bisect.bisect_right(starts, pc) - 1
+            if i >= 0 and pc < sections[i].addr + sections[i].size:
+                sections[i].samples += count
+                attributed += count
+    return total, attributed
+
+
+def select(sections, budget, min_samples):
+    """Greedy selection by samples per byte within the byte budget."""
+    candidates = [s for s in sections
+                  if s.out not in RAM_SECTIONS[:2] and s.samples >= min_samples]
+    candidates.sort(key=lambda s: s.density, reverse=True)
+
+    chosen = []
+    used = 0
+    for s in candidates:
+        size = (s.size + 3) & ~3
+        if used + size <= budget:
+            chosen.append(s)
+            used += size
+    return chosen, used
+
+
+def write_fragment(path, chosen, used, budget, total, argv):
+    lines = [
+        "/* Input sections placed in .app_code_hot (fast RAM). Generated by",
+        " * tools/hot_placement.py, do not edit. */",
+        "/* %s */" % " ".join(argv),
+        "/* %d sections, %d of %d bytes, %.1f%% of %d samples */" % (
+            len(chosen), used, budget,
+            100.0 * sum(s.samples for s in chosen) / total if total else 0.0, total),
+    ]
+    for s in chosen:
+        lines.append("%-60s /* %6d samples %5d bytes */" % (s.pattern(), s.samples, s.size))
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--map", required=True, help="GNU ld map file of the profiled build")
+    parser.add_argument("--profile", required=True, help="PC sample file")
+    parser.add_argument("--budget", required=True, type=lambda v: int(v, 0),
+                        help="bytes of RAM/ITCM available for hot code")
+    parser.add_argument("--min-samples", type=int, default=2,
+                        help="ignore sections with fewer samples (default 2)")
+    parser.add_argument("--out", help="fragment to write (default: print the ranking only)")
+    parser.add_argument("--top", type=int, default=20, help="ranking lines to print")
+    opts = parser.parse_args()
+
+    sections = parse_map(opts.map)
+    if not sections:
+        sys.exit("%s: no .text.* input sections found (build with -ffunction-sections)" % opts.map)
+
+    total, attributed = load_profile(opts.profile, sections)
+    if total == 0:
+        sys.exit("%s: no samples" % opts.profile)
+
+    chosen, used = select(sections, opts.budget, opts.min_samples)
+
+    in_ram = sum(s.samples for s in sections if s.out in RAM_SECTIONS)
+    gained = sum(s.samples for s in chosen)
+    print("%d samples, %d in function sections, %.1f%% already in RAM" % (
+        total, attributed, 100.0 * in_ram / total))
+    print("selected %d sections, %d/%d bytes, %.1f%% of samples move to RAM" % (
+        len(chosen), used, opts.budget, 100.0 * gained / total))
+    print("\n%8s %8s %6s  %s" % ("samples", "per byte", "bytes", "section"))
+    ranked = sorted(sections, key=lambda s: s.density, reverse=True)
+    for s in ranked[:opts.top]:
+        if s.samples == 0:
+            break
+        mark = "*" if s in chosen else ("=" if s.out in RAM_SECTIONS else " ")
+        print("%8d %8.3f %6d %s %s (%s)" % (s.samples, s.density, s.size, mark, s.name, s.out))
+    print("\n* selected, = already in RAM")
+
+    if opts.out:
+        write_fragment(opts.out, chosen, used, opts.budget, total, sys.argv[1:])
+        print("wrote %s" % opts.out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""Decode tokenized LOG_PRINT() output from proj_cm33_ns.
+
+The CM33 NS image built with DEFINES+=LOG_TOKENIZED=1 sends binary frames
+instead of formatted text (see proj_cm33_ns/log_token.h):
+
+    | 0xA5 | len | token (4, LE) | arg types (1) | args ... |
+
+The format strings live in the non-loaded .log_tokens section of the ELF.
+This script reads that section, checks it for token collisions and turns a
+captured UART stream back into text. Bytes outside frames (TF-M output) are
+passed through unchanged.
+
+Usage:
+    log_detokenize.py build/.../proj_cm33_ns.elf capture.bin
+    log_detokenize.py proj_cm33_ns.elf capture.bin --stats
+    log_detokenize.py proj_cm33_ns.elf --list
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FRAME_MARKER = 0xA5
+ENTRY_MAGIC = 0xBAA98DEE
+HASH_LEN = 80
+HASH_MULT = 65599
+
+# printf conversion: flags, width, precision, length modifier, specifier
+CONV_RE = re.compile(r"%([-+ #0]*)(\d*|\*)(?:\.(\d*|\*))?(hh|h|ll|l|z|j|t|L)?([diouxXcsp%])")
+
+
+def token_hash(text):
+    """Same hash as LOG_TOKEN_HASH() in log_token.h."""
+    data = text.encode("latin-1")
+    h = len(data)
+    coef = 1
+    for ch in data[:HASH_LEN]:
+        coef = (coef * HASH_MULT) & 0xFFFFFFFF
+        h = (h + coef * ch) & 0xFFFFFFFF
+    return h
+
+
+def read_log_tokens(elf_path):
+    """Return {token: format} from the .log_tokens section of an ELF file."""
+    with open(elf_path, "rb") as f:
+        elf = f.read()
+
+    if elf[:4] != b"\x7fELF" or elf[4] not in (1, 2) or elf[5] != 1:
+        sys.exit("%s: not a little-endian ELF file" % elf_path)
+
+    # ELF64 is accepted as well so the encoder can be exercised on a host
+    if elf[4] == 1:
+        shoff, = struct.unpack_from("<I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x2E)
+        shdr = "<IIIIIIIIII"
+    else:
+        shoff, = struct.unpack_from("<Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x3A)
+        shdr = "<IIQQQQIIQQ"
+
+    def section(index):
+        return struct.unpack_from(shdr, elf, shoff + index * shentsize)
+
+    strtab = section(shstrndx)
+    names = elf[strtab[4]:strtab[4] + strtab[5]]
+
+    data = None
+    for i in range(shnum):
+        sh = section(i)
+        name = names[sh[0]:names.index(b"\0", sh[0])].decode()
+        if name == ".log_tokens":
+            data = elf[sh[4]:sh[4] + sh[5]]
+            break
+    if data is None:
+        sys.exit("%s: no .log_tokens section (built without LOG_TOKENIZED=1?)" % elf_path)
+
+    tokens = {}
+    pos = 0
+    while pos + 12 <= len(data):
+        magic, token, length = struct.unpack_from("<III", data, pos)
+        if magic != ENTRY_MAGIC:
+            pos += 4          # alignment padding between entries
+            continue
+        text = data[pos + 12:pos + 12 + length].decode("latin-1")
+        if token_hash(text) != token:
+            print("warning: token %08x does not match its string %r" % (token, text),
+                  file=sys.stderr)
+        if token in tokens and tokens[token] != text:
+            print("warning: token collision %08x: %r / %r" % (token, tokens[token], text),
+                  file=sys.stderr)
+        tokens[token] = text
+        pos = (pos + 12 + length + 1 + 3) & ~3
+    return tokens
+
+
+def get_varint(buf, pos, end):
+    value = 0
+    shift = 0
+    while pos < end:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return value, pos
+        shift += 7
+    raise ValueError("truncated varint")
+
+
+def format_message(fmt, args):
+    """Apply printf-style formatting with 32-bit integer semantics."""
+    values = iter(args)
+
+    def conv(m):
+        flags, width, prec, _, spec = m.groups()
+        if spec == "%":
+            return "%"
+        value = next(values, None)
+        if value is None:
+            return m.group(0)
+        if spec in "di" and isinstance(value, int) and value & 0x80000000:
+            value -= 1 << 32
+        if spec == "p":
+            spec, flags = "x", flags + "#"
+        if spec == "s" and not isinstance(value, str):
+            value = str(value)
+        py = "%" + flags + width + (("." + prec) if prec is not None else "") + spec
+        return py % value
+
+    return CONV_RE.sub(conv, fmt)
+
+
+def decode(stream, tokens, out):
+    """Decode a capture; return (frames, frame_bytes, text_bytes)."""
+    frames = frame_bytes = text_bytes = 0
+    pos = 0
+    size = len(stream)
+    while pos < size:
+        if stream[pos] != FRAME_MARKER or pos + 7 > size:
+            out.write(chr(stream[pos]))
+            pos += 1
+            continue
+        length = stream[pos + 1]
+        end = pos + 2 + length
+        if length < 5 or end > size:
+            out.write(chr(stream[pos]))
+            pos += 1
+            continue
+        token, types = struct.unpack_from("<IB", stream, pos + 2)
+        p = pos + 7
+        args = []
+        try:
+            i = 0
+            while p < end:
+                n, p = get_varint(stream, p, end)
+                if types & (1 << i):
+                    args.append(stream[p:p + n].decode("latin-1"))
+                    p += n
+                else:
+                    args.append(n)
+                i += 1
+        except ValueError:
+            out.write("<corrupt frame %08x>\n" % token)
+            pos = end
+            continue
+
+        fmt = tokens.get(token)
+        if fmt is None:
+            text = "<unknown token %08x %r>\n" % (token, args)
+        else:
+            text = format_message(fmt, args)
+        out.write(text)
+        frames += 1
+        frame_bytes += end - pos
+        text_bytes += len(text.encode("latin-1", "replace"))
+        pos = end
+    return frames, frame_bytes, text_bytes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="proj_cm33_ns ELF built with LOG_TOKENIZED=1")
+    parser.add_argument("capture", nargs="?", help="raw UART capture ('-' for stdin)")
+    parser.add_argument("--list", action="store_true", help="list the token table")
+    parser.add_argument("--stats", action="store_true",
+                        help="report bytes on the wire against the equivalent text")
+    opts = parser.parse_args()
+
+    tokens = read_log_tokens(opts.elf)
+    if opts.list:
+        for token, text in sorted(tokens.items()):
+            print("%08x  %r" % (token, text))
+        return
+    if opts.capture is None:
+        parser.error("capture file required")
+
+    if opts.capture == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(opts.capture, "rb") as f:
+            stream = f.read()
+
+    frames, frame_bytes, text_bytes = decode(stream, tokens, sys.stdout)
+    if opts.stats and frames:
+        print("\n%d frames: %d bytes on the wire, %d bytes as text (%.1f%%)"
+              % (frames, frame_bytes, text_bytes, 100.0 * frame_bytes / text_bytes),
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Talk to the proj_cm33_ns UART signing service.
+
+The CM33 NS image built with RTOS_BUILD=1 and SIGN_SERVICE_UART_HW set
+serves requests on that UART (see proj_cm33_ns/sign_service.h). Frames are
+COBS encoded and end with 0x00; decoded they are
+
+    request:  cmd | seq | payload | crc16 (LE)
+    response: cmd | 0x80 | seq | status (4, LE) | payload | crc16 (LE)
+
+with CRC-16/CCITT-FALSE over everything before it.
+
+Usage:
+    sign_client.py /dev/ttyUSB1 pubkey
+    sign_client.py /dev/ttyUSB1 sign "firmware-1.2.3"
+    sign_client.py /dev/ttyUSB1 verify "firmware-1.2.3" <signature hex>
+    sign_client.py /dev/ttyUSB1 stats
+    sign_client.py /dev/ttyUSB1 bench --count 200 --size 64 --window 1,2,4
+
+bench signs --count messages with up to --window requests outstanding and
+reports requests per second and the round-trip distribution, once per
+window size. The window is capped at the device's receive slots (from
+STATS): each response returns one credit, so the device never has to drop
+a frame. Responses are matched by sequence number and may arrive out of
+order. Only the standard library is used; the port is opened raw with
+termios.
+"""
+
+import argparse
+import os
+import select
+import struct
+import sys
+import termios
+import time
+
+CMD_SIGN = 0x01
+CMD_VERIFY = 0x02
+CMD_PUBKEY = 0x03
+CMD_STATS = 0x04
+RESPONSE = 0x80
+
+STATS_FIELDS = ("requests", "crc_errors", "overruns", "oversize", "failures",
+                "sign_mean_cycles", "offloaded", "window")
+
+BAUD = {
+    115200: termios.B115200,
+    230400: getattr(termios, "B230400", None),
+    460800: getattr(termios, "B460800", None),
+    921600: getattr(termios, "B921600", None),
+}
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as sign_service_crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray()
+    block = bytearray()
+    for byte in data:
+        if byte == 0:
+            out.append(len(block) + 1)
+            out += block
+            block = bytearray()
+        else:
+            block.append(byte)
+            if len(block) == 254:
+                out.append(255)
+                out += block
+                block = bytearray()
+    out.append(len(block) + 1)
+    out += block
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        code = data[pos]
+        if code == 0 or pos + code > len(data):
+            raise ValueError("malformed COBS frame")
+        out += data[pos + 1:pos + code]
+        pos += code
+        if code != 255 and pos < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+class SignService(object):
+    def __init__(self, path, baud, timeout):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        self.timeout = timeout
+        self.seq = 0
+        self.rx = bytearray()
+        attrs = termios.tcgetattr(self.fd)
+        attrs[0] = 0                                    # iflag
+        attrs[1] = 0                                    # oflag
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                    # lflag
+        if BAUD.get(baud) is None:
+            raise ValueError("unsupported baud rate %d" % baud)
+        attrs[4] = attrs[5] = BAUD[baud]
+        attrs[6][termios.VMIN] = 0
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+
+    def close(self):
+        os.close(self.fd)
+
+    def _read_frame(self, deadline):
+        while True:
+            end = self.rx.find(b"\x00")
+            if end >= 0:
+                frame = bytes(self.rx[:end])
+                del self.rx[:end + 1]
+                if frame:
+                    return frame
+                continue
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            ready, _, _ = select.select([self.fd], [], [], left)
+            if ready:
+                self.rx += os.read(self.fd, 4096)
+
+    def send(self, cmd, payload=b""):
+        """Send one request without waiting; return its sequence number."""
+        self.seq = (self.seq + 1) & 0xFF
+        raw = bytes([cmd, self.seq]) + payload
+        raw += struct.pack("<H", crc16(raw))
+        os.write(self.fd, cobs_encode(raw) + b"\x00")
+        return self.seq
+
+    def receive(self, deadline):
+        """Next valid response as (cmd, seq, status, payload), or None on timeout."""
+        while True:
+            frame = self._read_frame(deadline)
+            if frame is None:
+                return None
+            try:
+                rsp = cobs_decode(frame)
+            except ValueError:
+                continue
+            if len(rsp) < 8 or struct.unpack("<H", rsp[-2:])[0] != crc16(rsp[:-2]):
+                continue
+            return (rsp[0] & ~RESPONSE, rsp[1], struct.unpack("<i", rsp[2:6])[0], rsp[6:-2])
+
+    def request(self, cmd, payload=b""):
+        """Send one request; return (status, payload) of the matching response."""
+        seq = self.send(cmd, payload)
+        deadline = time.monotonic() + self.timeout
+        while True:
+            rsp = self.receive(deadline)
+            if rsp is None:
+                raise TimeoutError("no response to command 0x%02x seq %d" % (cmd, seq))
+            # Stale responses from an earlier timeout carry another sequence number
+            if rsp[0] == cmd and rsp[1] == seq:
+                return rsp[2], rsp[3]
+
+    def stats(self):
+        status, data = self.request(CMD_STATS)
+        check(status, "stats")
+        return dict(zip(STATS_FIELDS, struct.unpack("<%dI" % (len(data) // 4), data)))
+
+
+def check(status, what):
+    if status != 0:
+        sys.exit("%s failed: PSA status %d" % (what, status))
+
+
+def bench(svc, count, size, window):
+    """Sign count messages with up to window requests outstanding."""
+    message = bytes((i * 7) & 0xFF for i in range(size))
+    pending = {}
+    times = []
+    sent = 0
+    start = time.monotonic()
+    while len(times) < count:
+        while sent < count and len(pending) < window:
+            pending[svc.send(CMD_SIGN, message)] = time.monotonic()
+            sent += 1
+        rsp = svc.receive(time.monotonic() + svc.timeout)
+        if rsp is None:
+            sys.exit("window %d: no response, %d requests outstanding" % (window, len(pending)))
+        cmd, seq, status, _ = rsp
+        if cmd != CMD_SIGN or seq not in pending:
+            continue
+        times.append(time.monotonic() - pending.pop(seq))
+        check(status, "sign")
+    elapsed = time.monotonic() - start
+
+    times.sort()
+    print("window %d: %d signatures of %d-byte messages in %.2f s: %.1f requests/s"
+          % (window, count, size, elapsed, count / elapsed))
+    print("  round trip ms: min %.2f  median %.2f  p95 %.2f  max %.2f"
+          % (times[0] * 1e3, times[len(times) // 2] * 1e3,
+             times[min(len(times) - 1, int(len(times) * 0.95))] * 1e3, times[-1] * 1e3))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="serial device of the service UART")
+    parser.add_argument("command", choices=("sign", "verify", "pubkey", "stats", "bench"))
+    parser.add_argument("message", nargs="?", default="", help="message for sign/verify")
+    parser.add_argument("signature", nargs="?", help="signature hex for verify")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=2.0, help="seconds per request")
+    parser.add_argument("--count", type=int, default=100, help="bench requests")
+    parser.add_argument("--size", type=int, default=32, help="bench message size")
+    parser.add_argument("--window", default="1",
+                        help="bench requests outstanding, or a comma-separated list to compare")
+    opts = parser.parse_args()
+
+    svc = SignService(opts.port, opts.baud, opts.timeout)
+    try:
+        message = opts.message.encode("utf-8")
+        if opts.command == "sign":
+            status, sig = svc.request(CMD_SIGN, message)
+            check(status, "sign")
+            print(sig.hex())
+        elif opts.command == "verify":
+            if opts.signature is None:
+                parser.error("verify needs a message and a signature")
+            sig = bytes.fromhex(opts.signature)
+            status, _ = svc.request(CMD_VERIFY, bytes([len(sig)]) + sig + message)
+            print("valid" if status == 0 else "invalid (PSA status %d)" % status)
+            sys.exit(0 if status == 0 else 1)
+        elif opts.command == "pubkey":
+            status, key = svc.request(CMD_PUBKEY)
+            check(status, "pubkey")
+            print(key.hex())
+        elif opts.command == "stats":
+            for name, value in svc.stats().items():
+                print("%-17s %d" % (name, value))
+        else:
+            slots = svc.stats().get("window", 1)
+            for window in (int(w) for w in opts.window.split(",")):
+                if window > slots:
+                    print("window %d capped at the device's %d receive slots" % (window, slots))
+                    window = slots
+                before = svc.stats()
+                bench(svc, opts.count, opts.size, window)
+                after = svc.stats()
+                dropped = sum(after[k] - before[k] for k in ("crc_errors", "overruns", "oversize"))
+                if dropped:
+                    print("  %d frames dropped by the device" % dropped)
+    finally:
+        svc.close()
+
+
+if __name__ == "__main__":
+    main()